@@ -0,0 +1,470 @@
+/*
+ * Carving functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_carve.h"
+#include "libscca_definitions.h"
+#include "libscca_file.h"
+#include "libscca_io_handle.h"
+#include "libscca_libbfio.h"
+#include "libscca_libcerror.h"
+
+#include "scca_file_header.h"
+
+/* Checks if the data contains a file signature
+ * The data must contain at least LIBSCCA_CARVE_CANDIDATE_SIZE bytes
+ * Returns 1 if the data contains a file signature or 0 if not
+ */
+int libscca_carve_check_candidate(
+     const uint8_t *data,
+     int *file_type )
+{
+	uint32_t value_32bit = 0;
+
+	if( memory_compare(
+	     &( data[ 4 ] ),
+	     scca_file_signature,
+	     4 ) == 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 data,
+		 value_32bit );
+
+		if( ( value_32bit == 17 )
+		 || ( value_32bit == 23 )
+		 || ( value_32bit == 26 )
+		 || ( value_32bit == 30 )
+		 || ( value_32bit == 31 ) )
+		{
+			*file_type = LIBSCCA_FILE_TYPE_UNCOMPRESSED;
+
+			return( 1 );
+		}
+	}
+	if( memory_compare(
+	     data,
+	     scca_mam_file_signature_win10,
+	     4 ) == 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 4 ] ),
+		 value_32bit );
+
+		if( ( value_32bit >= (uint32_t) sizeof( scca_file_header_t ) )
+		 && ( value_32bit <= (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			*file_type = LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Finds the next file signature in the data
+ * Both the "SCCA" signature at offset 4 and the "MAM\x04" signature at offset 0 of a file are searched for
+ *
+ * The search starts at the data offset. 8 candidate offsets are tested at a time by
+ * comparing all bytes of a 64-bit block at once and only the offsets that contain
+ * the first byte of a signature are checked further.
+ *
+ * If a signature is found the data offset is set to the start of the file, the search
+ * can be continued from the next offset. If no signature is found the data offset is
+ * set to the offset from which the search should be continued once more data is available.
+ *
+ * Returns 1 if a signature was found, 0 if not or -1 on error
+ */
+int libscca_carve_find_signature(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     int *file_type,
+     libcerror_error_t **error )
+{
+	static char *function   = "libscca_carve_find_signature";
+	size_t safe_data_offset = 0;
+	uint64_t mam_block      = 0;
+	uint64_t match_mask     = 0;
+	uint64_t scca_block     = 0;
+	uint8_t candidate_index = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_offset > data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	/* The last candidate in a block needs LIBSCCA_CARVE_CANDIDATE_SIZE bytes
+	 */
+	while( ( data_size - safe_data_offset ) >= ( 8 + LIBSCCA_CARVE_CANDIDATE_SIZE ) )
+	{
+		/* Byte N of the first block is the first byte of the candidate at offset + N,
+		 * which is 'M' for "MAM\x04", and byte N of the second block the fifth byte
+		 * of the candidate, which is 'S' for "SCCA"
+		 */
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ safe_data_offset ] ),
+		 mam_block );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ safe_data_offset + 4 ] ),
+		 scca_block );
+
+		mam_block  ^= 0x4d4d4d4d4d4d4d4dULL;
+		scca_block ^= 0x5353535353535353ULL;
+
+		/* Bit 7 of a byte of the mask is set when the corresponding byte of the block is 0,
+		 * a borrow can set the bit of a more significant byte as well, those candidates
+		 * are rejected when checked
+		 */
+		match_mask = ( ( ( mam_block - 0x0101010101010101ULL ) & ~mam_block )
+		             | ( ( scca_block - 0x0101010101010101ULL ) & ~scca_block ) )
+		           & 0x8080808080808080ULL;
+
+		if( match_mask != 0 )
+		{
+			for( candidate_index = 0;
+			     candidate_index < 8;
+			     candidate_index++ )
+			{
+				if( ( match_mask & ( 0x0000000000000080ULL << ( candidate_index * 8 ) ) ) == 0 )
+				{
+					continue;
+				}
+				if( libscca_carve_check_candidate(
+				     &( data[ safe_data_offset + candidate_index ] ),
+				     file_type ) == 1 )
+				{
+					*data_offset = safe_data_offset + candidate_index;
+
+					return( 1 );
+				}
+			}
+		}
+		safe_data_offset += 8;
+	}
+	while( ( data_size - safe_data_offset ) >= LIBSCCA_CARVE_CANDIDATE_SIZE )
+	{
+		if( ( ( data[ safe_data_offset ] == 'M' )
+		  || ( data[ safe_data_offset + 4 ] == 'S' ) )
+		 && ( libscca_carve_check_candidate(
+		       &( data[ safe_data_offset ] ),
+		       file_type ) == 1 ) )
+		{
+			*data_offset = safe_data_offset;
+
+			return( 1 );
+		}
+		safe_data_offset++;
+	}
+	*data_offset = safe_data_offset;
+
+	return( 0 );
+}
+
+/* Validates the data of a file found by carving
+ * The data is expected to start with a file signature and is validated by opening it as a file
+ * The layout of an uncompressed file is validated first, without allocating memory
+ * Only the part of the data that can belong to the file is read, for an uncompressed file
+ * this is the file size stored in the file header
+ *
+ * The file size is set to the size of the file or 0 if the size cannot be determined,
+ * which is the case for a compressed file.
+ *
+ * Returns 1 if the data contains a valid file, 0 if not or -1 on error
+ */
+int libscca_carve_validate_data(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *file_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libscca_file_t *file             = NULL;
+	static char *function            = "libscca_carve_validate_data";
+	size_t range_size                = 0;
+	uint32_t header_file_size        = 0;
+	int file_type                    = 0;
+	int result                       = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < sizeof( scca_file_header_t ) )
+	{
+		return( 0 );
+	}
+	if( libscca_carve_check_candidate(
+	     data,
+	     &file_type ) != 1 )
+	{
+		return( 0 );
+	}
+	if( file_type == LIBSCCA_FILE_TYPE_UNCOMPRESSED )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_header_t *) data )->file_size,
+		 header_file_size );
+
+		if( ( header_file_size < (uint32_t) sizeof( scca_file_header_t ) )
+		 || ( (size_t) header_file_size > data_size ) )
+		{
+			return( 0 );
+		}
+		range_size = (size_t) header_file_size;
+
+		/* Reject a candidate with an inconsistent layout before any memory is allocated
+		 */
+		result = libscca_file_validate_layout(
+		          data,
+		          range_size,
+		          (size64_t) range_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to validate layout.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	else
+	{
+		range_size = data_size;
+	}
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     (uint8_t *) data,
+	     range_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	/* A candidate that cannot be opened is not a valid file, hence the error is not retained
+	 */
+	result = libscca_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ,
+	          NULL );
+
+	if( result == 1 )
+	{
+		if( libscca_file_close(
+		     file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		result = 0;
+	}
+	if( libscca_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 1 )
+	{
+		if( file_type == LIBSCCA_FILE_TYPE_UNCOMPRESSED )
+		{
+			*file_size = range_size;
+		}
+		else
+		{
+			*file_size = 0;
+		}
+	}
+	return( result );
+
+on_error:
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
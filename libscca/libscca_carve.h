@@ -0,0 +1,63 @@
+/*
+ * Carving functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_CARVE_H )
+#define _LIBSCCA_CARVE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum number of bytes needed to check a candidate
+ */
+#define LIBSCCA_CARVE_CANDIDATE_SIZE	8
+
+int libscca_carve_check_candidate(
+     const uint8_t *data,
+     int *file_type );
+
+LIBSCCA_EXTERN \
+int libscca_carve_find_signature(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     int *file_type,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_carve_validate_data(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *file_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_CARVE_H ) */
+
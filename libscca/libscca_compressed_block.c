@@ -32,6 +32,8 @@
 #include "libscca_libcnotify.h"
 #include "libscca_libfdata.h"
 #include "libscca_libfwnt.h"
+#include "libscca_mam_decoder.h"
+#include "libscca_read_failure.h"
 #include "libscca_unused.h"
 
 /* Creates compressed block
@@ -168,6 +170,7 @@ int libscca_compressed_block_free(
      libcerror_error_t **error )
 {
 	static char *function = "libscca_compressed_block_free";
+	int result            = 1;
 
 	if( compressed_block == NULL )
 	{
@@ -182,6 +185,23 @@ int libscca_compressed_block_free(
 	}
 	if( *compressed_block != NULL )
 	{
+		if( ( *compressed_block )->io_handle != NULL )
+		{
+			if( libscca_io_handle_release_memory(
+			     ( *compressed_block )->io_handle,
+			     ( *compressed_block )->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to release memory of data.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *compressed_block )->data != NULL )
 		{
 			memory_free(
@@ -192,14 +212,18 @@ int libscca_compressed_block_free(
 
 		*compressed_block = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Reads a compressed block
+ * The compressed data is read into the compressed data buffer of the IO handle
+ * so that it is reused by subsequent reads
+ * The data is decompressed with the MAM decoder of the IO handle if set, otherwise with libfwnt
  * Returns the number of bytes of read on success or -1 on error
  */
 ssize_t libscca_compressed_block_read_file_io_handle(
          libscca_compressed_block_t *compressed_block,
+         libscca_io_handle_t *io_handle,
          libbfio_handle_t *file_io_handle,
          off64_t compressed_block_offset,
          size_t compressed_block_size,
@@ -209,6 +233,7 @@ ssize_t libscca_compressed_block_read_file_io_handle(
 	static char *function         = "libscca_compressed_block_read_file_io_handle";
 	size_t uncompressed_data_size = 0;
 	ssize_t read_count            = 0;
+	int result                    = 0;
 
 	if( compressed_block == NULL )
 	{
@@ -221,6 +246,17 @@ ssize_t libscca_compressed_block_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( compressed_block_size == 0 )
 	 || ( compressed_block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
@@ -233,21 +269,29 @@ ssize_t libscca_compressed_block_read_file_io_handle(
 
 		return( -1 );
 	}
-	compressed_data = (uint8_t *) memory_allocate(
-	                               sizeof( uint8_t ) * compressed_block_size );
-
-	if( compressed_data == NULL )
+	if( libscca_io_handle_get_compressed_data(
+	     io_handle,
+	     compressed_block_size,
+	     &compressed_data,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create compressed data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
 		 compressed_block_offset,
 		 compressed_block_offset );
 
-		goto on_error;
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 compressed_block_offset,
+		 NULL );
+
+		return( -1 );
 	}
 	read_count = libbfio_handle_read_buffer_at_offset(
 		      file_io_handle,
@@ -265,16 +309,37 @@ ssize_t libscca_compressed_block_read_file_io_handle(
 		 "%s: unable to read compressed block.",
 		 function );
 
-		goto on_error;
-	}
-	uncompressed_data_size = compressed_block->data_size;
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 compressed_block_offset,
+		 NULL );
 
-	if( libfwnt_lzxpress_huffman_decompress(
-	     compressed_data,
-	     (size_t) read_count,
-	     compressed_block->data,
-	     &uncompressed_data_size,
-	     error ) != 1 )
+		return( -1 );
+	}
+	if( io_handle->mam_decoder != NULL )
+	{
+		result = libscca_mam_decoder_decompress(
+		          (libscca_internal_mam_decoder_t *) io_handle->mam_decoder,
+		          compressed_data,
+		          (size_t) read_count,
+		          compressed_block->data,
+		          compressed_block->data_size,
+		          error );
+	}
+	else
+	{
+		uncompressed_data_size = compressed_block->data_size;
+
+		result = libfwnt_lzxpress_huffman_decompress(
+		          compressed_data,
+		          (size_t) read_count,
+		          compressed_block->data,
+		          &uncompressed_data_size,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -283,7 +348,14 @@ ssize_t libscca_compressed_block_read_file_io_handle(
 		 "%s: unable to decompress compressed data.",
 		 function );
 
-		goto on_error;
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 compressed_block_offset,
+		 NULL );
+
+		return( -1 );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -297,20 +369,7 @@ ssize_t libscca_compressed_block_read_file_io_handle(
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
-	memory_free(
-	 compressed_data );
-
-	compressed_data = NULL;
-
 	return( read_count );
-
-on_error:
-	if( compressed_data != NULL )
-	{
-		memory_free(
-		 compressed_data );
-	}
-	return( -1 );
 }
 
 /* Reads a compressed block
@@ -395,6 +454,41 @@ int libscca_compressed_block_read_element_data(
 
 		goto on_error;
 	}
+	if( uncompressed_size > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The uncompressed data is retained by the compressed block until it is removed from the cache,
+	 * the compressed data buffer of the IO handle reserves its own memory when it grows
+	 */
+	if( libscca_io_handle_reserve_memory(
+	     io_handle,
+	     (size_t) uncompressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to reserve memory for compressed block.",
+		 function );
+
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 compressed_block_offset,
+		 NULL );
+
+		goto on_error;
+	}
 	if( libscca_compressed_block_initialize(
 	     &compressed_block,
 	     (size_t) uncompressed_size,
@@ -407,10 +501,18 @@ int libscca_compressed_block_read_element_data(
 		 "%s: unable to create compressed block.",
 		 function );
 
+		libscca_io_handle_release_memory(
+		 io_handle,
+		 (size_t) uncompressed_size,
+		 NULL );
+
 		goto on_error;
 	}
+	compressed_block->io_handle = io_handle;
+
 	read_count = libscca_compressed_block_read_file_io_handle(
 	              compressed_block,
+	              io_handle,
 	              file_io_handle,
 	              compressed_block_offset,
 	              (size_t) compressed_block_size,
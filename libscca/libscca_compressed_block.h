@@ -44,6 +44,10 @@ struct libscca_compressed_block
 	/* The data size
 	 */
 	size_t data_size;
+
+	/* The IO handle the memory of the data was reserved from
+	 */
+	libscca_io_handle_t *io_handle;
 };
 
 int libscca_compressed_block_initialize(
@@ -57,6 +61,7 @@ int libscca_compressed_block_free(
 
 ssize_t libscca_compressed_block_read_file_io_handle(
          libscca_compressed_block_t *compressed_block,
+         libscca_io_handle_t *io_handle,
          libbfio_handle_t *file_io_handle,
          off64_t compressed_block_offset,
          size_t compressed_block_size,
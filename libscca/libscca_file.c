@@ -35,6 +35,7 @@
 #include "libscca_file_header.h"
 #include "libscca_file_information.h"
 #include "libscca_file_metrics.h"
+#include "libscca_file_visitor.h"
 #include "libscca_filename_strings.h"
 #include "libscca_libbfio.h"
 #include "libscca_libcdata.h"
@@ -44,8 +45,16 @@
 #include "libscca_libfdata.h"
 #include "libscca_libfvalue.h"
 #include "libscca_libuna.h"
+#include "libscca_read_failure.h"
+#include "libscca_snapshot.h"
 #include "libscca_volume_information.h"
 
+#include "scca_file_header.h"
+#include "scca_file_information.h"
+#include "scca_file_metrics_array.h"
+#include "scca_trace_chain_array.h"
+#include "scca_volume_information.h"
+
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -164,6 +173,8 @@ int libscca_file_initialize(
 
 		goto on_error;
 	}
+	internal_file->read_flags = LIBSCCA_READ_FLAGS_ALL;
+
 	*file = (libscca_file_t *) internal_file;
 
 	return( 1 );
@@ -223,7 +234,8 @@ int libscca_file_free(
 	{
 		internal_file = (libscca_internal_file_t *) *file;
 
-		if( internal_file->file_io_handle != NULL )
+		if( ( internal_file->file_io_handle != NULL )
+		 || ( internal_file->file_header != NULL ) )
 		{
 			if( libscca_file_close(
 			     *file,
@@ -340,18 +352,20 @@ int libscca_file_signal_abort(
 	return( 1 );
 }
 
-/* Opens a file
+/* Sets the read flags
+ * The read flags control which optional sections are read when the file is opened
+ * Reading the file metrics also reads the filename strings they refer to
+ * Sections that are not read are not parsed, the compressed data of a MAM compressed file
+ * is still decompressed in full
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_open(
+int libscca_file_set_read_flags(
      libscca_file_t *file,
-     const char *filename,
-     int access_flags,
+     uint8_t read_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle       = NULL;
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_open";
+	static char *function                  = "libscca_file_set_read_flags";
 
 	if( file == NULL )
 	{
@@ -366,129 +380,99 @@ int libscca_file_open(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( filename == NULL )
+	if( ( read_flags & ~( LIBSCCA_READ_FLAGS_ALL ) ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
-		 function );
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported read flags: 0x%02" PRIx8 ".",
+		 function,
+		 read_flags );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) == 0 ) )
+	if( internal_file->file_information != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file already open.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
+	internal_file->read_flags = read_flags;
+
+	return( 1 );
+}
+
+/* Sets the error mode
+ * In the codes only error mode a failure to read the file when it is opened
+ * is reported by a single error, without the error messages of every layer,
+ * that has the error domain and code of the innermost failure,
+ * its section and offset can be retrieved with libscca_file_get_read_failure
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_set_error_mode(
+     libscca_file_t *file,
+     uint8_t error_mode,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_set_error_mode";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
-		 function );
-
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
-
-		goto on_error;
-	}
-#endif
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     narrow_string_length(
-	      filename ) + 1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+	internal_file = (libscca_internal_file_t *) file;
 
-		goto on_error;
-	}
-	if( libscca_file_open_file_io_handle(
-	     file,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	if( ( error_mode != LIBSCCA_ERROR_MODE_DEFAULT )
+	 && ( error_mode != LIBSCCA_ERROR_MODE_CODES_ONLY ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %s.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported error mode: %" PRIu8 ".",
 		 function,
-		 filename );
+		 error_mode );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->file_io_handle_created_in_library = 1;
+	internal_file->error_mode = error_mode;
 
 	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Opens a file
- * Returns 1 if successful or -1 on error
+/* Retrieves the failure to read the file when it was last opened
+ * The error domain and code are those of the innermost failure and the offset is where
+ * the read failed, which is relative to the start of the file for the compressed file header
+ * and compressed blocks and relative to the start of the uncompressed data otherwise
+ * A failure that is not caused by reading the data, such as a failing section callback,
+ * is reported with LIBCERROR_ERROR_DOMAIN_RUNTIME and LIBCERROR_RUNTIME_ERROR_GENERIC
+ * and the offset of the section
+ * Returns 1 if successful, 0 if no read failure was recorded or -1 on error
  */
-int libscca_file_open_wide(
+int libscca_file_get_read_failure(
      libscca_file_t *file,
-     const wchar_t *filename,
-     int access_flags,
+     int *section_type,
+     int *error_domain,
+     int *error_code,
+     off64_t *offset,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle       = NULL;
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_open_wide";
+	static char *function                  = "libscca_file_get_read_failure";
 
 	if( file == NULL )
 	{
@@ -503,131 +487,82 @@ int libscca_file_open_wide(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( filename == NULL )
+	if( section_type == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid section type.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) == 0 ) )
+	if( error_domain == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error domain.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
+	if( error_code == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	if( offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
-
-		goto on_error;
-	}
-#endif
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     wide_string_length(
-	      filename ) + 1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
-
-		goto on_error;
+		return( -1 );
 	}
-	if( libscca_file_open_file_io_handle(
-	     file,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	if( internal_file->read_failure.is_set == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %ls.",
-		 function,
-		 filename );
-
-		goto on_error;
+		return( 0 );
 	}
-	internal_file->file_io_handle_created_in_library = 1;
+	*section_type = internal_file->read_failure_section_type;
+	*error_domain = internal_file->read_failure.error_domain;
+	*error_code   = internal_file->read_failure.error_code;
+	*offset       = internal_file->read_failure.offset;
 
 	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Opens a file using a Basic File IO (bfio) handle
+/* Sets the section callback
+ * The callback is invoked after each section that was read when the file is opened
+ * and can return 1 to continue, 0 to stop reading the remaining sections or -1 on error
+ * The file header and file information are always read, the file metrics, filename strings
+ * and volumes only when enabled by the read flags
+ * Sections after a stop are not parsed, the compressed data of a MAM compressed file
+ * is decompressed in full when the file is opened, before the first section is read
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_open_file_io_handle(
+int libscca_file_set_section_callback(
      libscca_file_t *file,
-     libbfio_handle_t *file_io_handle,
-     int access_flags,
+     int (*section_callback)(
+            libscca_file_t *file,
+            int section_type,
+            intptr_t *user_data ),
+     intptr_t *user_data,
      libcerror_error_t **error )
 {
-	libscca_internal_file_t *internal_file   = NULL;
-	static char *function                    = "libscca_file_open_file_io_handle";
-	uint8_t file_io_handle_opened_in_library = 0;
-	int bfio_access_flags                    = 0;
-	int file_io_handle_is_open               = 0;
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_set_section_callback";
 
 	if( file == NULL )
 	{
@@ -642,129 +577,147 @@ int libscca_file_open_file_io_handle(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( internal_file->file_io_handle != NULL )
+	if( internal_file->file_information != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file IO handle already set.",
+		 "%s: invalid file - file already open.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+	internal_file->section_callback           = section_callback;
+	internal_file->section_callback_user_data = user_data;
+
+	return( 1 );
+}
+
+/* Sets the maximum memory size
+ * The maximum memory size limits the memory the file allocates for data that scales
+ * with the size of the file, such as the decompressed blocks, the file metrics entries,
+ * the filename strings and the volumes information, a value of 0 represents no maximum
+ * The memory size is approximate, the per-entry values are accounted for by the size of
+ * their structures while the array, cache bookkeeping and fixed-size allocations are not
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_set_maximum_memory_size(
+     libscca_file_t *file,
+     size_t maximum_memory_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_set_maximum_memory_size";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) == 0 ) )
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
+	if( maximum_memory_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum memory size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) != 0 )
-	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
-	}
-	internal_file->file_io_handle = file_io_handle;
+	internal_file->io_handle->maximum_memory_size = maximum_memory_size;
 
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          internal_file->file_io_handle,
-	                          error );
+	return( 1 );
+}
 
-	if( file_io_handle_is_open == -1 )
+/* Retrieves the memory size
+ * The memory size contains the memory currently allocated by the file for data
+ * that scales with the size of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_memory_size(
+     libscca_file_t *file,
+     size_t *memory_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_memory_size";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to determine if file IO handle is open.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( file_io_handle_is_open == 0 )
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
-		if( libbfio_handle_open(
-		     internal_file->file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
 
-			goto on_error;
-		}
-		file_io_handle_opened_in_library = 1;
+		return( -1 );
 	}
-	if( libscca_file_open_read(
-	     internal_file,
-	     file_io_handle,
-	     error ) != 1 )
+	if( memory_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->file_io_handle                   = file_io_handle;
-	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	*memory_size = internal_file->io_handle->memory_size;
 
 	return( 1 );
-
-on_error:
-	if( file_io_handle_opened_in_library != 0 )
-	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
-	}
-	return( -1 );
 }
 
-/* Closes a file
- * Returns 0 if successful or -1 on error
+/* Sets the MAM decoder used to decompress the file
+ * By default the file is decompressed with libfwnt, setting a MAM decoder opts in to the native decoder
+ * The MAM decoder retains its decoding table and is not freed by the file, it can be shared by files
+ * that are not read concurrently, such as the files read by the same thread
+ * The memory of the MAM decoder is owned by the caller and is not accounted for by the maximum memory size
+ * of the file, the compressed data buffer the file reuses for reading is
+ * Returns 1 if successful or -1 on error
  */
-int libscca_file_close(
+int libscca_file_set_mam_decoder(
      libscca_file_t *file,
+     libscca_mam_decoder_t *mam_decoder,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_close";
-	int result                             = 0;
+	static char *function                  = "libscca_file_set_mam_decoder";
 
 	if( file == NULL )
 	{
@@ -779,226 +732,197 @@ int libscca_file_close(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( internal_file->file_io_handle == NULL )
+	if( ( internal_file->file_io_handle != NULL )
+	 || ( internal_file->file_header != NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file already open.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( internal_file->file_io_handle_created_in_library != 0 )
-		{
-			if( libscca_debug_print_read_offsets(
-			     internal_file->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
-
-				result = -1;
-			}
-		}
-	}
-#endif
-	if( internal_file->file_io_handle_opened_in_library != 0 )
-	{
-		if( libbfio_handle_close(
-		     internal_file->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
-
-			result = -1;
-		}
-		internal_file->file_io_handle_opened_in_library = 0;
-	}
-	if( internal_file->file_io_handle_created_in_library != 0 )
+	if( mam_decoder == NULL )
 	{
-		if( libbfio_handle_free(
-		     &( internal_file->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
 
-			result = -1;
-		}
-		internal_file->file_io_handle_created_in_library = 0;
+		return( -1 );
 	}
-	internal_file->file_io_handle = NULL;
-
-	if( libscca_io_handle_clear(
+	if( libscca_io_handle_set_mam_decoder(
 	     internal_file->io_handle,
+	     mam_decoder,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set MAM decoder in IO handle.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( internal_file->compressed_blocks_list != NULL )
-	{
-		if( libfdata_list_free(
-		     &( internal_file->compressed_blocks_list ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free compressed blocks list.",
-			 function );
+	return( 1 );
+}
 
-			result = -1;
-		}
-	}
-	if( internal_file->compressed_blocks_cache != NULL )
-	{
-		if( libfcache_cache_free(
-		     &( internal_file->compressed_blocks_cache ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free compressed blocks cache.",
-			 function );
+/* Opens a file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_open(
+     libscca_file_t *file,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_open";
 
-			result = -1;
-		}
-	}
-	if( internal_file->uncompressed_data_stream != NULL )
+	if( file == NULL )
 	{
-		if( libfdata_stream_free(
-		     &( internal_file->uncompressed_data_stream ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free uncompressed data strea,.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
-	if( internal_file->file_header != NULL )
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( filename == NULL )
 	{
-		if( libscca_file_header_free(
-		     &( internal_file->file_header ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file header.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
-	if( internal_file->file_information != NULL )
+	if( ( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
-		if( libscca_file_information_free(
-		     &( internal_file->file_information ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file information.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
-	if( libcdata_array_empty(
-	     internal_file->file_metrics_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_file_metrics_free,
-	     error ) != 1 )
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to empty file metrics array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( libscca_filename_strings_clear(
-	     internal_file->filename_strings,
+	if( libbfio_file_initialize(
+	     &file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear filename strings.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libcdata_array_empty(
-	     internal_file->volumes_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_volume_information_free,
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     narrow_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libscca_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to empty volumes array.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
 
-		result = -1;
+		goto on_error;
 	}
-	return( result );
+	internal_file->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Opens a file for reading
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a file
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_open_read(
-     libscca_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
+int libscca_file_open_wide(
+     libscca_file_t *file,
+     const wchar_t *filename,
+     int access_flags,
      libcerror_error_t **error )
 {
-	static char *function = "libscca_file_open_read";
-	size64_t file_size    = 0;
-	off64_t file_offset   = 0;
-	off64_t next_offset   = 0;
-	int segment_index     = 0;
+	libbfio_handle_t *file_io_handle       = NULL;
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_open_wide";
 
-	if( internal_file == NULL )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1009,575 +933,2154 @@ int libscca_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->io_handle == NULL )
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->compressed_blocks_list != NULL )
+	if( ( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - compressed blocks list value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->compressed_blocks_cache != NULL )
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - compressed blocks cache value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->file_header != NULL )
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file header value already set.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     wide_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libscca_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	internal_file->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_open_file_io_handle(
+     libscca_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file   = NULL;
+	libcerror_error_t **read_error           = NULL;
+	static char *function                    = "libscca_file_open_file_io_handle";
+	uint8_t file_io_handle_opened_in_library = 0;
+	int bfio_access_flags                    = 0;
+	int file_io_handle_is_open               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->file_information != NULL )
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file information value already set.",
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->io_handle->abort != 0 )
+	if( internal_file->file_header != NULL )
 	{
-		internal_file->io_handle->abort = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file header already set.",
+		 function );
+
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( file_io_handle == NULL )
 	{
-		libcnotify_printf(
-		 "Reading file header:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( libscca_io_handle_read_compressed_file_header(
-	     internal_file->io_handle,
-	     file_io_handle,
-	     error ) != 1 )
+	if( ( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( internal_file->io_handle->file_type != LIBSCCA_FILE_TYPE_UNCOMPRESSED )
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
 	{
-		if( libfdata_list_initialize(
-		     &( internal_file->compressed_blocks_list ),
-		     (intptr_t *) internal_file->io_handle,
-		     NULL,
-		     NULL,
-		     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libscca_compressed_block_read_element_data,
-		     NULL,
-		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	internal_file->file_io_handle = file_io_handle;
+
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          internal_file->file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     internal_file->file_io_handle,
+		     bfio_access_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create compressed blocks list.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfcache_cache_initialize(
-		     &( internal_file->compressed_blocks_cache ),
-		     LIBSCCA_MAXIMUM_CACHE_ENTRIES_COMPRESSED_BLOCKS,
-		     error ) != 1 )
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libscca_read_failure_clear(
+	     &( internal_file->read_failure ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear read failure.",
+		 function );
+
+		goto on_error;
+	}
+	/* In the codes only error mode the errors of the read are not retained
+	 * so that no error messages are formatted for every layer
+	 */
+	if( internal_file->error_mode != LIBSCCA_ERROR_MODE_CODES_ONLY )
+	{
+		read_error = error;
+	}
+	if( libscca_file_open_read(
+	     internal_file,
+	     file_io_handle,
+	     read_error ) != 1 )
+	{
+		/* In the codes only error mode the error has the error domain and code of the innermost failure
+		 */
+		if( ( internal_file->error_mode == LIBSCCA_ERROR_MODE_CODES_ONLY )
+		 && ( internal_file->read_failure.is_set != 0 ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create compressed blocks cache.",
+			 internal_file->read_failure.error_domain,
+			 internal_file->read_failure.error_code,
+			 "%s: unable to read from file handle.",
+			 function );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file handle.",
 			 function );
-
-			goto on_error;
 		}
+		goto on_error;
+	}
+	internal_file->file_io_handle                   = file_io_handle;
+	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Closes a file
+ * Returns 0 if successful or -1 on error
+ */
+int libscca_file_close(
+     libscca_file_t *file,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_close";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	/* A file opened from a snapshot has no file IO handle
+	 */
+	if( ( internal_file->file_io_handle == NULL )
+	 && ( internal_file->file_header == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_file->file_io_handle_created_in_library != 0 )
 		{
-			libcnotify_printf(
-			 "Reading compressed blocks:\n" );
+			if( libscca_debug_print_read_offsets(
+			     internal_file->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
 		}
+	}
 #endif
-		if( libscca_io_handle_read_compressed_blocks(
-		     internal_file->io_handle,
-		     file_io_handle,
-		     internal_file->compressed_blocks_list,
-		     internal_file->compressed_blocks_cache,
-		     error ) != 1 )
+	if( internal_file->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read compressed blocks.",
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		if( libscca_compressed_blocks_stream_initialize(
-		     &( internal_file->uncompressed_data_stream ),
-		     internal_file->compressed_blocks_list,
-		     internal_file->compressed_blocks_cache,
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->file_io_handle ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create compressed blocks stream.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
+		internal_file->file_io_handle_created_in_library = 0;
 	}
-	else
+	internal_file->file_io_handle = NULL;
+
+	if( internal_file->compressed_blocks_list != NULL )
 	{
-		if( libfdata_stream_initialize(
-		     &( internal_file->uncompressed_data_stream ),
-		     NULL,
-		     NULL,
-		     NULL,
-		     NULL,
-		     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libscca_io_handle_read_segment_data,
-		     NULL,
-		     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libscca_io_handle_seek_segment_offset,
-		     0,
+		if( libfdata_list_free(
+		     &( internal_file->compressed_blocks_list ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create uncompressed data stream.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks list.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		if( libfdata_stream_append_segment(
-		     internal_file->uncompressed_data_stream,
-		     &segment_index,
-		     0,
-		     0,
-		     (size64_t) internal_file->io_handle->uncompressed_data_size,
-		     0,
+	}
+	if( internal_file->compressed_blocks_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     &( internal_file->compressed_blocks_cache ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append uncompressed data stream segment: 0.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks cache.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
 	}
-	if( libfdata_stream_get_size(
-	     internal_file->uncompressed_data_stream,
-	     &file_size,
-	     error ) != 1 )
+	if( internal_file->uncompressed_data_stream != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve uncompressed data stream size.",
-		 function );
+		if( libfdata_stream_free(
+		     &( internal_file->uncompressed_data_stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free uncompressed data strea,.",
+			 function );
 
-		goto on_error;
+			result = -1;
+		}
 	}
-	if( libscca_file_header_initialize(
-	     &( internal_file->file_header ),
-	     error ) != 1 )
+	if( internal_file->uncompressed_data != NULL )
 	{
-		libcerror_error_set(
+		memory_free(
+		 internal_file->uncompressed_data );
+
+		internal_file->uncompressed_data = NULL;
+
+		if( libscca_io_handle_release_memory(
+		     internal_file->io_handle,
+		     internal_file->uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to release memory of uncompressed data.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_file->uncompressed_data_size = 0;
+
+	/* The IO handle is cleared after the compressed blocks are freed
+	 * so that the memory they reserved is released first
+	 */
+	if( libscca_io_handle_clear(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file header.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	if( libscca_file_header_read_data_stream(
-	     internal_file->file_header,
-	     internal_file->uncompressed_data_stream,
-	     file_io_handle,
+
+	if( internal_file->file_header != NULL )
+	{
+		if( libscca_file_header_free(
+		     &( internal_file->file_header ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file header.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->file_information != NULL )
+	{
+		if( libscca_file_information_free(
+		     &( internal_file->file_information ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file information.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcdata_array_empty(
+	     internal_file->file_metrics_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_file_metrics_free,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty file metrics array.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	internal_file->io_handle->format_version = internal_file->file_header->format_version;
+	if( libscca_filename_strings_clear(
+	     internal_file->filename_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear filename strings.",
+		 function );
 
-	if( internal_file->io_handle->uncompressed_data_size != internal_file->file_header->file_size )
+		result = -1;
+	}
+	if( libcdata_array_empty(
+	     internal_file->volumes_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_volume_information_free,
+	     error ) != 1 )
 	{
-/* TODO flag mismatch and file as corrupted? */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty volumes array.",
+		 function );
+
+		result = -1;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	return( result );
+}
+
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_open_read(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function         = "libscca_file_open_read";
+	size64_t file_size            = 0;
+	off64_t file_offset           = 0;
+	off64_t next_offset           = 0;
+	off64_t section_offset        = 0;
+	uint8_t read_filename_strings = 0;
+	int result                    = 0;
+	int section_type              = LIBSCCA_FILE_SECTION_TYPE_FILE_HEADER;
+	int segment_index             = 0;
+
+	if( internal_file == NULL )
 	{
-		libcnotify_printf(
-		 "Reading file information:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( libscca_file_information_initialize(
-	     &( internal_file->file_information ),
-	     error ) != 1 )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file information.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libscca_file_information_read_stream(
-	     internal_file->file_information,
-	     internal_file->uncompressed_data_stream,
-	     file_io_handle,
-	     internal_file->io_handle,
-	     error ) != 1 )
+	if( internal_file->compressed_blocks_list != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file information from stream.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - compressed blocks list value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfdata_stream_get_offset(
-	     internal_file->uncompressed_data_stream,
-	     &file_offset,
+	if( internal_file->compressed_blocks_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - compressed blocks cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file header value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->abort != 0 )
+	{
+		internal_file->io_handle->abort = 0;
+	}
+	if( libscca_read_failure_clear(
+	     &( internal_file->io_handle->read_failure ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve uncompressed data stream current offset.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle read failure.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( internal_file->file_information->metrics_array_offset != 0 )
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		next_offset = internal_file->file_information->trace_chain_array_offset;
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	if( libscca_io_handle_read_compressed_file_header(
+	     internal_file->io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
 
-		if( next_offset == 0 )
-		{
-			next_offset = internal_file->file_information->filename_strings_offset;
-		}
-		if( next_offset == 0 )
-		{
-			next_offset = internal_file->file_information->volumes_information_offset;
-		}
-		if( next_offset == 0 )
-		{
-			next_offset = file_size;
-		}
-		/* Allow for a margin of 8 + 4 bytes for version 30 variant 2
-		 */
-		if( ( internal_file->file_information->metrics_array_offset < ( file_offset - 12 ) )
-		 || ( internal_file->file_information->metrics_array_offset >= next_offset ) )
+		goto on_error;
+	}
+	if( internal_file->io_handle->file_type != LIBSCCA_FILE_TYPE_UNCOMPRESSED )
+	{
+		if( libfdata_list_initialize(
+		     &( internal_file->compressed_blocks_list ),
+		     (intptr_t *) internal_file->io_handle,
+		     NULL,
+		     NULL,
+		     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libscca_compressed_block_read_element_data,
+		     NULL,
+		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid metrics array offset value out of bounds: %jd > %jd > %jd.",
-			 function, file_offset, internal_file->file_information->metrics_array_offset, next_offset );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed blocks list.",
+			 function );
 
 			goto on_error;
 		}
-		if( libscca_io_handle_read_file_metrics_array(
-		     internal_file->io_handle,
-		     internal_file->uncompressed_data_stream,
-		     file_io_handle,
-		     internal_file->file_information->metrics_array_offset,
-		     internal_file->file_information->number_of_file_metrics_entries,
-		     internal_file->filename_strings,
-		     internal_file->file_metrics_array,
+		if( libfcache_cache_initialize(
+		     &( internal_file->compressed_blocks_cache ),
+		     LIBSCCA_MAXIMUM_CACHE_ENTRIES_COMPRESSED_BLOCKS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed blocks cache.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading compressed blocks:\n" );
+		}
+#endif
+		if( libscca_io_handle_read_compressed_blocks(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     internal_file->compressed_blocks_list,
+		     internal_file->compressed_blocks_cache,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read file metrics array.",
+			 "%s: unable to read compressed blocks.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfdata_stream_get_offset(
-		     internal_file->uncompressed_data_stream,
-		     &file_offset,
+		if( libscca_compressed_blocks_stream_initialize(
+		     &( internal_file->uncompressed_data_stream ),
+		     internal_file->compressed_blocks_list,
+		     internal_file->compressed_blocks_cache,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve uncompressed data stream current offset.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed blocks stream.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	if( internal_file->file_information->trace_chain_array_offset != 0 )
+	else
 	{
-		next_offset = internal_file->file_information->filename_strings_offset;
-
-		if( next_offset == 0 )
-		{
-			next_offset = internal_file->file_information->volumes_information_offset;
-		}
-		if( next_offset == 0 )
+		if( libfdata_stream_initialize(
+		     &( internal_file->uncompressed_data_stream ),
+		     (intptr_t *) internal_file->io_handle,
+		     NULL,
+		     NULL,
+		     NULL,
+		     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libscca_io_handle_read_segment_data,
+		     NULL,
+		     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libscca_io_handle_seek_segment_offset,
+		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+		     error ) != 1 )
 		{
-			next_offset = file_size;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create uncompressed data stream.",
+			 function );
+
+			goto on_error;
 		}
-		if( ( internal_file->file_information->trace_chain_array_offset < file_offset )
-		 || ( internal_file->file_information->trace_chain_array_offset >= next_offset ) )
+		if( libfdata_stream_append_segment(
+		     internal_file->uncompressed_data_stream,
+		     &segment_index,
+		     0,
+		     0,
+		     (size64_t) internal_file->io_handle->uncompressed_data_size,
+		     0,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid trace chain array offset value out of bounds.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append uncompressed data stream segment: 0.",
 			 function );
 
 			goto on_error;
 		}
+	}
+	if( libfdata_stream_get_size(
+	     internal_file->uncompressed_data_stream,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data stream size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_header_initialize(
+	     &( internal_file->file_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_header_read_data_stream(
+	     internal_file->file_header,
+	     internal_file->uncompressed_data_stream,
+	     file_io_handle,
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->format_version = internal_file->file_header->format_version;
+
+	if( internal_file->io_handle->uncompressed_data_size != internal_file->file_header->file_size )
+	{
+/* TODO flag mismatch and file as corrupted? */
+	}
+	result = libscca_internal_file_section_read(
+	          internal_file,
+	          LIBSCCA_FILE_SECTION_TYPE_FILE_HEADER,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to signal file header read.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	section_type   = LIBSCCA_FILE_SECTION_TYPE_FILE_INFORMATION;
+	section_offset = (off64_t) sizeof( scca_file_header_t );
+
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( libscca_io_handle_read_trace_chain_array(
-			     internal_file->io_handle,
-			     internal_file->uncompressed_data_stream,
-			     file_io_handle,
-			     internal_file->file_information->trace_chain_array_offset,
-			     internal_file->file_information->number_of_trace_chain_array_entries,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read trace chain array.",
-				 function );
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file information:\n" );
+	}
+#endif
+	if( libscca_file_information_initialize(
+	     &( internal_file->file_information ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file information.",
+		 function );
 
-				goto on_error;
-			}
-			if( libfdata_stream_get_offset(
-			     internal_file->uncompressed_data_stream,
-			     &file_offset,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve uncompressed data stream current offset.",
-				 function );
+		goto on_error;
+	}
+	if( libscca_file_information_read_stream(
+	     internal_file->file_information,
+	     internal_file->uncompressed_data_stream,
+	     file_io_handle,
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file information from stream.",
+		 function );
 
-				goto on_error;
-			}
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		goto on_error;
 	}
-	if( internal_file->file_information->filename_strings_offset != 0 )
+	if( libfdata_stream_get_offset(
+	     internal_file->uncompressed_data_stream,
+	     &file_offset,
+	     error ) != 1 )
 	{
-		next_offset = internal_file->file_information->volumes_information_offset;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data stream current offset.",
+		 function );
+
+		goto on_error;
+	}
+	result = libscca_internal_file_section_read(
+	          internal_file,
+	          LIBSCCA_FILE_SECTION_TYPE_FILE_INFORMATION,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to signal file information read.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	/* The file metrics refer to the filename strings
+	 */
+	if( ( internal_file->read_flags & ( LIBSCCA_READ_FLAG_FILE_METRICS | LIBSCCA_READ_FLAG_FILENAME_STRINGS ) ) != 0 )
+	{
+		read_filename_strings = 1;
+	}
+	if( ( internal_file->file_information->metrics_array_offset != 0 )
+	 && ( ( internal_file->read_flags & LIBSCCA_READ_FLAG_FILE_METRICS ) != 0 ) )
+	{
+		section_type   = LIBSCCA_FILE_SECTION_TYPE_FILE_METRICS;
+		section_offset = (off64_t) internal_file->file_information->metrics_array_offset;
 
+		next_offset = internal_file->file_information->trace_chain_array_offset;
+
+		if( next_offset == 0 )
+		{
+			next_offset = internal_file->file_information->filename_strings_offset;
+		}
+		if( next_offset == 0 )
+		{
+			next_offset = internal_file->file_information->volumes_information_offset;
+		}
 		if( next_offset == 0 )
 		{
 			next_offset = file_size;
 		}
-		if( ( internal_file->file_information->filename_strings_offset < file_offset )
-		 || ( internal_file->file_information->filename_strings_offset >= next_offset ) )
+		/* Allow for a margin of 8 + 4 bytes for version 30 variant 2
+		 */
+		if( ( internal_file->file_information->metrics_array_offset < ( file_offset - 12 ) )
+		 || ( internal_file->file_information->metrics_array_offset >= next_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid metrics array offset value out of bounds: %jd > %jd > %jd.",
+			 function, file_offset, internal_file->file_information->metrics_array_offset, next_offset );
+
+			libscca_read_failure_set(
+			 &( internal_file->io_handle->read_failure ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 section_offset,
+			 NULL );
+
+			goto on_error;
+		}
+		if( libscca_io_handle_read_file_metrics_array(
+		     internal_file->io_handle,
+		     internal_file->uncompressed_data_stream,
+		     file_io_handle,
+		     internal_file->file_information->metrics_array_offset,
+		     internal_file->file_information->number_of_file_metrics_entries,
+		     internal_file->filename_strings,
+		     internal_file->file_metrics_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file metrics array.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdata_stream_get_offset(
+		     internal_file->uncompressed_data_stream,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve uncompressed data stream current offset.",
+			 function );
+
+			goto on_error;
+		}
+		result = libscca_internal_file_section_read(
+		          internal_file,
+		          LIBSCCA_FILE_SECTION_TYPE_FILE_METRICS,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to signal file metrics read.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( internal_file->file_information->trace_chain_array_offset != 0 )
+	{
+		next_offset = internal_file->file_information->filename_strings_offset;
+
+		if( next_offset == 0 )
+		{
+			next_offset = internal_file->file_information->volumes_information_offset;
+		}
+		if( next_offset == 0 )
+		{
+			next_offset = file_size;
+		}
+		if( ( internal_file->file_information->trace_chain_array_offset < file_offset )
+		 || ( internal_file->file_information->trace_chain_array_offset >= next_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid trace chain array offset value out of bounds.",
+			 function );
+
+			libscca_read_failure_set(
+			 &( internal_file->io_handle->read_failure ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 (off64_t) internal_file->file_information->trace_chain_array_offset,
+			 NULL );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( libscca_io_handle_read_trace_chain_array(
+			     internal_file->io_handle,
+			     internal_file->uncompressed_data_stream,
+			     file_io_handle,
+			     internal_file->file_information->trace_chain_array_offset,
+			     internal_file->file_information->number_of_trace_chain_array_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read trace chain array.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfdata_stream_get_offset(
+			     internal_file->uncompressed_data_stream,
+			     &file_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve uncompressed data stream current offset.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	}
+	if( ( internal_file->file_information->filename_strings_offset != 0 )
+	 && ( read_filename_strings != 0 ) )
+	{
+		section_type   = LIBSCCA_FILE_SECTION_TYPE_FILENAME_STRINGS;
+		section_offset = (off64_t) internal_file->file_information->filename_strings_offset;
+
+		next_offset = internal_file->file_information->volumes_information_offset;
+
+		if( next_offset == 0 )
+		{
+			next_offset = file_size;
+		}
+		if( ( internal_file->file_information->filename_strings_offset < file_offset )
+		 || ( internal_file->file_information->filename_strings_offset >= next_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filename strings offset value out of bounds.",
+			 function );
+
+			libscca_read_failure_set(
+			 &( internal_file->io_handle->read_failure ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 section_offset,
+			 NULL );
+
+			goto on_error;
+		}
+		if( internal_file->file_information->filename_strings_size > ( next_offset - internal_file->file_information->filename_strings_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filename strings size value out of bounds.",
+			 function );
+
+			libscca_read_failure_set(
+			 &( internal_file->io_handle->read_failure ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 section_offset,
+			 NULL );
+
+			goto on_error;
+		}
+		if( libscca_io_handle_reserve_memory(
+		     internal_file->io_handle,
+		     (size_t) internal_file->file_information->filename_strings_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to reserve memory for filename strings.",
+			 function );
+
+			libscca_read_failure_set(
+			 &( internal_file->io_handle->read_failure ),
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 section_offset,
+			 NULL );
+
+			goto on_error;
+		}
+		if( libscca_filename_strings_read_stream(
+		     internal_file->filename_strings,
+		     internal_file->uncompressed_data_stream,
+		     file_io_handle,
+		     internal_file->file_information->filename_strings_offset,
+		     internal_file->file_information->filename_strings_size,
+		     &( internal_file->io_handle->read_failure ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read filename strings from stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdata_stream_get_offset(
+		     internal_file->uncompressed_data_stream,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve uncompressed data stream current offset.",
+			 function );
+
+			goto on_error;
+		}
+		result = libscca_internal_file_section_read(
+		          internal_file,
+		          LIBSCCA_FILE_SECTION_TYPE_FILENAME_STRINGS,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to signal filename strings read.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( ( internal_file->file_information->volumes_information_offset != 0 )
+	 && ( ( internal_file->read_flags & LIBSCCA_READ_FLAG_VOLUMES ) != 0 ) )
+	{
+		section_type   = LIBSCCA_FILE_SECTION_TYPE_VOLUMES;
+		section_offset = (off64_t) internal_file->file_information->volumes_information_offset;
+
+		if( ( internal_file->file_information->volumes_information_offset < file_offset )
+		 || ( internal_file->file_information->volumes_information_offset > file_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid volumes information offset value out of bounds.",
+			 function );
+
+			libscca_read_failure_set(
+			 &( internal_file->io_handle->read_failure ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 section_offset,
+			 NULL );
+
+			goto on_error;
+		}
+		if( internal_file->file_information->volumes_information_size > ( file_size - internal_file->file_information->volumes_information_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid volumes information size value out of bounds.",
+			 function );
+
+			libscca_read_failure_set(
+			 &( internal_file->io_handle->read_failure ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 section_offset,
+			 NULL );
+
+			goto on_error;
+		}
+		if( libscca_io_handle_read_volumes_information(
+		     internal_file->io_handle,
+		     internal_file->uncompressed_data_stream,
+		     internal_file->file_io_handle,
+		     internal_file->file_information->volumes_information_offset,
+		     internal_file->file_information->volumes_information_size,
+		     internal_file->file_information->number_of_volumes,
+		     internal_file->read_flags,
+		     internal_file->volumes_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read volumes information.",
+			 function );
+
+			goto on_error;
+		}
+		result = libscca_internal_file_section_read(
+		          internal_file,
+		          LIBSCCA_FILE_SECTION_TYPE_VOLUMES,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to signal volumes information read.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	/* A failure that was not recorded where it occurred is not caused by reading the data
+	 */
+	libscca_read_failure_set(
+	 &( internal_file->io_handle->read_failure ),
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 section_offset,
+	 NULL );
+
+	internal_file->read_failure              = internal_file->io_handle->read_failure;
+	internal_file->read_failure_section_type = section_type;
+
+	if( internal_file->file_information != NULL )
+	{
+		libscca_file_information_free(
+		 &( internal_file->file_information ),
+		 NULL );
+	}
+	if( internal_file->file_header != NULL )
+	{
+		libscca_file_header_free(
+		 &( internal_file->file_header ),
+		 NULL );
+	}
+	libcdata_array_empty(
+	 internal_file->file_metrics_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_file_metrics_free,
+	 NULL );
+
+	libscca_filename_strings_clear(
+	 internal_file->filename_strings,
+	 NULL );
+
+	libcdata_array_empty(
+	 internal_file->volumes_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_volume_information_free,
+	 NULL );
+
+	if( internal_file->compressed_blocks_list != NULL )
+	{
+		libfdata_list_free(
+		 &( internal_file->compressed_blocks_list ),
+		 NULL );
+	}
+	if( internal_file->compressed_blocks_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->compressed_blocks_cache ),
+		 NULL );
+	}
+	if( internal_file->uncompressed_data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &( internal_file->uncompressed_data_stream ),
+		 NULL );
+	}
+	/* The IO handle is cleared after the compressed blocks are freed
+	 * so that the memory reserved during the failed open is released
+	 * and a subsequent open of the file starts with only the retained compressed data reserved
+	 */
+	libscca_io_handle_clear(
+	 internal_file->io_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Signals that a section was read by invoking the section callback, if set
+ * Returns 1 to continue reading, 0 if reading was stopped by the callback or -1 on error
+ */
+int libscca_internal_file_section_read(
+     libscca_internal_file_t *internal_file,
+     int section_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_internal_file_section_read";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->section_callback == NULL )
+	{
+		return( 1 );
+	}
+	result = internal_file->section_callback(
+	          (libscca_file_t *) internal_file,
+	          section_type,
+	          internal_file->section_callback_user_data );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: section callback failed for section: %d.",
+		 function,
+		 section_type );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading stopped after section: %d.\n",
+			 function,
+			 section_type );
+		}
+#endif
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the format version
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_format_version(
+     libscca_file_t *file,
+     uint32_t *format_version,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_format_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+	*format_version = internal_file->io_handle->format_version;
+
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded executable filename
+ * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf8_executable_filename_size(
+     libscca_file_t *file,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf8_executable_filename_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_file_header_get_utf8_executable_filename_size(
+	     internal_file->file_header,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 executable filename size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded executable filename
+ * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf8_executable_filename(
+     libscca_file_t *file,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf8_executable_filename";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_file_header_get_utf8_executable_filename(
+	     internal_file->file_header,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-16 encoded executable filename
+ * This function uses UCS-2 (with surrogates) to support characters outside Unicode
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf16_executable_filename_size(
+     libscca_file_t *file,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf16_executable_filename_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_file_header_get_utf16_executable_filename_size(
+	     internal_file->file_header,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 executable filename size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-16 encoded executable filename
+ * This function uses UCS-2 (with surrogates) to support characters outside Unicode
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf16_executable_filename(
+     libscca_file_t *file,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf16_executable_filename";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_file_header_get_utf16_executable_filename(
+	     internal_file->file_header,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the prefetch hash
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_prefetch_hash(
+     libscca_file_t *file,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_prefetch_hash";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	*prefetch_hash = internal_file->file_header->prefetch_hash;
+
+	return( 1 );
+}
+
+/* Retrieves a specific last run time
+ * The timestamp is a 64-bit FILETIME date and time value
+ * Files of format version 23 and earlier contain a single last run time
+ * Files of format version 26 and later contain up to 8 last run times
+ * A value if 0 means the last run time is not set
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_last_run_time(
+     libscca_file_t *file,
+     int last_run_time_index,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_last_run_time";
+	int number_of_last_run_times           = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->format_version < 26 )
+	{
+		number_of_last_run_times = 1;
+	}
+	else
+	{
+		number_of_last_run_times = 8;
+	}
+	if( ( last_run_time_index < 0 )
+	 || ( last_run_time_index >= number_of_last_run_times ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid last run time index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetime.",
+		 function );
+
+		return( -1 );
+	}
+	*filetime = internal_file->file_information->last_run_time[ last_run_time_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the run count
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_run_count(
+     libscca_file_t *file,
+     uint32_t *run_count,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_run_count";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run count.",
+		 function );
+
+		return( -1 );
+	}
+	*run_count = internal_file->file_information->run_count;
+
+	return( 1 );
+}
+
+/* Retrieves the number of file metrics entries
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_number_of_file_metrics_entries(
+     libscca_file_t *file,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_number_of_file_metrics_entries";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->file_metrics_array,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific file metrics entry
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_file_metrics_entry(
+     libscca_file_t *file,
+     int entry_index,
+     libscca_file_metrics_t **file_metrics,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_file_metrics_entry";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->file_metrics_array,
+	     entry_index,
+	     (intptr_t **) file_metrics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file metrics entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the values of the file metrics entries as columns
+ * Every column is optional (NULL) and, when set, must contain number of entries values
+ * A file reference is 0 if not set and a filename index is -1 if the entry does not refer to a filename string
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_file_metrics_columns(
+     libscca_file_t *file,
+     int number_of_entries,
+     uint32_t *start_times,
+     uint32_t *durations,
+     uint32_t *flags,
+     uint64_t *file_references,
+     int32_t *filename_indexes,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_metrics_t *internal_file_metrics = NULL;
+	libscca_internal_file_t *internal_file                 = NULL;
+	static char *function                                  = "libscca_file_get_file_metrics_columns";
+	int entry_index                                        = 0;
+	int filename_index                                     = 0;
+	int number_of_file_metrics_entries                     = 0;
+	int result                                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->file_metrics_array,
+	     &number_of_file_metrics_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries != number_of_file_metrics_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->file_metrics_array,
+		     entry_index,
+		     (intptr_t **) &internal_file_metrics,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid filename strings offset value out of bounds.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry: %d.",
+			 function,
+			 entry_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( internal_file->file_information->filename_strings_size > ( next_offset - internal_file->file_information->filename_strings_offset ) )
+		if( internal_file_metrics == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid filename strings size value out of bounds.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing file metrics entry: %d.",
+			 function,
+			 entry_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libscca_filename_strings_read_stream(
-		     internal_file->filename_strings,
-		     internal_file->uncompressed_data_stream,
-		     file_io_handle,
-		     internal_file->file_information->filename_strings_offset,
-		     internal_file->file_information->filename_strings_size,
-		     error ) != 1 )
+		if( start_times != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read filename strings from stream.",
-			 function );
-
-			goto on_error;
+			start_times[ entry_index ] = internal_file_metrics->start_time;
 		}
-		if( libfdata_stream_get_offset(
-		     internal_file->uncompressed_data_stream,
-		     &file_offset,
-		     error ) != 1 )
+		if( durations != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve uncompressed data stream current offset.",
-			 function );
-
-			goto on_error;
+			durations[ entry_index ] = internal_file_metrics->duration;
 		}
-	}
-	if( internal_file->file_information->volumes_information_offset != 0 )
-	{
-		if( ( internal_file->file_information->volumes_information_offset < file_offset )
-		 || ( internal_file->file_information->volumes_information_offset > file_size ) )
+		if( flags != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid volumes information offset value out of bounds.",
-			 function );
-
-			goto on_error;
+			flags[ entry_index ] = internal_file_metrics->flags;
 		}
-		if( internal_file->file_information->volumes_information_size > ( file_size - internal_file->file_information->volumes_information_offset ) )
+		if( file_references != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid volumes information size value out of bounds.",
-			 function );
-
-			goto on_error;
+			if( internal_file_metrics->file_reference_is_set != 0 )
+			{
+				file_references[ entry_index ] = internal_file_metrics->file_reference;
+			}
+			else
+			{
+				file_references[ entry_index ] = 0;
+			}
 		}
-		if( libscca_io_handle_read_volumes_information(
-		     internal_file->io_handle,
-		     internal_file->uncompressed_data_stream,
-		     internal_file->file_io_handle,
-		     internal_file->file_information->volumes_information_offset,
-		     internal_file->file_information->volumes_information_size,
-		     internal_file->file_information->number_of_volumes,
-		     internal_file->volumes_array,
-		     error ) != 1 )
+		if( filename_indexes != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read volumes information.",
-			 function );
+			result = libscca_filename_strings_get_index_by_offset(
+			          internal_file_metrics->filename_strings,
+			          internal_file_metrics->filename_string_offset,
+			          &filename_index,
+			          error );
 
-			goto on_error;
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve filename index of file metrics entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				filename_index = -1;
+			}
+			filename_indexes[ entry_index ] = (int32_t) filename_index;
 		}
 	}
 	return( 1 );
+}
 
-on_error:
-	if( internal_file->file_information != NULL )
-	{
-		libscca_file_information_free(
-		 &( internal_file->file_information ),
-		 NULL );
-	}
-	if( internal_file->file_header != NULL )
+/* Retrieves the number of filenames
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_number_of_filenames(
+     libscca_file_t *file,
+     int *number_of_filenames,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_number_of_filenames";
+
+	if( file == NULL )
 	{
-		libscca_file_header_free(
-		 &( internal_file->file_header ),
-		 NULL );
-	}
-	libcdata_array_empty(
-	 internal_file->file_metrics_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_file_metrics_free,
-	 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-	libscca_filename_strings_clear(
-	 internal_file->filename_strings,
-	 NULL );
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
 
-	libcdata_array_empty(
-	 internal_file->volumes_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_volume_information_free,
-	 NULL );
+	if( libscca_filename_strings_get_number_of_filenames(
+	     internal_file->filename_strings,
+	     number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filename strings.",
+		 function );
 
-	return( -1 );
+		return( -1 );
+	}
+	return( 1 );
 }
 
-/* Retrieves the format version
+/* Retrieves the size of a specific UTF-8 encoded filename
+ * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
+ * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_format_version(
+int libscca_file_get_utf8_filename_size(
      libscca_file_t *file,
-     uint32_t *format_version,
+     int filename_index,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_format_version";
+	static char *function                  = "libscca_file_get_utf8_filename_size";
 
 	if( file == NULL )
 	{
@@ -1592,45 +3095,86 @@ int libscca_file_get_format_version(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( libscca_filename_strings_get_utf8_filename_size(
+	     internal_file->filename_strings,
+	     filename_index,
+	     utf8_string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal file - missing IO handle.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename: %d UTF-8 string size.",
+		 function,
+		 filename_index );
 
 		return( -1 );
 	}
-	if( format_version == NULL )
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded filename
+ * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf8_filename(
+     libscca_file_t *file,
+     int filename_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf8_filename";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format version.",
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	*format_version = internal_file->io_handle->format_version;
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_filename_strings_get_utf8_filename(
+	     internal_file->filename_strings,
+	     filename_index,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename: %d to UTF-8 string.",
+		 function,
+		 filename_index );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
-/* Retrieves the size of a specific UTF-8 encoded executable filename
- * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
+/* Retrieves the size of a specific UTF-16 encoded filename
+ * This function uses UCS-2 (with surrogates) to support characters outside Unicode
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_utf8_executable_filename_size(
+int libscca_file_get_utf16_filename_size(
      libscca_file_t *file,
-     size_t *utf8_string_size,
+     int filename_index,
+     size_t *utf16_string_size,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf8_executable_filename_size";
+	static char *function                  = "libscca_file_get_utf16_filename_size";
 
 	if( file == NULL )
 	{
@@ -1645,36 +3189,39 @@ int libscca_file_get_utf8_executable_filename_size(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( libscca_file_header_get_utf8_executable_filename_size(
-	     internal_file->file_header,
-	     utf8_string_size,
+	if( libscca_filename_strings_get_utf16_filename_size(
+	     internal_file->filename_strings,
+	     filename_index,
+	     utf16_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 executable filename size.",
-		 function );
+		 "%s: unable to retrieve filename: %d UTF-16 string size.",
+		 function,
+		 filename_index );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves a specific UTF-8 encoded executable filename
- * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
+/* Retrieves a specific UTF-16 encoded filename
+ * This function uses UCS-2 (with surrogates) to support characters outside Unicode
  * The size should include the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_utf8_executable_filename(
+int libscca_file_get_utf16_filename(
      libscca_file_t *file,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     int filename_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf8_executable_filename";
+	static char *function                  = "libscca_file_get_utf16_filename";
 
 	if( file == NULL )
 	{
@@ -1689,36 +3236,36 @@ int libscca_file_get_utf8_executable_filename(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( libscca_file_header_get_utf8_executable_filename(
-	     internal_file->file_header,
-	     utf8_string,
-	     utf8_string_size,
+	if( libscca_filename_strings_get_utf16_filename(
+	     internal_file->filename_strings,
+	     filename_index,
+	     utf16_string,
+	     utf16_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 executable filename.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename: %d to UTF-16 string.",
+		 function,
+		 filename_index );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves the size of a specific UTF-16 encoded executable filename
- * This function uses UCS-2 (with surrogates) to support characters outside Unicode
- * The returned size includes the end of string character
+/* Retrieves the number of volumes
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_utf16_executable_filename_size(
+int libscca_file_get_number_of_volumes(
      libscca_file_t *file,
-     size_t *utf16_string_size,
+     int *number_of_volumes,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf16_executable_filename_size";
+	static char *function                  = "libscca_file_get_number_of_volumes";
 
 	if( file == NULL )
 	{
@@ -1733,16 +3280,16 @@ int libscca_file_get_utf16_executable_filename_size(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( libscca_file_header_get_utf16_executable_filename_size(
-	     internal_file->file_header,
-	     utf16_string_size,
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->volumes_array,
+	     number_of_volumes,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 executable filename size.",
+		 "%s: unable to retrieve number of volumes.",
 		 function );
 
 		return( -1 );
@@ -1750,19 +3297,17 @@ int libscca_file_get_utf16_executable_filename_size(
 	return( 1 );
 }
 
-/* Retrieves a specific UTF-16 encoded executable filename
- * This function uses UCS-2 (with surrogates) to support characters outside Unicode
- * The size should include the end of string character
+/* Retrieves a specific volume information
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_utf16_executable_filename(
+int libscca_file_get_volume_information(
      libscca_file_t *file,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     int volume_index,
+     libscca_volume_information_t **volume_information,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf16_executable_filename";
+	static char *function                  = "libscca_file_get_volume_information";
 
 	if( file == NULL )
 	{
@@ -1777,34 +3322,36 @@ int libscca_file_get_utf16_executable_filename(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( libscca_file_header_get_utf16_executable_filename(
-	     internal_file->file_header,
-	     utf16_string,
-	     utf16_string_size,
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->volumes_array,
+	     volume_index,
+	     (intptr_t **) volume_information,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 executable filename.",
-		 function );
+		 "%s: unable to retrieve volume: %d information.",
+		 function,
+		 volume_index );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves the prefetch hash
+/* Retrieves the size of the uncompressed data
+ * For a compressed file this is the size of the decompressed data
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_prefetch_hash(
+int libscca_file_get_uncompressed_data_size(
      libscca_file_t *file,
-     uint32_t *prefetch_hash,
+     size64_t *data_size,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_prefetch_hash";
+	static char *function                  = "libscca_file_get_uncompressed_data_size";
 
 	if( file == NULL )
 	{
@@ -1819,49 +3366,52 @@ int libscca_file_get_prefetch_hash(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( internal_file->file_header == NULL )
+	/* A file opened from a snapshot has no uncompressed data stream
+	 */
+	if( internal_file->uncompressed_data_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal file - missing file header.",
+		 "%s: invalid file - missing uncompressed data stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( prefetch_hash == NULL )
+	if( libfdata_stream_get_size(
+	     internal_file->uncompressed_data_stream,
+	     data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid prefetch hash.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data stream size.",
 		 function );
 
 		return( -1 );
 	}
-	*prefetch_hash = internal_file->file_header->prefetch_hash;
-
 	return( 1 );
 }
 
-/* Retrieves a specific last run time
- * The timestamp is a 64-bit FILETIME date and time value
- * Files of format version 23 and earlier contain a single last run time
- * Files of format version 26 and later contain up to 8 last run times
- * A value if 0 means the last run time is not set
- * Returns 1 if successful or -1 on error
+/* Reads uncompressed data at a specific offset
+ * For a compressed file the data is decompressed on demand
+ * Returns the number of bytes read, 0 if the offset is beyond the end of the data or -1 on error
  */
-int libscca_file_get_last_run_time(
-     libscca_file_t *file,
-     int last_run_time_index,
-     uint64_t *filetime,
-     libcerror_error_t **error )
+ssize_t libscca_file_read_uncompressed_data(
+         libscca_file_t *file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_last_run_time";
-	int number_of_last_run_times           = 0;
+	static char *function                  = "libscca_file_read_uncompressed_data";
+	size64_t data_size                     = 0;
+	size_t read_size                       = 0;
+	ssize_t read_count                     = 0;
 
 	if( file == NULL )
 	{
@@ -1876,125 +3426,107 @@ int libscca_file_get_last_run_time(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->file_information == NULL )
+	if( buffer_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal file - missing file information.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->io_handle->format_version < 26 )
-	{
-		number_of_last_run_times = 1;
-	}
-	else
-	{
-		number_of_last_run_times = 8;
-	}
-	if( ( last_run_time_index < 0 )
-	 || ( last_run_time_index >= number_of_last_run_times ) )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid last run time index value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( filetime == NULL )
+	if( libscca_file_get_uncompressed_data_size(
+	     file,
+	     &data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filetime.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data size.",
 		 function );
 
 		return( -1 );
 	}
-	*filetime = internal_file->file_information->last_run_time[ last_run_time_index ];
-
-	return( 1 );
-}
-
-/* Retrieves the run count
- * Returns 1 if successful or -1 on error
- */
-int libscca_file_get_run_count(
-     libscca_file_t *file,
-     uint32_t *run_count,
-     libcerror_error_t **error )
-{
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_run_count";
-
-	if( file == NULL )
+	if( (size64_t) offset >= data_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
-
-		return( -1 );
+		return( 0 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
+	read_size = buffer_size;
 
-	if( internal_file->file_information == NULL )
+	if( (size64_t) read_size > ( data_size - (size64_t) offset ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal file - missing file information.",
-		 function );
-
-		return( -1 );
+		read_size = (size_t) ( data_size - (size64_t) offset );
 	}
-	if( run_count == NULL )
+	if( read_size == 0 )
+	{
+		return( 0 );
+	}
+	read_count = libfdata_stream_read_buffer_at_offset(
+	              internal_file->uncompressed_data_stream,
+	              (intptr_t *) internal_file->file_io_handle,
+	              buffer,
+	              read_size,
+	              offset,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid run count.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read uncompressed data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
 
 		return( -1 );
 	}
-	*run_count = internal_file->file_information->run_count;
-
-	return( 1 );
+	return( read_count );
 }
 
-/* Retrieves the number of file metrics entries
+/* Retrieves the uncompressed data
+ * The data is read once and remains owned by the file, it is valid until the file is closed
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_number_of_file_metrics_entries(
+int libscca_file_get_uncompressed_data(
      libscca_file_t *file,
-     int *number_of_entries,
+     const uint8_t **data,
+     size_t *data_size,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_number_of_file_metrics_entries";
+	uint8_t *uncompressed_data             = NULL;
+	static char *function                  = "libscca_file_get_uncompressed_data";
+	size64_t uncompressed_data_size        = 0;
+	ssize_t read_count                     = 0;
 
 	if( file == NULL )
 	{
@@ -2009,77 +3541,143 @@ int libscca_file_get_number_of_file_metrics_entries(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->file_metrics_array,
-	     number_of_entries,
-	     error ) != 1 )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of file metrics entries.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a specific file metrics entry
- * Returns 1 if successful or -1 on error
- */
-int libscca_file_get_file_metrics_entry(
-     libscca_file_t *file,
-     int entry_index,
-     libscca_file_metrics_t **file_metrics,
-     libcerror_error_t **error )
-{
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_file_metrics_entry";
-
-	if( file == NULL )
+	if( data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid data size.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
-
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->file_metrics_array,
-	     entry_index,
-	     (intptr_t **) file_metrics,
-	     error ) != 1 )
+	if( internal_file->uncompressed_data == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file metrics entry: %d.",
-		 function,
-		 entry_index );
+		if( libscca_file_get_uncompressed_data_size(
+		     file,
+		     &uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve uncompressed data size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( uncompressed_data_size == 0 )
+		 || ( uncompressed_data_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid uncompressed data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_io_handle_reserve_memory(
+		     internal_file->io_handle,
+		     (size_t) uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to reserve memory for uncompressed data.",
+			 function );
+
+			goto on_error;
+		}
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * (size_t) uncompressed_data_size );
+
+		if( uncompressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create uncompressed data.",
+			 function );
+
+			libscca_io_handle_release_memory(
+			 internal_file->io_handle,
+			 (size_t) uncompressed_data_size,
+			 NULL );
+
+			goto on_error;
+		}
+		read_count = libscca_file_read_uncompressed_data(
+		              file,
+		              uncompressed_data,
+		              (size_t) uncompressed_data_size,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) uncompressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read uncompressed data.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
+		internal_file->uncompressed_data      = uncompressed_data;
+		internal_file->uncompressed_data_size = (size_t) uncompressed_data_size;
 	}
+	*data      = internal_file->uncompressed_data;
+	*data_size = internal_file->uncompressed_data_size;
+
 	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+
+		libscca_io_handle_release_memory(
+		 internal_file->io_handle,
+		 (size_t) uncompressed_data_size,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the number of filenames
- * Returns 1 if successful or -1 on error
+/* Visits the contents of the file
+ * The uncompressed data is walked once and the visitor callbacks are invoked with borrowed pointers into the data
+ * Returns 1 if successful, 0 if a callback stopped visiting or -1 on error
  */
-int libscca_file_get_number_of_filenames(
+int libscca_file_visit(
      libscca_file_t *file,
-     int *number_of_filenames,
+     const libscca_file_visitor_t *visitor,
+     intptr_t *user_data,
      libcerror_error_t **error )
 {
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_number_of_filenames";
+	const uint8_t *data   = NULL;
+	static char *function = "libscca_file_visit";
+	size_t data_size      = 0;
+	int result            = 0;
 
 	if( file == NULL )
 	{
@@ -2092,179 +3690,274 @@ int libscca_file_get_number_of_filenames(
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
-
-	if( libscca_filename_strings_get_number_of_filenames(
-	     internal_file->filename_strings,
-	     number_of_filenames,
-	     error ) != 1 )
+	if( visitor == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of filename strings.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves the size of a specific UTF-8 encoded filename
- * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libscca_file_get_utf8_filename_size(
-     libscca_file_t *file,
-     int filename_index,
-     size_t *utf8_string_size,
-     libcerror_error_t **error )
-{
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf8_filename_size";
-
-	if( file == NULL )
+	if( libscca_file_get_uncompressed_data(
+	     file,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
+	result = libscca_file_visitor_visit_data(
+	          visitor,
+	          user_data,
+	          data,
+	          data_size,
+	          error );
 
-	if( libscca_filename_strings_get_utf8_filename_size(
-	     internal_file->filename_strings,
-	     filename_index,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve filename: %d UTF-8 string size.",
-		 function,
-		 filename_index );
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to visit uncompressed data.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves a specific UTF-8 encoded filename
- * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
+/* Validates the layout of the sections of a file without allocating memory
+ * The data contains the (uncompressed) file header followed by the file information
+ * The uncompressed data size is the size of the (uncompressed) file, which must match
+ * the file size in the file header
+ * The sections must follow the file information in the order: file metrics array,
+ * trace chain array, filename strings and volumes information, without overlap
+ * and the number of entries must fit in their section
+ * Returns 1 if the layout is valid, 0 if not or -1 on error
  */
-int libscca_file_get_utf8_filename(
-     libscca_file_t *file,
-     int filename_index,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+int libscca_file_validate_layout(
+     const uint8_t *data,
+     size_t data_size,
+     size64_t uncompressed_data_size,
      libcerror_error_t **error )
 {
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf8_filename";
+	libscca_file_header_t file_header;
+	libscca_file_information_t file_information;
+	libscca_io_handle_t io_handle;
 
-	if( file == NULL )
+	static char *function             = "libscca_file_validate_layout";
+	size_t file_information_data_size = 0;
+	size_t file_metrics_entry_size    = 0;
+	size_t trace_chain_entry_size     = 0;
+	size_t volume_information_size    = 0;
+	uint64_t section_end_offset       = 0;
+	uint64_t section_offset           = 0;
+
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
-
-	if( libscca_filename_strings_get_utf8_filename(
-	     internal_file->filename_strings,
-	     filename_index,
-	     utf8_string,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy filename: %d to UTF-8 string.",
-		 function,
-		 filename_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves the size of a specific UTF-16 encoded filename
- * This function uses UCS-2 (with surrogates) to support characters outside Unicode
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libscca_file_get_utf16_filename_size(
-     libscca_file_t *file,
-     int filename_index,
-     size_t *utf16_string_size,
-     libcerror_error_t **error )
-{
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf16_filename_size";
-
-	if( file == NULL )
+	if( data_size < sizeof( scca_file_header_t ) )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     &file_header,
+	     0,
+	     sizeof( libscca_file_header_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
+	if( memory_set(
+	     &file_information,
+	     0,
+	     sizeof( libscca_file_information_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file information.",
+		 function );
 
-	if( libscca_filename_strings_get_utf16_filename_size(
-	     internal_file->filename_strings,
-	     filename_index,
-	     utf16_string_size,
-	     error ) != 1 )
+		return( -1 );
+	}
+	if( memory_set(
+	     &io_handle,
+	     0,
+	     sizeof( libscca_io_handle_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve filename: %d UTF-16 string size.",
-		 function,
-		 filename_index );
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
 
 		return( -1 );
 	}
+	/* A layout that cannot be read is not valid, hence the errors are not retained
+	 */
+	if( libscca_file_header_read_data(
+	     &file_header,
+	     data,
+	     data_size,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( (size64_t) file_header.file_size != uncompressed_data_size )
+	{
+		return( 0 );
+	}
+	io_handle.format_version = file_header.format_version;
+
+	if( libscca_file_information_read_data(
+	     &file_information,
+	     &io_handle,
+	     &( data[ sizeof( scca_file_header_t ) ] ),
+	     data_size - sizeof( scca_file_header_t ),
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( file_header.format_version == 17 )
+	{
+		file_information_data_size = sizeof( scca_file_information_v17_t );
+		file_metrics_entry_size    = sizeof( scca_file_metrics_array_entry_v17_t );
+		trace_chain_entry_size     = sizeof( scca_trace_chain_array_entry_v17_t );
+		volume_information_size    = sizeof( scca_volume_information_v17_t );
+	}
+	else if( file_header.format_version == 23 )
+	{
+		file_information_data_size = sizeof( scca_file_information_v23_t );
+		file_metrics_entry_size    = sizeof( scca_file_metrics_array_entry_v23_t );
+		trace_chain_entry_size     = sizeof( scca_trace_chain_array_entry_v17_t );
+		volume_information_size    = sizeof( scca_volume_information_v23_t );
+	}
+	else if( file_header.format_version == 26 )
+	{
+		file_information_data_size = sizeof( scca_file_information_v26_t );
+		file_metrics_entry_size    = sizeof( scca_file_metrics_array_entry_v23_t );
+		trace_chain_entry_size     = sizeof( scca_trace_chain_array_entry_v17_t );
+		volume_information_size    = sizeof( scca_volume_information_v23_t );
+	}
+	else
+	{
+		if( ( file_header.format_version == 30 )
+		 && ( file_information.metrics_array_offset == 0x00000130 ) )
+		{
+			file_information_data_size = sizeof( scca_file_information_v26_t );
+		}
+		else
+		{
+			file_information_data_size = sizeof( scca_file_information_v30_2_t );
+		}
+		file_metrics_entry_size = sizeof( scca_file_metrics_array_entry_v23_t );
+		trace_chain_entry_size  = sizeof( scca_trace_chain_array_entry_v30_t );
+		volume_information_size = sizeof( scca_volume_information_v30_t );
+	}
+	/* Allow for a margin of 8 + 4 bytes for version 30 variant 2
+	 */
+	section_end_offset = (uint64_t) ( sizeof( scca_file_header_t ) + file_information_data_size - 12 );
+
+	if( file_information.metrics_array_offset != 0 )
+	{
+		section_offset = (uint64_t) file_information.metrics_array_offset;
+
+		if( section_offset < section_end_offset )
+		{
+			return( 0 );
+		}
+		section_end_offset = section_offset + ( (uint64_t) file_information.number_of_file_metrics_entries * file_metrics_entry_size );
+	}
+	if( file_information.trace_chain_array_offset != 0 )
+	{
+		section_offset = (uint64_t) file_information.trace_chain_array_offset;
+
+		if( section_offset < section_end_offset )
+		{
+			return( 0 );
+		}
+		section_end_offset = section_offset + ( (uint64_t) file_information.number_of_trace_chain_array_entries * trace_chain_entry_size );
+	}
+	if( file_information.filename_strings_offset != 0 )
+	{
+		section_offset = (uint64_t) file_information.filename_strings_offset;
+
+		if( section_offset < section_end_offset )
+		{
+			return( 0 );
+		}
+		section_end_offset = section_offset + file_information.filename_strings_size;
+	}
+	if( file_information.volumes_information_offset != 0 )
+	{
+		section_offset = (uint64_t) file_information.volumes_information_offset;
+
+		if( section_offset < section_end_offset )
+		{
+			return( 0 );
+		}
+		if( ( (uint64_t) file_information.number_of_volumes * volume_information_size ) > (uint64_t) file_information.volumes_information_size )
+		{
+			return( 0 );
+		}
+		section_end_offset = section_offset + file_information.volumes_information_size;
+	}
+	if( section_end_offset > (uint64_t) file_header.file_size )
+	{
+		return( 0 );
+	}
 	return( 1 );
 }
 
-/* Retrieves a specific UTF-16 encoded filename
- * This function uses UCS-2 (with surrogates) to support characters outside Unicode
- * The size should include the end of string character
+/* Retrieves the size of the snapshot of the file
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_utf16_filename(
+int libscca_file_get_snapshot_size(
      libscca_file_t *file,
-     int filename_index,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     size_t *snapshot_size,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf16_filename";
+	static char *function                  = "libscca_file_get_snapshot_size";
 
 	if( file == NULL )
 	{
@@ -2279,36 +3972,36 @@ int libscca_file_get_utf16_filename(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( libscca_filename_strings_get_utf16_filename(
-	     internal_file->filename_strings,
-	     filename_index,
-	     utf16_string,
-	     utf16_string_size,
+	if( libscca_snapshot_get_data_size(
+	     internal_file,
+	     snapshot_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy filename: %d to UTF-16 string.",
-		 function,
-		 filename_index );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve snapshot size.",
+		 function );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves the number of volumes
+/* Exports the parsed file into a snapshot
+ * The snapshot is a flat, versioned representation of the file that can be
+ * opened with libscca_file_open_snapshot without decompressing the file
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_number_of_volumes(
+int libscca_file_export_snapshot(
      libscca_file_t *file,
-     int *number_of_volumes,
+     uint8_t *snapshot_data,
+     size_t snapshot_data_size,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_number_of_volumes";
+	static char *function                  = "libscca_file_export_snapshot";
 
 	if( file == NULL )
 	{
@@ -2323,16 +4016,17 @@ int libscca_file_get_number_of_volumes(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->volumes_array,
-	     number_of_volumes,
+	if( libscca_snapshot_write_data(
+	     internal_file,
+	     snapshot_data,
+	     snapshot_data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of volumes.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write snapshot.",
 		 function );
 
 		return( -1 );
@@ -2340,17 +4034,18 @@ int libscca_file_get_number_of_volumes(
 	return( 1 );
 }
 
-/* Retrieves a specific volume information
+/* Opens a file from a snapshot
+ * The snapshot data is copied and can be freed or unmapped after the call
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_volume_information(
+int libscca_file_open_snapshot(
      libscca_file_t *file,
-     int volume_index,
-     libscca_volume_information_t **volume_information,
+     const uint8_t *snapshot_data,
+     size_t snapshot_data_size,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_volume_information";
+	static char *function                  = "libscca_file_open_snapshot";
 
 	if( file == NULL )
 	{
@@ -2365,19 +4060,30 @@ int libscca_file_get_volume_information(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->volumes_array,
-	     volume_index,
-	     (intptr_t **) volume_information,
-	     error ) != 1 )
+	if( ( internal_file->file_io_handle != NULL )
+	 || ( internal_file->file_header != NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve volume: %d information.",
-		 function,
-		 volume_index );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_snapshot_read_data(
+	     internal_file,
+	     snapshot_data,
+	     snapshot_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read snapshot.",
+		 function );
 
 		return( -1 );
 	}
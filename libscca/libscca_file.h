@@ -36,6 +36,7 @@
 #include "libscca_libfcache.h"
 #include "libscca_libfdata.h"
 #include "libscca_libfvalue.h"
+#include "libscca_read_failure.h"
 #include "libscca_types.h"
 
 #if defined( __cplusplus )
@@ -74,6 +75,14 @@ struct libscca_internal_file
 	 */
 	libfdata_stream_t *uncompressed_data_stream;
 
+	/* The uncompressed data, read on demand by libscca_file_get_uncompressed_data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
 	/* The (uncompressed) file header
 	 */
 	libscca_file_header_t *file_header;
@@ -93,6 +102,33 @@ struct libscca_internal_file
 	/* The volumes array
 	 */
 	libcdata_array_t *volumes_array;
+
+	/* The read flags
+	 */
+	uint8_t read_flags;
+
+	/* The section callback, invoked after a section was read when the file is opened
+	 */
+	int (*section_callback)(
+	       libscca_file_t *file,
+	       int section_type,
+	       intptr_t *user_data );
+
+	/* The section callback user data
+	 */
+	intptr_t *section_callback_user_data;
+
+	/* The error mode
+	 */
+	uint8_t error_mode;
+
+	/* The read failure recorded when the file was opened
+	 */
+	libscca_read_failure_t read_failure;
+
+	/* The type of the section that failed to read
+	 */
+	int read_failure_section_type;
 };
 
 LIBSCCA_EXTERN \
@@ -110,6 +146,55 @@ int libscca_file_signal_abort(
      libscca_file_t *file,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_file_set_read_flags(
+     libscca_file_t *file,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_set_error_mode(
+     libscca_file_t *file,
+     uint8_t error_mode,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_read_failure(
+     libscca_file_t *file,
+     int *section_type,
+     int *error_domain,
+     int *error_code,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_set_section_callback(
+     libscca_file_t *file,
+     int (*section_callback)(
+            libscca_file_t *file,
+            int section_type,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_set_maximum_memory_size(
+     libscca_file_t *file,
+     size_t maximum_memory_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_memory_size(
+     libscca_file_t *file,
+     size_t *memory_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_set_mam_decoder(
+     libscca_file_t *file,
+     libscca_mam_decoder_t *mam_decoder,
+     libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_file_open(
      libscca_file_t *file,
@@ -143,6 +228,11 @@ int libscca_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libscca_internal_file_section_read(
+     libscca_internal_file_t *internal_file,
+     int section_type,
+     libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_file_get_format_version(
      libscca_file_t *file,
@@ -207,6 +297,17 @@ int libscca_file_get_file_metrics_entry(
      libscca_file_metrics_t **file_metrics,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_file_get_file_metrics_columns(
+     libscca_file_t *file,
+     int number_of_entries,
+     uint32_t *start_times,
+     uint32_t *durations,
+     uint32_t *flags,
+     uint64_t *file_references,
+     int32_t *filename_indexes,
+     libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_file_get_number_of_filenames(
      libscca_file_t *file,
@@ -256,6 +357,61 @@ int libscca_file_get_volume_information(
      libscca_volume_information_t **volume_information,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_file_get_uncompressed_data_size(
+     libscca_file_t *file,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+ssize_t libscca_file_read_uncompressed_data(
+     libscca_file_t *file,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_uncompressed_data(
+     libscca_file_t *file,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_visit(
+     libscca_file_t *file,
+     const libscca_file_visitor_t *visitor,
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_validate_layout(
+     const uint8_t *data,
+     size_t data_size,
+     size64_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_snapshot_size(
+     libscca_file_t *file,
+     size_t *snapshot_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_export_snapshot(
+     libscca_file_t *file,
+     uint8_t *snapshot_data,
+     size_t snapshot_data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_open_snapshot(
+     libscca_file_t *file,
+     const uint8_t *snapshot_data,
+     size_t snapshot_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
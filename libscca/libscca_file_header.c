@@ -32,6 +32,7 @@
 #include "libscca_libcnotify.h"
 #include "libscca_libfdata.h"
 #include "libscca_libuna.h"
+#include "libscca_read_failure.h"
 
 #include "scca_file_header.h"
 
@@ -323,6 +324,7 @@ int libscca_file_header_read_data_stream(
      libscca_file_header_t *file_header,
      libfdata_stream_t *data_stream,
      libbfio_handle_t *file_io_handle,
+     libscca_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
 	uint8_t file_header_data[ sizeof( scca_file_header_t ) ];
@@ -341,6 +343,17 @@ int libscca_file_header_read_data_stream(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -367,6 +380,13 @@ int libscca_file_header_read_data_stream(
 		 "%s: unable to read file header data at offset: 0 (0x00000000).",
 		 function );
 
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 0,
+		 NULL );
+
 		return( -1 );
 	}
 	if( libscca_file_header_read_data(
@@ -382,6 +402,15 @@ int libscca_file_header_read_data_stream(
 		 "%s: unable to read file header.",
 		 function );
 
+		/* The signature is the only value of the data that is validated
+		 */
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 0,
+		 NULL );
+
 		return( -1 );
 	}
 	return( 1 );
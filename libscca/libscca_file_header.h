@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libscca_io_handle.h"
 #include "libscca_libbfio.h"
 #include "libscca_libcerror.h"
 #include "libscca_libfdata.h"
@@ -76,6 +77,7 @@ int libscca_file_header_read_data_stream(
      libscca_file_header_t *file_header,
      libfdata_stream_t *data_stream,
      libbfio_handle_t *file_io_handle,
+     libscca_io_handle_t *io_handle,
      libcerror_error_t **error );
 
 int libscca_file_header_get_utf8_executable_filename_size(
@@ -33,6 +33,7 @@
 #include "libscca_libcnotify.h"
 #include "libscca_libfdata.h"
 #include "libscca_libfdatetime.h"
+#include "libscca_read_failure.h"
 
 #include "scca_file_information.h"
 
@@ -712,6 +713,7 @@ int libscca_file_information_read_stream(
 	static char *function             = "libscca_file_information_read_stream";
 	size_t file_information_data_size = 0;
 	ssize_t read_count                = 0;
+	off64_t file_offset               = 0;
 
 	if( file_information == NULL )
 	{
@@ -735,6 +737,20 @@ int libscca_file_information_read_stream(
 
 		return( -1 );
 	}
+	if( libfdata_stream_get_offset(
+	     uncompressed_data_stream,
+	     &file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data stream current offset.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( io_handle->format_version != 17 )
 	 && ( io_handle->format_version != 23 )
 	 && ( io_handle->format_version != 26 )
@@ -748,6 +764,13 @@ int libscca_file_information_read_stream(
 		 "%s: invalid IO handle - unsupported format version.",
 		 function );
 
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 file_offset,
+		 NULL );
+
 		return( -1 );
 	}
 	if( io_handle->format_version == 17 )
@@ -795,6 +818,13 @@ int libscca_file_information_read_stream(
 		 "%s: unable to read file information data.",
 		 function );
 
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 file_offset,
+		 NULL );
+
 		goto on_error;
 	}
 	if( libscca_file_information_read_data(
@@ -811,6 +841,15 @@ int libscca_file_information_read_stream(
 		 "%s: unable to read file information data.",
 		 function );
 
+		/* The format version 30 variant is the only value of the data that is validated
+		 */
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 file_offset,
+		 NULL );
+
 		goto on_error;
 	}
 	memory_free(
@@ -0,0 +1,1049 @@
+/*
+ * File visitor functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_file_header.h"
+#include "libscca_file_information.h"
+#include "libscca_file_visitor.h"
+#include "libscca_io_handle.h"
+#include "libscca_libcerror.h"
+
+#include "scca_file_header.h"
+#include "scca_file_metrics_array.h"
+#include "scca_volume_information.h"
+
+/* Visits the entries of the file metrics array
+ * Returns 1 if successful, 0 if a callback stopped visiting or -1 on error
+ */
+int libscca_file_visitor_visit_file_metrics_array(
+     const libscca_file_visitor_t *visitor,
+     intptr_t *user_data,
+     uint32_t format_version,
+     libscca_file_information_t *file_information,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data            = NULL;
+	const uint8_t *filename_strings_data = NULL;
+	const uint8_t *utf16_filename        = NULL;
+	static char *function                = "libscca_file_visitor_visit_file_metrics_array";
+	size_t entry_data_size               = 0;
+	size_t filename_strings_data_size    = 0;
+	size_t utf16_filename_size           = 0;
+	uint64_t file_reference              = 0;
+	uint32_t duration                    = 0;
+	uint32_t entry_index                 = 0;
+	uint32_t filename_string_offset      = 0;
+	uint32_t flags                       = 0;
+	uint32_t number_of_characters        = 0;
+	uint32_t start_time                  = 0;
+	int result                           = 0;
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( visitor->on_metrics_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid visitor - missing on_metrics_entry callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == 17 )
+	{
+		entry_data_size = sizeof( scca_file_metrics_array_entry_v17_t );
+	}
+	else if( ( format_version == 23 )
+	      || ( format_version == 26 )
+	      || ( format_version == 30 )
+	      || ( format_version == 31 ) )
+	{
+		entry_data_size = sizeof( scca_file_metrics_array_entry_v23_t );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_information->metrics_array_offset >= data_size )
+	 || ( (size_t) file_information->number_of_file_metrics_entries > ( ( data_size - file_information->metrics_array_offset ) / entry_data_size ) )
+	 || ( file_information->number_of_file_metrics_entries > (uint32_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file metrics array value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The filenames of the entries are resolved in the filename strings without copying them
+	 */
+	if( ( file_information->filename_strings_offset != 0 )
+	 && ( file_information->filename_strings_offset < data_size ) )
+	{
+		filename_strings_data      = &( data[ file_information->filename_strings_offset ] );
+		filename_strings_data_size = data_size - file_information->filename_strings_offset;
+
+		if( filename_strings_data_size > (size_t) file_information->filename_strings_size )
+		{
+			filename_strings_data_size = (size_t) file_information->filename_strings_size;
+		}
+	}
+	entry_data = &( data[ file_information->metrics_array_offset ] );
+
+	for( entry_index = 0;
+	     entry_index < file_information->number_of_file_metrics_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_metrics_array_entry_v17_t *) entry_data )->start_time,
+		 start_time );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_metrics_array_entry_v17_t *) entry_data )->duration,
+		 duration );
+
+		if( format_version == 17 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (scca_file_metrics_array_entry_v17_t *) entry_data )->filename_string_offset,
+			 filename_string_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (scca_file_metrics_array_entry_v17_t *) entry_data )->filename_string_numbers_of_characters,
+			 number_of_characters );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (scca_file_metrics_array_entry_v17_t *) entry_data )->flags,
+			 flags );
+
+			file_reference = 0;
+		}
+		else
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (scca_file_metrics_array_entry_v23_t *) entry_data )->filename_string_offset,
+			 filename_string_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (scca_file_metrics_array_entry_v23_t *) entry_data )->filename_string_numbers_of_characters,
+			 number_of_characters );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (scca_file_metrics_array_entry_v23_t *) entry_data )->flags,
+			 flags );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (scca_file_metrics_array_entry_v23_t *) entry_data )->file_reference,
+			 file_reference );
+		}
+		entry_data += entry_data_size;
+
+		utf16_filename      = NULL;
+		utf16_filename_size = 0;
+
+		if( ( filename_strings_data != NULL )
+		 && ( (size_t) filename_string_offset < filename_strings_data_size )
+		 && ( (size_t) number_of_characters <= ( ( filename_strings_data_size - filename_string_offset ) / 2 ) ) )
+		{
+			utf16_filename      = &( filename_strings_data[ filename_string_offset ] );
+			utf16_filename_size = (size_t) number_of_characters * 2;
+		}
+		result = visitor->on_metrics_entry(
+		          user_data,
+		          (int) entry_index,
+		          start_time,
+		          duration,
+		          flags,
+		          file_reference,
+		          utf16_filename,
+		          utf16_filename_size );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: metrics entry callback failed.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Visits the filename strings
+ * Returns 1 if successful, 0 if a callback stopped visiting or -1 on error
+ */
+int libscca_file_visitor_visit_filename_strings(
+     const libscca_file_visitor_t *visitor,
+     intptr_t *user_data,
+     libscca_file_information_t *file_information,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *filename_strings_data = NULL;
+	static char *function                = "libscca_file_visitor_visit_filename_strings";
+	size_t data_offset                   = 0;
+	size_t filename_strings_data_size    = 0;
+	size_t last_data_offset              = 0;
+	int filename_index                   = 0;
+	int result                           = 0;
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( visitor->on_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid visitor - missing on_filename callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_information->filename_strings_offset >= data_size )
+	 || ( file_information->filename_strings_size < 2 )
+	 || ( (size_t) file_information->filename_strings_size > ( data_size - file_information->filename_strings_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename strings value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	filename_strings_data      = &( data[ file_information->filename_strings_offset ] );
+	filename_strings_data_size = (size_t) file_information->filename_strings_size;
+
+	while( last_data_offset < ( filename_strings_data_size - 1 ) )
+	{
+		for( data_offset = last_data_offset;
+		     data_offset < ( filename_strings_data_size - 1 );
+		     data_offset += 2 )
+		{
+			if( ( filename_strings_data[ data_offset ] == 0 )
+			 && ( filename_strings_data[ data_offset + 1 ] == 0 ) )
+			{
+				break;
+			}
+		}
+		result = visitor->on_filename(
+		          user_data,
+		          filename_index,
+		          &( filename_strings_data[ last_data_offset ] ),
+		          data_offset - last_data_offset );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: filename callback failed.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		/* Skip the end-of-string character
+		 */
+		last_data_offset = data_offset + 2;
+
+		filename_index++;
+	}
+	return( 1 );
+}
+
+/* Visits the volumes information
+ * Returns 1 if successful, 0 if a callback stopped visiting or -1 on error
+ */
+int libscca_file_visitor_visit_volumes_information(
+     const libscca_file_visitor_t *visitor,
+     intptr_t *user_data,
+     uint32_t format_version,
+     libscca_file_information_t *file_information,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *utf16_device_path        = NULL;
+	const uint8_t *volume_information_data  = NULL;
+	const uint8_t *volumes_information_data = NULL;
+	static char *function                   = "libscca_file_visitor_visit_volumes_information";
+	size_t directory_string_offset          = 0;
+	size_t file_reference_offset            = 0;
+	size_t utf16_device_path_size           = 0;
+	size_t volume_information_offset        = 0;
+	size_t volume_information_size          = 0;
+	size_t volumes_information_size         = 0;
+	uint64_t creation_time                  = 0;
+	uint64_t file_reference                 = 0;
+	uint32_t device_path_offset             = 0;
+	uint32_t directory_string_index         = 0;
+	uint32_t directory_strings_array_offset = 0;
+	uint32_t file_reference_index           = 0;
+	uint32_t file_references_offset         = 0;
+	uint32_t file_references_size           = 0;
+	uint32_t number_of_characters           = 0;
+	uint32_t number_of_directory_strings    = 0;
+	uint32_t number_of_file_references      = 0;
+	uint32_t serial_number                  = 0;
+	uint32_t volume_index                   = 0;
+	uint16_t directory_string_size          = 0;
+	int result                              = 0;
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == 17 )
+	{
+		volume_information_size = sizeof( scca_volume_information_v17_t );
+	}
+	else if( ( format_version == 23 )
+	      || ( format_version == 26 ) )
+	{
+		volume_information_size = sizeof( scca_volume_information_v23_t );
+	}
+	else if( ( format_version == 30 )
+	      || ( format_version == 31 ) )
+	{
+		volume_information_size = sizeof( scca_volume_information_v30_t );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_information->volumes_information_offset >= data_size )
+	 || ( (size_t) file_information->volumes_information_size > ( data_size - file_information->volumes_information_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volumes information value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	volumes_information_data = &( data[ file_information->volumes_information_offset ] );
+	volumes_information_size = (size_t) file_information->volumes_information_size;
+
+	if( ( (size_t) file_information->number_of_volumes > ( volumes_information_size / volume_information_size ) )
+	 || ( file_information->number_of_volumes > (uint32_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of volumes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( volume_index = 0;
+	     volume_index < file_information->number_of_volumes;
+	     volume_index++ )
+	{
+		volume_information_data = &( volumes_information_data[ volume_information_offset ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->device_path_offset,
+		 device_path_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->device_path_number_of_characters,
+		 number_of_characters );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->creation_time,
+		 creation_time );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->serial_number,
+		 serial_number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->file_references_offset,
+		 file_references_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->file_references_size,
+		 file_references_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->directory_strings_array_offset,
+		 directory_strings_array_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->number_of_directory_strings,
+		 number_of_directory_strings );
+
+		volume_information_offset += volume_information_size;
+
+		if( visitor->on_volume != NULL )
+		{
+			utf16_device_path      = NULL;
+			utf16_device_path_size = 0;
+
+			if( ( device_path_offset != 0 )
+			 && ( number_of_characters > 0 ) )
+			{
+				if( ( (size_t) device_path_offset >= volumes_information_size )
+				 || ( (size_t) number_of_characters > ( ( volumes_information_size - device_path_offset ) / 2 ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid volume: %" PRIu32 " device path value out of bounds.",
+					 function,
+					 volume_index );
+
+					return( -1 );
+				}
+				utf16_device_path      = &( volumes_information_data[ device_path_offset ] );
+				utf16_device_path_size = (size_t) number_of_characters * 2;
+			}
+			result = visitor->on_volume(
+			          user_data,
+			          (int) volume_index,
+			          creation_time,
+			          serial_number,
+			          utf16_device_path,
+			          utf16_device_path_size );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: volume callback failed.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				return( 0 );
+			}
+		}
+		if( ( visitor->on_file_reference != NULL )
+		 && ( file_references_offset != 0 ) )
+		{
+			if( ( (size_t) file_references_offset >= volumes_information_size )
+			 || ( file_references_size < 8 )
+			 || ( (size_t) file_references_size > ( volumes_information_size - file_references_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume: %" PRIu32 " file references value out of bounds.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( volumes_information_data[ file_references_offset + 4 ] ),
+			 number_of_file_references );
+
+			file_reference_offset = 8;
+
+			/* Format version 23 and later have an additional 8 bytes before the file references
+			 */
+			if( format_version >= 23 )
+			{
+				file_reference_offset += 8;
+			}
+			if( ( file_reference_offset > (size_t) file_references_size )
+			 || ( (size_t) number_of_file_references > ( ( file_references_size - file_reference_offset ) / 8 ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume: %" PRIu32 " number of file references value out of bounds.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			file_reference_offset += file_references_offset;
+
+			for( file_reference_index = 0;
+			     file_reference_index < number_of_file_references;
+			     file_reference_index++ )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( volumes_information_data[ file_reference_offset ] ),
+				 file_reference );
+
+				file_reference_offset += 8;
+
+				result = visitor->on_file_reference(
+				          user_data,
+				          (int) volume_index,
+				          (int) file_reference_index,
+				          file_reference );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: file reference callback failed.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					return( 0 );
+				}
+			}
+		}
+		if( ( visitor->on_directory_string != NULL )
+		 && ( directory_strings_array_offset != 0 ) )
+		{
+			if( (size_t) directory_strings_array_offset >= volumes_information_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume: %" PRIu32 " directory strings array offset value out of bounds.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			directory_string_offset = (size_t) directory_strings_array_offset;
+
+			for( directory_string_index = 0;
+			     directory_string_index < number_of_directory_strings;
+			     directory_string_index++ )
+			{
+				if( directory_string_offset > ( volumes_information_size - 2 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid volume: %" PRIu32 " directory string: %" PRIu32 " offset value out of bounds.",
+					 function,
+					 volume_index,
+					 directory_string_index );
+
+					return( -1 );
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( volumes_information_data[ directory_string_offset ] ),
+				 directory_string_size );
+
+				directory_string_offset += 2;
+
+				/* The number of characters does not include the end-of-string character
+				 */
+				if( (size_t) directory_string_size > ( ( volumes_information_size - directory_string_offset ) / 2 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid volume: %" PRIu32 " directory string: %" PRIu32 " number of characters value out of bounds.",
+					 function,
+					 volume_index,
+					 directory_string_index );
+
+					return( -1 );
+				}
+				result = visitor->on_directory_string(
+				          user_data,
+				          (int) volume_index,
+				          (int) directory_string_index,
+				          &( volumes_information_data[ directory_string_offset ] ),
+				          (size_t) directory_string_size * 2 );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: directory string callback failed.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					return( 0 );
+				}
+				directory_string_offset += ( (size_t) directory_string_size * 2 ) + 2;
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Visits the uncompressed data of a file
+ * The data is walked once and the callbacks are invoked with borrowed pointers into the data
+ * Returns 1 if successful, 0 if a callback stopped visiting or -1 on error
+ */
+int libscca_file_visitor_visit_data(
+     const libscca_file_visitor_t *visitor,
+     intptr_t *user_data,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libscca_file_header_t file_header;
+	libscca_file_information_t file_information;
+	libscca_io_handle_t io_handle;
+
+	static char *function        = "libscca_file_visitor_visit_data";
+	int last_run_time_index      = 0;
+	int number_of_last_run_times = 0;
+	int result                   = 0;
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &file_header,
+	     0,
+	     sizeof( libscca_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &file_information,
+	     0,
+	     sizeof( libscca_file_information_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &io_handle,
+	     0,
+	     sizeof( libscca_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_header_read_data(
+	     &file_header,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle.format_version = file_header.format_version;
+
+	if( libscca_file_information_read_data(
+	     &file_information,
+	     &io_handle,
+	     &( data[ sizeof( scca_file_header_t ) ] ),
+	     data_size - sizeof( scca_file_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( visitor->on_header != NULL )
+	{
+		result = visitor->on_header(
+		          user_data,
+		          file_header.format_version,
+		          file_header.prefetch_hash,
+		          file_information.run_count,
+		          ( (scca_file_header_t *) data )->executable_filename,
+		          file_header.executable_filename_size );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: header callback failed.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( visitor->on_run_time != NULL )
+	{
+		if( file_header.format_version < 26 )
+		{
+			number_of_last_run_times = 1;
+		}
+		else
+		{
+			number_of_last_run_times = 8;
+		}
+		for( last_run_time_index = 0;
+		     last_run_time_index < number_of_last_run_times;
+		     last_run_time_index++ )
+		{
+			result = visitor->on_run_time(
+			          user_data,
+			          last_run_time_index,
+			          file_information.last_run_time[ last_run_time_index ] );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: run time callback failed.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				return( 0 );
+			}
+		}
+	}
+	if( ( visitor->on_metrics_entry != NULL )
+	 && ( file_information.metrics_array_offset != 0 ) )
+	{
+		result = libscca_file_visitor_visit_file_metrics_array(
+		          visitor,
+		          user_data,
+		          file_header.format_version,
+		          &file_information,
+		          data,
+		          data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to visit file metrics array.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( visitor->on_filename != NULL )
+	 && ( file_information.filename_strings_offset != 0 ) )
+	{
+		result = libscca_file_visitor_visit_filename_strings(
+		          visitor,
+		          user_data,
+		          &file_information,
+		          data,
+		          data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to visit filename strings.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( ( visitor->on_volume != NULL )
+	  ||  ( visitor->on_directory_string != NULL )
+	  ||  ( visitor->on_file_reference != NULL ) )
+	 && ( file_information.volumes_information_offset != 0 ) )
+	{
+		result = libscca_file_visitor_visit_volumes_information(
+		          visitor,
+		          user_data,
+		          file_header.format_version,
+		          &file_information,
+		          data,
+		          data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to visit volumes information.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,73 @@
+/*
+ * File visitor functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_FILE_VISITOR_H )
+#define _LIBSCCA_FILE_VISITOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_file_information.h"
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libscca_file_visitor_visit_file_metrics_array(
+     const libscca_file_visitor_t *visitor,
+     intptr_t *user_data,
+     uint32_t format_version,
+     libscca_file_information_t *file_information,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libscca_file_visitor_visit_filename_strings(
+     const libscca_file_visitor_t *visitor,
+     intptr_t *user_data,
+     libscca_file_information_t *file_information,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libscca_file_visitor_visit_volumes_information(
+     const libscca_file_visitor_t *visitor,
+     intptr_t *user_data,
+     uint32_t format_version,
+     libscca_file_information_t *file_information,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libscca_file_visitor_visit_data(
+     const libscca_file_visitor_t *visitor,
+     intptr_t *user_data,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_FILE_VISITOR_H ) */
+
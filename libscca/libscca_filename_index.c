@@ -0,0 +1,987 @@
+/*
+ * Filename index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_filename_index.h"
+#include "libscca_libcerror.h"
+#include "libscca_libuna.h"
+#include "scca_filename_index.h"
+
+const char *libscca_filename_index_signature = "SCCAINDX";
+
+/* Compares an UTF-16 little-endian stored string with an UTF-16 string
+ * Returns -1 if the first string is less than the second, 0 if equal or 1 if greater
+ */
+int libscca_filename_index_compare_utf16_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_length,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length )
+{
+	size_t string_index = 0;
+	uint16_t character  = 0;
+
+	for( string_index = 0;
+	     ( string_index < utf16_stream_length ) && ( string_index < utf16_string_length );
+	     string_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ string_index * 2 ] ),
+		 character );
+
+		if( character < utf16_string[ string_index ] )
+		{
+			return( -1 );
+		}
+		else if( character > utf16_string[ string_index ] )
+		{
+			return( 1 );
+		}
+	}
+	if( utf16_stream_length < utf16_string_length )
+	{
+		return( -1 );
+	}
+	else if( utf16_stream_length > utf16_string_length )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Creates a filename index
+ * Make sure the value filename_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_initialize(
+     libscca_filename_index_t **filename_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_t *internal_filename_index = NULL;
+	static char *function                                      = "libscca_filename_index_initialize";
+
+	if( filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filename_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filename index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index = memory_allocate_structure(
+	                           libscca_internal_filename_index_t );
+
+	if( internal_filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename index.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_filename_index,
+	     0,
+	     sizeof( libscca_internal_filename_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear filename index.",
+		 function );
+
+		memory_free(
+		 internal_filename_index );
+
+		return( -1 );
+	}
+	*filename_index = (libscca_filename_index_t *) internal_filename_index;
+
+	return( 1 );
+}
+
+/* Frees a filename index
+ * The data set with libscca_filename_index_set_data is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_free(
+     libscca_filename_index_t **filename_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_t *internal_filename_index = NULL;
+	static char *function                                      = "libscca_filename_index_free";
+
+	if( filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filename_index != NULL )
+	{
+		internal_filename_index = (libscca_internal_filename_index_t *) *filename_index;
+		*filename_index         = NULL;
+
+		memory_free(
+		 internal_filename_index );
+	}
+	return( 1 );
+}
+
+/* Sets the filename index data
+ * The data is referenced and must remain valid while the filename index is in use
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_set_data(
+     libscca_filename_index_t *filename_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_t *internal_filename_index = NULL;
+	scca_filename_index_file_header_t *file_header             = NULL;
+	static char *function                                      = "libscca_filename_index_set_data";
+	uint64_t keys_offset                                       = 0;
+	uint64_t postings_offset                                   = 0;
+	uint64_t sources_offset                                    = 0;
+	uint64_t strings_offset                                    = 0;
+	uint64_t strings_size                                      = 0;
+	uint32_t format_version                                    = 0;
+	uint32_t number_of_keys                                    = 0;
+	uint32_t number_of_postings                                = 0;
+	uint32_t number_of_sources                                 = 0;
+
+	if( filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index = (libscca_internal_filename_index_t *) filename_index;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( scca_filename_index_file_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_header = (scca_filename_index_file_header_t *) data;
+
+	if( memory_compare(
+	     file_header->signature,
+	     libscca_filename_index_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->format_version,
+	 format_version );
+
+	if( format_version != LIBSCCA_FILENAME_INDEX_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->number_of_sources,
+	 number_of_sources );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->number_of_keys,
+	 number_of_keys );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->number_of_postings,
+	 number_of_postings );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->sources_offset,
+	 sources_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->keys_offset,
+	 keys_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->postings_offset,
+	 postings_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->strings_offset,
+	 strings_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->strings_size,
+	 strings_size );
+
+	/* The lookups only check the entries against the strings so the sections are checked here
+	 */
+	if( ( sources_offset < sizeof( scca_filename_index_file_header_t ) )
+	 || ( sources_offset > (uint64_t) data_size )
+	 || ( (uint64_t) number_of_sources > ( ( (uint64_t) data_size - sources_offset ) / sizeof( scca_filename_index_source_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sources value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( keys_offset < sizeof( scca_filename_index_file_header_t ) )
+	 || ( keys_offset > (uint64_t) data_size )
+	 || ( (uint64_t) number_of_keys > ( ( (uint64_t) data_size - keys_offset ) / sizeof( scca_filename_index_key_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid keys value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( postings_offset < sizeof( scca_filename_index_file_header_t ) )
+	 || ( postings_offset > (uint64_t) data_size )
+	 || ( (uint64_t) number_of_postings > ( ( (uint64_t) data_size - postings_offset ) / sizeof( scca_filename_index_posting_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid postings value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( strings_offset < sizeof( scca_filename_index_file_header_t ) )
+	 || ( strings_offset > (uint64_t) data_size )
+	 || ( strings_size > ( (uint64_t) data_size - strings_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid strings value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index->data               = data;
+	internal_filename_index->data_size          = data_size;
+	internal_filename_index->number_of_sources  = number_of_sources;
+	internal_filename_index->number_of_keys     = number_of_keys;
+	internal_filename_index->number_of_postings = number_of_postings;
+	internal_filename_index->sources_offset     = sources_offset;
+	internal_filename_index->keys_offset        = keys_offset;
+	internal_filename_index->postings_offset    = postings_offset;
+	internal_filename_index->strings_offset     = strings_offset;
+	internal_filename_index->strings_size       = strings_size;
+
+	return( 1 );
+}
+
+/* Finds the postings of an UTF-16 encoded filename in the filename index
+ * The string should be normalized, with libscca_upper_case_utf16_string, by the caller
+ * Returns 1 if found, 0 if not or -1 on error
+ */
+int libscca_filename_index_find_utf16_filename(
+     libscca_filename_index_t *filename_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *first_posting,
+     uint32_t *number_of_postings,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_t *internal_filename_index = NULL;
+	scca_filename_index_key_entry_t *key_entry                 = NULL;
+	static char *function                                      = "libscca_filename_index_find_utf16_filename";
+	uint64_t string_offset                                     = 0;
+	uint32_t key_index                                         = 0;
+	uint32_t lower_key_index                                   = 0;
+	uint32_t safe_first_posting                                = 0;
+	uint32_t safe_number_of_postings                           = 0;
+	uint32_t string_length                                     = 0;
+	uint32_t upper_key_index                                   = 0;
+	int result                                                 = 0;
+
+	if( filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index = (libscca_internal_filename_index_t *) filename_index;
+
+	if( internal_filename_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid filename index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_posting == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first posting.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_postings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of postings.",
+		 function );
+
+		return( -1 );
+	}
+	/* Binary search the sorted keys
+	 */
+	upper_key_index = internal_filename_index->number_of_keys;
+
+	while( lower_key_index < upper_key_index )
+	{
+		key_index = lower_key_index + ( ( upper_key_index - lower_key_index ) / 2 );
+		key_entry = (scca_filename_index_key_entry_t *) &( internal_filename_index->data[ internal_filename_index->keys_offset + ( key_index * sizeof( scca_filename_index_key_entry_t ) ) ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 key_entry->string_offset,
+		 string_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 key_entry->string_length,
+		 string_length );
+
+		if( ( string_offset > internal_filename_index->strings_size )
+		 || ( (uint64_t) string_length > ( ( internal_filename_index->strings_size - string_offset ) / 2 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid key: %" PRIu32 " string value out of bounds.",
+			 function,
+			 key_index );
+
+			return( -1 );
+		}
+		result = libscca_filename_index_compare_utf16_string(
+		          &( internal_filename_index->data[ internal_filename_index->strings_offset + string_offset ] ),
+		          (size_t) string_length,
+		          utf16_string,
+		          utf16_string_length );
+
+		if( result == 0 )
+		{
+			break;
+		}
+		else if( result < 0 )
+		{
+			lower_key_index = key_index + 1;
+		}
+		else
+		{
+			upper_key_index = key_index;
+		}
+	}
+	if( lower_key_index >= upper_key_index )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 key_entry->first_posting,
+	 safe_first_posting );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 key_entry->number_of_postings,
+	 safe_number_of_postings );
+
+	if( ( safe_first_posting > internal_filename_index->number_of_postings )
+	 || ( safe_number_of_postings > ( internal_filename_index->number_of_postings - safe_first_posting ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key: %" PRIu32 " postings value out of bounds.",
+		 function,
+		 key_index );
+
+		return( -1 );
+	}
+	*first_posting      = safe_first_posting;
+	*number_of_postings = safe_number_of_postings;
+
+	return( 1 );
+}
+
+/* Retrieves a specific posting
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_get_posting(
+     libscca_filename_index_t *filename_index,
+     uint32_t posting_index,
+     uint32_t *source_index,
+     uint32_t *metrics_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_t *internal_filename_index = NULL;
+	scca_filename_index_posting_entry_t *posting_entry         = NULL;
+	static char *function                                      = "libscca_filename_index_get_posting";
+
+	if( filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index = (libscca_internal_filename_index_t *) filename_index;
+
+	if( internal_filename_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid filename index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( posting_index >= internal_filename_index->number_of_postings )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid posting index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics index.",
+		 function );
+
+		return( -1 );
+	}
+	posting_entry = (scca_filename_index_posting_entry_t *) &( internal_filename_index->data[ internal_filename_index->postings_offset + ( posting_index * sizeof( scca_filename_index_posting_entry_t ) ) ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 posting_entry->source_index,
+	 *source_index );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 posting_entry->metrics_index,
+	 *metrics_index );
+
+	return( 1 );
+}
+
+/* Retrieves the path data of a specific source
+ * The path data references the index data, it is UTF-8 encoded and includes the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_get_source_path_data(
+     libscca_internal_filename_index_t *internal_filename_index,
+     uint32_t source_index,
+     const uint8_t **path_data,
+     size_t *path_data_size,
+     libcerror_error_t **error )
+{
+	scca_filename_index_source_entry_t *source_entry = NULL;
+	static char *function                            = "libscca_filename_index_get_source_path_data";
+	uint64_t path_offset                             = 0;
+	uint32_t path_size                               = 0;
+
+	if( internal_filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_filename_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid filename index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_index >= internal_filename_index->number_of_sources )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path data.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path data size.",
+		 function );
+
+		return( -1 );
+	}
+	source_entry = (scca_filename_index_source_entry_t *) &( internal_filename_index->data[ internal_filename_index->sources_offset + ( source_index * sizeof( scca_filename_index_source_entry_t ) ) ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 source_entry->path_offset,
+	 path_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 source_entry->path_size,
+	 path_size );
+
+	if( ( path_size == 0 )
+	 || ( path_offset > internal_filename_index->strings_size )
+	 || ( (uint64_t) path_size > ( internal_filename_index->strings_size - path_offset ) )
+	 || ( internal_filename_index->data[ internal_filename_index->strings_offset + path_offset + path_size - 1 ] != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source: %" PRIu32 " path value out of bounds.",
+		 function,
+		 source_index );
+
+		return( -1 );
+	}
+	*path_data      = &( internal_filename_index->data[ internal_filename_index->strings_offset + path_offset ] );
+	*path_data_size = (size_t) path_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded path of a specific source
+ * The returned size includes the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_get_utf8_source_path_size(
+     libscca_filename_index_t *filename_index,
+     uint32_t source_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_t *internal_filename_index = NULL;
+	const uint8_t *path_data                                   = NULL;
+	static char *function                                      = "libscca_filename_index_get_utf8_source_path_size";
+	size_t path_data_size                                      = 0;
+
+	if( filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index = (libscca_internal_filename_index_t *) filename_index;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_filename_index_get_source_path_data(
+	     internal_filename_index,
+	     source_index,
+	     &path_data,
+	     &path_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source: %" PRIu32 " path data.",
+		 function,
+		 source_index );
+
+		return( -1 );
+	}
+	*utf8_string_size = path_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded path of a specific source
+ * The size should include the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_get_utf8_source_path(
+     libscca_filename_index_t *filename_index,
+     uint32_t source_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_t *internal_filename_index = NULL;
+	const uint8_t *path_data                                   = NULL;
+	static char *function                                      = "libscca_filename_index_get_utf8_source_path";
+	size_t path_data_size                                      = 0;
+
+	if( filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index = (libscca_internal_filename_index_t *) filename_index;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_filename_index_get_source_path_data(
+	     internal_filename_index,
+	     source_index,
+	     &path_data,
+	     &path_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source: %" PRIu32 " path data.",
+		 function,
+		 source_index );
+
+		return( -1 );
+	}
+	if( utf8_string_size < path_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     utf8_string,
+	     path_data,
+	     path_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded path of a specific source
+ * The returned size includes the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_get_utf16_source_path_size(
+     libscca_filename_index_t *filename_index,
+     uint32_t source_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_t *internal_filename_index = NULL;
+	const uint8_t *path_data                                   = NULL;
+	static char *function                                      = "libscca_filename_index_get_utf16_source_path_size";
+	size_t path_data_size                                      = 0;
+
+	if( filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index = (libscca_internal_filename_index_t *) filename_index;
+
+	if( libscca_filename_index_get_source_path_data(
+	     internal_filename_index,
+	     source_index,
+	     &path_data,
+	     &path_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source: %" PRIu32 " path data.",
+		 function,
+		 source_index );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_size_from_utf8(
+	     (libuna_utf8_character_t *) path_data,
+	     path_data_size,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded path of a specific source
+ * The size should include the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_get_utf16_source_path(
+     libscca_filename_index_t *filename_index,
+     uint32_t source_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_t *internal_filename_index = NULL;
+	const uint8_t *path_data                                   = NULL;
+	static char *function                                      = "libscca_filename_index_get_utf16_source_path";
+	size_t path_data_size                                      = 0;
+
+	if( filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index = (libscca_internal_filename_index_t *) filename_index;
+
+	if( libscca_filename_index_get_source_path_data(
+	     internal_filename_index,
+	     source_index,
+	     &path_data,
+	     &path_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source: %" PRIu32 " path data.",
+		 function,
+		 source_index );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_copy_from_utf8(
+	     (libuna_utf16_character_t *) utf16_string,
+	     utf16_string_size,
+	     (libuna_utf8_character_t *) path_data,
+	     path_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
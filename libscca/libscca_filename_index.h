@@ -0,0 +1,169 @@
+/*
+ * Filename index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_FILENAME_INDEX_H )
+#define _LIBSCCA_FILENAME_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The filename index format version
+ */
+#define LIBSCCA_FILENAME_INDEX_FORMAT_VERSION	1
+
+extern const char *libscca_filename_index_signature;
+
+typedef struct libscca_internal_filename_index libscca_internal_filename_index_t;
+
+struct libscca_internal_filename_index
+{
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of sources
+	 */
+	uint32_t number_of_sources;
+
+	/* The number of keys
+	 */
+	uint32_t number_of_keys;
+
+	/* The number of postings
+	 */
+	uint32_t number_of_postings;
+
+	/* The sources offset
+	 */
+	uint64_t sources_offset;
+
+	/* The keys offset
+	 */
+	uint64_t keys_offset;
+
+	/* The postings offset
+	 */
+	uint64_t postings_offset;
+
+	/* The strings offset
+	 */
+	uint64_t strings_offset;
+
+	/* The strings size
+	 */
+	uint64_t strings_size;
+};
+
+int libscca_filename_index_compare_utf16_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_length,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_initialize(
+     libscca_filename_index_t **filename_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_free(
+     libscca_filename_index_t **filename_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_set_data(
+     libscca_filename_index_t *filename_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_find_utf16_filename(
+     libscca_filename_index_t *filename_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *first_posting,
+     uint32_t *number_of_postings,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_get_posting(
+     libscca_filename_index_t *filename_index,
+     uint32_t posting_index,
+     uint32_t *source_index,
+     uint32_t *metrics_index,
+     libcerror_error_t **error );
+
+int libscca_filename_index_get_source_path_data(
+     libscca_internal_filename_index_t *internal_filename_index,
+     uint32_t source_index,
+     const uint8_t **path_data,
+     size_t *path_data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_get_utf8_source_path_size(
+     libscca_filename_index_t *filename_index,
+     uint32_t source_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_get_utf8_source_path(
+     libscca_filename_index_t *filename_index,
+     uint32_t source_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_get_utf16_source_path_size(
+     libscca_filename_index_t *filename_index,
+     uint32_t source_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_get_utf16_source_path(
+     libscca_filename_index_t *filename_index,
+     uint32_t source_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_FILENAME_INDEX_H ) */
+
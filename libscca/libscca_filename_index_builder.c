@@ -0,0 +1,1437 @@
+/*
+ * Filename index builder functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libscca_filename_index.h"
+#include "libscca_filename_index_builder.h"
+#include "libscca_libcerror.h"
+#include "libscca_libuna.h"
+#include "scca_filename_index.h"
+
+/* Retrieves the hash of an UTF-16 string
+ * Returns the hash
+ */
+uint32_t libscca_filename_index_get_string_hash(
+          const uint16_t *utf16_string,
+          size_t utf16_string_length )
+{
+	size_t string_index = 0;
+	uint32_t hash       = 2166136261UL;
+
+	/* Calculate the 32-bit FNV-1a hash of the characters
+	 */
+	for( string_index = 0;
+	     string_index < utf16_string_length;
+	     string_index++ )
+	{
+		hash ^= (uint32_t) ( utf16_string[ string_index ] & 0x00ff );
+		hash *= 16777619UL;
+		hash ^= (uint32_t) ( utf16_string[ string_index ] >> 8 );
+		hash *= 16777619UL;
+	}
+	return( hash );
+}
+
+/* Compares two keys for sorting
+ * Returns -1 if the first key is less than the second, 0 if equal or 1 if greater
+ */
+int libscca_filename_index_key_compare(
+     const void *first_key,
+     const void *second_key )
+{
+	const libscca_filename_index_key_t *safe_first_key  = NULL;
+	const libscca_filename_index_key_t *safe_second_key = NULL;
+	size_t string_index                                 = 0;
+	uint16_t first_character                            = 0;
+	uint16_t second_character                           = 0;
+
+	safe_first_key  = *( (libscca_filename_index_key_t * const *) first_key );
+	safe_second_key = *( (libscca_filename_index_key_t * const *) second_key );
+
+	for( string_index = 0;
+	     ( string_index < safe_first_key->string_length ) && ( string_index < safe_second_key->string_length );
+	     string_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( safe_first_key->string[ string_index * 2 ] ),
+		 first_character );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( safe_second_key->string[ string_index * 2 ] ),
+		 second_character );
+
+		if( first_character < second_character )
+		{
+			return( -1 );
+		}
+		else if( first_character > second_character )
+		{
+			return( 1 );
+		}
+	}
+	if( safe_first_key->string_length < safe_second_key->string_length )
+	{
+		return( -1 );
+	}
+	else if( safe_first_key->string_length > safe_second_key->string_length )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Creates a filename index builder
+ * Make sure the value filename_index_builder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_builder_initialize(
+     libscca_filename_index_builder_t **filename_index_builder,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_builder_t *internal_filename_index_builder = NULL;
+	static char *function                                                      = "libscca_filename_index_builder_initialize";
+	int bucket_index                                                           = 0;
+
+	if( filename_index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filename_index_builder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filename index builder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index_builder = memory_allocate_structure(
+	                                   libscca_internal_filename_index_builder_t );
+
+	if( internal_filename_index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename index builder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_filename_index_builder,
+	     0,
+	     sizeof( libscca_internal_filename_index_builder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear filename index builder.",
+		 function );
+
+		memory_free(
+		 internal_filename_index_builder );
+
+		return( -1 );
+	}
+	internal_filename_index_builder->buckets = (int *) memory_allocate(
+	                                            sizeof( int ) * LIBSCCA_FILENAME_INDEX_BUILDER_NUMBER_OF_BUCKETS );
+
+	if( internal_filename_index_builder->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < LIBSCCA_FILENAME_INDEX_BUILDER_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		internal_filename_index_builder->buckets[ bucket_index ] = -1;
+	}
+	*filename_index_builder = (libscca_filename_index_builder_t *) internal_filename_index_builder;
+
+	return( 1 );
+
+on_error:
+	if( internal_filename_index_builder != NULL )
+	{
+		libscca_filename_index_builder_free(
+		 (libscca_filename_index_builder_t **) &internal_filename_index_builder,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a filename index builder
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_builder_free(
+     libscca_filename_index_builder_t **filename_index_builder,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_builder_t *internal_filename_index_builder = NULL;
+	static char *function                                                      = "libscca_filename_index_builder_free";
+
+	if( filename_index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filename_index_builder != NULL )
+	{
+		internal_filename_index_builder = (libscca_internal_filename_index_builder_t *) *filename_index_builder;
+		*filename_index_builder         = NULL;
+
+		if( internal_filename_index_builder->source_paths != NULL )
+		{
+			memory_free(
+			 internal_filename_index_builder->source_paths );
+		}
+		if( internal_filename_index_builder->source_path_offsets != NULL )
+		{
+			memory_free(
+			 internal_filename_index_builder->source_path_offsets );
+		}
+		if( internal_filename_index_builder->key_strings != NULL )
+		{
+			memory_free(
+			 internal_filename_index_builder->key_strings );
+		}
+		if( internal_filename_index_builder->keys != NULL )
+		{
+			memory_free(
+			 internal_filename_index_builder->keys );
+		}
+		if( internal_filename_index_builder->buckets != NULL )
+		{
+			memory_free(
+			 internal_filename_index_builder->buckets );
+		}
+		if( internal_filename_index_builder->postings != NULL )
+		{
+			memory_free(
+			 internal_filename_index_builder->postings );
+		}
+		memory_free(
+		 internal_filename_index_builder );
+	}
+	return( 1 );
+}
+
+/* Resizes an array of the filename index builder to fit one more entry
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_builder_resize_array(
+     void **array,
+     int number_of_entries,
+     int *number_of_allocated_entries,
+     size_t entry_size,
+     libcerror_error_t **error )
+{
+	void *reallocation                   = NULL;
+	static char *function                = "libscca_filename_index_builder_resize_array";
+	int safe_number_of_allocated_entries = 0;
+
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocated_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of allocated entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid entry size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries < *number_of_allocated_entries )
+	{
+		return( 1 );
+	}
+	if( *number_of_allocated_entries == 0 )
+	{
+		safe_number_of_allocated_entries = 1024;
+	}
+	else if( *number_of_allocated_entries < ( INT_MAX / 2 ) )
+	{
+		safe_number_of_allocated_entries = *number_of_allocated_entries * 2;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) safe_number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / entry_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of allocated entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = memory_reallocate(
+	                *array,
+	                entry_size * safe_number_of_allocated_entries );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize array.",
+		 function );
+
+		return( -1 );
+	}
+	*array                       = reallocation;
+	*number_of_allocated_entries = safe_number_of_allocated_entries;
+
+	return( 1 );
+}
+
+/* Resizes a buffer of the filename index builder to fit additional data
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_builder_resize_buffer(
+     uint8_t **buffer,
+     size_t buffer_size,
+     size_t *allocated_buffer_size,
+     size_t required_size,
+     libcerror_error_t **error )
+{
+	void *reallocation                = NULL;
+	static char *function             = "libscca_filename_index_builder_resize_buffer";
+	size_t safe_allocated_buffer_size = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > *allocated_buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_size <= ( *allocated_buffer_size - buffer_size ) )
+	{
+		return( 1 );
+	}
+	if( required_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The buffer size is doubled to keep the number of reallocations low
+	 */
+	safe_allocated_buffer_size = *allocated_buffer_size;
+
+	if( safe_allocated_buffer_size < 65536 )
+	{
+		safe_allocated_buffer_size = 65536;
+	}
+	while( safe_allocated_buffer_size < ( buffer_size + required_size ) )
+	{
+		if( safe_allocated_buffer_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+		{
+			safe_allocated_buffer_size = buffer_size + required_size;
+
+			break;
+		}
+		safe_allocated_buffer_size *= 2;
+	}
+	reallocation = memory_reallocate(
+	                *buffer,
+	                safe_allocated_buffer_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer                = (uint8_t *) reallocation;
+	*allocated_buffer_size = safe_allocated_buffer_size;
+
+	return( 1 );
+}
+
+/* Appends a source to the filename index builder
+ * The path size includes the end-of-string character, the caller copies the UTF-8 path into the path data
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_builder_append_source(
+     libscca_internal_filename_index_builder_t *internal_filename_index_builder,
+     size_t path_size,
+     uint8_t **path_data,
+     uint32_t *source_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_filename_index_builder_append_source";
+
+	if( internal_filename_index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_size == 0 )
+	 || ( path_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path data.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_filename_index_builder_resize_array(
+	     (void **) &( internal_filename_index_builder->source_path_offsets ),
+	     internal_filename_index_builder->number_of_sources,
+	     &( internal_filename_index_builder->number_of_allocated_sources ),
+	     sizeof( size_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize source path offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_filename_index_builder_resize_buffer(
+	     &( internal_filename_index_builder->source_paths ),
+	     internal_filename_index_builder->source_paths_size,
+	     &( internal_filename_index_builder->source_paths_allocated_size ),
+	     path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize source paths.",
+		 function );
+
+		return( -1 );
+	}
+	*path_data = &( internal_filename_index_builder->source_paths[ internal_filename_index_builder->source_paths_size ] );
+
+	internal_filename_index_builder->source_path_offsets[ internal_filename_index_builder->number_of_sources ] = internal_filename_index_builder->source_paths_size;
+
+	internal_filename_index_builder->source_paths_size += path_size;
+
+	*source_index = (uint32_t) internal_filename_index_builder->number_of_sources;
+
+	internal_filename_index_builder->number_of_sources += 1;
+
+	return( 1 );
+}
+
+/* Appends a source, the path of the prefetch file, to the filename index builder
+ * The path is stored as-is, it is expected to be UTF-8 encoded
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_builder_append_source_path(
+     libscca_filename_index_builder_t *filename_index_builder,
+     const char *path,
+     size_t path_length,
+     uint32_t *source_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_builder_t *internal_filename_index_builder = NULL;
+	uint8_t *path_data                                                         = NULL;
+	static char *function                                                      = "libscca_filename_index_builder_append_source_path";
+
+	if( filename_index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index_builder = (libscca_internal_filename_index_builder_t *) filename_index_builder;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_filename_index_builder_append_source(
+	     internal_filename_index_builder,
+	     path_length + 1,
+	     &path_data,
+	     source_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > 0 )
+	{
+		if( memory_copy(
+		     path_data,
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	path_data[ path_length ] = 0;
+
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Appends a source, the path of the prefetch file, to the filename index builder
+ * The path is stored UTF-8 encoded
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_builder_append_source_path_wide(
+     libscca_filename_index_builder_t *filename_index_builder,
+     const wchar_t *path,
+     size_t path_length,
+     uint32_t *source_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_builder_t *internal_filename_index_builder = NULL;
+	uint8_t *path_data                                                         = NULL;
+	static char *function                                                      = "libscca_filename_index_builder_append_source_path_wide";
+	size_t path_size                                                           = 1;
+	int result                                                                 = 0;
+
+	if( filename_index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index_builder = (libscca_internal_filename_index_builder_t *) filename_index_builder;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	/* The UTF-8 path size includes the end-of-string character
+	 */
+	if( path_length > 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) path,
+		          path_length,
+		          &path_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) path,
+		          path_length,
+		          &path_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 path size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libscca_filename_index_builder_append_source(
+	     internal_filename_index_builder,
+	     path_size,
+	     &path_data,
+	     source_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == 0 )
+	{
+		path_data[ 0 ] = 0;
+
+		return( 1 );
+	}
+#if SIZEOF_WCHAR_T == 4
+	result = libuna_utf8_string_copy_from_utf32(
+	          path_data,
+	          path_size,
+	          (libuna_utf32_character_t *) path,
+	          path_length,
+	          error );
+#elif SIZEOF_WCHAR_T == 2
+	result = libuna_utf8_string_copy_from_utf16(
+	          path_data,
+	          path_size,
+	          (libuna_utf16_character_t *) path,
+	          path_length,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Appends an UTF-16 encoded filename of a file metrics entry of a source to the filename index builder
+ * The filename should be normalized, with libscca_upper_case_utf16_string, by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_builder_append_utf16_filename(
+     libscca_filename_index_builder_t *filename_index_builder,
+     uint32_t source_index,
+     uint32_t metrics_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_builder_t *internal_filename_index_builder = NULL;
+	libscca_filename_index_key_t *key                                          = NULL;
+	uint8_t *key_string                                                        = NULL;
+	static char *function                                                      = "libscca_filename_index_builder_append_utf16_filename";
+	size_t string_index                                                        = 0;
+	uint32_t string_hash                                                       = 0;
+	int bucket_index                                                           = 0;
+	int key_index                                                              = 0;
+
+	if( filename_index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index_builder = (libscca_internal_filename_index_builder_t *) filename_index_builder;
+
+	if( source_index >= (uint32_t) internal_filename_index_builder->number_of_sources )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	string_hash = libscca_filename_index_get_string_hash(
+	               utf16_string,
+	               utf16_string_length );
+
+	bucket_index = (int) ( string_hash % LIBSCCA_FILENAME_INDEX_BUILDER_NUMBER_OF_BUCKETS );
+
+	for( key_index = internal_filename_index_builder->buckets[ bucket_index ];
+	     key_index != -1;
+	     key_index = key->next_bucket_key )
+	{
+		key = &( internal_filename_index_builder->keys[ key_index ] );
+
+		if( ( key->string_hash == string_hash )
+		 && ( libscca_filename_index_compare_utf16_string(
+		       &( internal_filename_index_builder->key_strings[ key->string_offset ] ),
+		       (size_t) key->string_length,
+		       utf16_string,
+		       utf16_string_length ) == 0 ) )
+		{
+			break;
+		}
+	}
+	if( key_index == -1 )
+	{
+		if( libscca_filename_index_builder_resize_array(
+		     (void **) &( internal_filename_index_builder->keys ),
+		     internal_filename_index_builder->number_of_keys,
+		     &( internal_filename_index_builder->number_of_allocated_keys ),
+		     sizeof( libscca_filename_index_key_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize keys.",
+			 function );
+
+			return( -1 );
+		}
+		if( libscca_filename_index_builder_resize_buffer(
+		     &( internal_filename_index_builder->key_strings ),
+		     internal_filename_index_builder->key_strings_size,
+		     &( internal_filename_index_builder->key_strings_allocated_size ),
+		     utf16_string_length * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize key strings.",
+			 function );
+
+			return( -1 );
+		}
+		key_index = internal_filename_index_builder->number_of_keys;
+		key       = &( internal_filename_index_builder->keys[ key_index ] );
+
+		key->string_offset      = internal_filename_index_builder->key_strings_size;
+		key->string_length      = (uint32_t) utf16_string_length;
+		key->string_hash        = string_hash;
+		key->number_of_postings = 0;
+		key->next_bucket_key    = internal_filename_index_builder->buckets[ bucket_index ];
+
+		key_string = &( internal_filename_index_builder->key_strings[ key->string_offset ] );
+
+		for( string_index = 0;
+		     string_index < utf16_string_length;
+		     string_index++ )
+		{
+			byte_stream_copy_from_uint16_little_endian(
+			 &( key_string[ string_index * 2 ] ),
+			 utf16_string[ string_index ] );
+		}
+		internal_filename_index_builder->key_strings_size += utf16_string_length * 2;
+
+		internal_filename_index_builder->buckets[ bucket_index ] = key_index;
+		internal_filename_index_builder->number_of_keys         += 1;
+	}
+	if( libscca_filename_index_builder_resize_array(
+	     (void **) &( internal_filename_index_builder->postings ),
+	     internal_filename_index_builder->number_of_postings,
+	     &( internal_filename_index_builder->number_of_allocated_postings ),
+	     sizeof( libscca_filename_index_posting_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize postings.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index_builder->postings[ internal_filename_index_builder->number_of_postings ].key_index     = (uint32_t) key_index;
+	internal_filename_index_builder->postings[ internal_filename_index_builder->number_of_postings ].source_index  = source_index;
+	internal_filename_index_builder->postings[ internal_filename_index_builder->number_of_postings ].metrics_index = metrics_index;
+
+	internal_filename_index_builder->number_of_postings += 1;
+
+	key->number_of_postings += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the layout of the filename index data
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_builder_get_layout(
+     libscca_internal_filename_index_builder_t *internal_filename_index_builder,
+     uint64_t *keys_offset,
+     uint64_t *postings_offset,
+     uint64_t *strings_offset,
+     uint64_t *key_strings_offset,
+     uint64_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_filename_index_builder_get_layout";
+	uint64_t offset       = 0;
+
+	if( internal_filename_index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( keys_offset == NULL )
+	 || ( postings_offset == NULL )
+	 || ( strings_offset == NULL )
+	 || ( key_strings_offset == NULL )
+	 || ( data_size == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout value.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sections are 8-byte aligned and the sources directly follow the file header
+	 */
+	offset  = sizeof( scca_filename_index_file_header_t );
+	offset += (uint64_t) internal_filename_index_builder->number_of_sources * sizeof( scca_filename_index_source_entry_t );
+
+	*keys_offset = ( offset + 7 ) & ~( (uint64_t) 7 );
+
+	offset = *keys_offset + ( (uint64_t) internal_filename_index_builder->number_of_keys * sizeof( scca_filename_index_key_entry_t ) );
+
+	*postings_offset = ( offset + 7 ) & ~( (uint64_t) 7 );
+
+	offset = *postings_offset + ( (uint64_t) internal_filename_index_builder->number_of_postings * sizeof( scca_filename_index_posting_entry_t ) );
+
+	*strings_offset     = ( offset + 7 ) & ~( (uint64_t) 7 );
+	*key_strings_offset = ( (uint64_t) internal_filename_index_builder->source_paths_size + 7 ) & ~( (uint64_t) 7 );
+	*data_size          = *strings_offset + *key_strings_offset + internal_filename_index_builder->key_strings_size;
+
+	if( *data_size > (uint64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of keys
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_builder_get_number_of_keys(
+     libscca_filename_index_builder_t *filename_index_builder,
+     int *number_of_keys,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_builder_t *internal_filename_index_builder = NULL;
+	static char *function                                                      = "libscca_filename_index_builder_get_number_of_keys";
+
+	if( filename_index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index_builder = (libscca_internal_filename_index_builder_t *) filename_index_builder;
+
+	if( number_of_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of keys.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_keys = internal_filename_index_builder->number_of_keys;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the filename index data
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_builder_get_data_size(
+     libscca_filename_index_builder_t *filename_index_builder,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_builder_t *internal_filename_index_builder = NULL;
+	static char *function                                                      = "libscca_filename_index_builder_get_data_size";
+	uint64_t key_strings_offset                                                = 0;
+	uint64_t keys_offset                                                       = 0;
+	uint64_t postings_offset                                                   = 0;
+	uint64_t required_data_size                                                = 0;
+	uint64_t strings_offset                                                    = 0;
+
+	if( filename_index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index_builder = (libscca_internal_filename_index_builder_t *) filename_index_builder;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_filename_index_builder_get_layout(
+	     internal_filename_index_builder,
+	     &keys_offset,
+	     &postings_offset,
+	     &strings_offset,
+	     &key_strings_offset,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve layout.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = (size_t) required_data_size;
+
+	return( 1 );
+}
+
+/* Writes the filename index data
+ * The keys are sorted and the postings of a key are stored in the order they were appended
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_index_builder_write_data(
+     libscca_filename_index_builder_t *filename_index_builder,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_filename_index_builder_t *internal_filename_index_builder = NULL;
+	scca_filename_index_file_header_t *file_header                             = NULL;
+	scca_filename_index_key_entry_t *key_entry                                 = NULL;
+	libscca_filename_index_key_t *key                                          = NULL;
+	libscca_filename_index_key_t **sorted_keys                                 = NULL;
+	scca_filename_index_posting_entry_t *posting_entry                         = NULL;
+	scca_filename_index_source_entry_t *source_entry                           = NULL;
+	static char *function                                                      = "libscca_filename_index_builder_write_data";
+	size_t path_size                                                           = 0;
+	uint64_t key_strings_offset                                                = 0;
+	uint64_t keys_offset                                                       = 0;
+	uint64_t postings_offset                                                   = 0;
+	uint64_t required_data_size                                                = 0;
+	uint64_t strings_offset                                                    = 0;
+	uint32_t first_posting                                                     = 0;
+	int entry_index                                                            = 0;
+
+	if( filename_index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filename_index_builder = (libscca_internal_filename_index_builder_t *) filename_index_builder;
+
+	if( libscca_filename_index_builder_get_layout(
+	     internal_filename_index_builder,
+	     &keys_offset,
+	     &postings_offset,
+	     &strings_offset,
+	     &key_strings_offset,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( (uint64_t) data_size < required_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_filename_index_builder->number_of_keys > 0 )
+	{
+		sorted_keys = (libscca_filename_index_key_t **) memory_allocate(
+		                                         sizeof( libscca_filename_index_key_t * ) * internal_filename_index_builder->number_of_keys );
+
+		if( sorted_keys == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sorted keys.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < internal_filename_index_builder->number_of_keys;
+		     entry_index++ )
+		{
+			key = &( internal_filename_index_builder->keys[ entry_index ] );
+
+			key->string = &( internal_filename_index_builder->key_strings[ key->string_offset ] );
+
+			sorted_keys[ entry_index ] = key;
+		}
+		qsort(
+		 sorted_keys,
+		 (size_t) internal_filename_index_builder->number_of_keys,
+		 sizeof( libscca_filename_index_key_t * ),
+		 &libscca_filename_index_key_compare );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     (size_t) required_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		goto on_error;
+	}
+	file_header = (scca_filename_index_file_header_t *) data;
+
+	if( memory_copy(
+	     file_header->signature,
+	     libscca_filename_index_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->format_version,
+	 LIBSCCA_FILENAME_INDEX_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->number_of_sources,
+	 (uint32_t) internal_filename_index_builder->number_of_sources );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->number_of_keys,
+	 (uint32_t) internal_filename_index_builder->number_of_keys );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->number_of_postings,
+	 (uint32_t) internal_filename_index_builder->number_of_postings );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header->sources_offset,
+	 (uint64_t) sizeof( scca_filename_index_file_header_t ) );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header->keys_offset,
+	 keys_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header->postings_offset,
+	 postings_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header->strings_offset,
+	 strings_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header->strings_size,
+	 required_data_size - strings_offset );
+
+	for( entry_index = 0;
+	     entry_index < internal_filename_index_builder->number_of_sources;
+	     entry_index++ )
+	{
+		source_entry = (scca_filename_index_source_entry_t *) &( data[ sizeof( scca_filename_index_file_header_t ) + ( entry_index * sizeof( scca_filename_index_source_entry_t ) ) ] );
+
+		if( ( entry_index + 1 ) < internal_filename_index_builder->number_of_sources )
+		{
+			path_size = internal_filename_index_builder->source_path_offsets[ entry_index + 1 ];
+		}
+		else
+		{
+			path_size = internal_filename_index_builder->source_paths_size;
+		}
+		path_size -= internal_filename_index_builder->source_path_offsets[ entry_index ];
+
+		byte_stream_copy_from_uint64_little_endian(
+		 source_entry->path_offset,
+		 (uint64_t) internal_filename_index_builder->source_path_offsets[ entry_index ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 source_entry->path_size,
+		 (uint32_t) path_size );
+	}
+	/* The first posting of a key is used as the position of its next posting
+	 */
+	for( entry_index = 0;
+	     entry_index < internal_filename_index_builder->number_of_keys;
+	     entry_index++ )
+	{
+		key       = sorted_keys[ entry_index ];
+		key_entry = (scca_filename_index_key_entry_t *) &( data[ keys_offset + ( entry_index * sizeof( scca_filename_index_key_entry_t ) ) ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 key_entry->string_offset,
+		 key_strings_offset + key->string_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 key_entry->string_length,
+		 key->string_length );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 key_entry->first_posting,
+		 first_posting );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 key_entry->number_of_postings,
+		 key->number_of_postings );
+
+		key->first_posting = first_posting;
+		first_posting     += key->number_of_postings;
+	}
+	for( entry_index = 0;
+	     entry_index < internal_filename_index_builder->number_of_postings;
+	     entry_index++ )
+	{
+		key           = &( internal_filename_index_builder->keys[ internal_filename_index_builder->postings[ entry_index ].key_index ] );
+		posting_entry = (scca_filename_index_posting_entry_t *) &( data[ postings_offset + ( key->first_posting * sizeof( scca_filename_index_posting_entry_t ) ) ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 posting_entry->source_index,
+		 internal_filename_index_builder->postings[ entry_index ].source_index );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 posting_entry->metrics_index,
+		 internal_filename_index_builder->postings[ entry_index ].metrics_index );
+
+		key->first_posting += 1;
+	}
+	if( internal_filename_index_builder->source_paths_size > 0 )
+	{
+		if( memory_copy(
+		     &( data[ strings_offset ] ),
+		     internal_filename_index_builder->source_paths,
+		     internal_filename_index_builder->source_paths_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source paths.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_filename_index_builder->key_strings_size > 0 )
+	{
+		if( memory_copy(
+		     &( data[ strings_offset + key_strings_offset ] ),
+		     internal_filename_index_builder->key_strings,
+		     internal_filename_index_builder->key_strings_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key strings.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( sorted_keys != NULL )
+	{
+		memory_free(
+		 sorted_keys );
+	}
+	return( 1 );
+
+on_error:
+	if( sorted_keys != NULL )
+	{
+		memory_free(
+		 sorted_keys );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,258 @@
+/*
+ * Filename index builder functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_FILENAME_INDEX_BUILDER_H )
+#define _LIBSCCA_FILENAME_INDEX_BUILDER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of hash buckets of the keys of the filename index builder
+ */
+#define LIBSCCA_FILENAME_INDEX_BUILDER_NUMBER_OF_BUCKETS	65536
+
+typedef struct libscca_filename_index_key libscca_filename_index_key_t;
+
+struct libscca_filename_index_key
+{
+	/* The offset of the UTF-16 little-endian string in the key strings
+	 */
+	size_t string_offset;
+
+	/* The string length in characters
+	 */
+	uint32_t string_length;
+
+	/* The hash of the string
+	 */
+	uint32_t string_hash;
+
+	/* The number of postings
+	 */
+	uint32_t number_of_postings;
+
+	/* The index of the first posting, set when the data is written
+	 */
+	uint32_t first_posting;
+
+	/* The UTF-16 little-endian string, set when the data is written
+	 */
+	const uint8_t *string;
+
+	/* The index of the next key in the same hash bucket or -1
+	 */
+	int next_bucket_key;
+};
+
+typedef struct libscca_filename_index_posting libscca_filename_index_posting_t;
+
+struct libscca_filename_index_posting
+{
+	/* The key index
+	 */
+	uint32_t key_index;
+
+	/* The source index
+	 */
+	uint32_t source_index;
+
+	/* The file metrics entry index
+	 */
+	uint32_t metrics_index;
+};
+
+typedef struct libscca_internal_filename_index_builder libscca_internal_filename_index_builder_t;
+
+struct libscca_internal_filename_index_builder
+{
+	/* The UTF-8 source paths, stored as consecutive end-of-string character terminated strings
+	 */
+	uint8_t *source_paths;
+
+	/* The size of the source paths
+	 */
+	size_t source_paths_size;
+
+	/* The allocated size of the source paths
+	 */
+	size_t source_paths_allocated_size;
+
+	/* The offsets of the source paths
+	 */
+	size_t *source_path_offsets;
+
+	/* The number of sources
+	 */
+	int number_of_sources;
+
+	/* The number of allocated sources
+	 */
+	int number_of_allocated_sources;
+
+	/* The UTF-16 little-endian key strings
+	 */
+	uint8_t *key_strings;
+
+	/* The size of the key strings
+	 */
+	size_t key_strings_size;
+
+	/* The allocated size of the key strings
+	 */
+	size_t key_strings_allocated_size;
+
+	/* The keys
+	 */
+	libscca_filename_index_key_t *keys;
+
+	/* The number of keys
+	 */
+	int number_of_keys;
+
+	/* The number of allocated keys
+	 */
+	int number_of_allocated_keys;
+
+	/* The hash buckets of the keys
+	 */
+	int *buckets;
+
+	/* The postings
+	 */
+	libscca_filename_index_posting_t *postings;
+
+	/* The number of postings
+	 */
+	int number_of_postings;
+
+	/* The number of allocated postings
+	 */
+	int number_of_allocated_postings;
+};
+
+uint32_t libscca_filename_index_get_string_hash(
+          const uint16_t *utf16_string,
+          size_t utf16_string_length );
+
+int libscca_filename_index_key_compare(
+     const void *first_key,
+     const void *second_key );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_builder_initialize(
+     libscca_filename_index_builder_t **filename_index_builder,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_builder_free(
+     libscca_filename_index_builder_t **filename_index_builder,
+     libcerror_error_t **error );
+
+int libscca_filename_index_builder_resize_array(
+     void **array,
+     int number_of_entries,
+     int *number_of_allocated_entries,
+     size_t entry_size,
+     libcerror_error_t **error );
+
+int libscca_filename_index_builder_resize_buffer(
+     uint8_t **buffer,
+     size_t buffer_size,
+     size_t *allocated_buffer_size,
+     size_t required_size,
+     libcerror_error_t **error );
+
+int libscca_filename_index_builder_append_source(
+     libscca_internal_filename_index_builder_t *internal_filename_index_builder,
+     size_t path_size,
+     uint8_t **path_data,
+     uint32_t *source_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_builder_append_source_path(
+     libscca_filename_index_builder_t *filename_index_builder,
+     const char *path,
+     size_t path_length,
+     uint32_t *source_index,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+LIBSCCA_EXTERN \
+int libscca_filename_index_builder_append_source_path_wide(
+     libscca_filename_index_builder_t *filename_index_builder,
+     const wchar_t *path,
+     size_t path_length,
+     uint32_t *source_index,
+     libcerror_error_t **error );
+#endif
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_builder_append_utf16_filename(
+     libscca_filename_index_builder_t *filename_index_builder,
+     uint32_t source_index,
+     uint32_t metrics_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+int libscca_filename_index_builder_get_layout(
+     libscca_internal_filename_index_builder_t *internal_filename_index_builder,
+     uint64_t *keys_offset,
+     uint64_t *postings_offset,
+     uint64_t *strings_offset,
+     uint64_t *key_strings_offset,
+     uint64_t *data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_builder_get_number_of_keys(
+     libscca_filename_index_builder_t *filename_index_builder,
+     int *number_of_keys,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_builder_get_data_size(
+     libscca_filename_index_builder_t *filename_index_builder,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_filename_index_builder_write_data(
+     libscca_filename_index_builder_t *filename_index_builder,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_FILENAME_INDEX_BUILDER_H ) */
+
@@ -31,6 +31,7 @@
 #include "libscca_libcerror.h"
 #include "libscca_libcnotify.h"
 #include "libscca_libfdata.h"
+#include "libscca_read_failure.h"
 
 /* Creates filename strings
  * Make sure the value filename_strings is referencing, is set to NULL
@@ -389,6 +390,7 @@ on_error:
 }
 
 /* Reads the filename strings
+ * The failure to read is recorded in the read failure, if not NULL
  * Returns 1 if successful or -1 on error
  */
 int libscca_filename_strings_read_stream(
@@ -397,6 +399,7 @@ int libscca_filename_strings_read_stream(
      libbfio_handle_t *file_io_handle,
      uint32_t filename_strings_offset,
      uint32_t filename_strings_size,
+     libscca_read_failure_t *read_failure,
      libcerror_error_t **error )
 {
 	static char *function = "libscca_filename_strings_read_stream";
@@ -482,6 +485,13 @@ int libscca_filename_strings_read_stream(
 		 filename_strings_offset,
 		 filename_strings_offset );
 
+		libscca_read_failure_set(
+		 read_failure,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 (off64_t) filename_strings_offset,
+		 NULL );
+
 		goto on_error;
 	}
 	if( libscca_filename_strings_read_data(
@@ -497,6 +507,15 @@ int libscca_filename_strings_read_stream(
 		 "%s: unable to read filename strings.",
 		 function );
 
+		/* The number of filename strings is the only value of the data that is validated
+		 */
+		libscca_read_failure_set(
+		 read_failure,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 (off64_t) filename_strings_offset,
+		 NULL );
+
 		goto on_error;
 	}
 	return( 1 );
@@ -519,7 +538,275 @@ on_error:
 	return( -1 );
 }
 
+/* Sets the filename strings data
+ * The data is copied but not read, the filename strings in the data
+ * are added with libscca_filename_strings_append_filename
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_set_data(
+     libscca_filename_strings_t *filename_strings,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_filename_strings_set_data";
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filename strings - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	filename_strings->data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * data_size );
+
+	if( filename_strings->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename strings data.",
+		 function );
+
+		goto on_error;
+	}
+	filename_strings->data_size = data_size;
+
+	if( memory_copy(
+	     filename_strings->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename strings data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( filename_strings->data != NULL )
+	{
+		memory_free(
+		 filename_strings->data );
+
+		filename_strings->data = NULL;
+	}
+	filename_strings->data_size = 0;
+
+	return( -1 );
+}
+
+/* Appends a filename string of the filename strings data
+ * The filename strings must be appended in ascending offset order and cannot overlap
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_append_filename(
+     libscca_filename_strings_t *filename_strings,
+     uint32_t filename_offset,
+     uint32_t filename_size,
+     libcerror_error_t **error )
+{
+	libscca_filename_string_t *filename_string = NULL;
+	static char *function                      = "libscca_filename_strings_append_filename";
+	size_t minimum_filename_offset             = 0;
+	int entry_index                            = 0;
+	int number_of_entries                      = 0;
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid filename strings - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_size == 0 )
+	 || ( (size_t) filename_offset >= filename_strings->data_size )
+	 || ( (size_t) filename_size > ( filename_strings->data_size - filename_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename string value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     filename_strings->strings_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings array entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries > LIBSCCA_MAXIMUM_NUMBER_OF_FILENAME_STRINGS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of strings array entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries > 0 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     filename_strings->strings_array,
+		     number_of_entries - 1,
+		     (intptr_t **) &filename_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve strings array entry: %d.",
+			 function,
+			 number_of_entries - 1 );
+
+			return( -1 );
+		}
+		if( filename_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing strings array entry: %d.",
+			 function,
+			 number_of_entries - 1 );
+
+			return( -1 );
+		}
+		minimum_filename_offset = (size_t) filename_string->offset + filename_string->data_size;
+
+		filename_string = NULL;
+	}
+	if( (size_t) filename_offset < minimum_filename_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_filename_string_initialize(
+	     &filename_string,
+	     filename_offset,
+	     &( filename_strings->data[ filename_offset ] ),
+	     (size_t) filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filename string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     filename_strings->strings_array,
+	     &entry_index,
+	     (intptr_t *) filename_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filename string to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( filename_string != NULL )
+	{
+		libscca_filename_string_free(
+		 &filename_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Retrieves the filename index for a specific offset
+ * The strings are read sequentially hence stored in ascending offset order
  * Returns 1 if successful, 0 if not found or -1 on error
  */
 int libscca_filename_strings_get_index_by_offset(
@@ -531,6 +818,8 @@ int libscca_filename_strings_get_index_by_offset(
 	libscca_filename_string_t *filename_string = NULL;
 	static char *function                      = "libscca_filename_strings_get_index_by_offset";
 	int entry_index                            = 0;
+	int first_entry_index                      = 0;
+	int last_entry_index                       = 0;
 	int number_of_entries                      = 0;
 
 	if( filename_strings == NULL )
@@ -569,10 +858,13 @@ int libscca_filename_strings_get_index_by_offset(
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	first_entry_index = 0;
+	last_entry_index  = number_of_entries - 1;
+
+	while( first_entry_index <= last_entry_index )
 	{
+		entry_index = first_entry_index + ( ( last_entry_index - first_entry_index ) / 2 );
+
 		if( libcdata_array_get_entry_by_index(
 		     filename_strings->strings_array,
 		     entry_index,
@@ -607,6 +899,14 @@ int libscca_filename_strings_get_index_by_offset(
 
 			return( 1 );
 		}
+		else if( filename_string->offset < filename_offset )
+		{
+			first_entry_index = entry_index + 1;
+		}
+		else
+		{
+			last_entry_index = entry_index - 1;
+		}
 	}
 	return( 0 );
 }
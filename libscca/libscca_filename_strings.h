@@ -29,6 +29,7 @@
 #include "libscca_libcdata.h"
 #include "libscca_libcerror.h"
 #include "libscca_libfdata.h"
+#include "libscca_read_failure.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -75,6 +76,19 @@ int libscca_filename_strings_read_stream(
      libbfio_handle_t *file_io_handle,
      uint32_t filename_strings_offset,
      uint32_t filename_strings_size,
+     libscca_read_failure_t *read_failure,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_set_data(
+     libscca_filename_strings_t *filename_strings,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_append_filename(
+     libscca_filename_strings_t *filename_strings,
+     uint32_t filename_offset,
+     uint32_t filename_size,
      libcerror_error_t **error );
 
 int libscca_filename_strings_get_index_by_offset(
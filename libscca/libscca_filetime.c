@@ -0,0 +1,377 @@
+/*
+ * FILETIME functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_filetime.h"
+#include "libscca_libcerror.h"
+
+/* The two digit decimal strings of the values 0 to 99
+ */
+static const char libscca_filetime_decimal_digit_pairs[ 201 ] = \
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+/* Retrieves the date and time values of a FILETIME
+ * The date is determined arithmetically from the number of days since January 1, 1601
+ * A FILETIME with a date past the year 9999 is out of bounds
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filetime_get_date_time_values(
+     uint64_t filetime,
+     uint16_t *year,
+     uint8_t *month,
+     uint8_t *day_of_month,
+     uint8_t *hours,
+     uint8_t *minutes,
+     uint8_t *seconds,
+     uint32_t *fraction_of_second,
+     libcerror_error_t **error )
+{
+	static char *function       = "libscca_filetime_get_date_time_values";
+	uint64_t number_of_days     = 0;
+	uint64_t number_of_seconds  = 0;
+	uint64_t day_of_era         = 0;
+	uint64_t day_of_year        = 0;
+	uint64_t era                = 0;
+	uint64_t year_of_era        = 0;
+	uint64_t calculated_year    = 0;
+	uint64_t month_position     = 0;
+
+	if( year == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid year.",
+		 function );
+
+		return( -1 );
+	}
+	if( month == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid month.",
+		 function );
+
+		return( -1 );
+	}
+	if( day_of_month == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid day of month.",
+		 function );
+
+		return( -1 );
+	}
+	if( hours == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hours.",
+		 function );
+
+		return( -1 );
+	}
+	if( minutes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minutes.",
+		 function );
+
+		return( -1 );
+	}
+	if( seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( fraction_of_second == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fraction of second.",
+		 function );
+
+		return( -1 );
+	}
+	/* The FILETIME is in intervals of 100 nano seconds
+	 */
+	*fraction_of_second = (uint32_t) ( filetime % 10000000UL );
+	number_of_seconds   = filetime / 10000000UL;
+
+	*seconds          = (uint8_t) ( number_of_seconds % 60 );
+	number_of_seconds /= 60;
+	*minutes          = (uint8_t) ( number_of_seconds % 60 );
+	number_of_seconds /= 60;
+	*hours            = (uint8_t) ( number_of_seconds % 24 );
+	number_of_days    = number_of_seconds / 24;
+
+	/* Count the days relative to March 1, 0000 so that the leap day
+	 * is the last day of the year and a 400 year era has a fixed number of days
+	 */
+	number_of_days += LIBSCCA_FILETIME_DAYS_FROM_MARCH_1_0000_TO_JANUARY_1_1601;
+
+	era         = number_of_days / 146097;
+	day_of_era  = number_of_days - ( era * 146097 );
+	year_of_era = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+	day_of_year = day_of_era - ( ( 365 * year_of_era ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+
+	month_position  = ( ( 5 * day_of_year ) + 2 ) / 153;
+	calculated_year = ( era * 400 ) + year_of_era;
+
+	*day_of_month = (uint8_t) ( day_of_year - ( ( ( 153 * month_position ) + 2 ) / 5 ) + 1 );
+
+	if( month_position < 10 )
+	{
+		*month = (uint8_t) ( month_position + 3 );
+	}
+	else
+	{
+		*month = (uint8_t) ( month_position - 9 );
+
+		calculated_year += 1;
+	}
+	if( calculated_year > 9999 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid FILETIME value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*year = (uint16_t) calculated_year;
+
+	return( 1 );
+}
+
+/* Copies a FILETIME to an ISO 8601 formatted UTF-8 string
+ * The string is formatted as: YYYY-MM-DDThh:mm:ss.fffffffZ
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filetime_copy_to_utf8_string(
+     uint64_t filetime,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libscca_filetime_copy_to_utf8_string";
+	uint32_t fraction_of_second = 0;
+	uint16_t year               = 0;
+	uint8_t day_of_month        = 0;
+	uint8_t hours               = 0;
+	uint8_t minutes             = 0;
+	uint8_t month               = 0;
+	uint8_t seconds             = 0;
+	int digit_index             = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size < LIBSCCA_FILETIME_ISO8601_STRING_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_filetime_get_date_time_values(
+	     filetime,
+	     &year,
+	     &month,
+	     &day_of_month,
+	     &hours,
+	     &minutes,
+	     &seconds,
+	     &fraction_of_second,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve date and time values.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_string[ 0 ]  = (uint8_t) libscca_filetime_decimal_digit_pairs[ 2 * ( year / 100 ) ];
+	utf8_string[ 1 ]  = (uint8_t) libscca_filetime_decimal_digit_pairs[ ( 2 * ( year / 100 ) ) + 1 ];
+	utf8_string[ 2 ]  = (uint8_t) libscca_filetime_decimal_digit_pairs[ 2 * ( year % 100 ) ];
+	utf8_string[ 3 ]  = (uint8_t) libscca_filetime_decimal_digit_pairs[ ( 2 * ( year % 100 ) ) + 1 ];
+	utf8_string[ 4 ]  = (uint8_t) '-';
+	utf8_string[ 5 ]  = (uint8_t) libscca_filetime_decimal_digit_pairs[ 2 * month ];
+	utf8_string[ 6 ]  = (uint8_t) libscca_filetime_decimal_digit_pairs[ ( 2 * month ) + 1 ];
+	utf8_string[ 7 ]  = (uint8_t) '-';
+	utf8_string[ 8 ]  = (uint8_t) libscca_filetime_decimal_digit_pairs[ 2 * day_of_month ];
+	utf8_string[ 9 ]  = (uint8_t) libscca_filetime_decimal_digit_pairs[ ( 2 * day_of_month ) + 1 ];
+	utf8_string[ 10 ] = (uint8_t) 'T';
+	utf8_string[ 11 ] = (uint8_t) libscca_filetime_decimal_digit_pairs[ 2 * hours ];
+	utf8_string[ 12 ] = (uint8_t) libscca_filetime_decimal_digit_pairs[ ( 2 * hours ) + 1 ];
+	utf8_string[ 13 ] = (uint8_t) ':';
+	utf8_string[ 14 ] = (uint8_t) libscca_filetime_decimal_digit_pairs[ 2 * minutes ];
+	utf8_string[ 15 ] = (uint8_t) libscca_filetime_decimal_digit_pairs[ ( 2 * minutes ) + 1 ];
+	utf8_string[ 16 ] = (uint8_t) ':';
+	utf8_string[ 17 ] = (uint8_t) libscca_filetime_decimal_digit_pairs[ 2 * seconds ];
+	utf8_string[ 18 ] = (uint8_t) libscca_filetime_decimal_digit_pairs[ ( 2 * seconds ) + 1 ];
+	utf8_string[ 19 ] = (uint8_t) '.';
+
+	for( digit_index = 26;
+	     digit_index > 19;
+	     digit_index-- )
+	{
+		utf8_string[ digit_index ] = (uint8_t) '0' + (uint8_t) ( fraction_of_second % 10 );
+
+		fraction_of_second /= 10;
+	}
+	utf8_string[ 27 ] = (uint8_t) 'Z';
+	utf8_string[ 28 ] = 0;
+
+	return( 1 );
+}
+
+/* Copies an array of FILETIMEs to ISO 8601 formatted UTF-8 strings
+ * Every string is stored in LIBSCCA_FILETIME_ISO8601_STRING_SIZE bytes, including the end of string character
+ * The UTF-8 strings size should be at least number of FILETIMEs * LIBSCCA_FILETIME_ISO8601_STRING_SIZE
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filetime_array_copy_to_utf8_strings(
+     const uint64_t *filetimes,
+     int number_of_filetimes,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_filetime_array_copy_to_utf8_strings";
+	size_t string_offset  = 0;
+	int filetime_index    = 0;
+
+	if( filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIMEs.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_filetimes < 0 )
+	 || ( (size_t) number_of_filetimes > ( (size_t) SSIZE_MAX / LIBSCCA_FILETIME_ISO8601_STRING_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of FILETIMEs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings_size < ( (size_t) number_of_filetimes * LIBSCCA_FILETIME_ISO8601_STRING_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 strings size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( filetime_index = 0;
+	     filetime_index < number_of_filetimes;
+	     filetime_index++ )
+	{
+		if( libscca_filetime_copy_to_utf8_string(
+		     filetimes[ filetime_index ],
+		     &( utf8_strings[ string_offset ] ),
+		     LIBSCCA_FILETIME_ISO8601_STRING_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy FILETIME: %d to UTF-8 string.",
+			 function,
+			 filetime_index );
+
+			return( -1 );
+		}
+		string_offset += LIBSCCA_FILETIME_ISO8601_STRING_SIZE;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,70 @@
+/*
+ * FILETIME functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_FILETIME_H )
+#define _LIBSCCA_FILETIME_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of days between March 1, 0000 and January 1, 1601 in the proleptic Gregorian calendar
+ */
+#define LIBSCCA_FILETIME_DAYS_FROM_MARCH_1_0000_TO_JANUARY_1_1601	584694
+
+LIBSCCA_EXTERN \
+int libscca_filetime_get_date_time_values(
+     uint64_t filetime,
+     uint16_t *year,
+     uint8_t *month,
+     uint8_t *day_of_month,
+     uint8_t *hours,
+     uint8_t *minutes,
+     uint8_t *seconds,
+     uint32_t *fraction_of_second,
+     libcerror_error_t **error );
+
+int libscca_filetime_copy_to_utf8_string(
+     uint64_t filetime,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_filetime_array_copy_to_utf8_strings(
+     const uint64_t *filetimes,
+     int number_of_filetimes,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_FILETIME_H ) */
+
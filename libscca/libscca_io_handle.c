@@ -36,6 +36,7 @@
 #include "libscca_libfdatetime.h"
 #include "libscca_libfvalue.h"
 #include "libscca_libuna.h"
+#include "libscca_read_failure.h"
 #include "libscca_unused.h"
 #include "libscca_volume_information.h"
 
@@ -141,6 +142,11 @@ int libscca_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->compressed_data != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->compressed_data );
+		}
 		memory_free(
 		 *io_handle );
 
@@ -150,13 +156,18 @@ int libscca_io_handle_free(
 }
 
 /* Clears the IO handle
+ * The memory reserved for the values read when opening the file is released
  * Returns 1 if successful or -1 on error
  */
 int libscca_io_handle_clear(
      libscca_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libscca_io_handle_clear";
+	libscca_mam_decoder_t *mam_decoder = NULL;
+	uint8_t *compressed_data           = NULL;
+	static char *function              = "libscca_io_handle_clear";
+	size_t compressed_data_size        = 0;
+	size_t maximum_memory_size         = 0;
 
 	if( io_handle == NULL )
 	{
@@ -169,6 +180,14 @@ int libscca_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The maximum memory size and MAM decoder are settings and are retained,
+	 * as is the compressed data so that it is reused by subsequent opens
+	 */
+	maximum_memory_size  = io_handle->maximum_memory_size;
+	mam_decoder          = io_handle->mam_decoder;
+	compressed_data      = io_handle->compressed_data;
+	compressed_data_size = io_handle->compressed_data_size;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -183,6 +202,226 @@ int libscca_io_handle_clear(
 
 		return( -1 );
 	}
+	io_handle->maximum_memory_size  = maximum_memory_size;
+	io_handle->mam_decoder          = mam_decoder;
+	io_handle->compressed_data      = compressed_data;
+	io_handle->compressed_data_size = compressed_data_size;
+
+	/* The retained compressed data remains reserved
+	 */
+	io_handle->memory_size = compressed_data_size;
+
+	return( 1 );
+}
+
+/* Sets the MAM decoder
+ * The MAM decoder is not managed by the IO handle, where NULL represents decompression with libfwnt
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_io_handle_set_mam_decoder(
+     libscca_io_handle_t *io_handle,
+     libscca_mam_decoder_t *mam_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_io_handle_set_mam_decoder";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->mam_decoder = mam_decoder;
+
+	return( 1 );
+}
+
+/* Retrieves a compressed data buffer of at least the requested size
+ * The buffer is owned by the IO handle, it is only reallocated when it is too small
+ * and remains valid until the next call or until the IO handle is freed
+ * The memory of the buffer is reserved from the memory budget when it grows
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_io_handle_get_compressed_data(
+     libscca_io_handle_t *io_handle,
+     size_t compressed_data_size,
+     uint8_t **compressed_data,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "libscca_io_handle_get_compressed_data";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size == 0 )
+	 || ( compressed_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > io_handle->compressed_data_size )
+	{
+		if( libscca_io_handle_reserve_memory(
+		     io_handle,
+		     compressed_data_size - io_handle->compressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to reserve memory for compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (uint8_t *) memory_reallocate(
+		                            io_handle->compressed_data,
+		                            sizeof( uint8_t ) * compressed_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize compressed data.",
+			 function );
+
+			libscca_io_handle_release_memory(
+			 io_handle,
+			 compressed_data_size - io_handle->compressed_data_size,
+			 NULL );
+
+			return( -1 );
+		}
+		io_handle->compressed_data      = reallocation;
+		io_handle->compressed_data_size = compressed_data_size;
+	}
+	*compressed_data = io_handle->compressed_data;
+
+	return( 1 );
+}
+
+/* Reserves memory from the memory budget
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_io_handle_reserve_memory(
+     libscca_io_handle_t *io_handle,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_io_handle_reserve_memory";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > ( (size_t) SSIZE_MAX - io_handle->memory_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->maximum_memory_size != 0 )
+	 && ( ( io_handle->memory_size + size ) > io_handle->maximum_memory_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to reserve: %" PRIzd " bytes - maximum memory size exceeded.",
+		 function,
+		 size );
+
+		return( -1 );
+	}
+	io_handle->memory_size += size;
+
+	return( 1 );
+}
+
+/* Releases memory to the memory budget
+ * Releasing more memory than is reserved is considered an error, since it indicates
+ * an unbalanced reservation
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_io_handle_release_memory(
+     libscca_io_handle_t *io_handle,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_io_handle_release_memory";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > io_handle->memory_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size: %" PRIzd " value exceeds reserved memory size: %" PRIzd ".",
+		 function,
+		 size,
+		 io_handle->memory_size );
+
+		return( -1 );
+	}
+	io_handle->memory_size -= size;
+
 	return( 1 );
 }
 
@@ -223,6 +462,13 @@ int libscca_io_handle_read_compressed_file_header(
 		 "%s: unable to retrieve file size.",
 		 function );
 
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 0,
+		 NULL );
+
 		return( -1 );
 	}
 	if( ( file_size < 8 )
@@ -235,6 +481,13 @@ int libscca_io_handle_read_compressed_file_header(
 		 "%s: invalid file size value out of bounds.",
 		 function );
 
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 0,
+		 NULL );
+
 		return( -1 );
 	}
 	io_handle->file_size = (uint32_t) file_size;
@@ -263,6 +516,13 @@ int libscca_io_handle_read_compressed_file_header(
 		 "%s: unable to read file header data at offset: 0 (0x00000000).",
 		 function );
 
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 0,
+		 NULL );
+
 		return( -1 );
 	}
 	if( memory_compare(
@@ -288,6 +548,13 @@ int libscca_io_handle_read_compressed_file_header(
 		 "%s: unsupported signature.",
 		 function );
 
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 0,
+		 NULL );
+
 		return( -1 );
 	}
 	if( io_handle->file_type == LIBSCCA_FILE_TYPE_UNCOMPRESSED )
@@ -388,6 +655,30 @@ int libscca_io_handle_read_compressed_blocks(
 	{
 		uncompressed_block_size = (size_t) uncompressed_data_size;
 
+		/* The uncompressed data is retained by the compressed block until it is removed from the cache
+		 */
+		if( libscca_io_handle_reserve_memory(
+		     io_handle,
+		     (size_t) uncompressed_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to reserve memory for compressed block: %d.",
+			 function,
+			 compressed_block_index );
+
+			libscca_read_failure_set(
+			 &( io_handle->read_failure ),
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 file_offset,
+			 NULL );
+
+			goto on_error;
+		}
 		if( libscca_compressed_block_initialize(
 		     &compressed_block,
 		     uncompressed_block_size,
@@ -400,8 +691,15 @@ int libscca_io_handle_read_compressed_blocks(
 			 "%s: unable to create compressed block.",
 			 function );
 
+			libscca_io_handle_release_memory(
+			 io_handle,
+			 (size_t) uncompressed_block_size,
+			 NULL );
+
 			goto on_error;
 		}
+		compressed_block->io_handle = io_handle;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -414,6 +712,7 @@ int libscca_io_handle_read_compressed_blocks(
 #endif
 		read_count = libscca_compressed_block_read_file_io_handle(
 		              compressed_block,
+		              io_handle,
 		              file_io_handle,
 		              file_offset,
 		              (size_t) uncompressed_block_size,
@@ -585,6 +884,29 @@ int libscca_io_handle_read_file_metrics_array(
 	}
 	read_size = number_of_entries * entry_data_size;
 
+	/* The file metrics array data is only used while reading, the file metrics are retained
+	 */
+	if( libscca_io_handle_reserve_memory(
+	     io_handle,
+	     read_size + ( number_of_entries * sizeof( libscca_internal_file_metrics_t ) ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to reserve memory for file metrics array.",
+		 function );
+
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 (off64_t) file_offset,
+		 NULL );
+
+		return( -1 );
+	}
 	file_metrics_array_data = (uint8_t *) memory_allocate(
 	                                       sizeof( uint8_t ) * read_size );
 
@@ -629,6 +951,13 @@ int libscca_io_handle_read_file_metrics_array(
 		 file_offset,
 		 file_offset );
 
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 (off64_t) file_offset,
+		 NULL );
+
 		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -704,6 +1033,20 @@ int libscca_io_handle_read_file_metrics_array(
 	memory_free(
 	 file_metrics_array_data );
 
+	if( libscca_io_handle_release_memory(
+	     io_handle,
+	     read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to release memory of file metrics array data.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 
 on_error:
@@ -792,6 +1135,27 @@ int libscca_io_handle_read_trace_chain_array(
 	}
 	read_size = number_of_entries * entry_data_size;
 
+	if( libscca_io_handle_reserve_memory(
+	     io_handle,
+	     read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to reserve memory for trace chain array data.",
+		 function );
+
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 (off64_t) file_offset,
+		 NULL );
+
+		return( -1 );
+	}
 	trace_chain_array_data = (uint8_t *) memory_allocate(
 	                                      sizeof( uint8_t ) * read_size );
 
@@ -836,6 +1200,13 @@ int libscca_io_handle_read_trace_chain_array(
 		 file_offset,
 		 file_offset );
 
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 (off64_t) file_offset,
+		 NULL );
+
 		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -965,6 +1336,20 @@ int libscca_io_handle_read_trace_chain_array(
 	memory_free(
 	 trace_chain_array_data );
 
+	if( libscca_io_handle_release_memory(
+	     io_handle,
+	     read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to release memory of trace chain array data.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 
 on_error:
@@ -986,6 +1371,7 @@ int libscca_io_handle_read_volumes_information(
      uint32_t volumes_information_offset,
      uint32_t volumes_information_size,
      uint32_t number_of_volumes,
+     uint8_t read_flags,
      libcdata_array_t *volumes_array,
      libcerror_error_t **error )
 {
@@ -1007,6 +1393,7 @@ int libscca_io_handle_read_volumes_information(
 	uint32_t number_of_file_references                        = 0;
 	uint32_t volume_index                                     = 0;
 	uint32_t volume_information_offset                        = 0;
+	off64_t volume_information_file_offset                    = 0;
 	uint16_t number_of_characters                             = 0;
 	int entry_index                                           = 0;
 
@@ -1066,6 +1453,30 @@ int libscca_io_handle_read_volumes_information(
 
 		return( -1 );
 	}
+	/* The volumes information data is only used while reading, the volume information
+	 * is retained including copies of the strings it contains
+	 */
+	if( libscca_io_handle_reserve_memory(
+	     io_handle,
+	     ( (size_t) volumes_information_size * 2 ) + ( number_of_volumes * sizeof( libscca_internal_volume_information_t ) ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to reserve memory for volumes information.",
+		 function );
+
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 (off64_t) volumes_information_offset,
+		 NULL );
+
+		return( -1 );
+	}
 	volumes_information_data = (uint8_t *) memory_allocate(
 	                                        sizeof( uint8_t ) * volumes_information_size );
 
@@ -1110,6 +1521,13 @@ int libscca_io_handle_read_volumes_information(
 		 volumes_information_offset,
 		 volumes_information_offset );
 
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 (off64_t) volumes_information_offset,
+		 NULL );
+
 		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1148,12 +1566,21 @@ int libscca_io_handle_read_volumes_information(
 		 "%s: invalid volume information size value out of bounds.",
 		 function );
 
+		libscca_read_failure_set(
+		 &( io_handle->read_failure ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 (off64_t) volumes_information_offset,
+		 NULL );
+
 		goto on_error;
 	}
 	for( volume_index = 0;
 	     volume_index < number_of_volumes;
 	     volume_index++ )
 	{
+		volume_information_file_offset = (off64_t) volumes_information_offset + volume_information_offset;
+
 		if( libscca_volume_information_initialize(
 		     (libscca_volume_information_t **) &volume_information,
 		     error ) != 1 )
@@ -1177,6 +1604,13 @@ int libscca_io_handle_read_volumes_information(
 			 "%s: invalid volume information offset value out of bounds.",
 			 function );
 
+			libscca_read_failure_set(
+			 &( io_handle->read_failure ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 volume_information_file_offset,
+			 NULL );
+
 			goto on_error;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1390,6 +1824,13 @@ int libscca_io_handle_read_volumes_information(
 				 "%s: invalid volume device path offset value out of bounds.",
 				 function );
 
+				libscca_read_failure_set(
+				 &( io_handle->read_failure ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 volume_information_file_offset,
+				 NULL );
+
 				goto on_error;
 			}
 			if( device_path_size > ( volumes_information_size / 2 ) )
@@ -1401,6 +1842,13 @@ int libscca_io_handle_read_volumes_information(
 				 "%s: invalid volume device path size value out of bounds.",
 				 function );
 
+				libscca_read_failure_set(
+				 &( io_handle->read_failure ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 volume_information_file_offset,
+				 NULL );
+
 				goto on_error;
 			}
 			device_path_size *= 2;
@@ -1414,6 +1862,13 @@ int libscca_io_handle_read_volumes_information(
 				 "%s: invalid volume device path size value out of bounds.",
 				 function );
 
+				libscca_read_failure_set(
+				 &( io_handle->read_failure ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 volume_information_file_offset,
+				 NULL );
+
 				goto on_error;
 			}
 			volume_information->device_path = (uint8_t *) memory_allocate(
@@ -1481,6 +1936,13 @@ int libscca_io_handle_read_volumes_information(
 				 "%s: invalid file references offset value out of bounds.",
 				 function );
 
+				libscca_read_failure_set(
+				 &( io_handle->read_failure ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 volume_information_file_offset,
+				 NULL );
+
 				goto on_error;
 			}
 			if( ( file_references_size < 8 )
@@ -1494,6 +1956,13 @@ int libscca_io_handle_read_volumes_information(
 				 "%s: invalid file references size value out of bounds.",
 				 function );
 
+				libscca_read_failure_set(
+				 &( io_handle->read_failure ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 volume_information_file_offset,
+				 NULL );
+
 				goto on_error;
 			}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1542,6 +2011,13 @@ int libscca_io_handle_read_volumes_information(
 				 "%s: invalid number of file references value out of bounds.",
 				 function );
 
+				libscca_read_failure_set(
+				 &( io_handle->read_failure ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 volume_information_file_offset,
+				 NULL );
+
 				goto on_error;
 			}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1591,7 +2067,8 @@ int libscca_io_handle_read_volumes_information(
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 		}
-		if( directory_strings_array_offset != 0 )
+		if( ( directory_strings_array_offset != 0 )
+		 && ( ( read_flags & LIBSCCA_READ_FLAG_DIRECTORY_STRINGS ) != 0 ) )
 		{
 			if( ( directory_strings_array_offset < volume_information_offset )
 			 || ( directory_strings_array_offset >= volumes_information_size ) )
@@ -1603,6 +2080,13 @@ int libscca_io_handle_read_volumes_information(
 				 "%s: invalid directory strings array offset value out of bounds.",
 				 function );
 
+				libscca_read_failure_set(
+				 &( io_handle->read_failure ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 volume_information_file_offset,
+				 NULL );
+
 				goto on_error;
 			}
 			if( number_of_directory_strings > ( ( volumes_information_size - directory_strings_array_offset ) / 4 ) )
@@ -1614,6 +2098,13 @@ int libscca_io_handle_read_volumes_information(
 				 "%s: invalid number of directory strings value out of bounds.",
 				 function );
 
+				libscca_read_failure_set(
+				 &( io_handle->read_failure ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 volume_information_file_offset,
+				 NULL );
+
 				goto on_error;
 			}
 			if( libfvalue_value_type_initialize(
@@ -1674,6 +2165,13 @@ int libscca_io_handle_read_volumes_information(
 					 function,
 					 directory_string_index );
 
+					libscca_read_failure_set(
+					 &( io_handle->read_failure ),
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 volume_information_file_offset,
+					 NULL );
+
 					goto on_error;
 				}
 				/* The number of characters does not include the end-of-string character
@@ -1740,6 +2238,20 @@ int libscca_io_handle_read_volumes_information(
 	memory_free(
 	 volumes_information_data );
 
+	if( libscca_io_handle_release_memory(
+	     io_handle,
+	     (size_t) volumes_information_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to release memory of volumes information data.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 
 on_error:
@@ -1758,11 +2270,11 @@ on_error:
 }
 
 /* Reads data from the current offset into a buffer
- * Callback for the uncompressed block stream
+ * Callback for the uncompressed block stream, where the data handle is the IO handle or NULL
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libscca_io_handle_read_segment_data(
-         intptr_t *data_handle LIBSCCA_ATTRIBUTE_UNUSED,
+         intptr_t *data_handle,
          intptr_t *file_io_handle,
          int segment_index,
          int segment_file_index LIBSCCA_ATTRIBUTE_UNUSED,
@@ -1772,10 +2284,11 @@ ssize_t libscca_io_handle_read_segment_data(
          uint8_t read_flags LIBSCCA_ATTRIBUTE_UNUSED,
          libcerror_error_t **error )
 {
-	static char *function = "libscca_io_handle_read_segment_data";
-	ssize_t read_count    = 0;
+	libscca_io_handle_t *io_handle = NULL;
+	static char *function          = "libscca_io_handle_read_segment_data";
+	off64_t file_offset            = 0;
+	ssize_t read_count             = 0;
 
-	LIBSCCA_UNREFERENCED_PARAMETER( data_handle )
 	LIBSCCA_UNREFERENCED_PARAMETER( segment_file_index )
 	LIBSCCA_UNREFERENCED_PARAMETER( segment_flags )
 	LIBSCCA_UNREFERENCED_PARAMETER( read_flags )
@@ -1807,26 +2320,43 @@ ssize_t libscca_io_handle_read_segment_data(
 		 function,
 		 segment_index );
 
+		io_handle = (libscca_io_handle_t *) data_handle;
+
+		/* The current offset is where the read failed
+		 */
+		if( ( io_handle != NULL )
+		 && ( libbfio_handle_get_offset(
+		       (libbfio_handle_t *) file_io_handle,
+		       &file_offset,
+		       NULL ) == 1 ) )
+		{
+			libscca_read_failure_set(
+			 &( io_handle->read_failure ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 file_offset,
+			 NULL );
+		}
 		return( -1 );
 	}
 	return( read_count );
 }
 
 /* Seeks a certain offset of the data
- * Callback for the uncompressed block stream
+ * Callback for the uncompressed block stream, where the data handle is the IO handle or NULL
  * Returns the offset if seek is successful or -1 on error
  */
 off64_t libscca_io_handle_seek_segment_offset(
-         intptr_t *data_handle LIBSCCA_ATTRIBUTE_UNUSED,
+         intptr_t *data_handle,
          intptr_t *file_io_handle,
          int segment_index,
          int segment_file_index LIBSCCA_ATTRIBUTE_UNUSED,
          off64_t segment_offset,
          libcerror_error_t **error )
 {
-	static char *function = "libscca_io_handle_seek_segment_offset";
+	libscca_io_handle_t *io_handle = NULL;
+	static char *function          = "libscca_io_handle_seek_segment_offset";
 
-	LIBSCCA_UNREFERENCED_PARAMETER( data_handle )
 	LIBSCCA_UNREFERENCED_PARAMETER( segment_file_index )
 
 	if( libbfio_handle_seek_offset(
@@ -1844,6 +2374,17 @@ off64_t libscca_io_handle_seek_segment_offset(
 		 segment_index,
 		 segment_offset );
 
+		io_handle = (libscca_io_handle_t *) data_handle;
+
+		if( io_handle != NULL )
+		{
+			libscca_read_failure_set(
+			 &( io_handle->read_failure ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 segment_offset,
+			 NULL );
+		}
 		return( -1 );
 	}
 	return( segment_offset );
@@ -32,6 +32,8 @@
 #include "libscca_libfcache.h"
 #include "libscca_libfdata.h"
 #include "libscca_libfvalue.h"
+#include "libscca_read_failure.h"
+#include "libscca_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -63,6 +65,30 @@ struct libscca_io_handle
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+	/* The maximum memory size, where 0 represents no maximum
+	 */
+	size_t maximum_memory_size;
+
+	/* The memory size currently reserved
+	 */
+	size_t memory_size;
+
+	/* The MAM decoder, where NULL represents decompression with libfwnt
+	 */
+	libscca_mam_decoder_t *mam_decoder;
+
+	/* The compressed data, retained to be reused by subsequent reads of compressed blocks
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The read failure, recorded where the read fails
+	 */
+	libscca_read_failure_t read_failure;
 };
 
 int libscca_io_handle_initialize(
@@ -77,6 +103,27 @@ int libscca_io_handle_clear(
      libscca_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libscca_io_handle_set_mam_decoder(
+     libscca_io_handle_t *io_handle,
+     libscca_mam_decoder_t *mam_decoder,
+     libcerror_error_t **error );
+
+int libscca_io_handle_get_compressed_data(
+     libscca_io_handle_t *io_handle,
+     size_t compressed_data_size,
+     uint8_t **compressed_data,
+     libcerror_error_t **error );
+
+int libscca_io_handle_reserve_memory(
+     libscca_io_handle_t *io_handle,
+     size_t size,
+     libcerror_error_t **error );
+
+int libscca_io_handle_release_memory(
+     libscca_io_handle_t *io_handle,
+     size_t size,
+     libcerror_error_t **error );
+
 int libscca_io_handle_read_compressed_file_header(
      libscca_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -123,6 +170,7 @@ int libscca_io_handle_read_volumes_information(
      uint32_t volumes_information_offset,
      uint32_t volumes_information_size,
      uint32_t number_of_volumes,
+     uint8_t read_flags,
      libcdata_array_t *volumes_array,
      libcerror_error_t **error );
 
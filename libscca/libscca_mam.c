@@ -0,0 +1,196 @@
+/*
+ * MAM compressed container functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_io_handle.h"
+#include "libscca_libcerror.h"
+#include "libscca_mam.h"
+#include "libscca_mam_decoder.h"
+
+/* Retrieves the uncompressed data size stored in the header of a MAM container
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_mam_get_uncompressed_size(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_mam_get_uncompressed_size";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < LIBSCCA_MAM_HEADER_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     scca_mam_file_signature_win10,
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 *uncompressed_data_size );
+
+	return( 1 );
+}
+
+/* Decompresses the data of a MAM container
+ * The compressed data contains the MAM container header
+ * The decoder retains its decoding tables and can be reused by subsequent calls
+ * On input the uncompressed data size contains the size of the uncompressed data buffer,
+ * on output the size of the uncompressed data
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_mam_decompress(
+     libscca_mam_decoder_t *mam_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "libscca_mam_decompress";
+	uint32_t mam_uncompressed_size = 0;
+
+	if( mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_mam_get_uncompressed_size(
+	     compressed_data,
+	     compressed_data_size,
+	     &mam_uncompressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) mam_uncompressed_size > *uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid uncompressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_mam_decoder_decompress(
+	     (libscca_internal_mam_decoder_t *) mam_decoder,
+	     &( compressed_data[ LIBSCCA_MAM_HEADER_SIZE ] ),
+	     compressed_data_size - LIBSCCA_MAM_HEADER_SIZE,
+	     uncompressed_data,
+	     (size_t) mam_uncompressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data_size = (size_t) mam_uncompressed_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,61 @@
+/*
+ * MAM compressed container functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_MAM_H )
+#define _LIBSCCA_MAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the MAM container header
+ */
+#define LIBSCCA_MAM_HEADER_SIZE		8
+
+LIBSCCA_EXTERN \
+int libscca_mam_get_uncompressed_size(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_mam_decompress(
+     libscca_mam_decoder_t *mam_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_MAM_H ) */
+
@@ -0,0 +1,621 @@
+/*
+ * MAM (LZXpress Huffman) decoder functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+#include "libscca_mam_decoder.h"
+
+/* Reads 16 bits of the bit stream, the bits beyond the end of the compressed data are 0
+ */
+#define libscca_mam_decoder_read_bits16( compressed_data, compressed_data_size, compressed_data_offset ) \
+	( ( ( compressed_data_offset ) + 2 <= ( compressed_data_size ) ) ? \
+	  ( (uint32_t) ( compressed_data )[ ( compressed_data_offset ) ] | ( (uint32_t) ( compressed_data )[ ( compressed_data_offset ) + 1 ] << 8 ) ) : 0 )
+
+/* Creates a MAM decoder
+ * Make sure the value mam_decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_mam_decoder_initialize(
+     libscca_mam_decoder_t **mam_decoder,
+     libcerror_error_t **error )
+{
+	libscca_internal_mam_decoder_t *internal_mam_decoder = NULL;
+	static char *function                                = "libscca_mam_decoder_initialize";
+
+	if( mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mam_decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid MAM decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_mam_decoder = memory_allocate_structure(
+	                        libscca_internal_mam_decoder_t );
+
+	if( internal_mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create MAM decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_mam_decoder,
+	     0,
+	     sizeof( libscca_internal_mam_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear MAM decoder.",
+		 function );
+
+		goto on_error;
+	}
+	*mam_decoder = (libscca_mam_decoder_t *) internal_mam_decoder;
+
+	return( 1 );
+
+on_error:
+	if( internal_mam_decoder != NULL )
+	{
+		memory_free(
+		 internal_mam_decoder );
+	}
+	return( -1 );
+}
+
+/* Frees a MAM decoder
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_mam_decoder_free(
+     libscca_mam_decoder_t **mam_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_mam_decoder_free";
+
+	if( mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mam_decoder != NULL )
+	{
+		memory_free(
+		 *mam_decoder );
+
+		*mam_decoder = NULL;
+	}
+	return( 1 );
+}
+
+/* Builds the decoding table from the code lengths of a block
+ * The code lengths consist of 256 bytes with a 4-bit code length per symbol, lower nibble first
+ * The codes are canonical: ordered by code length and then by symbol
+ * The decoding table is only rebuilt if the code lengths differ from those of the previous block
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_mam_decoder_build_decoding_table(
+     libscca_internal_mam_decoder_t *internal_mam_decoder,
+     const uint8_t *code_lengths,
+     libcerror_error_t **error )
+{
+	static char *function      = "libscca_mam_decoder_build_decoding_table";
+	size_t fill_size           = 0;
+	size_t table_index         = 0;
+	uint16_t entry             = 0;
+	uint16_t symbol            = 0;
+	uint8_t code_length        = 0;
+	uint8_t symbol_code_length = 0;
+
+	if( internal_mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_mam_decoder->decoding_table_is_valid != 0 )
+	 && ( memory_compare(
+	       internal_mam_decoder->code_lengths,
+	       code_lengths,
+	       LIBSCCA_MAM_DECODER_CODE_LENGTHS_SIZE ) == 0 ) )
+	{
+		return( 1 );
+	}
+	internal_mam_decoder->decoding_table_is_valid = 0;
+
+	for( code_length = 1;
+	     code_length <= LIBSCCA_MAM_DECODER_MAXIMUM_CODE_LENGTH;
+	     code_length++ )
+	{
+		fill_size = (size_t) 1 << ( LIBSCCA_MAM_DECODER_MAXIMUM_CODE_LENGTH - code_length );
+
+		for( symbol = 0;
+		     symbol < LIBSCCA_MAM_DECODER_NUMBER_OF_SYMBOLS;
+		     symbol++ )
+		{
+			symbol_code_length = code_lengths[ symbol / 2 ];
+
+			if( ( symbol % 2 ) == 0 )
+			{
+				symbol_code_length &= 0x0f;
+			}
+			else
+			{
+				symbol_code_length >>= 4;
+			}
+			if( symbol_code_length != code_length )
+			{
+				continue;
+			}
+			if( fill_size > ( LIBSCCA_MAM_DECODER_DECODING_TABLE_SIZE - table_index ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: invalid code lengths - too many codes.",
+				 function );
+
+				return( -1 );
+			}
+			entry = (uint16_t) ( ( symbol << 4 ) | code_length );
+
+			while( fill_size > 0 )
+			{
+				internal_mam_decoder->decoding_table[ table_index++ ] = entry;
+
+				fill_size--;
+			}
+			fill_size = (size_t) 1 << ( LIBSCCA_MAM_DECODER_MAXIMUM_CODE_LENGTH - code_length );
+		}
+	}
+	if( table_index == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: invalid code lengths - missing codes.",
+		 function );
+
+		return( -1 );
+	}
+	/* The 15-bit values that do not start with a code are marked invalid
+	 */
+	if( table_index < LIBSCCA_MAM_DECODER_DECODING_TABLE_SIZE )
+	{
+		if( memory_set(
+		     &( internal_mam_decoder->decoding_table[ table_index ] ),
+		     0,
+		     sizeof( uint16_t ) * ( LIBSCCA_MAM_DECODER_DECODING_TABLE_SIZE - table_index ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear decoding table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( memory_copy(
+	     internal_mam_decoder->code_lengths,
+	     code_lengths,
+	     LIBSCCA_MAM_DECODER_CODE_LENGTHS_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy code lengths.",
+		 function );
+
+		return( -1 );
+	}
+	internal_mam_decoder->decoding_table_is_valid = 1;
+
+	return( 1 );
+}
+
+/* Decompresses LZXpress Huffman compressed data
+ * The uncompressed data size must be the exact size of the uncompressed data
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_mam_decoder_decompress(
+     libscca_internal_mam_decoder_t *internal_mam_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libscca_mam_decoder_decompress";
+	size_t block_end_offset       = 0;
+	size_t compressed_data_offset = 0;
+	size_t match_length           = 0;
+	size_t match_offset           = 0;
+	size_t uncompressed_offset    = 0;
+	uint32_t next_bits            = 0;
+	uint16_t entry                = 0;
+	uint16_t symbol               = 0;
+	uint8_t code_length           = 0;
+	uint8_t offset_bit_length     = 0;
+	int extra_bit_count           = 0;
+	int valid_bit_count           = 0;
+
+	if( internal_mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( uncompressed_offset < uncompressed_data_size )
+	{
+		/* The compressed data offset can exceed the compressed data size since
+		 * the bit stream is read ahead
+		 */
+		if( ( compressed_data_offset > compressed_data_size )
+		 || ( LIBSCCA_MAM_DECODER_CODE_LENGTHS_SIZE > ( compressed_data_size - compressed_data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( libscca_mam_decoder_build_decoding_table(
+		     internal_mam_decoder,
+		     &( compressed_data[ compressed_data_offset ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build decoding table at offset: %" PRIzd ".",
+			 function,
+			 compressed_data_offset );
+
+			return( -1 );
+		}
+		compressed_data_offset += LIBSCCA_MAM_DECODER_CODE_LENGTHS_SIZE;
+
+		/* The bits beyond the end of the compressed data are read ahead as 0,
+		 * only the bits read from the compressed data can be decoded
+		 */
+		valid_bit_count = 0;
+
+		if( ( compressed_data_offset + 2 ) <= compressed_data_size )
+		{
+			valid_bit_count += 16;
+		}
+		if( ( compressed_data_offset + 4 ) <= compressed_data_size )
+		{
+			valid_bit_count += 16;
+		}
+		next_bits  = libscca_mam_decoder_read_bits16( compressed_data, compressed_data_size, compressed_data_offset ) << 16;
+		next_bits |= libscca_mam_decoder_read_bits16( compressed_data, compressed_data_size, compressed_data_offset + 2 );
+
+		compressed_data_offset += 4;
+		extra_bit_count         = 16;
+
+		block_end_offset = uncompressed_offset + LIBSCCA_MAM_DECODER_BLOCK_SIZE;
+
+		if( block_end_offset > uncompressed_data_size )
+		{
+			block_end_offset = uncompressed_data_size;
+		}
+		while( uncompressed_offset < block_end_offset )
+		{
+			entry       = internal_mam_decoder->decoding_table[ next_bits >> ( 32 - LIBSCCA_MAM_DECODER_MAXIMUM_CODE_LENGTH ) ];
+			code_length = (uint8_t) ( entry & 0x0f );
+			symbol      = entry >> 4;
+
+			if( code_length == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: invalid code at offset: %" PRIzd ".",
+				 function,
+				 compressed_data_offset );
+
+				return( -1 );
+			}
+			next_bits      <<= code_length;
+			extra_bit_count -= code_length;
+			valid_bit_count -= code_length;
+
+			if( valid_bit_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: compressed data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( extra_bit_count < 0 )
+			{
+				if( ( compressed_data_offset + 2 ) <= compressed_data_size )
+				{
+					valid_bit_count += 16;
+				}
+				next_bits |= libscca_mam_decoder_read_bits16( compressed_data, compressed_data_size, compressed_data_offset ) << ( -extra_bit_count );
+
+				compressed_data_offset += 2;
+				extra_bit_count        += 16;
+			}
+			if( symbol < 256 )
+			{
+				uncompressed_data[ uncompressed_offset++ ] = (uint8_t) symbol;
+
+				continue;
+			}
+			symbol -= 256;
+
+			match_length      = symbol & 0x0f;
+			offset_bit_length = (uint8_t) ( symbol >> 4 );
+
+			/* The extended match length is stored in the bytes that follow the 16-bit values read so far
+			 */
+			if( match_length == 15 )
+			{
+				if( compressed_data_offset >= compressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: compressed data size value too small.",
+					 function );
+
+					return( -1 );
+				}
+				match_length = compressed_data[ compressed_data_offset++ ];
+
+				if( match_length == 255 )
+				{
+					if( ( compressed_data_size - compressed_data_offset ) < 2 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+						 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+						 "%s: compressed data size value too small.",
+						 function );
+
+						return( -1 );
+					}
+					byte_stream_copy_to_uint16_little_endian(
+					 &( compressed_data[ compressed_data_offset ] ),
+					 match_length );
+
+					compressed_data_offset += 2;
+
+					if( match_length == 0 )
+					{
+						if( ( compressed_data_size - compressed_data_offset ) < 4 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+							 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+							 "%s: compressed data size value too small.",
+							 function );
+
+							return( -1 );
+						}
+						byte_stream_copy_to_uint32_little_endian(
+						 &( compressed_data[ compressed_data_offset ] ),
+						 match_length );
+
+						compressed_data_offset += 4;
+					}
+					if( match_length < 15 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+						 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+						 "%s: invalid match length value out of bounds.",
+						 function );
+
+						return( -1 );
+					}
+					match_length -= 15;
+				}
+				match_length += 15;
+			}
+			match_length += 3;
+
+			match_offset = (size_t) 1 << offset_bit_length;
+
+			if( offset_bit_length > 0 )
+			{
+				match_offset |= next_bits >> ( 32 - offset_bit_length );
+
+				next_bits      <<= offset_bit_length;
+				extra_bit_count -= offset_bit_length;
+				valid_bit_count -= offset_bit_length;
+
+				if( valid_bit_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: compressed data size value too small.",
+					 function );
+
+					return( -1 );
+				}
+				if( extra_bit_count < 0 )
+				{
+					if( ( compressed_data_offset + 2 ) <= compressed_data_size )
+					{
+						valid_bit_count += 16;
+					}
+					next_bits |= libscca_mam_decoder_read_bits16( compressed_data, compressed_data_size, compressed_data_offset ) << ( -extra_bit_count );
+
+					compressed_data_offset += 2;
+					extra_bit_count        += 16;
+				}
+			}
+			if( match_offset > uncompressed_offset )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: invalid match offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( match_length > ( uncompressed_data_size - uncompressed_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: invalid match length value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			/* The match can overlap with the data it produces
+			 */
+			while( match_length > 0 )
+			{
+				uncompressed_data[ uncompressed_offset ] = uncompressed_data[ uncompressed_offset - match_offset ];
+
+				uncompressed_offset++;
+				match_length--;
+			}
+		}
+	}
+	return( 1 );
+}
+
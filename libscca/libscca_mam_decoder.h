@@ -0,0 +1,103 @@
+/*
+ * MAM (LZXpress Huffman) decoder functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_MAM_DECODER_H )
+#define _LIBSCCA_MAM_DECODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of symbols of the Huffman code
+ */
+#define LIBSCCA_MAM_DECODER_NUMBER_OF_SYMBOLS		512
+
+/* The maximum bit length of a Huffman code
+ */
+#define LIBSCCA_MAM_DECODER_MAXIMUM_CODE_LENGTH		15
+
+/* The number of entries in the decoding table, one for every 15-bit value
+ */
+#define LIBSCCA_MAM_DECODER_DECODING_TABLE_SIZE		32768
+
+/* The size of the code lengths table that precedes every block
+ */
+#define LIBSCCA_MAM_DECODER_CODE_LENGTHS_SIZE		256
+
+/* The number of bytes of uncompressed data that is decoded with the same code
+ */
+#define LIBSCCA_MAM_DECODER_BLOCK_SIZE			65536
+
+typedef struct libscca_internal_mam_decoder libscca_internal_mam_decoder_t;
+
+struct libscca_internal_mam_decoder
+{
+	/* The decoding table
+	 * Every entry contains the symbol in the upper 12 bits and the code length in the lower 4 bits,
+	 * a code length of 0 indicates the 15-bit value does not start with a valid code
+	 */
+	uint16_t decoding_table[ LIBSCCA_MAM_DECODER_DECODING_TABLE_SIZE ];
+
+	/* The code lengths the decoding table was built from
+	 */
+	uint8_t code_lengths[ LIBSCCA_MAM_DECODER_CODE_LENGTHS_SIZE ];
+
+	/* Value to indicate the decoding table is valid for the code lengths
+	 */
+	uint8_t decoding_table_is_valid;
+};
+
+LIBSCCA_EXTERN \
+int libscca_mam_decoder_initialize(
+     libscca_mam_decoder_t **mam_decoder,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_mam_decoder_free(
+     libscca_mam_decoder_t **mam_decoder,
+     libcerror_error_t **error );
+
+int libscca_mam_decoder_build_decoding_table(
+     libscca_internal_mam_decoder_t *internal_mam_decoder,
+     const uint8_t *code_lengths,
+     libcerror_error_t **error );
+
+int libscca_mam_decoder_decompress(
+     libscca_internal_mam_decoder_t *internal_mam_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_MAM_DECODER_H ) */
+
@@ -0,0 +1,333 @@
+/*
+ * Prefetch hash functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_libcerror.h"
+#include "libscca_prefetch_hash.h"
+#include "libscca_upper_case.h"
+
+/* Upper cases a block of 4 UTF-16 characters
+ * The characters are stored in the block as 16-bit values, the first character in the least significant bits
+ * All 4 characters are converted at once when they are in the Basic Latin range
+ * Returns the upper case block
+ */
+uint64_t libscca_prefetch_hash_upper_case_block(
+          uint64_t block )
+{
+	uint64_t lower_case_mask  = 0;
+	uint64_t upper_case_block = 0;
+	uint16_t character        = 0;
+	uint8_t character_index   = 0;
+
+	if( ( block & 0xff80ff80ff80ff80ULL ) == 0 )
+	{
+		/* Bit 7 of a character is set by the additions when it is >= 'a' and
+		 * respectively when it is > 'z', since the characters are < 0x80 the
+		 * additions cannot carry into the next character
+		 */
+		lower_case_mask = ( block + 0x001f001f001f001fULL )
+		                & ~( block + 0x0005000500050005ULL )
+		                & 0x0080008000800080ULL;
+
+		return( block - ( lower_case_mask >> 2 ) );
+	}
+	for( character_index = 0;
+	     character_index < 4;
+	     character_index++ )
+	{
+		character = (uint16_t) ( ( block >> ( character_index * 16 ) ) & 0xffff );
+
+		character = libscca_upper_case_get_utf16_character(
+		             character );
+
+		upper_case_block |= (uint64_t) character << ( character_index * 16 );
+	}
+	return( upper_case_block );
+}
+
+/* Calculates the prefetch hash of an UTF-16 string
+ * The string is hashed up to the size or the first end-of-string character
+ * The characters are upper cased and hashed as UTF-16 little-endian bytes
+ *
+ * All hash functions multiply the hash by 37 and add a byte, 8 bytes are
+ * processed at a time using precomputed powers of 37. The Windows 2008 hash
+ * function is an unrolled form of the Vista hash function and yields the same
+ * values.
+ *
+ * Returns the prefetch hash
+ */
+uint32_t libscca_prefetch_hash_calculate_utf16(
+          const uint16_t *utf16_string,
+          size_t utf16_string_size,
+          int hash_type )
+{
+	uint64_t block      = 0;
+	size_t string_index = 0;
+	uint32_t hash_value = 0;
+	uint16_t character  = 0;
+
+	if( hash_type != LIBSCCA_PREFETCH_HASH_TYPE_XP )
+	{
+		hash_value = 314159;
+	}
+	while( ( utf16_string_size - string_index ) >= 4 )
+	{
+		block = (uint64_t) utf16_string[ string_index ]
+		      | ( (uint64_t) utf16_string[ string_index + 1 ] << 16 )
+		      | ( (uint64_t) utf16_string[ string_index + 2 ] << 32 )
+		      | ( (uint64_t) utf16_string[ string_index + 3 ] << 48 );
+
+		/* Determine if the block contains an end-of-string character
+		 */
+		if( ( ( block - 0x0001000100010001ULL ) & ~block & 0x8000800080008000ULL ) != 0 )
+		{
+			break;
+		}
+		block = libscca_prefetch_hash_upper_case_block(
+		         block );
+
+		/* 37^8 .. 37^0 modulo 2^32
+		 */
+		hash_value = (uint32_t) ( ( hash_value * 3491173089UL )
+		                        + ( ( block & 0xff ) * 442596621UL )
+		                        + ( ( ( block >> 8 ) & 0xff ) * 2565726409UL )
+		                        + ( ( ( block >> 16 ) & 0xff ) * 69343957UL )
+		                        + ( ( ( block >> 24 ) & 0xff ) * 1874161UL )
+		                        + ( ( ( block >> 32 ) & 0xff ) * 50653UL )
+		                        + ( ( ( block >> 40 ) & 0xff ) * 1369UL )
+		                        + ( ( ( block >> 48 ) & 0xff ) * 37UL )
+		                        + ( ( block >> 56 ) & 0xff ) );
+
+		string_index += 4;
+	}
+	while( string_index < utf16_string_size )
+	{
+		character = utf16_string[ string_index ];
+
+		if( character == 0 )
+		{
+			break;
+		}
+		character = libscca_upper_case_get_utf16_character(
+		             character );
+
+		hash_value = ( hash_value * 37 ) + ( character & 0x00ff );
+		hash_value = ( hash_value * 37 ) + ( character >> 8 );
+
+		string_index++;
+	}
+	if( hash_type == LIBSCCA_PREFETCH_HASH_TYPE_XP )
+	{
+		hash_value *= 314159269UL;
+
+		if( hash_value > 0x80000000UL )
+		{
+			hash_value = ~hash_value + 1;
+		}
+		hash_value %= 1000000007UL;
+	}
+	return( hash_value );
+}
+
+/* Calculates the prefetch hash of an UTF-16 encoded path
+ * The path is expected to be a device path, such as \DEVICE\HARDDISKVOLUME1\WINDOWS\SYSTEM32\CMD.EXE
+ * The path is upper cased before it is hashed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_calculate_prefetch_hash(
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     int hash_type,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_calculate_prefetch_hash";
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) ( SSIZE_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_type != LIBSCCA_PREFETCH_HASH_TYPE_XP )
+	 && ( hash_type != LIBSCCA_PREFETCH_HASH_TYPE_VISTA )
+	 && ( hash_type != LIBSCCA_PREFETCH_HASH_TYPE_2008 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported hash type.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	*prefetch_hash = libscca_prefetch_hash_calculate_utf16(
+	                  utf16_string,
+	                  utf16_string_size,
+	                  hash_type );
+
+	return( 1 );
+}
+
+/* Calculates the prefetch hashes of multiple UTF-16 encoded paths
+ * The arguments are validated once after which the paths are hashed without further overhead
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_calculate_prefetch_hashes(
+     const uint16_t **utf16_strings,
+     const size_t *utf16_string_sizes,
+     int number_of_strings,
+     int hash_type,
+     uint32_t *prefetch_hashes,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_calculate_prefetch_hashes";
+	int string_index      = 0;
+
+	if( utf16_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_strings < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of strings value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_type != LIBSCCA_PREFETCH_HASH_TYPE_XP )
+	 && ( hash_type != LIBSCCA_PREFETCH_HASH_TYPE_VISTA )
+	 && ( hash_type != LIBSCCA_PREFETCH_HASH_TYPE_2008 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported hash type.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetch hashes.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		if( utf16_strings[ string_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-16 string: %d.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( utf16_string_sizes[ string_index ] > (size_t) ( SSIZE_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-16 string: %d size value exceeds maximum.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		prefetch_hashes[ string_index ] = libscca_prefetch_hash_calculate_utf16(
+		                                   utf16_strings[ string_index ],
+		                                   utf16_string_sizes[ string_index ],
+		                                   hash_type );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,65 @@
+/*
+ * Prefetch hash functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_PREFETCH_HASH_H )
+#define _LIBSCCA_PREFETCH_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+uint64_t libscca_prefetch_hash_upper_case_block(
+          uint64_t block );
+
+uint32_t libscca_prefetch_hash_calculate_utf16(
+          const uint16_t *utf16_string,
+          size_t utf16_string_size,
+          int hash_type );
+
+LIBSCCA_EXTERN \
+int libscca_calculate_prefetch_hash(
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     int hash_type,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_calculate_prefetch_hashes(
+     const uint16_t **utf16_strings,
+     const size_t *utf16_string_sizes,
+     int number_of_strings,
+     int hash_type,
+     uint32_t *prefetch_hashes,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_PREFETCH_HASH_H ) */
+
@@ -0,0 +1,92 @@
+/*
+ * Read failure functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+#include "libscca_read_failure.h"
+
+/* Clears the read failure
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_read_failure_clear(
+     libscca_read_failure_t *read_failure,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_read_failure_clear";
+
+	if( read_failure == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read failure.",
+		 function );
+
+		return( -1 );
+	}
+	read_failure->is_set       = 0;
+	read_failure->error_domain = 0;
+	read_failure->error_code   = 0;
+	read_failure->offset       = 0;
+
+	return( 1 );
+}
+
+/* Sets the read failure
+ * Only the first failure is recorded, since a failure is recorded where it occurs
+ * before it is returned to the callers this is the innermost failure
+ * Returns 1 if successful, 0 if a failure was already recorded or -1 on error
+ */
+int libscca_read_failure_set(
+     libscca_read_failure_t *read_failure,
+     int error_domain,
+     int error_code,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_read_failure_set";
+
+	if( read_failure == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read failure.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_failure->is_set != 0 )
+	{
+		return( 0 );
+	}
+	read_failure->is_set       = 1;
+	read_failure->error_domain = error_domain;
+	read_failure->error_code   = error_code;
+	read_failure->offset       = offset;
+
+	return( 1 );
+}
+
@@ -0,0 +1,74 @@
+/*
+ * Read failure functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_READ_FAILURE_H )
+#define _LIBSCCA_READ_FAILURE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libscca_read_failure libscca_read_failure_t;
+
+/* The read failure records the error domain, error code and offset of a failure
+ * to read without formatting an error message
+ */
+struct libscca_read_failure
+{
+	/* Value to indicate a failure was recorded
+	 */
+	uint8_t is_set;
+
+	/* The error domain
+	 */
+	int error_domain;
+
+	/* The error code
+	 */
+	int error_code;
+
+	/* The offset
+	 */
+	off64_t offset;
+};
+
+int libscca_read_failure_clear(
+     libscca_read_failure_t *read_failure,
+     libcerror_error_t **error );
+
+int libscca_read_failure_set(
+     libscca_read_failure_t *read_failure,
+     int error_domain,
+     int error_code,
+     off64_t offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_READ_FAILURE_H ) */
+
@@ -0,0 +1,1254 @@
+/*
+ * Snapshot functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_file.h"
+#include "libscca_file_header.h"
+#include "libscca_file_information.h"
+#include "libscca_file_metrics.h"
+#include "libscca_filename_string.h"
+#include "libscca_filename_strings.h"
+#include "libscca_libcdata.h"
+#include "libscca_libcerror.h"
+#include "libscca_snapshot.h"
+#include "libscca_volume_information.h"
+
+#include "scca_snapshot.h"
+
+const char *scca_snapshot_signature = "SCCASNAP";
+
+/* Retrieves the size of the snapshot data of a file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_snapshot_get_data_size(
+     libscca_internal_file_t *internal_file,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_information_t *volume_information = NULL;
+	static char *function                                     = "libscca_snapshot_get_data_size";
+	uint64_t required_data_size                               = 0;
+	int number_of_file_metrics_entries                        = 0;
+	int number_of_filenames                                   = 0;
+	int number_of_volumes                                     = 0;
+	int volume_index                                          = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->file_metrics_array,
+	     &number_of_file_metrics_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->volumes_array,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_filename_strings_get_number_of_filenames(
+	     internal_file->filename_strings,
+	     &number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		return( -1 );
+	}
+	/* The strings are stored after the fixed-size entries and are 8-byte aligned
+	 */
+	required_data_size = sizeof( scca_snapshot_header_t )
+	                   + ( (uint64_t) number_of_file_metrics_entries * sizeof( scca_snapshot_file_metrics_entry_t ) )
+	                   + ( (uint64_t) number_of_volumes * sizeof( scca_snapshot_volume_entry_t ) )
+	                   + ( (uint64_t) number_of_filenames * sizeof( scca_snapshot_filename_string_entry_t ) )
+	                   + ( ( (uint64_t) internal_file->filename_strings->data_size + 7 ) & ~( (uint64_t) 7 ) );
+
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->volumes_array,
+		     volume_index,
+		     (intptr_t **) &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		if( volume_information == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing volume: %d information.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		required_data_size += ( (uint64_t) volume_information->device_path_size + 7 ) & ~( (uint64_t) 7 );
+	}
+	/* The offsets in the snapshot are 32-bit
+	 */
+	if( ( required_data_size > (uint64_t) UINT32_MAX )
+	 || ( required_data_size > (uint64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = (size_t) required_data_size;
+
+	return( 1 );
+}
+
+/* Writes the snapshot data of a file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_snapshot_write_data(
+     libscca_internal_file_t *internal_file,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libscca_filename_string_t *filename_string                   = NULL;
+	libscca_internal_file_metrics_t *file_metrics                = NULL;
+	libscca_internal_volume_information_t *volume_information    = NULL;
+	scca_snapshot_file_metrics_entry_t *file_metrics_entry       = NULL;
+	scca_snapshot_filename_string_entry_t *filename_string_entry = NULL;
+	scca_snapshot_header_t *snapshot_header                      = NULL;
+	scca_snapshot_volume_entry_t *volume_entry                   = NULL;
+	static char *function                                        = "libscca_snapshot_write_data";
+	size_t data_offset                                           = 0;
+	size_t required_data_size                                    = 0;
+	size_t volumes_array_offset                                  = 0;
+	int entry_index                                              = 0;
+	int last_run_time_index                                      = 0;
+	int number_of_file_metrics_entries                           = 0;
+	int number_of_filenames                                      = 0;
+	int number_of_volumes                                        = 0;
+
+	if( libscca_snapshot_get_data_size(
+	     internal_file,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve snapshot data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < required_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->file_metrics_array,
+	     &number_of_file_metrics_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->volumes_array,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_filename_strings_get_number_of_filenames(
+	     internal_file->filename_strings,
+	     &number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     required_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+	snapshot_header = (scca_snapshot_header_t *) data;
+
+	if( memory_copy(
+	     snapshot_header->signature,
+	     scca_snapshot_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 snapshot_header->version,
+	 LIBSCCA_SNAPSHOT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 snapshot_header->format_version,
+	 internal_file->file_header->format_version );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 snapshot_header->data_size,
+	 (uint64_t) required_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 snapshot_header->file_size,
+	 internal_file->file_header->file_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 snapshot_header->prefetch_hash,
+	 internal_file->file_header->prefetch_hash );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 snapshot_header->run_count,
+	 internal_file->file_information->run_count );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 snapshot_header->executable_filename_size,
+	 (uint32_t) internal_file->file_header->executable_filename_size );
+
+	for( last_run_time_index = 0;
+	     last_run_time_index < 8;
+	     last_run_time_index++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( snapshot_header->last_run_times[ last_run_time_index * 8 ] ),
+		 internal_file->file_information->last_run_time[ last_run_time_index ] );
+	}
+	if( memory_copy(
+	     snapshot_header->executable_filename,
+	     internal_file->file_header->executable_filename,
+	     60 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = sizeof( scca_snapshot_header_t );
+
+	if( number_of_file_metrics_entries > 0 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 snapshot_header->file_metrics_array_offset,
+		 (uint32_t) data_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 snapshot_header->number_of_file_metrics_entries,
+		 (uint32_t) number_of_file_metrics_entries );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_file_metrics_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->file_metrics_array,
+		     entry_index,
+		     (intptr_t **) &file_metrics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( file_metrics == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing file metrics entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		file_metrics_entry = (scca_snapshot_file_metrics_entry_t *) &( data[ data_offset ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 file_metrics_entry->start_time,
+		 file_metrics->start_time );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 file_metrics_entry->duration,
+		 file_metrics->duration );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 file_metrics_entry->filename_string_offset,
+		 file_metrics->filename_string_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 file_metrics_entry->flags,
+		 file_metrics->flags );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 file_metrics_entry->file_reference,
+		 file_metrics->file_reference );
+
+		file_metrics_entry->file_reference_is_set[ 0 ] = file_metrics->file_reference_is_set;
+
+		data_offset += sizeof( scca_snapshot_file_metrics_entry_t );
+	}
+	volumes_array_offset = data_offset;
+
+	if( number_of_volumes > 0 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 snapshot_header->volumes_array_offset,
+		 (uint32_t) volumes_array_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 snapshot_header->number_of_volumes,
+		 (uint32_t) number_of_volumes );
+	}
+	data_offset += (size_t) number_of_volumes * sizeof( scca_snapshot_volume_entry_t );
+
+	/* The filename string entries are stored so that the filename strings
+	 * do not need to be read again when the snapshot is opened
+	 */
+	if( number_of_filenames > 0 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 snapshot_header->filename_string_entries_array_offset,
+		 (uint32_t) data_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 snapshot_header->number_of_filename_string_entries,
+		 (uint32_t) number_of_filenames );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_filenames;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->filename_strings->strings_array,
+		     entry_index,
+		     (intptr_t **) &filename_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename string: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( filename_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing filename string: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		filename_string_entry = (scca_snapshot_filename_string_entry_t *) &( data[ data_offset ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 filename_string_entry->offset,
+		 filename_string->offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 filename_string_entry->size,
+		 (uint32_t) filename_string->data_size );
+
+		data_offset += sizeof( scca_snapshot_filename_string_entry_t );
+	}
+	if( internal_file->filename_strings->data_size > 0 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 snapshot_header->filename_strings_offset,
+		 (uint32_t) data_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 snapshot_header->filename_strings_size,
+		 (uint32_t) internal_file->filename_strings->data_size );
+
+		if( memory_copy(
+		     &( data[ data_offset ] ),
+		     internal_file->filename_strings->data,
+		     internal_file->filename_strings->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy filename strings.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += ( internal_file->filename_strings->data_size + 7 ) & ~( (size_t) 7 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_volumes;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->volumes_array,
+		     entry_index,
+		     (intptr_t **) &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( volume_information == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing volume: %d information.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		volume_entry = (scca_snapshot_volume_entry_t *) &( data[ volumes_array_offset ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 volume_entry->creation_time,
+		 volume_information->creation_time );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 volume_entry->serial_number,
+		 volume_information->serial_number );
+
+		if( ( volume_information->device_path != NULL )
+		 && ( volume_information->device_path_size > 0 ) )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 volume_entry->device_path_offset,
+			 (uint32_t) data_offset );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 volume_entry->device_path_size,
+			 volume_information->device_path_size );
+
+			if( memory_copy(
+			     &( data[ data_offset ] ),
+			     volume_information->device_path,
+			     (size_t) volume_information->device_path_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy volume: %d device path.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			data_offset += ( (size_t) volume_information->device_path_size + 7 ) & ~( (size_t) 7 );
+		}
+		volumes_array_offset += sizeof( scca_snapshot_volume_entry_t );
+	}
+	return( 1 );
+}
+
+/* Reads the snapshot data of a file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_snapshot_read_data(
+     libscca_internal_file_t *internal_file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libscca_file_metrics_t *file_metrics                               = NULL;
+	libscca_internal_file_metrics_t *internal_file_metrics             = NULL;
+	libscca_internal_volume_information_t *internal_volume_information = NULL;
+	libscca_volume_information_t *volume_information                   = NULL;
+	scca_snapshot_file_metrics_entry_t *file_metrics_entry             = NULL;
+	scca_snapshot_filename_string_entry_t *filename_string_entry       = NULL;
+	scca_snapshot_header_t *snapshot_header                            = NULL;
+	scca_snapshot_volume_entry_t *volume_entry                         = NULL;
+	static char *function                                              = "libscca_snapshot_read_data";
+	size_t snapshot_data_size                                          = 0;
+	uint64_t value_64bit                                               = 0;
+	uint32_t device_path_offset                                        = 0;
+	uint32_t device_path_size                                          = 0;
+	uint32_t entry_index                                               = 0;
+	uint32_t executable_filename_size                                  = 0;
+	uint32_t file_metrics_array_offset                                 = 0;
+	uint32_t filename_string_entries_array_offset                      = 0;
+	uint32_t filename_string_offset                                    = 0;
+	uint32_t filename_string_size                                      = 0;
+	uint32_t filename_strings_offset                                   = 0;
+	uint32_t filename_strings_size                                     = 0;
+	uint32_t number_of_file_metrics_entries                            = 0;
+	uint32_t number_of_filename_string_entries                         = 0;
+	uint32_t number_of_volumes                                         = 0;
+	uint32_t version                                                   = 0;
+	uint32_t volumes_array_offset                                      = 0;
+	int array_entry_index                                              = 0;
+	int last_run_time_index                                            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file header value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( scca_snapshot_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	snapshot_header = (scca_snapshot_header_t *) data;
+
+	if( memory_compare(
+	     snapshot_header->signature,
+	     scca_snapshot_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->version,
+	 version );
+
+	if( version != LIBSCCA_SNAPSHOT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported version: %" PRIu32 ".",
+		 function,
+		 version );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 snapshot_header->data_size,
+	 value_64bit );
+
+	if( ( value_64bit < (uint64_t) sizeof( scca_snapshot_header_t ) )
+	 || ( value_64bit > (uint64_t) data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	snapshot_data_size = (size_t) value_64bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->executable_filename_size,
+	 executable_filename_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->file_metrics_array_offset,
+	 file_metrics_array_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->number_of_file_metrics_entries,
+	 number_of_file_metrics_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->filename_strings_offset,
+	 filename_strings_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->filename_strings_size,
+	 filename_strings_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->filename_string_entries_array_offset,
+	 filename_string_entries_array_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->number_of_filename_string_entries,
+	 number_of_filename_string_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->volumes_array_offset,
+	 volumes_array_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->number_of_volumes,
+	 number_of_volumes );
+
+	if( executable_filename_size > 60 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid executable filename size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_file_metrics_entries > 0 )
+	 && ( ( file_metrics_array_offset < sizeof( scca_snapshot_header_t ) )
+	  ||  ( file_metrics_array_offset > snapshot_data_size )
+	  ||  ( number_of_file_metrics_entries > ( ( snapshot_data_size - file_metrics_array_offset ) / sizeof( scca_snapshot_file_metrics_entry_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file metrics array value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_volumes > 0 )
+	 && ( ( volumes_array_offset < sizeof( scca_snapshot_header_t ) )
+	  ||  ( volumes_array_offset > snapshot_data_size )
+	  ||  ( number_of_volumes > ( ( snapshot_data_size - volumes_array_offset ) / sizeof( scca_snapshot_volume_entry_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volumes array value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_strings_size > 0 )
+	 && ( ( filename_strings_offset < sizeof( scca_snapshot_header_t ) )
+	  ||  ( filename_strings_offset > snapshot_data_size )
+	  ||  ( filename_strings_size > ( snapshot_data_size - filename_strings_offset ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename strings value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_filename_string_entries > 0 )
+	 && ( ( filename_string_entries_array_offset < sizeof( scca_snapshot_header_t ) )
+	  ||  ( filename_string_entries_array_offset > snapshot_data_size )
+	  ||  ( number_of_filename_string_entries > ( ( snapshot_data_size - filename_string_entries_array_offset ) / sizeof( scca_snapshot_filename_string_entry_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename string entries array value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_header_initialize(
+	     &( internal_file->file_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->format_version,
+	 internal_file->file_header->format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->file_size,
+	 internal_file->file_header->file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->prefetch_hash,
+	 internal_file->file_header->prefetch_hash );
+
+	if( memory_copy(
+	     internal_file->file_header->executable_filename,
+	     snapshot_header->executable_filename,
+	     60 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy executable filename.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->file_header->executable_filename_size = (size_t) executable_filename_size;
+
+	if( libscca_file_information_initialize(
+	     &( internal_file->file_information ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file information.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->run_count,
+	 internal_file->file_information->run_count );
+
+	for( last_run_time_index = 0;
+	     last_run_time_index < 8;
+	     last_run_time_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( snapshot_header->last_run_times[ last_run_time_index * 8 ] ),
+		 internal_file->file_information->last_run_time[ last_run_time_index ] );
+	}
+	internal_file->file_information->number_of_file_metrics_entries = number_of_file_metrics_entries;
+	internal_file->file_information->number_of_volumes              = number_of_volumes;
+
+	internal_file->io_handle->format_version         = internal_file->file_header->format_version;
+	internal_file->io_handle->file_size              = internal_file->file_header->file_size;
+	internal_file->io_handle->uncompressed_data_size = internal_file->file_header->file_size;
+
+	/* The file metrics refer to the filename strings
+	 * The filename strings are not read from the data but from their precomputed entries
+	 */
+	if( ( filename_strings_size > 0 )
+	 && ( ( internal_file->read_flags & ( LIBSCCA_READ_FLAG_FILE_METRICS | LIBSCCA_READ_FLAG_FILENAME_STRINGS ) ) != 0 ) )
+	{
+		if( libscca_filename_strings_set_data(
+		     internal_file->filename_strings,
+		     &( data[ filename_strings_offset ] ),
+		     (size_t) filename_strings_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename strings.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_filename_string_entries;
+		     entry_index++ )
+		{
+			filename_string_entry = (scca_snapshot_filename_string_entry_t *) &( data[ filename_string_entries_array_offset + ( entry_index * sizeof( scca_snapshot_filename_string_entry_t ) ) ] );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 filename_string_entry->offset,
+			 filename_string_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 filename_string_entry->size,
+			 filename_string_size );
+
+			if( libscca_filename_strings_append_filename(
+			     internal_file->filename_strings,
+			     filename_string_offset,
+			     filename_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append filename string: %" PRIu32 ".",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( ( internal_file->read_flags & LIBSCCA_READ_FLAG_FILE_METRICS ) != 0 )
+	{
+		for( entry_index = 0;
+		     entry_index < number_of_file_metrics_entries;
+		     entry_index++ )
+		{
+			file_metrics_entry = (scca_snapshot_file_metrics_entry_t *) &( data[ file_metrics_array_offset + ( entry_index * sizeof( scca_snapshot_file_metrics_entry_t ) ) ] );
+
+			if( libscca_file_metrics_initialize(
+			     &file_metrics,
+			     internal_file->filename_strings,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create file metrics entry: %" PRIu32 ".",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			internal_file_metrics = (libscca_internal_file_metrics_t *) file_metrics;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 file_metrics_entry->start_time,
+			 internal_file_metrics->start_time );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 file_metrics_entry->duration,
+			 internal_file_metrics->duration );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 file_metrics_entry->filename_string_offset,
+			 internal_file_metrics->filename_string_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 file_metrics_entry->flags,
+			 internal_file_metrics->flags );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 file_metrics_entry->file_reference,
+			 internal_file_metrics->file_reference );
+
+			internal_file_metrics->file_reference_is_set = file_metrics_entry->file_reference_is_set[ 0 ];
+
+			if( libcdata_array_append_entry(
+			     internal_file->file_metrics_array,
+			     &array_entry_index,
+			     (intptr_t *) file_metrics,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append file metrics entry: %" PRIu32 " to array.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			file_metrics = NULL;
+		}
+	}
+	if( ( internal_file->read_flags & LIBSCCA_READ_FLAG_VOLUMES ) != 0 )
+	{
+		for( entry_index = 0;
+		     entry_index < number_of_volumes;
+		     entry_index++ )
+		{
+			volume_entry = (scca_snapshot_volume_entry_t *) &( data[ volumes_array_offset + ( entry_index * sizeof( scca_snapshot_volume_entry_t ) ) ] );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 volume_entry->device_path_offset,
+			 device_path_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 volume_entry->device_path_size,
+			 device_path_size );
+
+			if( ( device_path_size > 0 )
+			 && ( ( device_path_offset < sizeof( scca_snapshot_header_t ) )
+			  ||  ( device_path_offset > snapshot_data_size )
+			  ||  ( device_path_size > ( snapshot_data_size - device_path_offset ) ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume: %" PRIu32 " device path value out of bounds.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( libscca_volume_information_initialize(
+			     &volume_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create volume: %" PRIu32 " information.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			internal_volume_information = (libscca_internal_volume_information_t *) volume_information;
+
+			byte_stream_copy_to_uint64_little_endian(
+			 volume_entry->creation_time,
+			 internal_volume_information->creation_time );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 volume_entry->serial_number,
+			 internal_volume_information->serial_number );
+
+			if( device_path_size > 0 )
+			{
+				internal_volume_information->device_path = (uint8_t *) memory_allocate(
+				                                                        sizeof( uint8_t ) * device_path_size );
+
+				if( internal_volume_information->device_path == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create device path.",
+					 function );
+
+					goto on_error;
+				}
+				internal_volume_information->device_path_size = device_path_size;
+
+				if( memory_copy(
+				     internal_volume_information->device_path,
+				     &( data[ device_path_offset ] ),
+				     (size_t) device_path_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy device path.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libcdata_array_append_entry(
+			     internal_file->volumes_array,
+			     &array_entry_index,
+			     (intptr_t *) volume_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append volume: %" PRIu32 " information to array.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			volume_information = NULL;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( volume_information != NULL )
+	{
+		libscca_internal_volume_information_free(
+		 (libscca_internal_volume_information_t **) &volume_information,
+		 NULL );
+	}
+	if( file_metrics != NULL )
+	{
+		libscca_internal_file_metrics_free(
+		 (libscca_internal_file_metrics_t **) &file_metrics,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 internal_file->volumes_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_volume_information_free,
+	 NULL );
+
+	libcdata_array_empty(
+	 internal_file->file_metrics_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_file_metrics_free,
+	 NULL );
+
+	libscca_filename_strings_clear(
+	 internal_file->filename_strings,
+	 NULL );
+
+	if( internal_file->file_information != NULL )
+	{
+		libscca_file_information_free(
+		 &( internal_file->file_information ),
+		 NULL );
+	}
+	if( internal_file->file_header != NULL )
+	{
+		libscca_file_header_free(
+		 &( internal_file->file_header ),
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,61 @@
+/*
+ * Snapshot functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_SNAPSHOT_H )
+#define _LIBSCCA_SNAPSHOT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_file.h"
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The snapshot version
+ */
+#define LIBSCCA_SNAPSHOT_VERSION	2
+
+int libscca_snapshot_get_data_size(
+     libscca_internal_file_t *internal_file,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libscca_snapshot_write_data(
+     libscca_internal_file_t *internal_file,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libscca_snapshot_read_data(
+     libscca_internal_file_t *internal_file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_SNAPSHOT_H ) */
+
@@ -0,0 +1,815 @@
+/*
+ * Task scheduler functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_task_scheduler.h"
+
+/* Creates a task scheduler
+ * Make sure the value task_scheduler is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_task_scheduler_initialize(
+     libscca_task_scheduler_t **task_scheduler,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	libscca_internal_task_scheduler_t *internal_task_scheduler = NULL;
+	static char *function                                      = "libscca_task_scheduler_initialize";
+
+#if defined( HAVE_LIBSCCA_MULTI_THREAD_SUPPORT )
+	int queue_index                                            = 0;
+#endif
+
+	if( task_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *task_scheduler != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid task scheduler value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( number_of_workers > LIBSCCA_TASK_SCHEDULER_MAXIMUM_NUMBER_OF_WORKERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_task_scheduler = memory_allocate_structure(
+	                           libscca_internal_task_scheduler_t );
+
+	if( internal_task_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create task scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_task_scheduler,
+	     0,
+	     sizeof( libscca_internal_task_scheduler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear task scheduler.",
+		 function );
+
+		memory_free(
+		 internal_task_scheduler );
+
+		return( -1 );
+	}
+	internal_task_scheduler->queues = (libscca_task_scheduler_queue_t *) memory_allocate(
+	                                                                      sizeof( libscca_task_scheduler_queue_t ) * number_of_workers );
+
+	if( internal_task_scheduler->queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create queues.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_task_scheduler->queues,
+	     0,
+	     sizeof( libscca_task_scheduler_queue_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear queues.",
+		 function );
+
+		goto on_error;
+	}
+	internal_task_scheduler->number_of_workers = number_of_workers;
+
+#if defined( HAVE_LIBSCCA_MULTI_THREAD_SUPPORT )
+	for( queue_index = 0;
+	     queue_index < number_of_workers;
+	     queue_index++ )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( internal_task_scheduler->queues[ queue_index ].mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize mutex of queue: %d.",
+			 function,
+			 queue_index );
+
+			goto on_error;
+		}
+	}
+#endif
+	*task_scheduler = (libscca_task_scheduler_t *) internal_task_scheduler;
+
+	return( 1 );
+
+on_error:
+	if( internal_task_scheduler != NULL )
+	{
+		libscca_task_scheduler_free(
+		 (libscca_task_scheduler_t **) &internal_task_scheduler,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a task scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_task_scheduler_free(
+     libscca_task_scheduler_t **task_scheduler,
+     libcerror_error_t **error )
+{
+	libscca_internal_task_scheduler_t *internal_task_scheduler = NULL;
+	static char *function                                      = "libscca_task_scheduler_free";
+	int queue_index                                            = 0;
+	int result                                                 = 1;
+
+	if( task_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *task_scheduler != NULL )
+	{
+		internal_task_scheduler = (libscca_internal_task_scheduler_t *) *task_scheduler;
+		*task_scheduler         = NULL;
+
+		if( internal_task_scheduler->queues != NULL )
+		{
+			for( queue_index = 0;
+			     queue_index < internal_task_scheduler->number_of_workers;
+			     queue_index++ )
+			{
+				if( internal_task_scheduler->queues[ queue_index ].task_indexes != NULL )
+				{
+					memory_free(
+					 internal_task_scheduler->queues[ queue_index ].task_indexes );
+				}
+#if defined( HAVE_LIBSCCA_MULTI_THREAD_SUPPORT )
+				if( internal_task_scheduler->queues[ queue_index ].mutex != NULL )
+				{
+					if( libcthreads_mutex_free(
+					     &( internal_task_scheduler->queues[ queue_index ].mutex ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free mutex of queue: %d.",
+						 function,
+						 queue_index );
+
+						result = -1;
+					}
+				}
+#endif
+			}
+			memory_free(
+			 internal_task_scheduler->queues );
+		}
+		if( internal_task_scheduler->tasks != NULL )
+		{
+			memory_free(
+			 internal_task_scheduler->tasks );
+		}
+		memory_free(
+		 internal_task_scheduler );
+	}
+	return( result );
+}
+
+/* Appends a task
+ * The weight is an estimate of the cost of the task, e.g. the size of the data to process
+ * The task index is the number of tasks appended before this task
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_task_scheduler_append_task(
+     libscca_task_scheduler_t *task_scheduler,
+     size64_t weight,
+     int *task_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_task_scheduler_t *internal_task_scheduler = NULL;
+	void *reallocation                                         = NULL;
+	static char *function                                      = "libscca_task_scheduler_append_task";
+	int number_of_allocated_tasks                              = 0;
+
+	if( task_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	internal_task_scheduler = (libscca_internal_task_scheduler_t *) task_scheduler;
+
+	if( internal_task_scheduler->is_started != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid task scheduler - already started.",
+		 function );
+
+		return( -1 );
+	}
+	if( task_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_task_scheduler->number_of_tasks >= internal_task_scheduler->number_of_allocated_tasks )
+	{
+		if( internal_task_scheduler->number_of_allocated_tasks == 0 )
+		{
+			number_of_allocated_tasks = 256;
+		}
+		else if( internal_task_scheduler->number_of_allocated_tasks < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_tasks = internal_task_scheduler->number_of_allocated_tasks * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of tasks value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) number_of_allocated_tasks > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libscca_task_scheduler_task_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated tasks value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                internal_task_scheduler->tasks,
+		                sizeof( libscca_task_scheduler_task_t ) * number_of_allocated_tasks );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize tasks.",
+			 function );
+
+			return( -1 );
+		}
+		internal_task_scheduler->tasks                     = (libscca_task_scheduler_task_t *) reallocation;
+		internal_task_scheduler->number_of_allocated_tasks = number_of_allocated_tasks;
+	}
+	*task_index = internal_task_scheduler->number_of_tasks;
+
+	internal_task_scheduler->tasks[ *task_index ].weight = weight;
+	internal_task_scheduler->tasks[ *task_index ].index  = *task_index;
+
+	internal_task_scheduler->number_of_tasks += 1;
+
+	return( 1 );
+}
+
+/* Compares two tasks by descending weight and ascending index
+ * Returns a negative value if first task is to be scheduled before the second task or a positive value otherwise
+ */
+int libscca_task_scheduler_compare_tasks(
+     const libscca_task_scheduler_task_t *first_task,
+     const libscca_task_scheduler_task_t *second_task )
+{
+	if( first_task->weight > second_task->weight )
+	{
+		return( -1 );
+	}
+	else if( first_task->weight < second_task->weight )
+	{
+		return( 1 );
+	}
+	if( first_task->index < second_task->index )
+	{
+		return( -1 );
+	}
+	else if( first_task->index > second_task->index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Starts the task scheduler
+ * The tasks are ordered by descending weight and dealt out over the queues of the workers
+ * so that every worker starts with one of the largest tasks
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_task_scheduler_start(
+     libscca_task_scheduler_t *task_scheduler,
+     libcerror_error_t **error )
+{
+	libscca_internal_task_scheduler_t *internal_task_scheduler = NULL;
+	libscca_task_scheduler_queue_t *queue                      = NULL;
+	static char *function                                      = "libscca_task_scheduler_start";
+	int maximum_number_of_queued_tasks                         = 0;
+	int queue_index                                            = 0;
+	int sorted_task_index                                      = 0;
+
+	if( task_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	internal_task_scheduler = (libscca_internal_task_scheduler_t *) task_scheduler;
+
+	if( internal_task_scheduler->is_started != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid task scheduler - already started.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_task_scheduler->number_of_tasks > 1 )
+	{
+		qsort(
+		 internal_task_scheduler->tasks,
+		 (size_t) internal_task_scheduler->number_of_tasks,
+		 sizeof( libscca_task_scheduler_task_t ),
+		 (int (*)(const void *, const void *)) &libscca_task_scheduler_compare_tasks );
+	}
+	maximum_number_of_queued_tasks = ( internal_task_scheduler->number_of_tasks / internal_task_scheduler->number_of_workers ) + 1;
+
+	for( queue_index = 0;
+	     queue_index < internal_task_scheduler->number_of_workers;
+	     queue_index++ )
+	{
+		queue = &( internal_task_scheduler->queues[ queue_index ] );
+
+		queue->task_indexes = (int *) memory_allocate(
+		                               sizeof( int ) * maximum_number_of_queued_tasks );
+
+		if( queue->task_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create task indexes of queue: %d.",
+			 function,
+			 queue_index );
+
+			goto on_error;
+		}
+		queue->first_index      = 0;
+		queue->last_index       = 0;
+		queue->remaining_weight = 0;
+	}
+	/* Deal the tasks out round-robin, the queues remain ordered by descending weight
+	 */
+	for( sorted_task_index = 0;
+	     sorted_task_index < internal_task_scheduler->number_of_tasks;
+	     sorted_task_index++ )
+	{
+		queue = &( internal_task_scheduler->queues[ sorted_task_index % internal_task_scheduler->number_of_workers ] );
+
+		queue->task_indexes[ queue->last_index++ ] = sorted_task_index;
+		queue->remaining_weight                   += internal_task_scheduler->tasks[ sorted_task_index ].weight;
+	}
+	internal_task_scheduler->is_started = 1;
+
+	return( 1 );
+
+on_error:
+	for( queue_index = 0;
+	     queue_index < internal_task_scheduler->number_of_workers;
+	     queue_index++ )
+	{
+		queue = &( internal_task_scheduler->queues[ queue_index ] );
+
+		if( queue->task_indexes != NULL )
+		{
+			memory_free(
+			 queue->task_indexes );
+
+			queue->task_indexes = NULL;
+		}
+	}
+	return( -1 );
+}
+
+/* Retrieves the number and weight of the remaining tasks of a queue
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_task_scheduler_queue_get_remaining(
+     libscca_task_scheduler_queue_t *queue,
+     int *number_of_remaining_tasks,
+     size64_t *remaining_weight,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_task_scheduler_queue_get_remaining";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_remaining_tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of remaining tasks.",
+		 function );
+
+		return( -1 );
+	}
+	if( remaining_weight == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid remaining weight.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSCCA_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_remaining_tasks = queue->last_index - queue->first_index;
+	*remaining_weight          = queue->remaining_weight;
+
+#if defined( HAVE_LIBSCCA_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Removes the first, largest remaining, task from a queue
+ * Returns 1 if successful, 0 if the queue is empty or -1 on error
+ */
+int libscca_task_scheduler_queue_pop_first(
+     libscca_internal_task_scheduler_t *internal_task_scheduler,
+     libscca_task_scheduler_queue_t *queue,
+     int *task_index,
+     libcerror_error_t **error )
+{
+	libscca_task_scheduler_task_t *task = NULL;
+	static char *function               = "libscca_task_scheduler_queue_pop_first";
+	int result                          = 0;
+
+	if( internal_task_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( task_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSCCA_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( queue->first_index < queue->last_index )
+	{
+		task = &( internal_task_scheduler->tasks[ queue->task_indexes[ queue->first_index ] ] );
+
+		queue->first_index      += 1;
+		queue->remaining_weight -= task->weight;
+
+		*task_index = task->index;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBSCCA_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the next task of a worker
+ * A worker takes the tasks of its own queue first, largest first. When its queue is
+ * empty it steals the largest remaining task of the queue with the most remaining work
+ * This function can be called concurrently by different workers
+ * Returns 1 if successful, 0 if no tasks remain or -1 on error
+ */
+int libscca_task_scheduler_get_next_task(
+     libscca_task_scheduler_t *task_scheduler,
+     int worker_index,
+     int *task_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_task_scheduler_t *internal_task_scheduler = NULL;
+	static char *function                                      = "libscca_task_scheduler_get_next_task";
+	size64_t remaining_weight                                  = 0;
+	size64_t victim_remaining_weight                           = 0;
+	int number_of_remaining_tasks                              = 0;
+	int queue_index                                            = 0;
+	int result                                                 = 0;
+	int victim_number_of_remaining_tasks                       = 0;
+	int victim_queue_index                                     = 0;
+
+	if( task_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	internal_task_scheduler = (libscca_internal_task_scheduler_t *) task_scheduler;
+
+	if( internal_task_scheduler->is_started == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid task scheduler - not started.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= internal_task_scheduler->number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_task_scheduler_queue_pop_first(
+	          internal_task_scheduler,
+	          &( internal_task_scheduler->queues[ worker_index ] ),
+	          task_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve task from queue: %d.",
+		 function,
+		 worker_index );
+
+		return( -1 );
+	}
+	/* Another worker can empty the victim queue between the scan and the steal,
+	 * in which case the queues are scanned again
+	 */
+	while( result == 0 )
+	{
+		victim_number_of_remaining_tasks = 0;
+		victim_remaining_weight          = 0;
+
+		for( queue_index = 0;
+		     queue_index < internal_task_scheduler->number_of_workers;
+		     queue_index++ )
+		{
+			if( queue_index == worker_index )
+			{
+				continue;
+			}
+			if( libscca_task_scheduler_queue_get_remaining(
+			     &( internal_task_scheduler->queues[ queue_index ] ),
+			     &number_of_remaining_tasks,
+			     &remaining_weight,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve remaining tasks of queue: %d.",
+				 function,
+				 queue_index );
+
+				return( -1 );
+			}
+			if( number_of_remaining_tasks == 0 )
+			{
+				continue;
+			}
+			if( ( victim_number_of_remaining_tasks == 0 )
+			 || ( remaining_weight > victim_remaining_weight )
+			 || ( ( remaining_weight == victim_remaining_weight )
+			  &&  ( number_of_remaining_tasks > victim_number_of_remaining_tasks ) ) )
+			{
+				victim_queue_index               = queue_index;
+				victim_number_of_remaining_tasks = number_of_remaining_tasks;
+				victim_remaining_weight          = remaining_weight;
+			}
+		}
+		if( victim_number_of_remaining_tasks == 0 )
+		{
+			break;
+		}
+		result = libscca_task_scheduler_queue_pop_first(
+		          internal_task_scheduler,
+		          &( internal_task_scheduler->queues[ victim_queue_index ] ),
+		          task_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve task from queue: %d.",
+			 function,
+			 victim_queue_index );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
@@ -0,0 +1,159 @@
+/*
+ * Task scheduler functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_TASK_SCHEDULER_H )
+#define _LIBSCCA_TASK_SCHEDULER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBSCCA_TASK_SCHEDULER_MAXIMUM_NUMBER_OF_WORKERS	1024
+
+typedef struct libscca_task_scheduler_task libscca_task_scheduler_task_t;
+
+struct libscca_task_scheduler_task
+{
+	/* The (estimated) weight
+	 */
+	size64_t weight;
+
+	/* The index
+	 */
+	int index;
+};
+
+typedef struct libscca_task_scheduler_queue libscca_task_scheduler_queue_t;
+
+struct libscca_task_scheduler_queue
+{
+	/* The task indexes, ordered by descending weight
+	 */
+	int *task_indexes;
+
+	/* The index of the first remaining task
+	 */
+	int first_index;
+
+	/* The index after the last remaining task
+	 */
+	int last_index;
+
+	/* The weight of the remaining tasks
+	 */
+	size64_t remaining_weight;
+
+#if defined( HAVE_LIBSCCA_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+typedef struct libscca_internal_task_scheduler libscca_internal_task_scheduler_t;
+
+struct libscca_internal_task_scheduler
+{
+	/* The tasks
+	 */
+	libscca_task_scheduler_task_t *tasks;
+
+	/* The number of tasks
+	 */
+	int number_of_tasks;
+
+	/* The number of allocated tasks
+	 */
+	int number_of_allocated_tasks;
+
+	/* The queues, one per worker
+	 */
+	libscca_task_scheduler_queue_t *queues;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* Value to indicate the tasks were distributed over the queues
+	 */
+	uint8_t is_started;
+};
+
+LIBSCCA_EXTERN \
+int libscca_task_scheduler_initialize(
+     libscca_task_scheduler_t **task_scheduler,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_task_scheduler_free(
+     libscca_task_scheduler_t **task_scheduler,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_task_scheduler_append_task(
+     libscca_task_scheduler_t *task_scheduler,
+     size64_t weight,
+     int *task_index,
+     libcerror_error_t **error );
+
+int libscca_task_scheduler_compare_tasks(
+     const libscca_task_scheduler_task_t *first_task,
+     const libscca_task_scheduler_task_t *second_task );
+
+LIBSCCA_EXTERN \
+int libscca_task_scheduler_start(
+     libscca_task_scheduler_t *task_scheduler,
+     libcerror_error_t **error );
+
+int libscca_task_scheduler_queue_get_remaining(
+     libscca_task_scheduler_queue_t *queue,
+     int *number_of_remaining_tasks,
+     size64_t *remaining_weight,
+     libcerror_error_t **error );
+
+int libscca_task_scheduler_queue_pop_first(
+     libscca_internal_task_scheduler_t *internal_task_scheduler,
+     libscca_task_scheduler_queue_t *queue,
+     int *task_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_task_scheduler_get_next_task(
+     libscca_task_scheduler_t *task_scheduler,
+     int worker_index,
+     int *task_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_TASK_SCHEDULER_H ) */
+
@@ -36,11 +36,19 @@
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libscca_file {}			libscca_file_t;
 typedef struct libscca_file_metrics {}		libscca_file_metrics_t;
+typedef struct libscca_filename_index {}	libscca_filename_index_t;
+typedef struct libscca_filename_index_builder {}	libscca_filename_index_builder_t;
+typedef struct libscca_mam_decoder {}		libscca_mam_decoder_t;
+typedef struct libscca_task_scheduler {}	libscca_task_scheduler_t;
 typedef struct libscca_volume_information {}	libscca_volume_information_t;
 
 #else
 typedef intptr_t libscca_file_t;
 typedef intptr_t libscca_file_metrics_t;
+typedef intptr_t libscca_filename_index_t;
+typedef intptr_t libscca_filename_index_builder_t;
+typedef intptr_t libscca_mam_decoder_t;
+typedef intptr_t libscca_task_scheduler_t;
 typedef intptr_t libscca_volume_information_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
@@ -0,0 +1,169 @@
+/*
+ * Upper case functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+#include "libscca_upper_case.h"
+
+/* Retrieves the upper case of an UTF-16 character
+ * Windows stores the filenames in a prefetch file in upper case, this maps
+ * the lower case characters of the Latin, Greek and Cyrillic alphabets
+ * Returns the upper case character
+ */
+uint16_t libscca_upper_case_get_utf16_character(
+          uint16_t character )
+{
+	if( character < 0x0061 )
+	{
+		return( character );
+	}
+	/* Basic Latin
+	 */
+	if( character <= 0x007a )
+	{
+		return( character - 0x0020 );
+	}
+	if( character < 0x00e0 )
+	{
+		return( character );
+	}
+	/* Latin-1 Supplement
+	 */
+	if( character <= 0x00fe )
+	{
+		if( character == 0x00f7 )
+		{
+			return( character );
+		}
+		return( character - 0x0020 );
+	}
+	if( character == 0x00ff )
+	{
+		return( 0x0178 );
+	}
+	/* Latin Extended-A
+	 */
+	if( character <= 0x017f )
+	{
+		if( ( ( character <= 0x012f )
+		  ||  ( ( character >= 0x0132 ) && ( character <= 0x0137 ) )
+		  ||  ( ( character >= 0x014a ) && ( character <= 0x0177 ) ) )
+		 && ( ( character & 0x0001 ) != 0 ) )
+		{
+			return( character - 1 );
+		}
+		if( ( ( ( character >= 0x0139 ) && ( character <= 0x0148 ) )
+		  ||  ( ( character >= 0x0179 ) && ( character <= 0x017e ) ) )
+		 && ( ( character & 0x0001 ) == 0 ) )
+		{
+			return( character - 1 );
+		}
+		return( character );
+	}
+	if( character < 0x03b1 )
+	{
+		return( character );
+	}
+	/* Greek
+	 */
+	if( character <= 0x03cb )
+	{
+		if( character == 0x03c2 )
+		{
+			return( 0x03a3 );
+		}
+		return( character - 0x0020 );
+	}
+	if( character < 0x0430 )
+	{
+		return( character );
+	}
+	/* Cyrillic
+	 */
+	if( character <= 0x044f )
+	{
+		return( character - 0x0020 );
+	}
+	if( character <= 0x045f )
+	{
+		return( character - 0x0050 );
+	}
+	/* Halfwidth and Fullwidth Forms
+	 */
+	if( ( character >= 0xff41 )
+	 && ( character <= 0xff5a ) )
+	{
+		return( character - 0x0020 );
+	}
+	return( character );
+}
+
+/* Converts an UTF-16 string to upper case
+ * The string is converted up to the size or the first end-of-string character
+ * Upper case strings can be compared with the filenames stored in a prefetch file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_upper_case_utf16_string(
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_upper_case_utf16_string";
+	size_t string_index   = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) ( SSIZE_MAX / sizeof( uint16_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < utf16_string_size;
+	     string_index++ )
+	{
+		if( utf16_string[ string_index ] == 0 )
+		{
+			break;
+		}
+		utf16_string[ string_index ] = libscca_upper_case_get_utf16_character(
+		                                utf16_string[ string_index ] );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,158 @@
+/*
+ * The filename index definition of an index of Windows Prefetch Files (PF)
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SCCA_FILENAME_INDEX_H )
+#define _SCCA_FILENAME_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct scca_filename_index_file_header scca_filename_index_file_header_t;
+
+struct scca_filename_index_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * "SCCAINDX"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The number of sources
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_sources[ 4 ];
+
+	/* The number of keys
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_keys[ 4 ];
+
+	/* The number of postings
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_postings[ 4 ];
+
+	/* The sources offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t sources_offset[ 8 ];
+
+	/* The keys offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t keys_offset[ 8 ];
+
+	/* The postings offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t postings_offset[ 8 ];
+
+	/* The strings offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t strings_offset[ 8 ];
+
+	/* The strings size
+	 * Consists of 8 bytes
+	 */
+	uint8_t strings_size[ 8 ];
+};
+
+typedef struct scca_filename_index_source_entry scca_filename_index_source_entry_t;
+
+struct scca_filename_index_source_entry
+{
+	/* The UTF-8 path offset, relative to the strings offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t path_offset[ 8 ];
+
+	/* The UTF-8 path size, including the end-of-string character
+	 * Consists of 4 bytes
+	 */
+	uint8_t path_size[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding1[ 4 ];
+};
+
+typedef struct scca_filename_index_key_entry scca_filename_index_key_entry_t;
+
+struct scca_filename_index_key_entry
+{
+	/* The UTF-16 little-endian string offset, relative to the strings offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t string_offset[ 8 ];
+
+	/* The string length in characters, without the end-of-string character
+	 * Consists of 4 bytes
+	 */
+	uint8_t string_length[ 4 ];
+
+	/* The index of the first posting
+	 * Consists of 4 bytes
+	 */
+	uint8_t first_posting[ 4 ];
+
+	/* The number of postings
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_postings[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding1[ 4 ];
+};
+
+typedef struct scca_filename_index_posting_entry scca_filename_index_posting_entry_t;
+
+struct scca_filename_index_posting_entry
+{
+	/* The source index
+	 * Consists of 4 bytes
+	 */
+	uint8_t source_index[ 4 ];
+
+	/* The file metrics entry index
+	 * Consists of 4 bytes
+	 */
+	uint8_t metrics_index[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SCCA_FILENAME_INDEX_H ) */
+
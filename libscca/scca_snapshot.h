@@ -0,0 +1,226 @@
+/*
+ * The snapshot definition of a parsed Windows Prefetch File (PF)
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SCCA_SNAPSHOT_H )
+#define _SCCA_SNAPSHOT_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct scca_snapshot_header scca_snapshot_header_t;
+
+struct scca_snapshot_header
+{
+	/* Signature
+	 * Consists of 8 bytes
+	 * "SCCASNAP"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The snapshot version
+	 * Consists of 4 bytes
+	 */
+	uint8_t version[ 4 ];
+
+	/* The format version of the prefetch file
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The size of the snapshot data
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_size[ 8 ];
+
+	/* The file size of the prefetch file
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_size[ 4 ];
+
+	/* The prefetch hash
+	 * Consists of 4 bytes
+	 */
+	uint8_t prefetch_hash[ 4 ];
+
+	/* The run count
+	 * Consists of 4 bytes
+	 */
+	uint8_t run_count[ 4 ];
+
+	/* The executable filename size
+	 * Consists of 4 bytes
+	 */
+	uint8_t executable_filename_size[ 4 ];
+
+	/* The last run times
+	 * Consists of 64 bytes
+	 * Contains 8 FILETIME values
+	 */
+	uint8_t last_run_times[ 64 ];
+
+	/* The UTF-16 little-endian executable filename
+	 * Consists of 60 bytes
+	 */
+	uint8_t executable_filename[ 60 ];
+
+	/* The file metrics array offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_metrics_array_offset[ 4 ];
+
+	/* The number of file metrics array entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_file_metrics_entries[ 4 ];
+
+	/* The filename strings offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t filename_strings_offset[ 4 ];
+
+	/* The filename strings size
+	 * Consists of 4 bytes
+	 */
+	uint8_t filename_strings_size[ 4 ];
+
+	/* The filename string entries array offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t filename_string_entries_array_offset[ 4 ];
+
+	/* The number of filename string entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_filename_string_entries[ 4 ];
+
+	/* The volumes array offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t volumes_array_offset[ 4 ];
+
+	/* The number of volumes array entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_volumes[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding1[ 4 ];
+};
+
+typedef struct scca_snapshot_file_metrics_entry scca_snapshot_file_metrics_entry_t;
+
+struct scca_snapshot_file_metrics_entry
+{
+	/* The start time
+	 * Consists of 4 bytes
+	 */
+	uint8_t start_time[ 4 ];
+
+	/* The duration
+	 * Consists of 4 bytes
+	 */
+	uint8_t duration[ 4 ];
+
+	/* The filename string offset
+	 * Consists of 4 bytes
+	 * Relative to the start of the filename strings
+	 */
+	uint8_t filename_string_offset[ 4 ];
+
+	/* The flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The file reference
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_reference[ 8 ];
+
+	/* Value to indicate the file reference was set
+	 * Consists of 1 bytes
+	 */
+	uint8_t file_reference_is_set[ 1 ];
+
+	/* Padding
+	 * Consists of 7 bytes
+	 */
+	uint8_t padding1[ 7 ];
+};
+
+typedef struct scca_snapshot_filename_string_entry scca_snapshot_filename_string_entry_t;
+
+struct scca_snapshot_filename_string_entry
+{
+	/* The filename string offset
+	 * Consists of 4 bytes
+	 * Relative to the start of the filename strings
+	 */
+	uint8_t offset[ 4 ];
+
+	/* The filename string size
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+};
+
+typedef struct scca_snapshot_volume_entry scca_snapshot_volume_entry_t;
+
+struct scca_snapshot_volume_entry
+{
+	/* The creation time
+	 * Consists of 8 bytes
+	 */
+	uint8_t creation_time[ 8 ];
+
+	/* The serial number
+	 * Consists of 4 bytes
+	 */
+	uint8_t serial_number[ 4 ];
+
+	/* The UTF-16 little-endian device path offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t device_path_offset[ 4 ];
+
+	/* The device path size
+	 * Consists of 4 bytes
+	 */
+	uint8_t device_path_size[ 4 ];
+
+	/* Padding
+	 * Consists of 12 bytes
+	 */
+	uint8_t padding1[ 12 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SCCA_SNAPSHOT_H ) */
+
@@ -73,9 +73,9 @@ AC_DEFUN([AX_TOOLS_CHECK_ENABLE_MINGW_BINMODE],
 
 dnl Function to detect if sccatools dependencies are available
 AC_DEFUN([AX_SCCATOOLS_CHECK_LOCAL],
-  [AC_CHECK_HEADERS([signal.h sys/signal.h unistd.h])
+  [AC_CHECK_HEADERS([dirent.h fcntl.h signal.h stdarg.h sys/inotify.h sys/mman.h sys/signal.h sys/socket.h sys/stat.h sys/un.h unistd.h varargs.h])
 
-  AC_CHECK_FUNCS([close getopt setvbuf])
+  AC_CHECK_FUNCS([close getopt opendir setvbuf])
 
   AS_IF(
    [test "x$ac_cv_func_close" != xyes],
@@ -84,6 +84,13 @@ AC_DEFUN([AX_SCCATOOLS_CHECK_LOCAL],
      [1])
   ])
 
+  AS_IF(
+   [test "x$ac_cv_header_stdarg_h" != xyes && test "x$ac_cv_header_varargs_h" != xyes],
+   [AC_MSG_FAILURE(
+     [Missing headers: stdarg.h and varargs.h],
+     [1])
+  ])
+
   AX_TOOLS_CHECK_ENABLE_MINGW_BINMODE
 ])
 
@@ -0,0 +1,640 @@
+/*
+ * OSS-Fuzz persistent-mode target for libscca file type
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined( OSSFUZZ_STANDALONE_BENCHMARK )
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#endif
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_libbfio.h"
+#include "ossfuzz_libscca.h"
+
+#if !defined( LIBSCCA_HAVE_BFIO )
+
+/* Opens a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+LIBSCCA_EXTERN \
+int libscca_file_open_file_io_handle(
+     libscca_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libscca_error_t **error );
+
+#endif /* !defined( LIBSCCA_HAVE_BFIO ) */
+
+/* The string buffer is shared by all accessors and all iterations
+ */
+#define OSSFUZZ_STRING_BUFFER_SIZE	32768
+
+/* The file IO handle and file are created once and reused by every iteration
+ */
+static libbfio_handle_t *ossfuzz_file_io_handle = NULL;
+static libscca_file_t *ossfuzz_file             = NULL;
+
+static uint8_t ossfuzz_utf8_string[ OSSFUZZ_STRING_BUFFER_SIZE ];
+static uint16_t ossfuzz_utf16_string[ OSSFUZZ_STRING_BUFFER_SIZE / 2 ];
+
+/* Exercises the file metrics entry accessors
+ */
+void ossfuzz_file_metrics_fuzz(
+      libscca_file_metrics_t *file_metrics )
+{
+	uint64_t file_reference = 0;
+	size_t string_size      = 0;
+
+	if( libscca_file_metrics_get_utf8_filename_size(
+	     file_metrics,
+	     &string_size,
+	     NULL ) == 1 )
+	{
+		if( string_size <= sizeof( ossfuzz_utf8_string ) )
+		{
+			libscca_file_metrics_get_utf8_filename(
+			 file_metrics,
+			 ossfuzz_utf8_string,
+			 string_size,
+			 NULL );
+		}
+	}
+	if( libscca_file_metrics_get_utf16_filename_size(
+	     file_metrics,
+	     &string_size,
+	     NULL ) == 1 )
+	{
+		if( string_size <= ( sizeof( ossfuzz_utf16_string ) / 2 ) )
+		{
+			libscca_file_metrics_get_utf16_filename(
+			 file_metrics,
+			 ossfuzz_utf16_string,
+			 string_size,
+			 NULL );
+		}
+	}
+	libscca_file_metrics_get_file_reference(
+	 file_metrics,
+	 &file_reference,
+	 NULL );
+}
+
+/* Exercises the volume information accessors
+ */
+void ossfuzz_volume_information_fuzz(
+      libscca_volume_information_t *volume_information )
+{
+	uint64_t creation_time = 0;
+	uint32_t serial_number = 0;
+	size_t string_size     = 0;
+
+	libscca_volume_information_get_creation_time(
+	 volume_information,
+	 &creation_time,
+	 NULL );
+
+	libscca_volume_information_get_serial_number(
+	 volume_information,
+	 &serial_number,
+	 NULL );
+
+	if( libscca_volume_information_get_utf8_device_path_size(
+	     volume_information,
+	     &string_size,
+	     NULL ) == 1 )
+	{
+		if( string_size <= sizeof( ossfuzz_utf8_string ) )
+		{
+			libscca_volume_information_get_utf8_device_path(
+			 volume_information,
+			 ossfuzz_utf8_string,
+			 string_size,
+			 NULL );
+		}
+	}
+	if( libscca_volume_information_get_utf16_device_path_size(
+	     volume_information,
+	     &string_size,
+	     NULL ) == 1 )
+	{
+		if( string_size <= ( sizeof( ossfuzz_utf16_string ) / 2 ) )
+		{
+			libscca_volume_information_get_utf16_device_path(
+			 volume_information,
+			 ossfuzz_utf16_string,
+			 string_size,
+			 NULL );
+		}
+	}
+}
+
+/* Exercises the file accessors
+ */
+void ossfuzz_file_fuzz(
+      libscca_file_t *file )
+{
+	libscca_file_metrics_t *file_metrics             = NULL;
+	libscca_volume_information_t *volume_information = NULL;
+	uint64_t filetime                                = 0;
+	size_t string_size                               = 0;
+	uint32_t format_version                          = 0;
+	uint32_t prefetch_hash                           = 0;
+	uint32_t run_count                               = 0;
+	int entry_index                                  = 0;
+	int number_of_entries                            = 0;
+	int last_run_time_index                          = 0;
+
+	libscca_file_get_format_version(
+	 file,
+	 &format_version,
+	 NULL );
+
+	libscca_file_get_prefetch_hash(
+	 file,
+	 &prefetch_hash,
+	 NULL );
+
+	libscca_file_get_run_count(
+	 file,
+	 &run_count,
+	 NULL );
+
+	if( libscca_file_get_utf8_executable_filename_size(
+	     file,
+	     &string_size,
+	     NULL ) == 1 )
+	{
+		if( string_size <= sizeof( ossfuzz_utf8_string ) )
+		{
+			libscca_file_get_utf8_executable_filename(
+			 file,
+			 ossfuzz_utf8_string,
+			 string_size,
+			 NULL );
+		}
+	}
+	if( libscca_file_get_utf16_executable_filename_size(
+	     file,
+	     &string_size,
+	     NULL ) == 1 )
+	{
+		if( string_size <= ( sizeof( ossfuzz_utf16_string ) / 2 ) )
+		{
+			libscca_file_get_utf16_executable_filename(
+			 file,
+			 ossfuzz_utf16_string,
+			 string_size,
+			 NULL );
+		}
+	}
+	for( last_run_time_index = 0;
+	     last_run_time_index < 8;
+	     last_run_time_index++ )
+	{
+		if( libscca_file_get_last_run_time(
+		     file,
+		     last_run_time_index,
+		     &filetime,
+		     NULL ) != 1 )
+		{
+			break;
+		}
+	}
+	if( libscca_file_get_number_of_file_metrics_entries(
+	     file,
+	     &number_of_entries,
+	     NULL ) == 1 )
+	{
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libscca_file_get_file_metrics_entry(
+			     file,
+			     entry_index,
+			     &file_metrics,
+			     NULL ) != 1 )
+			{
+				continue;
+			}
+			ossfuzz_file_metrics_fuzz(
+			 file_metrics );
+
+			libscca_file_metrics_free(
+			 &file_metrics,
+			 NULL );
+		}
+	}
+	if( libscca_file_get_number_of_filenames(
+	     file,
+	     &number_of_entries,
+	     NULL ) == 1 )
+	{
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libscca_file_get_utf8_filename_size(
+			     file,
+			     entry_index,
+			     &string_size,
+			     NULL ) == 1 )
+			{
+				if( string_size <= sizeof( ossfuzz_utf8_string ) )
+				{
+					libscca_file_get_utf8_filename(
+					 file,
+					 entry_index,
+					 ossfuzz_utf8_string,
+					 string_size,
+					 NULL );
+				}
+			}
+			if( libscca_file_get_utf16_filename_size(
+			     file,
+			     entry_index,
+			     &string_size,
+			     NULL ) == 1 )
+			{
+				if( string_size <= ( sizeof( ossfuzz_utf16_string ) / 2 ) )
+				{
+					libscca_file_get_utf16_filename(
+					 file,
+					 entry_index,
+					 ossfuzz_utf16_string,
+					 string_size,
+					 NULL );
+				}
+			}
+		}
+	}
+	if( libscca_file_get_number_of_volumes(
+	     file,
+	     &number_of_entries,
+	     NULL ) == 1 )
+	{
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libscca_file_get_volume_information(
+			     file,
+			     entry_index,
+			     &volume_information,
+			     NULL ) != 1 )
+			{
+				continue;
+			}
+			ossfuzz_volume_information_fuzz(
+			 volume_information );
+
+			libscca_volume_information_free(
+			 &volume_information,
+			 NULL );
+		}
+	}
+}
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+	if( ossfuzz_file_io_handle == NULL )
+	{
+		if( libbfio_memory_range_initialize(
+		     &ossfuzz_file_io_handle,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	if( ossfuzz_file == NULL )
+	{
+		if( libscca_file_initialize(
+		     &ossfuzz_file,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	if( libbfio_memory_range_set(
+	     ossfuzz_file_io_handle,
+	     (uint8_t *) data,
+	     size,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( libscca_file_open_file_io_handle(
+	     ossfuzz_file,
+	     ossfuzz_file_io_handle,
+	     LIBSCCA_OPEN_READ,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	ossfuzz_file_fuzz(
+	 ossfuzz_file );
+
+	libscca_file_close(
+	 ossfuzz_file,
+	 NULL );
+
+	return( 0 );
+}
+
+#if defined( OSSFUZZ_STANDALONE_BENCHMARK )
+
+/* Runs the target over every file in a corpus directory and reports
+ * the number of executions per second
+ * Returns EXIT_SUCCESS if successful or EXIT_FAILURE on error
+ */
+int main(
+     int argc,
+     char * const argv[] )
+{
+	struct timespec end_time;
+	struct timespec start_time;
+
+	struct dirent *directory_entry = NULL;
+	uint8_t **corpus_data          = NULL;
+	size_t *corpus_data_size       = NULL;
+	char *path                     = NULL;
+	DIR *directory                 = NULL;
+	FILE *stream                   = NULL;
+	void *reallocation             = NULL;
+	double elapsed_time            = 0.0;
+	size_t path_size               = 0;
+	long file_size                 = 0;
+	int corpus_index               = 0;
+	int iteration                  = 0;
+	int number_of_corpus_entries   = 0;
+	int number_of_iterations       = 1;
+	int result                     = EXIT_FAILURE;
+
+	if( ( argc < 2 )
+	 || ( argc > 3 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Usage: %s corpus_directory [number_of_iterations]\n",
+		 argv[ 0 ] );
+
+		return( EXIT_FAILURE );
+	}
+	if( argc == 3 )
+	{
+		number_of_iterations = atoi(
+		                        argv[ 2 ] );
+
+		if( number_of_iterations <= 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid number of iterations.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	directory = opendir(
+	             argv[ 1 ] );
+
+	if( directory == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open corpus directory: %s.\n",
+		 argv[ 1 ] );
+
+		return( EXIT_FAILURE );
+	}
+	/* Read the entire corpus into memory so that file system access
+	 * does not contribute to the measurement
+	 */
+	while( ( directory_entry = readdir( directory ) ) != NULL )
+	{
+		if( directory_entry->d_name[ 0 ] == '.' )
+		{
+			continue;
+		}
+		path_size = strlen( argv[ 1 ] ) + strlen( directory_entry->d_name ) + 2;
+
+		path = (char *) malloc(
+		                 path_size );
+
+		if( path == NULL )
+		{
+			goto on_error;
+		}
+		snprintf(
+		 path,
+		 path_size,
+		 "%s/%s",
+		 argv[ 1 ],
+		 directory_entry->d_name );
+
+		stream = fopen(
+		          path,
+		          "rb" );
+
+		free(
+		 path );
+
+		path = NULL;
+
+		if( stream == NULL )
+		{
+			continue;
+		}
+		if( fseek(
+		     stream,
+		     0,
+		     SEEK_END ) != 0 )
+		{
+			fclose(
+			 stream );
+
+			continue;
+		}
+		file_size = ftell(
+		             stream );
+
+		if( ( file_size <= 0 )
+		 || ( fseek(
+		       stream,
+		       0,
+		       SEEK_SET ) != 0 ) )
+		{
+			fclose(
+			 stream );
+
+			continue;
+		}
+		reallocation = realloc(
+		                corpus_data,
+		                sizeof( uint8_t * ) * ( number_of_corpus_entries + 1 ) );
+
+		if( reallocation == NULL )
+		{
+			fclose(
+			 stream );
+
+			goto on_error;
+		}
+		corpus_data = (uint8_t **) reallocation;
+
+		reallocation = realloc(
+		                corpus_data_size,
+		                sizeof( size_t ) * ( number_of_corpus_entries + 1 ) );
+
+		if( reallocation == NULL )
+		{
+			fclose(
+			 stream );
+
+			goto on_error;
+		}
+		corpus_data_size = (size_t *) reallocation;
+
+		corpus_data[ number_of_corpus_entries ] = (uint8_t *) malloc(
+		                                                       (size_t) file_size );
+
+		if( corpus_data[ number_of_corpus_entries ] == NULL )
+		{
+			fclose(
+			 stream );
+
+			goto on_error;
+		}
+		corpus_data_size[ number_of_corpus_entries ] = fread(
+		                                                corpus_data[ number_of_corpus_entries ],
+		                                                1,
+		                                                (size_t) file_size,
+		                                                stream );
+
+		fclose(
+		 stream );
+
+		number_of_corpus_entries++;
+	}
+	closedir(
+	 directory );
+
+	directory = NULL;
+
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &start_time );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		for( corpus_index = 0;
+		     corpus_index < number_of_corpus_entries;
+		     corpus_index++ )
+		{
+			LLVMFuzzerTestOneInput(
+			 corpus_data[ corpus_index ],
+			 corpus_data_size[ corpus_index ] );
+		}
+	}
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &end_time );
+
+	elapsed_time = (double) ( end_time.tv_sec - start_time.tv_sec )
+	             + ( (double) ( end_time.tv_nsec - start_time.tv_nsec ) / 1000000000.0 );
+
+	fprintf(
+	 stdout,
+	 "Corpus entries\t\t: %d\n",
+	 number_of_corpus_entries );
+
+	fprintf(
+	 stdout,
+	 "Executions\t\t: %d\n",
+	 number_of_corpus_entries * number_of_iterations );
+
+	fprintf(
+	 stdout,
+	 "Elapsed time\t\t: %.3f seconds\n",
+	 elapsed_time );
+
+	if( elapsed_time > 0.0 )
+	{
+		fprintf(
+		 stdout,
+		 "Executions per second\t: %.1f\n",
+		 (double) ( number_of_corpus_entries * number_of_iterations ) / elapsed_time );
+	}
+	result = EXIT_SUCCESS;
+
+on_error:
+	if( directory != NULL )
+	{
+		closedir(
+		 directory );
+	}
+	if( corpus_data != NULL )
+	{
+		for( corpus_index = 0;
+		     corpus_index < number_of_corpus_entries;
+		     corpus_index++ )
+		{
+			free(
+			 corpus_data[ corpus_index ] );
+		}
+		free(
+		 corpus_data );
+	}
+	if( corpus_data_size != NULL )
+	{
+		free(
+		 corpus_data_size );
+	}
+	if( ossfuzz_file != NULL )
+	{
+		libscca_file_free(
+		 &ossfuzz_file,
+		 NULL );
+	}
+	if( ossfuzz_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &ossfuzz_file_io_handle,
+		 NULL );
+	}
+	return( result );
+}
+
+#endif /* defined( OSSFUZZ_STANDALONE_BENCHMARK ) */
+
+} /* extern "C" */
+
@@ -31,6 +31,7 @@
 #include "pyscca_error.h"
 #include "pyscca_file.h"
 #include "pyscca_file_metrics.h"
+#include "pyscca_file_metrics_column.h"
 #include "pyscca_file_metrics_entries.h"
 #include "pyscca_file_object_io_handle.h"
 #include "pyscca_filenames.h"
@@ -659,6 +660,23 @@ PyMODINIT_FUNC initpyscca(
 	 "file_metrics_entries",
 	 (PyObject *) &pyscca_file_metrics_entries_type_object );
 
+	/* Setup the file_metrics_column type object
+	 */
+	pyscca_file_metrics_column_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyscca_file_metrics_column_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyscca_file_metrics_column_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "file_metrics_column",
+	 (PyObject *) &pyscca_file_metrics_column_type_object );
+
 	/* Setup the filenames type object
 	 */
 	pyscca_filenames_type_object.tp_new = PyType_GenericNew;
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
@@ -30,6 +31,7 @@
 #include "pyscca_error.h"
 #include "pyscca_file.h"
 #include "pyscca_file_metrics.h"
+#include "pyscca_file_metrics_column.h"
 #include "pyscca_file_metrics_entries.h"
 #include "pyscca_file_object_io_handle.h"
 #include "pyscca_filenames.h"
@@ -168,6 +170,39 @@ PyMethodDef pyscca_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the volume information specified by the index." },
 
+	{ "get_filenames_list",
+	  (PyCFunction) pyscca_file_get_filenames_list,
+	  METH_NOARGS,
+	  "get_filenames_list() -> List of Unicode strings\n"
+	  "\n"
+	  "Retrieves all the filenames in a single pass." },
+
+	{ "get_file_metrics_as_tuples",
+	  (PyCFunction) pyscca_file_get_file_metrics_as_tuples,
+	  METH_NOARGS,
+	  "get_file_metrics_as_tuples() -> List of tuples\n"
+	  "\n"
+	  "Retrieves all the file metrics entries in a single pass, as (filename, file_reference) tuples.\n"
+	  "The filename or file reference is None if not available." },
+
+	{ "get_volumes_as_dicts",
+	  (PyCFunction) pyscca_file_get_volumes_as_dicts,
+	  METH_NOARGS,
+	  "get_volumes_as_dicts() -> List of dictionaries\n"
+	  "\n"
+	  "Retrieves all the volumes in a single pass, as dictionaries with the keys:\n"
+	  "device_path, creation_time_as_integer, serial_number, directory_strings and file_references." },
+
+	{ "get_file_metrics_columns",
+	  (PyCFunction) pyscca_file_get_file_metrics_columns,
+	  METH_NOARGS,
+	  "get_file_metrics_columns() -> Dictionary\n"
+	  "\n"
+	  "Retrieves all the file metrics entries in a single pass, as a dictionary of read-only buffer objects\n"
+	  "with the keys: start_time, duration, flags, file_reference and filename_index.\n"
+	  "Every buffer contains a value per entry and can be used with numpy.frombuffer without copying.\n"
+	  "A file reference is 0 if not set and a filename index is -1 if not available." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -2074,3 +2109,796 @@ PyObject *pyscca_file_get_volumes(
 	return( sequence_object );
 }
 
+/* Visits the file to retrieve values in a single pass
+ * The GIL is held while visiting since the callbacks create Python objects
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_file_visit_values(
+     pyscca_file_t *pyscca_file,
+     const libscca_file_visitor_t *visitor,
+     intptr_t *user_data,
+     const char *function )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	result = libscca_file_visit(
+	          pyscca_file->file,
+	          visitor,
+	          user_data,
+	          &error );
+
+	if( result == -1 )
+	{
+		/* Retain the Python exception raised by a callback
+		 */
+		if( PyErr_Occurred() )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+		else
+		{
+			pyscca_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to visit file.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+		}
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a filename to a list
+ * Callback function for the file visitor
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_file_append_filename(
+     intptr_t *user_data,
+     int filename_index PYSCCA_ATTRIBUTE_UNUSED,
+     const uint8_t *utf16_filename,
+     size_t utf16_filename_size )
+{
+	PyObject *string_object = NULL;
+	int result              = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( filename_index )
+
+	string_object = pyscca_string_new_from_utf16_stream(
+	                 utf16_filename,
+	                 utf16_filename_size );
+
+	if( string_object == NULL )
+	{
+		return( -1 );
+	}
+	result = PyList_Append(
+	          (PyObject *) user_data,
+	          string_object );
+
+	Py_DecRef(
+	 string_object );
+
+	if( result != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a (filename, file reference) tuple of a file metrics entry to a list
+ * Callback function for the file visitor
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_file_append_file_metrics_tuple(
+     intptr_t *user_data,
+     int entry_index PYSCCA_ATTRIBUTE_UNUSED,
+     uint32_t start_time PYSCCA_ATTRIBUTE_UNUSED,
+     uint32_t duration PYSCCA_ATTRIBUTE_UNUSED,
+     uint32_t flags PYSCCA_ATTRIBUTE_UNUSED,
+     uint64_t file_reference,
+     const uint8_t *utf16_filename,
+     size_t utf16_filename_size )
+{
+	PyObject *integer_object = NULL;
+	PyObject *string_object  = NULL;
+	PyObject *tuple_object   = NULL;
+	int result               = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( entry_index )
+	PYSCCA_UNREFERENCED_PARAMETER( start_time )
+	PYSCCA_UNREFERENCED_PARAMETER( duration )
+	PYSCCA_UNREFERENCED_PARAMETER( flags )
+
+	if( utf16_filename != NULL )
+	{
+		string_object = pyscca_string_new_from_utf16_stream(
+		                 utf16_filename,
+		                 utf16_filename_size );
+	}
+	else
+	{
+		Py_IncRef(
+		 Py_None );
+
+		string_object = Py_None;
+	}
+	if( string_object == NULL )
+	{
+		goto on_error;
+	}
+	/* The file reference is 0 when not available
+	 */
+	if( file_reference != 0 )
+	{
+		integer_object = pyscca_integer_unsigned_new_from_64bit(
+		                  file_reference );
+	}
+	else
+	{
+		Py_IncRef(
+		 Py_None );
+
+		integer_object = Py_None;
+	}
+	if( integer_object == NULL )
+	{
+		goto on_error;
+	}
+	tuple_object = PyTuple_New(
+	                2 );
+
+	if( tuple_object == NULL )
+	{
+		goto on_error;
+	}
+	/* PyTuple_SetItem steals the references
+	 */
+	PyTuple_SetItem(
+	 tuple_object,
+	 0,
+	 string_object );
+
+	string_object = NULL;
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 1,
+	 integer_object );
+
+	integer_object = NULL;
+
+	result = PyList_Append(
+	          (PyObject *) user_data,
+	          tuple_object );
+
+	Py_DecRef(
+	 tuple_object );
+
+	if( result != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( integer_object != NULL )
+	{
+		Py_DecRef(
+		 integer_object );
+	}
+	if( string_object != NULL )
+	{
+		Py_DecRef(
+		 string_object );
+	}
+	return( -1 );
+}
+
+/* Sets a value of a dictionary
+ * The reference of the value object is released
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_file_set_dictionary_value(
+     PyObject *dictionary_object,
+     const char *key,
+     PyObject *value_object )
+{
+	int result = 0;
+
+	if( value_object == NULL )
+	{
+		return( -1 );
+	}
+	result = PyDict_SetItemString(
+	          dictionary_object,
+	          key,
+	          value_object );
+
+	Py_DecRef(
+	 value_object );
+
+	if( result != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a dictionary of a volume to a list
+ * Callback function for the file visitor
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_file_append_volume_dictionary(
+     intptr_t *user_data,
+     int volume_index PYSCCA_ATTRIBUTE_UNUSED,
+     uint64_t creation_time,
+     uint32_t serial_number,
+     const uint8_t *utf16_device_path,
+     size_t utf16_device_path_size )
+{
+	PyObject *dictionary_object                  = NULL;
+	PyObject *list_object                        = NULL;
+	pyscca_file_volumes_values_t *volumes_values = NULL;
+	int result                                   = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( volume_index )
+
+	volumes_values = (pyscca_file_volumes_values_t *) user_data;
+
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		return( -1 );
+	}
+	if( pyscca_file_set_dictionary_value(
+	     dictionary_object,
+	     "device_path",
+	     pyscca_string_new_from_utf16_stream(
+	      utf16_device_path,
+	      utf16_device_path_size ) ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pyscca_file_set_dictionary_value(
+	     dictionary_object,
+	     "creation_time_as_integer",
+	     pyscca_integer_unsigned_new_from_64bit(
+	      creation_time ) ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pyscca_file_set_dictionary_value(
+	     dictionary_object,
+	     "serial_number",
+	     PyLong_FromUnsignedLong(
+	      (unsigned long) serial_number ) ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The dictionary retains the lists, the borrowed references are valid while the dictionary is in the volumes list
+	 */
+	list_object = PyList_New(
+	               0 );
+
+	volumes_values->directory_strings_list_object = list_object;
+
+	if( pyscca_file_set_dictionary_value(
+	     dictionary_object,
+	     "directory_strings",
+	     list_object ) != 1 )
+	{
+		goto on_error;
+	}
+	list_object = PyList_New(
+	               0 );
+
+	volumes_values->file_references_list_object = list_object;
+
+	if( pyscca_file_set_dictionary_value(
+	     dictionary_object,
+	     "file_references",
+	     list_object ) != 1 )
+	{
+		goto on_error;
+	}
+	result = PyList_Append(
+	          volumes_values->list_object,
+	          dictionary_object );
+
+	Py_DecRef(
+	 dictionary_object );
+
+	if( result != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	volumes_values->directory_strings_list_object = NULL;
+	volumes_values->file_references_list_object   = NULL;
+
+	Py_DecRef(
+	 dictionary_object );
+
+	return( -1 );
+}
+
+/* Appends a directory string to the dictionary of the current volume
+ * Callback function for the file visitor
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_file_append_volume_directory_string(
+     intptr_t *user_data,
+     int volume_index PYSCCA_ATTRIBUTE_UNUSED,
+     int directory_string_index PYSCCA_ATTRIBUTE_UNUSED,
+     const uint8_t *utf16_directory_string,
+     size_t utf16_directory_string_size )
+{
+	PyObject *string_object                      = NULL;
+	pyscca_file_volumes_values_t *volumes_values = NULL;
+	int result                                   = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( volume_index )
+	PYSCCA_UNREFERENCED_PARAMETER( directory_string_index )
+
+	volumes_values = (pyscca_file_volumes_values_t *) user_data;
+
+	if( volumes_values->directory_strings_list_object == NULL )
+	{
+		return( -1 );
+	}
+	string_object = pyscca_string_new_from_utf16_stream(
+	                 utf16_directory_string,
+	                 utf16_directory_string_size );
+
+	if( string_object == NULL )
+	{
+		return( -1 );
+	}
+	result = PyList_Append(
+	          volumes_values->directory_strings_list_object,
+	          string_object );
+
+	Py_DecRef(
+	 string_object );
+
+	if( result != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a file reference to the dictionary of the current volume
+ * Callback function for the file visitor
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_file_append_volume_file_reference(
+     intptr_t *user_data,
+     int volume_index PYSCCA_ATTRIBUTE_UNUSED,
+     int file_reference_index PYSCCA_ATTRIBUTE_UNUSED,
+     uint64_t file_reference )
+{
+	PyObject *integer_object                     = NULL;
+	pyscca_file_volumes_values_t *volumes_values = NULL;
+	int result                                   = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( volume_index )
+	PYSCCA_UNREFERENCED_PARAMETER( file_reference_index )
+
+	volumes_values = (pyscca_file_volumes_values_t *) user_data;
+
+	if( volumes_values->file_references_list_object == NULL )
+	{
+		return( -1 );
+	}
+	integer_object = pyscca_integer_unsigned_new_from_64bit(
+	                  file_reference );
+
+	if( integer_object == NULL )
+	{
+		return( -1 );
+	}
+	result = PyList_Append(
+	          volumes_values->file_references_list_object,
+	          integer_object );
+
+	Py_DecRef(
+	 integer_object );
+
+	if( result != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the filenames as a list
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_filenames_list(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	libscca_file_visitor_t visitor;
+
+	PyObject *list_object = NULL;
+	static char *function = "pyscca_file_get_filenames_list";
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	memory_set(
+	 &visitor,
+	 0,
+	 sizeof( libscca_file_visitor_t ) );
+
+	visitor.on_filename = &pyscca_file_append_filename;
+
+	list_object = PyList_New(
+	               0 );
+
+	if( list_object == NULL )
+	{
+		return( NULL );
+	}
+	if( pyscca_file_visit_values(
+	     pyscca_file,
+	     &visitor,
+	     (intptr_t *) list_object,
+	     function ) != 1 )
+	{
+		Py_DecRef(
+		 list_object );
+
+		return( NULL );
+	}
+	return( list_object );
+}
+
+/* Retrieves the file metrics entries as a list of (filename, file reference) tuples
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_file_metrics_as_tuples(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	libscca_file_visitor_t visitor;
+
+	PyObject *list_object = NULL;
+	static char *function = "pyscca_file_get_file_metrics_as_tuples";
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	memory_set(
+	 &visitor,
+	 0,
+	 sizeof( libscca_file_visitor_t ) );
+
+	visitor.on_metrics_entry = &pyscca_file_append_file_metrics_tuple;
+
+	list_object = PyList_New(
+	               0 );
+
+	if( list_object == NULL )
+	{
+		return( NULL );
+	}
+	if( pyscca_file_visit_values(
+	     pyscca_file,
+	     &visitor,
+	     (intptr_t *) list_object,
+	     function ) != 1 )
+	{
+		Py_DecRef(
+		 list_object );
+
+		return( NULL );
+	}
+	return( list_object );
+}
+
+/* Retrieves the volumes as a list of dictionaries
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_volumes_as_dicts(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	libscca_file_visitor_t visitor;
+	pyscca_file_volumes_values_t volumes_values;
+
+	static char *function = "pyscca_file_get_volumes_as_dicts";
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	memory_set(
+	 &visitor,
+	 0,
+	 sizeof( libscca_file_visitor_t ) );
+
+	memory_set(
+	 &volumes_values,
+	 0,
+	 sizeof( pyscca_file_volumes_values_t ) );
+
+	visitor.on_volume           = &pyscca_file_append_volume_dictionary;
+	visitor.on_directory_string = &pyscca_file_append_volume_directory_string;
+	visitor.on_file_reference   = &pyscca_file_append_volume_file_reference;
+
+	volumes_values.list_object = PyList_New(
+	                              0 );
+
+	if( volumes_values.list_object == NULL )
+	{
+		return( NULL );
+	}
+	if( pyscca_file_visit_values(
+	     pyscca_file,
+	     &visitor,
+	     (intptr_t *) &volumes_values,
+	     function ) != 1 )
+	{
+		Py_DecRef(
+		 volumes_values.list_object );
+
+		return( NULL );
+	}
+	return( volumes_values.list_object );
+}
+
+/* Retrieves the file metrics entries as columns
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_file_metrics_columns(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *dictionary_object        = NULL;
+	PyObject *duration_object          = NULL;
+	PyObject *file_reference_object    = NULL;
+	PyObject *filename_index_object    = NULL;
+	PyObject *flags_object             = NULL;
+	PyObject *start_time_object        = NULL;
+	libcerror_error_t *error           = NULL;
+	static char *function              = "pyscca_file_get_file_metrics_columns";
+	int number_of_file_metrics_entries = 0;
+	int result                         = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          pyscca_file->file,
+	          &number_of_file_metrics_entries,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	start_time_object = pyscca_file_metrics_column_new(
+	                     "I",
+	                     (Py_ssize_t) sizeof( uint32_t ),
+	                     (Py_ssize_t) number_of_file_metrics_entries );
+
+	if( start_time_object == NULL )
+	{
+		goto on_error;
+	}
+	duration_object = pyscca_file_metrics_column_new(
+	                   "I",
+	                   (Py_ssize_t) sizeof( uint32_t ),
+	                   (Py_ssize_t) number_of_file_metrics_entries );
+
+	if( duration_object == NULL )
+	{
+		goto on_error;
+	}
+	flags_object = pyscca_file_metrics_column_new(
+	                "I",
+	                (Py_ssize_t) sizeof( uint32_t ),
+	                (Py_ssize_t) number_of_file_metrics_entries );
+
+	if( flags_object == NULL )
+	{
+		goto on_error;
+	}
+	file_reference_object = pyscca_file_metrics_column_new(
+	                         "Q",
+	                         (Py_ssize_t) sizeof( uint64_t ),
+	                         (Py_ssize_t) number_of_file_metrics_entries );
+
+	if( file_reference_object == NULL )
+	{
+		goto on_error;
+	}
+	filename_index_object = pyscca_file_metrics_column_new(
+	                         "i",
+	                         (Py_ssize_t) sizeof( int32_t ),
+	                         (Py_ssize_t) number_of_file_metrics_entries );
+
+	if( filename_index_object == NULL )
+	{
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_file_metrics_columns(
+	          pyscca_file->file,
+	          number_of_file_metrics_entries,
+	          (uint32_t *) ( (pyscca_file_metrics_column_t *) start_time_object )->data,
+	          (uint32_t *) ( (pyscca_file_metrics_column_t *) duration_object )->data,
+	          (uint32_t *) ( (pyscca_file_metrics_column_t *) flags_object )->data,
+	          (uint64_t *) ( (pyscca_file_metrics_column_t *) file_reference_object )->data,
+	          (int32_t *) ( (pyscca_file_metrics_column_t *) filename_index_object )->data,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve file metrics columns.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		goto on_error;
+	}
+	/* The dictionary takes over the references of the column objects
+	 */
+	result = pyscca_file_set_dictionary_value(
+	          dictionary_object,
+	          "start_time",
+	          start_time_object );
+
+	start_time_object = NULL;
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	result = pyscca_file_set_dictionary_value(
+	          dictionary_object,
+	          "duration",
+	          duration_object );
+
+	duration_object = NULL;
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	result = pyscca_file_set_dictionary_value(
+	          dictionary_object,
+	          "flags",
+	          flags_object );
+
+	flags_object = NULL;
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	result = pyscca_file_set_dictionary_value(
+	          dictionary_object,
+	          "file_reference",
+	          file_reference_object );
+
+	file_reference_object = NULL;
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	result = pyscca_file_set_dictionary_value(
+	          dictionary_object,
+	          "filename_index",
+	          filename_index_object );
+
+	filename_index_object = NULL;
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( dictionary_object );
+
+on_error:
+	if( filename_index_object != NULL )
+	{
+		Py_DecRef(
+		 filename_index_object );
+	}
+	if( file_reference_object != NULL )
+	{
+		Py_DecRef(
+		 file_reference_object );
+	}
+	if( flags_object != NULL )
+	{
+		Py_DecRef(
+		 flags_object );
+	}
+	if( duration_object != NULL )
+	{
+		Py_DecRef(
+		 duration_object );
+	}
+	if( start_time_object != NULL )
+	{
+		Py_DecRef(
+		 start_time_object );
+	}
+	if( dictionary_object != NULL )
+	{
+		Py_DecRef(
+		 dictionary_object );
+	}
+	return( NULL );
+}
+
@@ -50,6 +50,23 @@ struct pyscca_file
 	libbfio_handle_t *file_io_handle;
 };
 
+typedef struct pyscca_file_volumes_values pyscca_file_volumes_values_t;
+
+struct pyscca_file_volumes_values
+{
+	/* The volumes list object
+	 */
+	PyObject *list_object;
+
+	/* The directory strings list object of the current volume
+	 */
+	PyObject *directory_strings_list_object;
+
+	/* The file references list object of the current volume
+	 */
+	PyObject *file_references_list_object;
+};
+
 extern PyMethodDef pyscca_file_object_methods[];
 extern PyTypeObject pyscca_file_type_object;
 
@@ -154,6 +171,70 @@ PyObject *pyscca_file_get_volumes(
            pyscca_file_t *pyscca_file,
            PyObject *arguments );
 
+int pyscca_file_visit_values(
+     pyscca_file_t *pyscca_file,
+     const libscca_file_visitor_t *visitor,
+     intptr_t *user_data,
+     const char *function );
+
+int pyscca_file_append_filename(
+     intptr_t *user_data,
+     int filename_index,
+     const uint8_t *utf16_filename,
+     size_t utf16_filename_size );
+
+int pyscca_file_append_file_metrics_tuple(
+     intptr_t *user_data,
+     int entry_index,
+     uint32_t start_time,
+     uint32_t duration,
+     uint32_t flags,
+     uint64_t file_reference,
+     const uint8_t *utf16_filename,
+     size_t utf16_filename_size );
+
+int pyscca_file_set_dictionary_value(
+     PyObject *dictionary_object,
+     const char *key,
+     PyObject *value_object );
+
+int pyscca_file_append_volume_dictionary(
+     intptr_t *user_data,
+     int volume_index,
+     uint64_t creation_time,
+     uint32_t serial_number,
+     const uint8_t *utf16_device_path,
+     size_t utf16_device_path_size );
+
+int pyscca_file_append_volume_directory_string(
+     intptr_t *user_data,
+     int volume_index,
+     int directory_string_index,
+     const uint8_t *utf16_directory_string,
+     size_t utf16_directory_string_size );
+
+int pyscca_file_append_volume_file_reference(
+     intptr_t *user_data,
+     int volume_index,
+     int file_reference_index,
+     uint64_t file_reference );
+
+PyObject *pyscca_file_get_filenames_list(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments );
+
+PyObject *pyscca_file_get_file_metrics_as_tuples(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments );
+
+PyObject *pyscca_file_get_volumes_as_dicts(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments );
+
+PyObject *pyscca_file_get_file_metrics_columns(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,433 @@
+/*
+ * Python object definition of the file metrics column object
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyscca_file_metrics_column.h"
+#include "pyscca_python.h"
+
+PySequenceMethods pyscca_file_metrics_column_sequence_methods = {
+	/* sq_length */
+	(lenfunc) pyscca_file_metrics_column_len,
+	/* sq_concat */
+	0,
+	/* sq_repeat */
+	0,
+	/* sq_item */
+	0,
+	/* sq_slice */
+	0,
+	/* sq_ass_item */
+	0,
+	/* sq_ass_slice */
+	0,
+	/* sq_contains */
+	0,
+	/* sq_inplace_concat */
+	0,
+	/* sq_inplace_repeat */
+	0
+};
+
+PyBufferProcs pyscca_file_metrics_column_buffer_procs = {
+#if PY_MAJOR_VERSION < 3
+	/* bf_getreadbuffer */
+	0,
+	/* bf_getwritebuffer */
+	0,
+	/* bf_getsegcount */
+	0,
+	/* bf_getcharbuffer */
+	0,
+#endif
+	/* bf_getbuffer */
+	(getbufferproc) pyscca_file_metrics_column_getbuffer,
+	/* bf_releasebuffer */
+	0
+};
+
+PyTypeObject pyscca_file_metrics_column_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyscca.file_metrics_column",
+	/* tp_basicsize */
+	sizeof( pyscca_file_metrics_column_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyscca_file_metrics_column_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	&pyscca_file_metrics_column_sequence_methods,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	&pyscca_file_metrics_column_buffer_procs,
+	/* tp_flags */
+#if PY_MAJOR_VERSION >= 3
+	Py_TPFLAGS_DEFAULT,
+#else
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER,
+#endif
+	/* tp_doc */
+	"pyscca file metrics column object, a read-only buffer of the values of the file metrics entries",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyscca_file_metrics_column_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new file metrics column object
+ * The values data is allocated but not initialized
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_metrics_column_new(
+           char *format,
+           Py_ssize_t value_size,
+           Py_ssize_t number_of_values )
+{
+	pyscca_file_metrics_column_t *column_object = NULL;
+	static char *function                       = "pyscca_file_metrics_column_new";
+
+	if( format == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid format.",
+		 function );
+
+		return( NULL );
+	}
+	if( value_size <= 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid value size value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( number_of_values < 0 )
+	 || ( number_of_values > ( PY_SSIZE_T_MAX / value_size ) ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	column_object = PyObject_New(
+	                 struct pyscca_file_metrics_column,
+	                 &pyscca_file_metrics_column_type_object );
+
+	if( column_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create column object.",
+		 function );
+
+		goto on_error;
+	}
+	column_object->data             = NULL;
+	column_object->number_of_values = number_of_values;
+	column_object->value_size       = value_size;
+	column_object->format           = format;
+	column_object->shape[ 0 ]       = number_of_values;
+	column_object->strides[ 0 ]     = value_size;
+
+	/* PyMem_Malloc returns a non-NULL pointer for a size of 0
+	 */
+	column_object->data = (uint8_t *) PyMem_Malloc(
+	                                   (size_t) ( number_of_values * value_size ) );
+
+	if( column_object->data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create column object data.",
+		 function );
+
+		goto on_error;
+	}
+	return( (PyObject *) column_object );
+
+on_error:
+	if( column_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) column_object );
+	}
+	return( NULL );
+}
+
+/* Initializes a file metrics column object
+ * Returns 0 if successful or -1 on error
+ */
+int pyscca_file_metrics_column_init(
+     pyscca_file_metrics_column_t *column_object )
+{
+	static char *function = "pyscca_file_metrics_column_init";
+
+	if( column_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid column object.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the file metrics column values are initialized
+	 */
+	column_object->data             = NULL;
+	column_object->number_of_values = 0;
+	column_object->value_size       = 0;
+	column_object->format           = NULL;
+
+	PyErr_Format(
+	 PyExc_NotImplementedError,
+	 "%s: initialize of file metrics column not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a file metrics column object
+ */
+void pyscca_file_metrics_column_free(
+      pyscca_file_metrics_column_t *column_object )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pyscca_file_metrics_column_free";
+
+	if( column_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid column object.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           column_object );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( column_object->data != NULL )
+	{
+		PyMem_Free(
+		 column_object->data );
+	}
+	ob_type->tp_free(
+	 (PyObject*) column_object );
+}
+
+/* The file metrics column len() function
+ */
+Py_ssize_t pyscca_file_metrics_column_len(
+            pyscca_file_metrics_column_t *column_object )
+{
+	static char *function = "pyscca_file_metrics_column_len";
+
+	if( column_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid column object.",
+		 function );
+
+		return( -1 );
+	}
+	return( column_object->number_of_values );
+}
+
+/* The file metrics column get buffer function
+ * The buffer refers to the values data and is read-only
+ * Returns 0 if successful or -1 on error
+ */
+int pyscca_file_metrics_column_getbuffer(
+     pyscca_file_metrics_column_t *column_object,
+     Py_buffer *buffer,
+     int flags )
+{
+	static char *function = "pyscca_file_metrics_column_getbuffer";
+
+	if( buffer == NULL )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	buffer->obj = NULL;
+
+	if( column_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: invalid column object.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_object->data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: invalid column object - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & PyBUF_WRITABLE ) == PyBUF_WRITABLE )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: column object is read-only.",
+		 function );
+
+		return( -1 );
+	}
+	buffer->buf        = (void *) column_object->data;
+	buffer->len        = column_object->number_of_values * column_object->value_size;
+	buffer->readonly   = 1;
+	buffer->itemsize   = column_object->value_size;
+	buffer->format     = NULL;
+	buffer->ndim       = 1;
+	buffer->shape      = NULL;
+	buffer->strides    = NULL;
+	buffer->suboffsets = NULL;
+	buffer->internal   = NULL;
+
+	if( ( flags & PyBUF_FORMAT ) == PyBUF_FORMAT )
+	{
+		buffer->format = column_object->format;
+	}
+	if( ( flags & PyBUF_ND ) == PyBUF_ND )
+	{
+		buffer->shape = column_object->shape;
+	}
+	if( ( flags & PyBUF_STRIDES ) == PyBUF_STRIDES )
+	{
+		buffer->strides = column_object->strides;
+	}
+	buffer->obj = (PyObject *) column_object;
+
+	Py_IncRef(
+	 buffer->obj );
+
+	return( 0 );
+}
+
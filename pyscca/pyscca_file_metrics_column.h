@@ -0,0 +1,93 @@
+/*
+ * Python object definition of the file metrics column object
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYSCCA_FILE_METRICS_COLUMN_H )
+#define _PYSCCA_FILE_METRICS_COLUMN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyscca_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyscca_file_metrics_column pyscca_file_metrics_column_t;
+
+struct pyscca_file_metrics_column
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The values data
+	 */
+	uint8_t *data;
+
+	/* The number of values
+	 */
+	Py_ssize_t number_of_values;
+
+	/* The value size
+	 */
+	Py_ssize_t value_size;
+
+	/* The value format, as used by the struct module
+	 */
+	char *format;
+
+	/* The shape of the buffer
+	 */
+	Py_ssize_t shape[ 1 ];
+
+	/* The strides of the buffer
+	 */
+	Py_ssize_t strides[ 1 ];
+};
+
+extern PyTypeObject pyscca_file_metrics_column_type_object;
+
+PyObject *pyscca_file_metrics_column_new(
+           char *format,
+           Py_ssize_t value_size,
+           Py_ssize_t number_of_values );
+
+int pyscca_file_metrics_column_init(
+     pyscca_file_metrics_column_t *column_object );
+
+void pyscca_file_metrics_column_free(
+      pyscca_file_metrics_column_t *column_object );
+
+Py_ssize_t pyscca_file_metrics_column_len(
+            pyscca_file_metrics_column_t *column_object );
+
+int pyscca_file_metrics_column_getbuffer(
+     pyscca_file_metrics_column_t *column_object,
+     Py_buffer *buffer,
+     int flags );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYSCCA_FILE_METRICS_COLUMN_H ) */
+
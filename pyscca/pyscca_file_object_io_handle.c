@@ -251,7 +251,9 @@ int pyscca_file_object_io_handle_clone(
      pyscca_file_object_io_handle_t *source_file_object_io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "pyscca_file_object_io_handle_clone";
+	static char *function      = "pyscca_file_object_io_handle_clone";
+	PyGILState_STATE gil_state = 0;
+	int result                 = 0;
 
 	if( destination_file_object_io_handle == NULL )
 	{
@@ -281,10 +283,20 @@ int pyscca_file_object_io_handle_clone(
 
 		return( 1 );
 	}
-	if( pyscca_file_object_io_handle_initialize(
-	     destination_file_object_io_handle,
-	     source_file_object_io_handle->file_object,
-	     error ) != 1 )
+	/* The clone can be created while the GIL is released, for example by libbfio
+	 * during an open, and the initialize function allocates and references Python objects
+	 */
+	gil_state = PyGILState_Ensure();
+
+	result = pyscca_file_object_io_handle_initialize(
+	          destination_file_object_io_handle,
+	          source_file_object_io_handle->file_object,
+	          error );
+
+	PyGILState_Release(
+	 gil_state );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -349,3 +349,175 @@ on_error:
 
 #endif /* PY_MAJOR_VERSION >= 3 && PY_MINOR_VERSION >= 3 */
 
+/* Creates a new string object from an UTF-16 little-endian stream
+ * The stream does not contain an end-of-string character, unpaired UTF-16 surrogates are retained
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_string_new_from_utf16_stream(
+           const uint8_t *utf16_stream,
+           size_t utf16_stream_size )
+{
+	PyObject *string_object                              = NULL;
+	static char *function                                = "pyscca_string_new_from_utf16_stream";
+
+#if PY_MAJOR_VERSION >= 3 && PY_MINOR_VERSION >= 3
+	uint32_t *utf32_string                               = NULL;
+	libuna_unicode_character_t largest_unicode_character = 127;
+	libuna_unicode_character_t unicode_character         = 0;
+	size_t utf16_stream_index                            = 0;
+	size_t utf32_string_index                            = 0;
+	size_t utf32_string_length                           = 0;
+	uint16_t low_surrogate                               = 0;
+#else
+	int byte_order                                       = -1;
+#endif
+
+	if( utf16_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( ( utf16_stream_size % 2 ) != 0 )
+	 || ( utf16_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3 && PY_MINOR_VERSION >= 3
+	if( utf16_stream_size == 0 )
+	{
+		return( PyUnicode_New(
+		         0,
+		         0 ) );
+	}
+	utf32_string = (uint32_t *) PyMem_Malloc(
+	                             sizeof( uint32_t ) * ( utf16_stream_size / 2 ) );
+
+	if( utf32_string == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create UTF-32 string.",
+		 function );
+
+		goto on_error;
+	}
+	while( utf16_stream_index < utf16_stream_size )
+	{
+		unicode_character   = (libuna_unicode_character_t) utf16_stream[ utf16_stream_index + 1 ] << 8;
+		unicode_character  |= utf16_stream[ utf16_stream_index ];
+		utf16_stream_index += 2;
+
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		if( ( unicode_character >= 0x0000d800UL )
+		 && ( unicode_character <= 0x0000dbffUL )
+		 && ( utf16_stream_index < utf16_stream_size ) )
+		{
+			low_surrogate  = (uint16_t) utf16_stream[ utf16_stream_index + 1 ] << 8;
+			low_surrogate |= utf16_stream[ utf16_stream_index ];
+
+			if( ( low_surrogate >= 0xdc00 )
+			 && ( low_surrogate <= 0xdfff ) )
+			{
+				unicode_character   = ( ( unicode_character - 0x0000d800UL ) << 10 ) + ( low_surrogate - 0xdc00 ) + 0x00010000UL;
+				utf16_stream_index += 2;
+			}
+		}
+		utf32_string[ utf32_string_index++ ] = unicode_character;
+
+		if( ( unicode_character >= 0x0000d800UL )
+		 && ( unicode_character <= 0x0000dfffUL ) )
+		{
+			largest_unicode_character = 0x0010ffffUL;
+		}
+		else if( unicode_character > largest_unicode_character )
+		{
+			largest_unicode_character = unicode_character;
+		}
+	}
+	utf32_string_length = utf32_string_index;
+
+	if( largest_unicode_character > 65535 )
+	{
+		largest_unicode_character = 0x0010ffffUL;
+	}
+	else if( largest_unicode_character > 255 )
+	{
+		largest_unicode_character = 0x0000ffffUL;
+	}
+	else if( largest_unicode_character > 127 )
+	{
+		largest_unicode_character = 0x000000ffUL;
+	}
+	string_object = PyUnicode_New(
+	                 utf32_string_length, largest_unicode_character);
+
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create string object.",
+		 function );
+
+		goto on_error;
+	}
+	for( utf32_string_index = 0;
+	     utf32_string_index < utf32_string_length;
+	     utf32_string_index++ )
+	{
+		unicode_character = utf32_string[ utf32_string_index ];
+
+		if( PyUnicode_WriteChar(
+		     string_object,
+		     (Py_ssize_t) utf32_string_index,
+		     (Py_UCS4) unicode_character ) == -1 )
+		{
+			PyErr_Format(
+			 PyExc_RuntimeError,
+			 "%s: unable to copy Unicode character: 0x%08" PRIx32 " at index: %" PRIzd " to string object.",
+			 function,
+			 unicode_character,
+			 utf32_string_index );
+
+			goto on_error;
+		}
+	}
+	PyMem_Free(
+	 utf32_string );
+
+	return( string_object );
+
+on_error:
+	if( string_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) string_object );
+	}
+	if( utf32_string != NULL )
+	{
+		PyMem_Free(
+		 utf32_string );
+	}
+	return( NULL );
+#else
+	string_object = PyUnicode_DecodeUTF16(
+	                 (char *) utf16_stream,
+	                 (Py_ssize_t) utf16_stream_size,
+	                 NULL,
+	                 &byte_order );
+
+	return( string_object );
+#endif
+}
+
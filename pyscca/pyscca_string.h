@@ -46,6 +46,10 @@ int pyscca_string_copy_to_utf8_rfc2279(
 
 #endif /* PY_MAJOR_VERSION >= 3 && PY_MINOR_VERSION >= 3 */
 
+PyObject *pyscca_string_new_from_utf16_stream(
+           const uint8_t *utf16_stream,
+           size_t utf16_stream_size );
+
 #if defined( __cplusplus )
 }
 #endif
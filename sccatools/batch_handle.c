@@ -0,0 +1,1900 @@
+/*
+ * Batch handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "batch_handle.h"
+#include "info_handle.h"
+#include "output_writer.h"
+#include "source_list.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libcthreads.h"
+
+#define BATCH_HANDLE_NOTIFY_STREAM		stdout
+
+/* Creates a batch handle
+ * Make sure the value batch_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_initialize(
+     batch_handle_t **batch_handle,
+     int number_of_jobs,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_initialize";
+	int worker_index      = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_jobs < 1 )
+	 || ( number_of_jobs > BATCH_HANDLE_MAXIMUM_NUMBER_OF_JOBS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of jobs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*batch_handle = memory_allocate_structure(
+	                 batch_handle_t );
+
+	if( *batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *batch_handle,
+	     0,
+	     sizeof( batch_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch handle.",
+		 function );
+
+		memory_free(
+		 *batch_handle );
+
+		*batch_handle = NULL;
+
+		return( -1 );
+	}
+	( *batch_handle )->workers = (batch_handle_worker_t *) memory_allocate(
+	                                                         sizeof( batch_handle_worker_t ) * number_of_jobs );
+
+	if( ( *batch_handle )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *batch_handle )->workers,
+	     0,
+	     sizeof( batch_handle_worker_t ) * number_of_jobs ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	( *batch_handle )->number_of_jobs = number_of_jobs;
+
+	/* Every worker has its own info handle that retains its output in memory
+	 * and its own MAM decoder that retains its decoding table between the files of the worker
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_jobs;
+	     worker_index++ )
+	{
+		( *batch_handle )->workers[ worker_index ].batch_handle = *batch_handle;
+		( *batch_handle )->workers[ worker_index ].worker_index = worker_index;
+
+		if( info_handle_initialize(
+		     &( ( *batch_handle )->workers[ worker_index ].info_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize info handle: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( output_writer_set_stream(
+		     ( *batch_handle )->workers[ worker_index ].info_handle->output_writer,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set output stream of info handle: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( libscca_mam_decoder_initialize(
+		     &( ( *batch_handle )->workers[ worker_index ].mam_decoder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize MAM decoder: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( libscca_file_set_mam_decoder(
+		     ( *batch_handle )->workers[ worker_index ].info_handle->input_file,
+		     ( *batch_handle )->workers[ worker_index ].mam_decoder,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set MAM decoder of info handle: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	if( output_writer_initialize(
+	     &( ( *batch_handle )->output_writer ),
+	     BATCH_HANDLE_NOTIFY_STREAM,
+	     OUTPUT_WRITER_DEFAULT_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output writer.",
+		 function );
+
+		goto on_error;
+	}
+	( *batch_handle )->output_format = INFO_HANDLE_OUTPUT_FORMAT_TEXT;
+
+	return( 1 );
+
+on_error:
+	if( *batch_handle != NULL )
+	{
+		batch_handle_free(
+		 batch_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a batch handle
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_free(
+     batch_handle_t **batch_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_free";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_handle != NULL )
+	{
+		if( ( *batch_handle )->workers != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < ( *batch_handle )->number_of_jobs;
+			     worker_index++ )
+			{
+				if( ( *batch_handle )->workers[ worker_index ].info_handle != NULL )
+				{
+					if( info_handle_free(
+					     &( ( *batch_handle )->workers[ worker_index ].info_handle ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free info handle: %d.",
+						 function,
+						 worker_index );
+
+						result = -1;
+					}
+				}
+				/* The MAM decoder is freed after the info handle since it is referenced by its input file
+				 */
+				if( ( *batch_handle )->workers[ worker_index ].mam_decoder != NULL )
+				{
+					if( libscca_mam_decoder_free(
+					     &( ( *batch_handle )->workers[ worker_index ].mam_decoder ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free MAM decoder: %d.",
+						 function,
+						 worker_index );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 ( *batch_handle )->workers );
+		}
+		if( ( *batch_handle )->output_writer != NULL )
+		{
+			if( output_writer_free(
+			     &( ( *batch_handle )->output_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free output writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *batch_handle );
+
+		*batch_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the batch handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_signal_abort(
+     batch_handle_t *batch_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_signal_abort";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	batch_handle->abort = 1;
+
+	if( batch_handle->workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < batch_handle->number_of_jobs;
+		     worker_index++ )
+		{
+			if( batch_handle->workers[ worker_index ].info_handle == NULL )
+			{
+				continue;
+			}
+			if( info_handle_signal_abort(
+			     batch_handle->workers[ worker_index ].info_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal info handle: %d to abort.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+	}
+	return( result );
+}
+
+/* Sets the output format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int batch_handle_set_output_format(
+     batch_handle_t *batch_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_set_output_format";
+	int result            = 0;
+	int worker_index      = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < batch_handle->number_of_jobs;
+	     worker_index++ )
+	{
+		result = info_handle_set_output_format(
+		          batch_handle->workers[ worker_index ].info_handle,
+		          string,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set output format of info handle: %d.",
+			 function,
+			 worker_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		batch_handle->output_format = batch_handle->workers[ worker_index ].info_handle->output_format;
+	}
+	return( 1 );
+}
+
+/* Sets the fields to output
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int batch_handle_set_fields(
+     batch_handle_t *batch_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_set_fields";
+	int result            = 0;
+	int worker_index      = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < batch_handle->number_of_jobs;
+	     worker_index++ )
+	{
+		result = info_handle_set_fields(
+		          batch_handle->workers[ worker_index ].info_handle,
+		          string,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set fields of info handle: %d.",
+			 function,
+			 worker_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Processes a task using an info handle
+ * Errors that relate to the source are retained in the task and are not considered a failure
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_process_task(
+     batch_handle_t *batch_handle,
+     info_handle_t *info_handle,
+     batch_handle_task_t *task,
+     libcerror_error_t **error )
+{
+	output_writer_t *output_writer = NULL;
+	static char *function          = "batch_handle_process_task";
+	int result                     = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( task->output_data != NULL )
+	 || ( task->error != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid task - already processed.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer = info_handle->output_writer;
+
+	output_writer->buffer_offset = 0;
+
+	if( task->source_data != NULL )
+	{
+		result = info_handle_open_input_data(
+		          info_handle,
+		          task->source_data,
+		          task->source_data_size,
+		          &( task->error ) );
+	}
+	else
+	{
+		result = info_handle_open_input(
+		          info_handle,
+		          task->source,
+		          &( task->error ) );
+	}
+
+	if( result == 1 )
+	{
+		result = info_handle_file_fprint(
+		          info_handle,
+		          &( task->error ) );
+
+		if( task->error == NULL )
+		{
+			if( info_handle_close_input(
+			     info_handle,
+			     &( task->error ) ) != 0 )
+			{
+				result = -1;
+			}
+		}
+		else
+		{
+			info_handle_close_input(
+			 info_handle,
+			 NULL );
+		}
+	}
+	/* The output of a failed source is discarded and only the error is reported
+	 */
+	if( ( result == 1 )
+	 && ( output_writer->buffer_offset > 0 ) )
+	{
+		task->output_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * output_writer->buffer_offset );
+
+		if( task->output_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create output data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     task->output_data,
+		     output_writer->buffer,
+		     output_writer->buffer_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy output data.",
+			 function );
+
+			goto on_error;
+		}
+		task->output_data_size = output_writer->buffer_offset;
+	}
+	output_writer->buffer_offset = 0;
+
+	return( 1 );
+
+on_error:
+	if( task->output_data != NULL )
+	{
+		memory_free(
+		 task->output_data );
+
+		task->output_data = NULL;
+	}
+	output_writer->buffer_offset = 0;
+
+	return( -1 );
+}
+
+/* Outputs a processed task
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_output_task(
+     batch_handle_t *batch_handle,
+     batch_handle_task_t *task,
+     libcerror_error_t **error )
+{
+	char error_string[ 512 ];
+
+	static char *function = "batch_handle_output_task";
+	size_t source_length  = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	if( task->source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task - missing source.",
+		 function );
+
+		return( -1 );
+	}
+	source_length = system_string_length(
+	                 task->source );
+
+	if( task->error != NULL )
+	{
+		batch_handle->number_of_failed_tasks += 1;
+
+		if( batch_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSONL )
+		{
+			if( libcerror_error_sprint(
+			     task->error,
+			     error_string,
+			     512 ) == -1 )
+			{
+				error_string[ 0 ] = 0;
+			}
+			if( output_writer_write_string(
+			     batch_handle->output_writer,
+			     "{\"source\":",
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( output_writer_write_json_system_string(
+			     batch_handle->output_writer,
+			     task->source,
+			     source_length,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( output_writer_write_string(
+			     batch_handle->output_writer,
+			     ",\"error\":",
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( output_writer_write_json_string(
+			     batch_handle->output_writer,
+			     (uint8_t *) error_string,
+			     narrow_string_length(
+			      error_string ),
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( output_writer_write_string(
+			     batch_handle->output_writer,
+			     "}\n",
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		else
+		{
+			/* Flush first so that stdout and stderr are interleaved in order
+			 */
+			if( output_writer_flush(
+			     batch_handle->output_writer,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			fprintf(
+			 stderr,
+			 "Unable to process source: %" PRIs_SYSTEM ".\n",
+			 task->source );
+
+			libcnotify_print_error_backtrace(
+			 task->error );
+		}
+		libcerror_error_free(
+		 &( task->error ) );
+	}
+	else if( task->output_data != NULL )
+	{
+		if( batch_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSONL )
+		{
+			/* The object of the info handle is extended with the source as its first member
+			 */
+			if( ( task->output_data_size < 2 )
+			 || ( task->output_data[ 0 ] != (uint8_t) '{' ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported output data.",
+				 function );
+
+				return( -1 );
+			}
+			if( output_writer_write_string(
+			     batch_handle->output_writer,
+			     "{\"source\":",
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( output_writer_write_json_system_string(
+			     batch_handle->output_writer,
+			     task->source,
+			     source_length,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( output_writer_write_data(
+			     batch_handle->output_writer,
+			     (uint8_t *) ",",
+			     1,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( output_writer_write_data(
+			     batch_handle->output_writer,
+			     &( task->output_data[ 1 ] ),
+			     task->output_data_size - 1,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( output_writer_printf(
+			     batch_handle->output_writer,
+			     "Source\t\t\t\t\t: %" PRIs_SYSTEM "\n",
+			     task->source ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write source.",
+				 function );
+
+				return( -1 );
+			}
+			if( output_writer_write_data(
+			     batch_handle->output_writer,
+			     task->output_data,
+			     task->output_data_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		memory_free(
+		 task->output_data );
+
+		task->output_data      = NULL;
+		task->output_data_size = 0;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write output of source: %" PRIs_SYSTEM ".",
+	 function,
+	 task->source );
+
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Processes the tasks handed out by the task scheduler until none are left or abort was signalled
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_worker_callback_function(
+     batch_handle_worker_t *worker )
+{
+	batch_handle_t *batch_handle = NULL;
+	batch_handle_task_t *task    = NULL;
+	libcerror_error_t *error     = NULL;
+	static char *function        = "batch_handle_worker_callback_function";
+	int mutex_is_grabbed         = 0;
+	int result                   = 0;
+	int task_index               = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		goto on_error;
+	}
+	batch_handle = worker->batch_handle;
+
+	do
+	{
+		result = libscca_task_scheduler_get_next_task(
+		          batch_handle->task_scheduler,
+		          worker->worker_index,
+		          &task_index,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next task.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_grab(
+		     batch_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		mutex_is_grabbed = 1;
+
+		if( batch_handle->abort != 0 )
+		{
+			result = 0;
+		}
+		if( result != 0 )
+		{
+			task = &( batch_handle->tasks[ batch_handle->window_start_index + task_index ] );
+
+			task->status = BATCH_HANDLE_TASK_STATUS_PROCESSING;
+		}
+		else
+		{
+			/* Wake up the output so that it can detect that no more tasks will be processed
+			 */
+			if( libcthreads_condition_broadcast(
+			     batch_handle->condition,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		mutex_is_grabbed = 0;
+
+		if( libcthreads_mutex_release(
+		     batch_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( result == 0 )
+		{
+			break;
+		}
+		if( batch_handle_process_task(
+		     batch_handle,
+		     worker->info_handle,
+		     task,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process task.",
+			 function );
+
+			/* The error is reported with the task so that the other tasks can continue
+			 */
+			if( task->error == NULL )
+			{
+				task->error = error;
+			}
+			else
+			{
+				libcerror_error_free(
+				 &error );
+			}
+			error = NULL;
+		}
+		if( libcthreads_mutex_grab(
+		     batch_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		mutex_is_grabbed = 1;
+
+		task->status = BATCH_HANDLE_TASK_STATUS_DONE;
+
+		if( libcthreads_condition_broadcast(
+		     batch_handle->condition,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			goto on_error;
+		}
+		mutex_is_grabbed = 0;
+
+		if( libcthreads_mutex_release(
+		     batch_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( result != 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	/* Stop the other workers and the output since the tasks of this worker
+	 * might never be done
+	 */
+	if( batch_handle != NULL )
+	{
+		if( mutex_is_grabbed == 0 )
+		{
+			mutex_is_grabbed = libcthreads_mutex_grab(
+			                    batch_handle->mutex,
+			                    NULL );
+		}
+		batch_handle->abort = 1;
+
+		if( mutex_is_grabbed == 1 )
+		{
+			libcthreads_condition_broadcast(
+			 batch_handle->condition,
+			 NULL );
+			libcthreads_mutex_release(
+			 batch_handle->mutex,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Processes the tasks using multiple workers, largest first, and outputs them in order
+ * The tasks are processed in windows of BATCH_HANDLE_TASK_WINDOW_SIZE tasks so that
+ * at most the output of one window is buffered while waiting for a preceding task
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_process_tasks_concurrently(
+     batch_handle_t *batch_handle,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	batch_handle_task_t *task = NULL;
+	static char *function     = "batch_handle_process_tasks_concurrently";
+	size64_t file_size        = 0;
+	int mutex_is_grabbed      = 0;
+	int output_index          = 0;
+	int result                = 1;
+	int task_index            = 0;
+	int task_status           = 0;
+	int window_end_index      = 0;
+	int worker_index          = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers < 1 )
+	 || ( number_of_workers > batch_handle->number_of_jobs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_initialize(
+	     &( batch_handle->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( batch_handle->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	for( batch_handle->window_start_index = 0;
+	     batch_handle->window_start_index < batch_handle->number_of_tasks;
+	     batch_handle->window_start_index = window_end_index )
+	{
+		if( batch_handle->abort != 0 )
+		{
+			break;
+		}
+		window_end_index = batch_handle->number_of_tasks;
+
+		if( ( window_end_index - batch_handle->window_start_index ) > BATCH_HANDLE_TASK_WINDOW_SIZE )
+		{
+			window_end_index = batch_handle->window_start_index + BATCH_HANDLE_TASK_WINDOW_SIZE;
+		}
+		if( libscca_task_scheduler_initialize(
+		     &( batch_handle->task_scheduler ),
+		     number_of_workers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create task scheduler.",
+			 function );
+
+			goto on_error;
+		}
+		/* The largest files are processed first so that a single large file
+		 * does not leave the other workers idle at the end of the window.
+		 * The file size is used as the weight since it is available without
+		 * reading the file
+		 */
+		for( output_index = batch_handle->window_start_index;
+		     output_index < window_end_index;
+		     output_index++ )
+		{
+			if( source_list_get_file_size(
+			     batch_handle->tasks[ output_index ].source,
+			     &file_size,
+			     NULL ) != 1 )
+			{
+				/* The error is reported when the task is processed
+				 */
+				file_size = 0;
+			}
+			if( libscca_task_scheduler_append_task(
+			     batch_handle->task_scheduler,
+			     file_size,
+			     &task_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append task: %d to task scheduler.",
+				 function,
+				 output_index );
+
+				goto on_error;
+			}
+		}
+		if( libscca_task_scheduler_start(
+		     batch_handle->task_scheduler,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start task scheduler.",
+			 function );
+
+			goto on_error;
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( batch_handle->workers[ worker_index ].thread ),
+			     NULL,
+			     (int (*)(void *)) &batch_handle_worker_callback_function,
+			     (void *) &( batch_handle->workers[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		for( output_index = batch_handle->window_start_index;
+		     output_index < window_end_index;
+		     output_index++ )
+		{
+			task = &( batch_handle->tasks[ output_index ] );
+
+			if( libcthreads_mutex_grab(
+			     batch_handle->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab mutex.",
+				 function );
+
+				goto on_error;
+			}
+			mutex_is_grabbed = 1;
+
+			/* A task that is not being processed when abort is signalled will never be done
+			 */
+			while( ( task->status != BATCH_HANDLE_TASK_STATUS_DONE )
+			    && ( ( batch_handle->abort == 0 )
+			     ||  ( task->status == BATCH_HANDLE_TASK_STATUS_PROCESSING ) ) )
+			{
+				if( libcthreads_condition_wait(
+				     batch_handle->condition,
+				     batch_handle->mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to wait for condition.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			task_status = task->status;
+
+			batch_handle->next_output_index = output_index + 1;
+
+			if( libcthreads_condition_broadcast(
+			     batch_handle->condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+
+				goto on_error;
+			}
+			mutex_is_grabbed = 0;
+
+			if( libcthreads_mutex_release(
+			     batch_handle->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				goto on_error;
+			}
+			if( task_status != BATCH_HANDLE_TASK_STATUS_DONE )
+			{
+				break;
+			}
+			if( batch_handle_output_task(
+			     batch_handle,
+			     task,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to output task: %d.",
+				 function,
+				 output_index );
+
+				goto on_error;
+			}
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( libcthreads_thread_join(
+			     &( batch_handle->workers[ worker_index ].thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+		if( libscca_task_scheduler_free(
+		     &( batch_handle->task_scheduler ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free task scheduler.",
+			 function );
+
+			result = -1;
+		}
+		if( result != 1 )
+		{
+			break;
+		}
+	}
+	if( libcthreads_condition_free(
+	     &( batch_handle->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_free(
+	     &( batch_handle->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mutex.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+
+on_error:
+	/* Stop the workers before they are joined
+	 */
+	batch_handle->abort = 1;
+
+	if( batch_handle->mutex != NULL )
+	{
+		if( mutex_is_grabbed == 0 )
+		{
+			mutex_is_grabbed = libcthreads_mutex_grab(
+			                    batch_handle->mutex,
+			                    NULL );
+		}
+		if( batch_handle->condition != NULL )
+		{
+			libcthreads_condition_broadcast(
+			 batch_handle->condition,
+			 NULL );
+		}
+		if( mutex_is_grabbed == 1 )
+		{
+			libcthreads_mutex_release(
+			 batch_handle->mutex,
+			 NULL );
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( batch_handle->workers[ worker_index ].thread != NULL )
+		{
+			libcthreads_thread_join(
+			 &( batch_handle->workers[ worker_index ].thread ),
+			 NULL );
+		}
+	}
+	if( batch_handle->task_scheduler != NULL )
+	{
+		libscca_task_scheduler_free(
+		 &( batch_handle->task_scheduler ),
+		 NULL );
+	}
+	if( batch_handle->condition != NULL )
+	{
+		libcthreads_condition_free(
+		 &( batch_handle->condition ),
+		 NULL );
+	}
+	if( batch_handle->mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( batch_handle->mutex ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Processes and outputs the tasks one after the other
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_process_tasks_sequentially(
+     batch_handle_t *batch_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_process_tasks_sequentially";
+	int task_index        = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( task_index = 0;
+	     task_index < batch_handle->number_of_tasks;
+	     task_index++ )
+	{
+		if( batch_handle->abort != 0 )
+		{
+			break;
+		}
+		if( batch_handle_process_task(
+		     batch_handle,
+		     batch_handle->workers[ 0 ].info_handle,
+		     &( batch_handle->tasks[ task_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process task: %d.",
+			 function,
+			 task_index );
+
+			return( -1 );
+		}
+		batch_handle->tasks[ task_index ].status = BATCH_HANDLE_TASK_STATUS_DONE;
+
+		if( batch_handle_output_task(
+		     batch_handle,
+		     &( batch_handle->tasks[ task_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to output task: %d.",
+			 function,
+			 task_index );
+
+			return( -1 );
+		}
+		batch_handle->next_output_index = task_index + 1;
+	}
+	return( 1 );
+}
+
+/* Processes the sources
+ * The output of the sources is written in the order of the source list,
+ * regardless of the order in which the sources are processed
+ * Returns 1 if successful, 0 if one or more sources could not be processed or -1 on error
+ */
+int batch_handle_process_sources(
+     batch_handle_t *batch_handle,
+     source_list_t *source_list,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_process_sources";
+	int number_of_workers = 0;
+	int result            = 0;
+	int task_index        = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_handle->tasks != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch handle - tasks value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source list.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_list->number_of_sources == 0 )
+	{
+		return( 1 );
+	}
+	if( ( source_list->number_of_sources < 0 )
+	 || ( (size_t) source_list->number_of_sources > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( batch_handle_task_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source list - number of sources value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	batch_handle->tasks = (batch_handle_task_t *) memory_allocate(
+	                                               sizeof( batch_handle_task_t ) * source_list->number_of_sources );
+
+	if( batch_handle->tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tasks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     batch_handle->tasks,
+	     0,
+	     sizeof( batch_handle_task_t ) * source_list->number_of_sources ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tasks.",
+		 function );
+
+		goto on_error;
+	}
+	for( task_index = 0;
+	     task_index < source_list->number_of_sources;
+	     task_index++ )
+	{
+		batch_handle->tasks[ task_index ].source = source_list->sources[ task_index ];
+	}
+	batch_handle->number_of_tasks        = source_list->number_of_sources;
+	batch_handle->next_output_index      = 0;
+	batch_handle->number_of_failed_tasks = 0;
+
+	number_of_workers = batch_handle->number_of_jobs;
+
+	if( number_of_workers > batch_handle->number_of_tasks )
+	{
+		number_of_workers = batch_handle->number_of_tasks;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_workers > 1 )
+	{
+		result = batch_handle_process_tasks_concurrently(
+		          batch_handle,
+		          number_of_workers,
+		          error );
+	}
+	else
+#endif
+	{
+		result = batch_handle_process_tasks_sequentially(
+		          batch_handle,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process tasks.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_flush(
+	     batch_handle->output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output.",
+		 function );
+
+		goto on_error;
+	}
+	/* Tasks that were not output because of an abort are counted as failed
+	 */
+	batch_handle->number_of_failed_tasks += batch_handle->number_of_tasks - batch_handle->next_output_index;
+
+	for( task_index = 0;
+	     task_index < batch_handle->number_of_tasks;
+	     task_index++ )
+	{
+		if( batch_handle->tasks[ task_index ].output_data != NULL )
+		{
+			memory_free(
+			 batch_handle->tasks[ task_index ].output_data );
+		}
+		if( batch_handle->tasks[ task_index ].error != NULL )
+		{
+			libcerror_error_free(
+			 &( batch_handle->tasks[ task_index ].error ) );
+		}
+	}
+	memory_free(
+	 batch_handle->tasks );
+
+	batch_handle->tasks           = NULL;
+	batch_handle->number_of_tasks = 0;
+
+	if( batch_handle->number_of_failed_tasks > 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( batch_handle->tasks != NULL )
+	{
+		for( task_index = 0;
+		     task_index < batch_handle->number_of_tasks;
+		     task_index++ )
+		{
+			if( batch_handle->tasks[ task_index ].output_data != NULL )
+			{
+				memory_free(
+				 batch_handle->tasks[ task_index ].output_data );
+			}
+			if( batch_handle->tasks[ task_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( batch_handle->tasks[ task_index ].error ) );
+			}
+		}
+		memory_free(
+		 batch_handle->tasks );
+
+		batch_handle->tasks = NULL;
+	}
+	batch_handle->number_of_tasks = 0;
+
+	return( -1 );
+}
+
+/* Processes the regular file members of a tar archive stream
+ * The members are read from memory in the order they are stored in the archive
+ * Returns 1 if successful, 0 if one or more members could not be processed or -1 on error
+ */
+int batch_handle_process_tar_stream(
+     batch_handle_t *batch_handle,
+     tar_reader_t *tar_reader,
+     libcerror_error_t **error )
+{
+	batch_handle_task_t task;
+
+	static char *function = "batch_handle_process_tar_stream";
+	int result            = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_handle->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch handle - missing workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( tar_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tar reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &task,
+	     0,
+	     sizeof( batch_handle_task_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear task.",
+		 function );
+
+		return( -1 );
+	}
+	batch_handle->number_of_failed_tasks = 0;
+
+	while( batch_handle->abort == 0 )
+	{
+		result = tar_reader_read_member(
+		          tar_reader,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read member.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		task.source           = tar_reader->member_name;
+		task.source_data      = tar_reader->member_data;
+		task.source_data_size = tar_reader->member_data_size;
+
+		/* The members are processed sequentially since the stream is read sequentially
+		 */
+		if( batch_handle_process_task(
+		     batch_handle,
+		     batch_handle->workers[ 0 ].info_handle,
+		     &task,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process member.",
+			 function );
+
+			goto on_error;
+		}
+		if( batch_handle_output_task(
+		     batch_handle,
+		     &task,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to output member.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( output_writer_flush(
+	     batch_handle->output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output.",
+		 function );
+
+		goto on_error;
+	}
+	if( batch_handle->number_of_failed_tasks > 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( task.output_data != NULL )
+	{
+		memory_free(
+		 task.output_data );
+	}
+	if( task.error != NULL )
+	{
+		libcerror_error_free(
+		 &( task.error ) );
+	}
+	return( -1 );
+}
+
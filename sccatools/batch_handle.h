@@ -0,0 +1,246 @@
+/*
+ * Batch handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BATCH_HANDLE_H )
+#define _BATCH_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "info_handle.h"
+#include "output_writer.h"
+#include "source_list.h"
+#include "tar_reader.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcthreads.h"
+#include "sccatools_libscca.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of concurrent jobs
+ */
+#define BATCH_HANDLE_DEFAULT_NUMBER_OF_JOBS	4
+
+/* The maximum number of concurrent jobs
+ */
+#define BATCH_HANDLE_MAXIMUM_NUMBER_OF_JOBS	32
+
+/* The number of tasks that are scheduled together when processing concurrently
+ * The output of a task is buffered until the output of the preceding tasks has been written,
+ * the window bounds this buffer to the output of the tasks in the window
+ */
+#define BATCH_HANDLE_TASK_WINDOW_SIZE		1024
+
+enum BATCH_HANDLE_TASK_STATUSES
+{
+	BATCH_HANDLE_TASK_STATUS_PENDING	= 0,
+	BATCH_HANDLE_TASK_STATUS_PROCESSING	= 1,
+	BATCH_HANDLE_TASK_STATUS_DONE		= 2
+};
+
+typedef struct batch_handle_task batch_handle_task_t;
+
+struct batch_handle_task
+{
+	/* The source
+	 */
+	const system_character_t *source;
+
+	/* The source data, when the source is read from memory instead of a file
+	 */
+	const uint8_t *source_data;
+
+	/* The source data size
+	 */
+	size_t source_data_size;
+
+	/* The output data
+	 */
+	uint8_t *output_data;
+
+	/* The output data size
+	 */
+	size_t output_data_size;
+
+	/* The error that occurred while processing the source
+	 */
+	libcerror_error_t *error;
+
+	/* The status
+	 */
+	int status;
+};
+
+typedef struct batch_handle batch_handle_t;
+
+typedef struct batch_handle_worker batch_handle_worker_t;
+
+struct batch_handle_worker
+{
+	/* The batch handle
+	 */
+	batch_handle_t *batch_handle;
+
+	/* The info handle
+	 */
+	info_handle_t *info_handle;
+
+	/* The MAM decoder of the input file of the info handle
+	 */
+	libscca_mam_decoder_t *mam_decoder;
+
+	/* The index of the worker in the task scheduler
+	 */
+	int worker_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+struct batch_handle
+{
+	/* The workers
+	 */
+	batch_handle_worker_t *workers;
+
+	/* The number of jobs
+	 */
+	int number_of_jobs;
+
+	/* The output format
+	 */
+	int output_format;
+
+	/* The output writer
+	 */
+	output_writer_t *output_writer;
+
+	/* The tasks
+	 */
+	batch_handle_task_t *tasks;
+
+	/* The number of tasks
+	 */
+	int number_of_tasks;
+
+	/* The index of the next task to output
+	 */
+	int next_output_index;
+
+	/* The index of the first task of the window that is being processed
+	 */
+	int window_start_index;
+
+	/* The number of failed tasks
+	 */
+	int number_of_failed_tasks;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the task indexes and statuses
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a task is done
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The task scheduler
+	 */
+	libscca_task_scheduler_t *task_scheduler;
+#endif
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int batch_handle_initialize(
+     batch_handle_t **batch_handle,
+     int number_of_jobs,
+     libcerror_error_t **error );
+
+int batch_handle_free(
+     batch_handle_t **batch_handle,
+     libcerror_error_t **error );
+
+int batch_handle_signal_abort(
+     batch_handle_t *batch_handle,
+     libcerror_error_t **error );
+
+int batch_handle_set_output_format(
+     batch_handle_t *batch_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int batch_handle_set_fields(
+     batch_handle_t *batch_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int batch_handle_process_task(
+     batch_handle_t *batch_handle,
+     info_handle_t *info_handle,
+     batch_handle_task_t *task,
+     libcerror_error_t **error );
+
+int batch_handle_output_task(
+     batch_handle_t *batch_handle,
+     batch_handle_task_t *task,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int batch_handle_worker_callback_function(
+     batch_handle_worker_t *worker );
+
+int batch_handle_process_tasks_concurrently(
+     batch_handle_t *batch_handle,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int batch_handle_process_tasks_sequentially(
+     batch_handle_t *batch_handle,
+     libcerror_error_t **error );
+
+int batch_handle_process_sources(
+     batch_handle_t *batch_handle,
+     source_list_t *source_list,
+     libcerror_error_t **error );
+
+int batch_handle_process_tar_stream(
+     batch_handle_t *batch_handle,
+     tar_reader_t *tar_reader,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BATCH_HANDLE_H ) */
+
@@ -0,0 +1,2124 @@
+/*
+ * Carve handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "carve_handle.h"
+#include "output_writer.h"
+#include "sccatools_libbfio.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libcthreads.h"
+#include "sccatools_libscca.h"
+
+#define CARVE_HANDLE_NOTIFY_STREAM		stdout
+
+#if defined( WINAPI )
+#define CARVE_HANDLE_PATH_SEPARATOR	'\\'
+#else
+#define CARVE_HANDLE_PATH_SEPARATOR	'/'
+#endif
+
+/* Creates a carve handle
+ * Make sure the value carve_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_initialize(
+     carve_handle_t **carve_handle,
+     int number_of_jobs,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_initialize";
+	int worker_index      = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carve_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carve handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_jobs < 1 )
+	 || ( number_of_jobs > CARVE_HANDLE_MAXIMUM_NUMBER_OF_JOBS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of jobs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*carve_handle = memory_allocate_structure(
+	                 carve_handle_t );
+
+	if( *carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create carve handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *carve_handle,
+	     0,
+	     sizeof( carve_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear carve handle.",
+		 function );
+
+		memory_free(
+		 *carve_handle );
+
+		*carve_handle = NULL;
+
+		return( -1 );
+	}
+	( *carve_handle )->workers = (carve_handle_worker_t *) memory_allocate(
+	                                                         sizeof( carve_handle_worker_t ) * number_of_jobs );
+
+	if( ( *carve_handle )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *carve_handle )->workers,
+	     0,
+	     sizeof( carve_handle_worker_t ) * number_of_jobs ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	( *carve_handle )->number_of_jobs = number_of_jobs;
+
+	for( worker_index = 0;
+	     worker_index < number_of_jobs;
+	     worker_index++ )
+	{
+		( *carve_handle )->workers[ worker_index ].carve_handle = *carve_handle;
+		( *carve_handle )->workers[ worker_index ].worker_index = worker_index;
+	}
+	if( output_writer_initialize(
+	     &( ( *carve_handle )->output_writer ),
+	     CARVE_HANDLE_NOTIFY_STREAM,
+	     OUTPUT_WRITER_DEFAULT_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output writer.",
+		 function );
+
+		goto on_error;
+	}
+	( *carve_handle )->chunk_size = CARVE_HANDLE_DEFAULT_CHUNK_SIZE;
+
+	return( 1 );
+
+on_error:
+	if( *carve_handle != NULL )
+	{
+		carve_handle_free(
+		 carve_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a carve handle
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_free(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_free";
+	int chunk_index       = 0;
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carve_handle != NULL )
+	{
+		if( carve_handle_close_source(
+		     *carve_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close source.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *carve_handle )->workers != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < ( *carve_handle )->number_of_jobs;
+			     worker_index++ )
+			{
+				if( ( *carve_handle )->workers[ worker_index ].buffer != NULL )
+				{
+					memory_free(
+					 ( *carve_handle )->workers[ worker_index ].buffer );
+				}
+			}
+			memory_free(
+			 ( *carve_handle )->workers );
+		}
+		if( ( *carve_handle )->chunks != NULL )
+		{
+			for( chunk_index = 0;
+			     chunk_index < ( *carve_handle )->number_of_chunks;
+			     chunk_index++ )
+			{
+				if( ( *carve_handle )->chunks[ chunk_index ].files != NULL )
+				{
+					memory_free(
+					 ( *carve_handle )->chunks[ chunk_index ].files );
+				}
+				if( ( *carve_handle )->chunks[ chunk_index ].error != NULL )
+				{
+					libcerror_error_free(
+					 &( ( *carve_handle )->chunks[ chunk_index ].error ) );
+				}
+			}
+			memory_free(
+			 ( *carve_handle )->chunks );
+		}
+		if( ( *carve_handle )->output_writer != NULL )
+		{
+			if( output_writer_free(
+			     &( ( *carve_handle )->output_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free output writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *carve_handle );
+
+		*carve_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the carve handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_signal_abort(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_signal_abort";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	carve_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the chunk size
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_set_chunk_size(
+     carve_handle_t *carve_handle,
+     size_t chunk_size,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_set_chunk_size";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->chunks != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carve handle - chunks value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The buffer of a worker contains a chunk and the overlap
+	 */
+	if( ( chunk_size < CARVE_HANDLE_SIGNATURE_SIZE )
+	 || ( chunk_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - CARVE_HANDLE_MAXIMUM_FILE_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	carve_handle->chunk_size = chunk_size;
+
+	return( 1 );
+}
+
+/* Sets the target path, the directory the carved files are written to
+ * The target path is referenced and must remain available while carving
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_set_target_path(
+     carve_handle_t *carve_handle,
+     const system_character_t *target_path,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_set_target_path";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path.",
+		 function );
+
+		return( -1 );
+	}
+	carve_handle->target_path = target_path;
+
+	return( 1 );
+}
+
+/* Opens the source
+ * Every worker opens the source separately so that the chunks can be read concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_open_source(
+     carve_handle_t *carve_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "carve_handle_open_source";
+	size_t filename_length = 0;
+	int worker_index       = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->workers[ 0 ].source_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carve handle - source file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	for( worker_index = 0;
+	     worker_index < carve_handle->number_of_jobs;
+	     worker_index++ )
+	{
+		if( libbfio_file_initialize(
+		     &( carve_handle->workers[ worker_index ].source_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create source file IO handle: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libbfio_file_set_name_wide(
+		     carve_handle->workers[ worker_index ].source_file_io_handle,
+		     filename,
+		     filename_length,
+		     error ) != 1 )
+#else
+		if( libbfio_file_set_name(
+		     carve_handle->workers[ worker_index ].source_file_io_handle,
+		     filename,
+		     filename_length,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename of source file IO handle: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( libbfio_handle_open(
+		     carve_handle->workers[ worker_index ].source_file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open source: %" PRIs_SYSTEM ".",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_get_size(
+	     carve_handle->workers[ 0 ].source_file_io_handle,
+	     &( carve_handle->source_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source size.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	carve_handle_close_source(
+	 carve_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes the source
+ * Returns the 0 if successful or -1 on error
+ */
+int carve_handle_close_source(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_close_source";
+	int result            = 0;
+	int worker_index      = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->workers == NULL )
+	{
+		return( 0 );
+	}
+	for( worker_index = 0;
+	     worker_index < carve_handle->number_of_jobs;
+	     worker_index++ )
+	{
+		if( carve_handle->workers[ worker_index ].source_file_io_handle == NULL )
+		{
+			continue;
+		}
+		/* Closing a file IO handle that failed to open is not an error
+		 */
+		libbfio_handle_close(
+		 carve_handle->workers[ worker_index ].source_file_io_handle,
+		 NULL );
+
+		if( libbfio_handle_free(
+		     &( carve_handle->workers[ worker_index ].source_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free source file IO handle: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	carve_handle->source_size = 0;
+
+	return( result );
+}
+
+/* Appends a file to a chunk
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_chunk_append_file(
+     carve_handle_chunk_t *chunk,
+     off64_t offset,
+     size_t size,
+     int file_type,
+     libcerror_error_t **error )
+{
+	carve_handle_file_t *files    = NULL;
+	static char *function         = "carve_handle_chunk_append_file";
+	int number_of_allocated_files = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->number_of_files >= chunk->number_of_allocated_files )
+	{
+		if( chunk->number_of_allocated_files == 0 )
+		{
+			number_of_allocated_files = 16;
+		}
+		else
+		{
+			number_of_allocated_files = chunk->number_of_allocated_files * 2;
+		}
+		if( ( number_of_allocated_files <= chunk->number_of_allocated_files )
+		 || ( (size_t) number_of_allocated_files > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( carve_handle_file_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated files value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		files = (carve_handle_file_t *) memory_reallocate(
+		                                 chunk->files,
+		                                 sizeof( carve_handle_file_t ) * number_of_allocated_files );
+
+		if( files == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize files.",
+			 function );
+
+			return( -1 );
+		}
+		chunk->files                     = files;
+		chunk->number_of_allocated_files = number_of_allocated_files;
+	}
+	chunk->files[ chunk->number_of_files ].offset    = offset;
+	chunk->files[ chunk->number_of_files ].size      = size;
+	chunk->files[ chunk->number_of_files ].file_type = file_type;
+
+	chunk->number_of_files += 1;
+
+	return( 1 );
+}
+
+/* Writes a carved file to the target path
+ * The file is named after its offset in the source
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_write_file(
+     carve_handle_t *carve_handle,
+     off64_t offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	system_character_t *path  = NULL;
+	FILE *stream              = NULL;
+	static char *function     = "carve_handle_write_file";
+	size_t path_index         = 0;
+	size_t path_size          = 0;
+	size_t target_path_length = 0;
+	size_t write_count        = 0;
+	int print_count           = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carve handle - missing target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	target_path_length = system_string_length(
+	                      carve_handle->target_path );
+
+	/* The filename consists of the 16 hexadecimal digits of the offset followed by ".pf"
+	 */
+	path_size = target_path_length + 21;
+
+	path = system_string_allocate(
+	        path_size );
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     path,
+	     carve_handle->target_path,
+	     target_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy target path.",
+		 function );
+
+		goto on_error;
+	}
+	path_index = target_path_length;
+
+	if( ( path_index == 0 )
+	 || ( path[ path_index - 1 ] != (system_character_t) CARVE_HANDLE_PATH_SEPARATOR ) )
+	{
+		path[ path_index++ ] = (system_character_t) CARVE_HANDLE_PATH_SEPARATOR;
+	}
+	print_count = system_string_sprintf(
+	               &( path[ path_index ] ),
+	               path_size - path_index,
+	               _SYSTEM_STRING( "%016" PRIx64 ".pf" ),
+	               (uint64_t) offset );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= ( path_size - path_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          path,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          path,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	write_count = file_stream_write(
+	               stream,
+	               data,
+	               data_size );
+
+	if( write_count != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	memory_free(
+	 path );
+
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( -1 );
+}
+
+/* Scans the data of a chunk for files
+ * The data starts at the offset of the chunk and contains the chunk followed by the overlap,
+ * only files that start within the chunk are retained so that a file is found by exactly one chunk
+ * Every file is validated with at most CARVE_HANDLE_MAXIMUM_FILE_SIZE bytes of data, regardless
+ * of the chunk boundaries
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_scan_data(
+     carve_handle_t *carve_handle,
+     carve_handle_chunk_t *chunk,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_scan_data";
+	size_t carved_size    = 0;
+	size_t data_offset    = 0;
+	size_t file_size      = 0;
+	size_t next_offset    = 0;
+	size_t scan_size      = 0;
+	size_t validate_size  = 0;
+	int file_type         = 0;
+	int next_file_type    = 0;
+	int result            = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* A signature that starts at the last byte of the chunk extends into the overlap
+	 */
+	scan_size = chunk->size + ( CARVE_HANDLE_SIGNATURE_SIZE - 1 );
+
+	if( scan_size > data_size )
+	{
+		scan_size = data_size;
+	}
+	while( carve_handle->abort == 0 )
+	{
+		result = libscca_carve_find_signature(
+		          data,
+		          scan_size,
+		          &data_offset,
+		          &file_type,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to find signature.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		validate_size = data_size - data_offset;
+
+		if( validate_size > (size_t) CARVE_HANDLE_MAXIMUM_FILE_SIZE )
+		{
+			validate_size = (size_t) CARVE_HANDLE_MAXIMUM_FILE_SIZE;
+		}
+		result = libscca_carve_validate_data(
+		          &( data[ data_offset ] ),
+		          validate_size,
+		          &file_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to validate data at offset: %" PRIi64 ".",
+			 function,
+			 chunk->offset + (off64_t) data_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			carved_size = file_size;
+
+			/* The size of a compressed file is not stored, it is carved up to
+			 * the next signature if the file can be opened without the data after it
+			 */
+			if( file_size == 0 )
+			{
+				carved_size = validate_size;
+				next_offset = data_offset + 1;
+
+				result = libscca_carve_find_signature(
+				          data,
+				          data_offset + validate_size,
+				          &next_offset,
+				          &next_file_type,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to find next signature.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					result = libscca_carve_validate_data(
+					          &( data[ data_offset ] ),
+					          next_offset - data_offset,
+					          &file_size,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to validate data at offset: %" PRIi64 ".",
+						 function,
+						 chunk->offset + (off64_t) data_offset );
+
+						return( -1 );
+					}
+					else if( result != 0 )
+					{
+						carved_size = next_offset - data_offset;
+					}
+				}
+			}
+			if( carve_handle_chunk_append_file(
+			     chunk,
+			     chunk->offset + (off64_t) data_offset,
+			     carved_size,
+			     file_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append file.",
+				 function );
+
+				return( -1 );
+			}
+			if( carve_handle->target_path != NULL )
+			{
+				if( carve_handle_write_file(
+				     carve_handle,
+				     chunk->offset + (off64_t) data_offset,
+				     &( data[ data_offset ] ),
+				     carved_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write file.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		data_offset += 1;
+	}
+	return( 1 );
+}
+
+/* Reads and scans a chunk
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_process_chunk(
+     carve_handle_t *carve_handle,
+     carve_handle_worker_t *worker,
+     carve_handle_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_process_chunk";
+	size64_t read_size    = 0;
+	ssize_t read_count    = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk->offset < 0 )
+	 || ( (size64_t) chunk->offset >= carve_handle->source_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk - offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The buffer is reused for all the chunks processed by the worker
+	 */
+	if( worker->buffer == NULL )
+	{
+		worker->buffer = (uint8_t *) memory_allocate(
+		                              sizeof( uint8_t ) * ( carve_handle->chunk_size + CARVE_HANDLE_MAXIMUM_FILE_SIZE ) );
+
+		if( worker->buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	read_size = carve_handle->source_size - (size64_t) chunk->offset;
+
+	if( read_size > (size64_t) ( chunk->size + CARVE_HANDLE_MAXIMUM_FILE_SIZE ) )
+	{
+		read_size = (size64_t) ( chunk->size + CARVE_HANDLE_MAXIMUM_FILE_SIZE );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              worker->source_file_io_handle,
+	              worker->buffer,
+	              (size_t) read_size,
+	              chunk->offset,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 chunk->offset,
+		 chunk->offset );
+
+		return( -1 );
+	}
+	if( carve_handle_scan_data(
+	     carve_handle,
+	     chunk,
+	     worker->buffer,
+	     (size_t) read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 chunk->offset,
+		 chunk->offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Outputs the files found in a processed chunk
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_output_chunk(
+     carve_handle_t *carve_handle,
+     carve_handle_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	carve_handle_file_t *file = NULL;
+	const char *file_type     = NULL;
+	static char *function     = "carve_handle_output_chunk";
+	int file_index            = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->error != NULL )
+	{
+		carve_handle->number_of_failed_chunks += 1;
+
+		/* Flush first so that stdout and stderr are interleaved in order
+		 */
+		if( output_writer_flush(
+		     carve_handle->output_writer,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		fprintf(
+		 stderr,
+		 "Unable to process chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+		 chunk->offset,
+		 chunk->offset );
+
+		libcnotify_print_error_backtrace(
+		 chunk->error );
+		libcerror_error_free(
+		 &( chunk->error ) );
+	}
+	for( file_index = 0;
+	     file_index < chunk->number_of_files;
+	     file_index++ )
+	{
+		file = &( chunk->files[ file_index ] );
+
+		if( file->file_type == LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10 )
+		{
+			file_type = "compressed";
+		}
+		else
+		{
+			file_type = "uncompressed";
+		}
+		if( output_writer_printf(
+		     carve_handle->output_writer,
+		     "%" PRIi64 "\t0x%08" PRIx64 "\t%" PRIzd "\t%s\n",
+		     file->offset,
+		     file->offset,
+		     file->size,
+		     file_type ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	carve_handle->number_of_files += chunk->number_of_files;
+
+	if( chunk->files != NULL )
+	{
+		memory_free(
+		 chunk->files );
+
+		chunk->files = NULL;
+	}
+	chunk->number_of_files           = 0;
+	chunk->number_of_allocated_files = 0;
+
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write output of chunk at offset: %" PRIi64 ".",
+	 function,
+	 chunk->offset );
+
+	return( -1 );
+}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Processes the chunks handed out by the task scheduler until none are left or abort was signalled
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_worker_callback_function(
+     carve_handle_worker_t *worker )
+{
+	carve_handle_t *carve_handle = NULL;
+	carve_handle_chunk_t *chunk  = NULL;
+	libcerror_error_t *error     = NULL;
+	static char *function        = "carve_handle_worker_callback_function";
+	int mutex_is_grabbed         = 0;
+	int result                   = 0;
+	int task_index               = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		goto on_error;
+	}
+	carve_handle = worker->carve_handle;
+
+	do
+	{
+		result = libscca_task_scheduler_get_next_task(
+		          carve_handle->task_scheduler,
+		          worker->worker_index,
+		          &task_index,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next task.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_grab(
+		     carve_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		mutex_is_grabbed = 1;
+
+		if( carve_handle->abort != 0 )
+		{
+			result = 0;
+		}
+		if( result != 0 )
+		{
+			chunk = &( carve_handle->chunks[ task_index ] );
+
+			chunk->status = CARVE_HANDLE_CHUNK_STATUS_PROCESSING;
+		}
+		else
+		{
+			/* Wake up the output so that it can detect that no more chunks will be processed
+			 */
+			if( libcthreads_condition_broadcast(
+			     carve_handle->condition,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		mutex_is_grabbed = 0;
+
+		if( libcthreads_mutex_release(
+		     carve_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( result == 0 )
+		{
+			break;
+		}
+		if( carve_handle_process_chunk(
+		     carve_handle,
+		     worker,
+		     chunk,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process chunk.",
+			 function );
+
+			/* The error is reported with the chunk so that the other chunks can continue
+			 */
+			if( chunk->error == NULL )
+			{
+				chunk->error = error;
+			}
+			else
+			{
+				libcerror_error_free(
+				 &error );
+			}
+			error = NULL;
+		}
+		if( libcthreads_mutex_grab(
+		     carve_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		mutex_is_grabbed = 1;
+
+		chunk->status = CARVE_HANDLE_CHUNK_STATUS_DONE;
+
+		if( libcthreads_condition_broadcast(
+		     carve_handle->condition,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			goto on_error;
+		}
+		mutex_is_grabbed = 0;
+
+		if( libcthreads_mutex_release(
+		     carve_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( result != 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	/* Stop the other workers and the output since the chunks of this worker
+	 * might never be done
+	 */
+	if( carve_handle != NULL )
+	{
+		if( mutex_is_grabbed == 0 )
+		{
+			mutex_is_grabbed = libcthreads_mutex_grab(
+			                    carve_handle->mutex,
+			                    NULL );
+		}
+		carve_handle->abort = 1;
+
+		if( mutex_is_grabbed == 1 )
+		{
+			libcthreads_condition_broadcast(
+			 carve_handle->condition,
+			 NULL );
+			libcthreads_mutex_release(
+			 carve_handle->mutex,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Processes the chunks using multiple workers and outputs them in order
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_process_chunks_concurrently(
+     carve_handle_t *carve_handle,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	carve_handle_chunk_t *chunk = NULL;
+	static char *function       = "carve_handle_process_chunks_concurrently";
+	int chunk_status            = 0;
+	int mutex_is_grabbed        = 0;
+	int output_index            = 0;
+	int result                  = 1;
+	int task_index              = 0;
+	int worker_index            = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers < 1 )
+	 || ( number_of_workers > carve_handle->number_of_jobs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_initialize(
+	     &( carve_handle->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( carve_handle->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_task_scheduler_initialize(
+	     &( carve_handle->task_scheduler ),
+	     number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create task scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	/* The chunks are dealt out in order so that the output of the first chunks
+	 * does not have to wait for the last chunks
+	 */
+	for( output_index = 0;
+	     output_index < carve_handle->number_of_chunks;
+	     output_index++ )
+	{
+		if( libscca_task_scheduler_append_task(
+		     carve_handle->task_scheduler,
+		     (size64_t) carve_handle->chunks[ output_index ].size,
+		     &task_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append chunk: %d to task scheduler.",
+			 function,
+			 output_index );
+
+			goto on_error;
+		}
+	}
+	if( libscca_task_scheduler_start(
+	     carve_handle->task_scheduler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start task scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( carve_handle->workers[ worker_index ].thread ),
+		     NULL,
+		     (int (*)(void *)) &carve_handle_worker_callback_function,
+		     (void *) &( carve_handle->workers[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	for( output_index = 0;
+	     output_index < carve_handle->number_of_chunks;
+	     output_index++ )
+	{
+		chunk = &( carve_handle->chunks[ output_index ] );
+
+		if( libcthreads_mutex_grab(
+		     carve_handle->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		mutex_is_grabbed = 1;
+
+		/* A chunk that is not being processed when abort is signalled will never be done
+		 */
+		while( ( chunk->status != CARVE_HANDLE_CHUNK_STATUS_DONE )
+		    && ( ( carve_handle->abort == 0 )
+		     ||  ( chunk->status == CARVE_HANDLE_CHUNK_STATUS_PROCESSING ) ) )
+		{
+			if( libcthreads_condition_wait(
+			     carve_handle->condition,
+			     carve_handle->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		chunk_status = chunk->status;
+
+		mutex_is_grabbed = 0;
+
+		if( libcthreads_mutex_release(
+		     carve_handle->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( chunk_status != CARVE_HANDLE_CHUNK_STATUS_DONE )
+		{
+			break;
+		}
+		if( carve_handle_output_chunk(
+		     carve_handle,
+		     chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to output chunk: %d.",
+			 function,
+			 output_index );
+
+			goto on_error;
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_join(
+		     &( carve_handle->workers[ worker_index ].thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	if( libscca_task_scheduler_free(
+	     &( carve_handle->task_scheduler ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free task scheduler.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_condition_free(
+	     &( carve_handle->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_free(
+	     &( carve_handle->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mutex.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+
+on_error:
+	/* Stop the workers before they are joined
+	 */
+	carve_handle->abort = 1;
+
+	if( carve_handle->mutex != NULL )
+	{
+		if( mutex_is_grabbed == 0 )
+		{
+			mutex_is_grabbed = libcthreads_mutex_grab(
+			                    carve_handle->mutex,
+			                    NULL );
+		}
+		if( carve_handle->condition != NULL )
+		{
+			libcthreads_condition_broadcast(
+			 carve_handle->condition,
+			 NULL );
+		}
+		if( mutex_is_grabbed == 1 )
+		{
+			libcthreads_mutex_release(
+			 carve_handle->mutex,
+			 NULL );
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( carve_handle->workers[ worker_index ].thread != NULL )
+		{
+			libcthreads_thread_join(
+			 &( carve_handle->workers[ worker_index ].thread ),
+			 NULL );
+		}
+	}
+	if( carve_handle->task_scheduler != NULL )
+	{
+		libscca_task_scheduler_free(
+		 &( carve_handle->task_scheduler ),
+		 NULL );
+	}
+	if( carve_handle->condition != NULL )
+	{
+		libcthreads_condition_free(
+		 &( carve_handle->condition ),
+		 NULL );
+	}
+	if( carve_handle->mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( carve_handle->mutex ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Processes and outputs the chunks one after the other
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_process_chunks_sequentially(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	carve_handle_chunk_t *chunk = NULL;
+	static char *function       = "carve_handle_process_chunks_sequentially";
+	int chunk_index             = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < carve_handle->number_of_chunks;
+	     chunk_index++ )
+	{
+		if( carve_handle->abort != 0 )
+		{
+			break;
+		}
+		chunk = &( carve_handle->chunks[ chunk_index ] );
+
+		/* The error is reported with the chunk so that the other chunks can continue
+		 */
+		if( carve_handle_process_chunk(
+		     carve_handle,
+		     &( carve_handle->workers[ 0 ] ),
+		     chunk,
+		     &( chunk->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( chunk->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process chunk: %d.",
+			 function,
+			 chunk_index );
+		}
+		chunk->status = CARVE_HANDLE_CHUNK_STATUS_DONE;
+
+		if( carve_handle_output_chunk(
+		     carve_handle,
+		     chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to output chunk: %d.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Processes the source
+ * The source is divided into chunks that are scanned concurrently, the files are
+ * written in the order of their offset, regardless of the order in which the chunks are processed
+ * Returns 1 if successful, 0 if one or more chunks could not be processed or -1 on error
+ */
+int carve_handle_process_source(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_process_source";
+	size64_t chunk_offset = 0;
+	int chunk_index       = 0;
+	int number_of_chunks  = 0;
+	int number_of_workers = 0;
+	int result            = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->workers[ 0 ].source_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carve handle - missing source file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->chunks != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carve handle - chunks value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( carve_handle->source_size / carve_handle->chunk_size ) >= (size64_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of chunks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = (int) ( carve_handle->source_size / carve_handle->chunk_size );
+
+	if( ( carve_handle->source_size % carve_handle->chunk_size ) != 0 )
+	{
+		number_of_chunks += 1;
+	}
+	if( number_of_chunks == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_chunks > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( carve_handle_chunk_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of chunks value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	carve_handle->chunks = (carve_handle_chunk_t *) memory_allocate(
+	                                                 sizeof( carve_handle_chunk_t ) * number_of_chunks );
+
+	if( carve_handle->chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     carve_handle->chunks,
+	     0,
+	     sizeof( carve_handle_chunk_t ) * number_of_chunks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunks.",
+		 function );
+
+		memory_free(
+		 carve_handle->chunks );
+
+		carve_handle->chunks = NULL;
+
+		return( -1 );
+	}
+	carve_handle->number_of_chunks        = number_of_chunks;
+	carve_handle->number_of_files         = 0;
+	carve_handle->number_of_failed_chunks = 0;
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		carve_handle->chunks[ chunk_index ].offset = (off64_t) chunk_offset;
+		carve_handle->chunks[ chunk_index ].size   = carve_handle->chunk_size;
+
+		if( carve_handle->chunks[ chunk_index ].size > ( carve_handle->source_size - chunk_offset ) )
+		{
+			carve_handle->chunks[ chunk_index ].size = (size_t) ( carve_handle->source_size - chunk_offset );
+		}
+		chunk_offset += carve_handle->chunk_size;
+	}
+	number_of_workers = carve_handle->number_of_jobs;
+
+	if( number_of_workers > number_of_chunks )
+	{
+		number_of_workers = number_of_chunks;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_workers > 1 )
+	{
+		result = carve_handle_process_chunks_concurrently(
+		          carve_handle,
+		          number_of_workers,
+		          error );
+	}
+	else
+#endif
+	{
+		result = carve_handle_process_chunks_sequentially(
+		          carve_handle,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_flush(
+	     carve_handle->output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->number_of_failed_chunks > 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,295 @@
+/*
+ * Carve handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CARVE_HANDLE_H )
+#define _CARVE_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "output_writer.h"
+#include "sccatools_libbfio.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcthreads.h"
+#include "sccatools_libscca.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default size of the part of the source that is scanned by a single job
+ */
+#define CARVE_HANDLE_DEFAULT_CHUNK_SIZE		( 16 * 1024 * 1024 )
+
+/* The maximum size of a carved file
+ * This is also the size of the overlap between chunks
+ */
+#define CARVE_HANDLE_MAXIMUM_FILE_SIZE		( 4 * 1024 * 1024 )
+
+/* The number of bytes needed to check a signature
+ */
+#define CARVE_HANDLE_SIGNATURE_SIZE		8
+
+/* The default number of concurrent jobs
+ */
+#define CARVE_HANDLE_DEFAULT_NUMBER_OF_JOBS	4
+
+/* The maximum number of concurrent jobs
+ */
+#define CARVE_HANDLE_MAXIMUM_NUMBER_OF_JOBS	32
+
+enum CARVE_HANDLE_CHUNK_STATUSES
+{
+	CARVE_HANDLE_CHUNK_STATUS_PENDING	= 0,
+	CARVE_HANDLE_CHUNK_STATUS_PROCESSING	= 1,
+	CARVE_HANDLE_CHUNK_STATUS_DONE		= 2
+};
+
+typedef struct carve_handle_file carve_handle_file_t;
+
+struct carve_handle_file
+{
+	/* The offset of the file in the source
+	 */
+	off64_t offset;
+
+	/* The size of the carved data
+	 */
+	size_t size;
+
+	/* The file type
+	 */
+	int file_type;
+};
+
+typedef struct carve_handle_chunk carve_handle_chunk_t;
+
+struct carve_handle_chunk
+{
+	/* The offset of the chunk in the source
+	 */
+	off64_t offset;
+
+	/* The size of the chunk, without the overlap
+	 */
+	size_t size;
+
+	/* The files found in the chunk
+	 */
+	carve_handle_file_t *files;
+
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The number of allocated files
+	 */
+	int number_of_allocated_files;
+
+	/* The error that occurred while processing the chunk
+	 */
+	libcerror_error_t *error;
+
+	/* The status
+	 */
+	int status;
+};
+
+typedef struct carve_handle carve_handle_t;
+
+typedef struct carve_handle_worker carve_handle_worker_t;
+
+struct carve_handle_worker
+{
+	/* The carve handle
+	 */
+	carve_handle_t *carve_handle;
+
+	/* The source file IO handle
+	 */
+	libbfio_handle_t *source_file_io_handle;
+
+	/* The buffer that contains a chunk and its overlap
+	 */
+	uint8_t *buffer;
+
+	/* The index of the worker in the task scheduler
+	 */
+	int worker_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+struct carve_handle
+{
+	/* The workers
+	 */
+	carve_handle_worker_t *workers;
+
+	/* The number of jobs
+	 */
+	int number_of_jobs;
+
+	/* The size of the source
+	 */
+	size64_t source_size;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The chunks
+	 */
+	carve_handle_chunk_t *chunks;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The target path, the directory the carved files are written to
+	 */
+	const system_character_t *target_path;
+
+	/* The output writer
+	 */
+	output_writer_t *output_writer;
+
+	/* The number of carved files
+	 */
+	int number_of_files;
+
+	/* The number of chunks that could not be processed
+	 */
+	int number_of_failed_chunks;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the chunk statuses
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a chunk is done
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The task scheduler
+	 */
+	libscca_task_scheduler_t *task_scheduler;
+#endif
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int carve_handle_initialize(
+     carve_handle_t **carve_handle,
+     int number_of_jobs,
+     libcerror_error_t **error );
+
+int carve_handle_free(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_signal_abort(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_set_chunk_size(
+     carve_handle_t *carve_handle,
+     size_t chunk_size,
+     libcerror_error_t **error );
+
+int carve_handle_set_target_path(
+     carve_handle_t *carve_handle,
+     const system_character_t *target_path,
+     libcerror_error_t **error );
+
+int carve_handle_open_source(
+     carve_handle_t *carve_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int carve_handle_close_source(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_chunk_append_file(
+     carve_handle_chunk_t *chunk,
+     off64_t offset,
+     size_t size,
+     int file_type,
+     libcerror_error_t **error );
+
+int carve_handle_write_file(
+     carve_handle_t *carve_handle,
+     off64_t offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int carve_handle_scan_data(
+     carve_handle_t *carve_handle,
+     carve_handle_chunk_t *chunk,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int carve_handle_process_chunk(
+     carve_handle_t *carve_handle,
+     carve_handle_worker_t *worker,
+     carve_handle_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int carve_handle_output_chunk(
+     carve_handle_t *carve_handle,
+     carve_handle_chunk_t *chunk,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int carve_handle_worker_callback_function(
+     carve_handle_worker_t *worker );
+
+int carve_handle_process_chunks_concurrently(
+     carve_handle_t *carve_handle,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int carve_handle_process_chunks_sequentially(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_process_source(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CARVE_HANDLE_H ) */
+
@@ -0,0 +1,2064 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#else
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#endif /* defined( WINAPI ) */
+
+#include "export_handle.h"
+#include "output_writer.h"
+#include "source_list.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libcthreads.h"
+#include "sccatools_libscca.h"
+
+#define EXPORT_HANDLE_NOTIFY_STREAM		stdout
+
+#if defined( WINAPI )
+#define EXPORT_HANDLE_PATH_SEPARATOR	'\\'
+#else
+#define EXPORT_HANDLE_PATH_SEPARATOR	'/'
+#endif
+
+/* Creates an export handle
+ * Make sure the value export_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     int number_of_jobs,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_initialize";
+	int worker_index      = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_jobs < 1 )
+	 || ( number_of_jobs > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_JOBS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of jobs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*export_handle = memory_allocate_structure(
+	                  export_handle_t );
+
+	if( *export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_handle,
+	     0,
+	     sizeof( export_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export handle.",
+		 function );
+
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+
+		return( -1 );
+	}
+	( *export_handle )->workers = (export_handle_worker_t *) memory_allocate(
+	                                                           sizeof( export_handle_worker_t ) * number_of_jobs );
+
+	if( ( *export_handle )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *export_handle )->workers,
+	     0,
+	     sizeof( export_handle_worker_t ) * number_of_jobs ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_handle )->number_of_jobs = number_of_jobs;
+
+	/* Every worker has its own MAM decoder that retains its decoding table between the files of the worker
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_jobs;
+	     worker_index++ )
+	{
+		( *export_handle )->workers[ worker_index ].export_handle = *export_handle;
+		( *export_handle )->workers[ worker_index ].worker_index  = worker_index;
+
+		if( libscca_mam_decoder_initialize(
+		     &( ( *export_handle )->workers[ worker_index ].mam_decoder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize MAM decoder: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	if( source_list_initialize(
+	     &( ( *export_handle )->source_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize source list.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_initialize(
+	     &( ( *export_handle )->output_writer ),
+	     EXPORT_HANDLE_NOTIFY_STREAM,
+	     OUTPUT_WRITER_DEFAULT_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output writer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *export_handle != NULL )
+	{
+		export_handle_free(
+		 export_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_free";
+	int result            = 1;
+	int task_index        = 0;
+	int worker_index      = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		if( ( *export_handle )->workers != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < ( *export_handle )->number_of_jobs;
+			     worker_index++ )
+			{
+				if( ( *export_handle )->workers[ worker_index ].mam_decoder == NULL )
+				{
+					continue;
+				}
+				if( libscca_mam_decoder_free(
+				     &( ( *export_handle )->workers[ worker_index ].mam_decoder ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free MAM decoder: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *export_handle )->workers );
+		}
+		if( ( *export_handle )->tasks != NULL )
+		{
+			for( task_index = 0;
+			     task_index < ( *export_handle )->number_of_tasks;
+			     task_index++ )
+			{
+				if( ( *export_handle )->tasks[ task_index ].error != NULL )
+				{
+					libcerror_error_free(
+					 &( ( *export_handle )->tasks[ task_index ].error ) );
+				}
+			}
+			memory_free(
+			 ( *export_handle )->tasks );
+		}
+		if( ( *export_handle )->source_list != NULL )
+		{
+			if( source_list_free(
+			     &( ( *export_handle )->source_list ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free source list.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->output_writer != NULL )
+		{
+			if( output_writer_free(
+			     &( ( *export_handle )->output_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free output writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the export handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_signal_abort";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the target path, the directory the exported files are written to
+ * The target path is referenced and must remain available while exporting
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_target_path(
+     export_handle_t *export_handle,
+     const system_character_t *target_path,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_target_path";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->target_path = target_path;
+
+	return( 1 );
+}
+
+/* Determines if a path refers to a prefetch file
+ * A prefetch file has the .pf extension, compared case-insensitive
+ * Returns 1 if the path refers to a prefetch file or 0 if not
+ */
+int export_handle_path_is_prefetch_file(
+     const system_character_t *path,
+     size_t path_length )
+{
+	if( ( path == NULL )
+	 || ( path_length < 4 ) )
+	{
+		return( 0 );
+	}
+	if( ( path[ path_length - 3 ] != (system_character_t) '.' )
+	 || ( ( path[ path_length - 2 ] != (system_character_t) 'p' )
+	  &&  ( path[ path_length - 2 ] != (system_character_t) 'P' ) )
+	 || ( ( path[ path_length - 1 ] != (system_character_t) 'f' )
+	  &&  ( path[ path_length - 1 ] != (system_character_t) 'F' ) ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Appends a task
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_task(
+     export_handle_t *export_handle,
+     const system_character_t *source,
+     size_t relative_path_offset,
+     libcerror_error_t **error )
+{
+	export_handle_task_t *tasks   = NULL;
+	static char *function         = "export_handle_append_task";
+	int number_of_allocated_tasks = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_path_offset >= system_string_length(
+	                             source ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid relative path offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_tasks >= export_handle->number_of_allocated_tasks )
+	{
+		if( export_handle->number_of_allocated_tasks == 0 )
+		{
+			number_of_allocated_tasks = 64;
+		}
+		else
+		{
+			number_of_allocated_tasks = export_handle->number_of_allocated_tasks * 2;
+		}
+		if( ( number_of_allocated_tasks <= export_handle->number_of_allocated_tasks )
+		 || ( (size_t) number_of_allocated_tasks > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( export_handle_task_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated tasks value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		tasks = (export_handle_task_t *) memory_reallocate(
+		                                  export_handle->tasks,
+		                                  sizeof( export_handle_task_t ) * number_of_allocated_tasks );
+
+		if( tasks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize tasks.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->tasks                     = tasks;
+		export_handle->number_of_allocated_tasks = number_of_allocated_tasks;
+	}
+	if( memory_set(
+	     &( export_handle->tasks[ export_handle->number_of_tasks ] ),
+	     0,
+	     sizeof( export_handle_task_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear task.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->tasks[ export_handle->number_of_tasks ].source               = source;
+	export_handle->tasks[ export_handle->number_of_tasks ].relative_path_offset = relative_path_offset;
+
+	export_handle->number_of_tasks += 1;
+
+	return( 1 );
+}
+
+/* Appends a path
+ * A file is exported under its name, the prefetch files in a directory and its
+ * sub directories are exported under their path relative to the directory
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_path(
+     export_handle_t *export_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	const system_character_t *source = NULL;
+	static char *function            = "export_handle_append_path";
+	size_t path_length               = 0;
+	size_t relative_path_offset      = 0;
+	size_t source_length             = 0;
+	int result                       = 0;
+	int source_index                 = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+	source_index = export_handle->source_list->number_of_sources;
+
+	result = source_list_append_path(
+	          export_handle->source_list,
+	          path,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	while( source_index < export_handle->source_list->number_of_sources )
+	{
+		source = export_handle->source_list->sources[ source_index ];
+
+		source_length = system_string_length(
+		                 source );
+
+		if( result == 2 )
+		{
+			/* Files in the directory that are not prefetch files are ignored
+			 */
+			if( export_handle_path_is_prefetch_file(
+			     source,
+			     source_length ) == 0 )
+			{
+				source_index++;
+
+				continue;
+			}
+			relative_path_offset = path_length;
+
+			while( ( relative_path_offset < source_length )
+			    && ( source[ relative_path_offset ] == (system_character_t) EXPORT_HANDLE_PATH_SEPARATOR ) )
+			{
+				relative_path_offset++;
+			}
+		}
+		else
+		{
+			relative_path_offset = source_length;
+
+			while( ( relative_path_offset > 0 )
+			    && ( source[ relative_path_offset - 1 ] != (system_character_t) EXPORT_HANDLE_PATH_SEPARATOR ) )
+			{
+				relative_path_offset--;
+			}
+		}
+		if( export_handle_append_task(
+		     export_handle,
+		     source,
+		     relative_path_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append task: %" PRIs_SYSTEM ".",
+			 function,
+			 source );
+
+			return( -1 );
+		}
+		source_index++;
+	}
+	return( 1 );
+}
+
+/* Retrieves the target path of a task
+ * The target path consists of the target path of the export handle followed by
+ * the relative path of the source
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_target_path(
+     export_handle_t *export_handle,
+     export_handle_task_t *task,
+     system_character_t **target_path,
+     libcerror_error_t **error )
+{
+	system_character_t *safe_target_path = NULL;
+	static char *function                = "export_handle_get_target_path";
+	size_t relative_path_length          = 0;
+	size_t target_path_index             = 0;
+	size_t target_path_length            = 0;
+	size_t target_path_size              = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	if( task->source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task - missing source.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path.",
+		 function );
+
+		return( -1 );
+	}
+	relative_path_length = system_string_length(
+	                        &( task->source[ task->relative_path_offset ] ) );
+
+	target_path_length = system_string_length(
+	                      export_handle->target_path );
+
+	/* The size includes a path separator and the end-of-string character
+	 */
+	target_path_size = target_path_length + relative_path_length + 2;
+
+	safe_target_path = system_string_allocate(
+	                    target_path_size );
+
+	if( safe_target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create target path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     safe_target_path,
+	     export_handle->target_path,
+	     target_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy target path.",
+		 function );
+
+		goto on_error;
+	}
+	target_path_index = target_path_length;
+
+	if( ( target_path_index == 0 )
+	 || ( safe_target_path[ target_path_index - 1 ] != (system_character_t) EXPORT_HANDLE_PATH_SEPARATOR ) )
+	{
+		safe_target_path[ target_path_index++ ] = (system_character_t) EXPORT_HANDLE_PATH_SEPARATOR;
+	}
+	if( system_string_copy(
+	     &( safe_target_path[ target_path_index ] ),
+	     &( task->source[ task->relative_path_offset ] ),
+	     relative_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy relative path.",
+		 function );
+
+		goto on_error;
+	}
+	target_path_index += relative_path_length;
+
+	safe_target_path[ target_path_index ] = 0;
+
+	*target_path = safe_target_path;
+
+	return( 1 );
+
+on_error:
+	if( safe_target_path != NULL )
+	{
+		memory_free(
+		 safe_target_path );
+	}
+	return( -1 );
+}
+
+/* Creates the parent directories of a path if they do not exist
+ * The path is temporarily modified to terminate it at every path separator
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_create_parent_directories(
+     system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_create_parent_directories";
+	size_t path_index     = 0;
+	int result            = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	/* The root directory is never created
+	 */
+	for( path_index = 1;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		if( ( path[ path_index ] != (system_character_t) EXPORT_HANDLE_PATH_SEPARATOR )
+		 || ( path[ path_index - 1 ] == (system_character_t) EXPORT_HANDLE_PATH_SEPARATOR ) )
+		{
+			continue;
+		}
+		path[ path_index ] = 0;
+
+#if defined( WINAPI )
+		/* A drive letter, such as C:, is never created
+		 */
+		if( path[ path_index - 1 ] == (system_character_t) ':' )
+		{
+			result = 1;
+		}
+		else
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = (int) CreateDirectoryW(
+			                path,
+			                NULL );
+#else
+			result = (int) CreateDirectoryA(
+			                path,
+			                NULL );
+#endif
+			if( ( result == 0 )
+			 && ( GetLastError() == ERROR_ALREADY_EXISTS ) )
+			{
+				result = 1;
+			}
+		}
+#elif defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = 0;
+#else
+		result = (int) ( mkdir(
+		                  path,
+		                  0755 ) == 0 );
+
+		if( ( result == 0 )
+		 && ( errno == EEXIST ) )
+		{
+			result = 1;
+		}
+#endif
+		path[ path_index ] = (system_character_t) EXPORT_HANDLE_PATH_SEPARATOR;
+
+		if( result == 0 )
+		{
+			path[ path_index ] = 0;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to create directory: %" PRIs_SYSTEM ".",
+			 function,
+			 path );
+
+			path[ path_index ] = (system_character_t) EXPORT_HANDLE_PATH_SEPARATOR;
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes data to a file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_file(
+     const system_character_t *path,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "export_handle_write_file";
+	size_t write_count    = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          path,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          path,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	write_count = file_stream_write(
+	               stream,
+	               data,
+	               data_size );
+
+	if( write_count != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( -1 );
+}
+
+/* Exports the uncompressed data of the source of a task
+ * The file is decompressed with the MAM decoder of the worker that processes the task
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_process_task(
+     export_handle_t *export_handle,
+     export_handle_task_t *task,
+     libscca_mam_decoder_t *mam_decoder,
+     libcerror_error_t **error )
+{
+	libscca_file_t *file            = NULL;
+	system_character_t *target_path = NULL;
+	const uint8_t *data             = NULL;
+	static char *function           = "export_handle_process_task";
+	size_t data_size                = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_get_target_path(
+	     export_handle,
+	     task,
+	     &target_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve target path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_set_mam_decoder(
+	     file,
+	     mam_decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set MAM decoder.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libscca_file_open_wide(
+	     file,
+	     task->source,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libscca_file_open(
+	     file,
+	     task->source,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 task->source );
+
+		goto on_error;
+	}
+	if( libscca_file_get_uncompressed_data(
+	     file,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_create_parent_directories(
+	     target_path,
+	     system_string_length(
+	      target_path ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to create parent directories of: %" PRIs_SYSTEM ".",
+		 function,
+		 target_path );
+
+		goto on_error;
+	}
+	if( export_handle_write_file(
+	     target_path,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file: %" PRIs_SYSTEM ".",
+		 function,
+		 target_path );
+
+		goto on_error;
+	}
+	task->data_size = data_size;
+
+	if( libscca_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 target_path );
+
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	if( target_path != NULL )
+	{
+		memory_free(
+		 target_path );
+	}
+	return( -1 );
+}
+
+/* Outputs the result of a processed task
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_output_task(
+     export_handle_t *export_handle,
+     export_handle_task_t *task,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_output_task";
+	size_t source_length  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	if( task->source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task - missing source.",
+		 function );
+
+		return( -1 );
+	}
+	if( task->error != NULL )
+	{
+		export_handle->number_of_failed_tasks += 1;
+
+		/* Flush first so that stdout and stderr are interleaved in order
+		 */
+		if( output_writer_flush(
+		     export_handle->output_writer,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		fprintf(
+		 stderr,
+		 "Unable to export source: %" PRIs_SYSTEM ".\n",
+		 task->source );
+
+		libcnotify_print_error_backtrace(
+		 task->error );
+		libcerror_error_free(
+		 &( task->error ) );
+
+		return( 1 );
+	}
+	source_length = system_string_length(
+	                 task->source );
+
+	if( output_writer_write_system_string(
+	     export_handle->output_writer,
+	     &( task->source[ task->relative_path_offset ] ),
+	     source_length - task->relative_path_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_printf(
+	     export_handle->output_writer,
+	     "\t%" PRIzd "\n",
+	     task->data_size ) != 1 )
+	{
+		goto on_error;
+	}
+	export_handle->number_of_exported_files += 1;
+
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write output of source: %" PRIs_SYSTEM ".",
+	 function,
+	 task->source );
+
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Processes the tasks handed out by the task scheduler until none are left or abort was signalled
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_worker_callback_function(
+     export_handle_worker_t *worker )
+{
+	export_handle_t *export_handle = NULL;
+	export_handle_task_t *task     = NULL;
+	libcerror_error_t *error       = NULL;
+	static char *function          = "export_handle_worker_callback_function";
+	int mutex_is_grabbed           = 0;
+	int result                     = 0;
+	int task_index                 = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle = worker->export_handle;
+
+	do
+	{
+		result = libscca_task_scheduler_get_next_task(
+		          export_handle->task_scheduler,
+		          worker->worker_index,
+		          &task_index,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next task.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_grab(
+		     export_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		mutex_is_grabbed = 1;
+
+		if( export_handle->abort != 0 )
+		{
+			result = 0;
+		}
+		if( result != 0 )
+		{
+			task = &( export_handle->tasks[ task_index ] );
+
+			task->status = EXPORT_HANDLE_TASK_STATUS_PROCESSING;
+		}
+		else
+		{
+			/* Wake up the output so that it can detect that no more tasks will be processed
+			 */
+			if( libcthreads_condition_broadcast(
+			     export_handle->condition,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		mutex_is_grabbed = 0;
+
+		if( libcthreads_mutex_release(
+		     export_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( result == 0 )
+		{
+			break;
+		}
+		if( export_handle_process_task(
+		     export_handle,
+		     task,
+		     worker->mam_decoder,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process task.",
+			 function );
+
+			/* The error is reported with the task so that the other tasks can continue
+			 */
+			if( task->error == NULL )
+			{
+				task->error = error;
+			}
+			else
+			{
+				libcerror_error_free(
+				 &error );
+			}
+			error = NULL;
+		}
+		if( libcthreads_mutex_grab(
+		     export_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		mutex_is_grabbed = 1;
+
+		task->status = EXPORT_HANDLE_TASK_STATUS_DONE;
+
+		if( libcthreads_condition_broadcast(
+		     export_handle->condition,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			goto on_error;
+		}
+		mutex_is_grabbed = 0;
+
+		if( libcthreads_mutex_release(
+		     export_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( result != 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	/* Stop the other workers and the output since the tasks of this worker
+	 * might never be done
+	 */
+	if( export_handle != NULL )
+	{
+		if( mutex_is_grabbed == 0 )
+		{
+			mutex_is_grabbed = libcthreads_mutex_grab(
+			                    export_handle->mutex,
+			                    NULL );
+		}
+		export_handle->abort = 1;
+
+		if( mutex_is_grabbed == 1 )
+		{
+			libcthreads_condition_broadcast(
+			 export_handle->condition,
+			 NULL );
+			libcthreads_mutex_release(
+			 export_handle->mutex,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Processes the tasks using multiple workers, largest first, and outputs them in order
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_process_tasks_concurrently(
+     export_handle_t *export_handle,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	export_handle_task_t *task = NULL;
+	static char *function      = "export_handle_process_tasks_concurrently";
+	size64_t file_size         = 0;
+	int mutex_is_grabbed       = 0;
+	int output_index           = 0;
+	int result                 = 1;
+	int task_index             = 0;
+	int task_status            = 0;
+	int worker_index           = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers < 1 )
+	 || ( number_of_workers > export_handle->number_of_jobs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_initialize(
+	     &( export_handle->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( export_handle->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_task_scheduler_initialize(
+	     &( export_handle->task_scheduler ),
+	     number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create task scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	/* The largest files are processed first so that a single large file
+	 * does not leave the other workers idle at the end of the batch.
+	 * The file size is used as the weight since it is available without
+	 * reading the file
+	 */
+	for( output_index = 0;
+	     output_index < export_handle->number_of_tasks;
+	     output_index++ )
+	{
+		if( source_list_get_file_size(
+		     export_handle->tasks[ output_index ].source,
+		     &file_size,
+		     NULL ) != 1 )
+		{
+			/* The error is reported when the task is processed
+			 */
+			file_size = 0;
+		}
+		if( libscca_task_scheduler_append_task(
+		     export_handle->task_scheduler,
+		     file_size,
+		     &task_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append task: %d to task scheduler.",
+			 function,
+			 output_index );
+
+			goto on_error;
+		}
+	}
+	if( libscca_task_scheduler_start(
+	     export_handle->task_scheduler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start task scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( export_handle->workers[ worker_index ].thread ),
+		     NULL,
+		     (int (*)(void *)) &export_handle_worker_callback_function,
+		     (void *) &( export_handle->workers[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	for( output_index = 0;
+	     output_index < export_handle->number_of_tasks;
+	     output_index++ )
+	{
+		task = &( export_handle->tasks[ output_index ] );
+
+		if( libcthreads_mutex_grab(
+		     export_handle->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		mutex_is_grabbed = 1;
+
+		/* A task that is not being processed when abort is signalled will never be done
+		 */
+		while( ( task->status != EXPORT_HANDLE_TASK_STATUS_DONE )
+		    && ( ( export_handle->abort == 0 )
+		     ||  ( task->status == EXPORT_HANDLE_TASK_STATUS_PROCESSING ) ) )
+		{
+			if( libcthreads_condition_wait(
+			     export_handle->condition,
+			     export_handle->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		task_status = task->status;
+
+		export_handle->next_output_index = output_index + 1;
+
+		if( libcthreads_condition_broadcast(
+		     export_handle->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			goto on_error;
+		}
+		mutex_is_grabbed = 0;
+
+		if( libcthreads_mutex_release(
+		     export_handle->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( task_status != EXPORT_HANDLE_TASK_STATUS_DONE )
+		{
+			break;
+		}
+		if( export_handle_output_task(
+		     export_handle,
+		     task,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to output task: %d.",
+			 function,
+			 output_index );
+
+			goto on_error;
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_join(
+		     &( export_handle->workers[ worker_index ].thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	if( libscca_task_scheduler_free(
+	     &( export_handle->task_scheduler ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free task scheduler.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_condition_free(
+	     &( export_handle->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_free(
+	     &( export_handle->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mutex.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+
+on_error:
+	/* Stop the workers before they are joined
+	 */
+	export_handle->abort = 1;
+
+	if( export_handle->mutex != NULL )
+	{
+		if( mutex_is_grabbed == 0 )
+		{
+			mutex_is_grabbed = libcthreads_mutex_grab(
+			                    export_handle->mutex,
+			                    NULL );
+		}
+		if( export_handle->condition != NULL )
+		{
+			libcthreads_condition_broadcast(
+			 export_handle->condition,
+			 NULL );
+		}
+		if( mutex_is_grabbed == 1 )
+		{
+			libcthreads_mutex_release(
+			 export_handle->mutex,
+			 NULL );
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( export_handle->workers[ worker_index ].thread != NULL )
+		{
+			libcthreads_thread_join(
+			 &( export_handle->workers[ worker_index ].thread ),
+			 NULL );
+		}
+	}
+	if( export_handle->task_scheduler != NULL )
+	{
+		libscca_task_scheduler_free(
+		 &( export_handle->task_scheduler ),
+		 NULL );
+	}
+	if( export_handle->condition != NULL )
+	{
+		libcthreads_condition_free(
+		 &( export_handle->condition ),
+		 NULL );
+	}
+	if( export_handle->mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( export_handle->mutex ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Processes and outputs the tasks one after the other
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_process_tasks_sequentially(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	export_handle_task_t *task = NULL;
+	static char *function      = "export_handle_process_tasks_sequentially";
+	int task_index             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( task_index = 0;
+	     task_index < export_handle->number_of_tasks;
+	     task_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		task = &( export_handle->tasks[ task_index ] );
+
+		/* The error is reported with the task so that the other tasks can continue
+		 */
+		if( export_handle_process_task(
+		     export_handle,
+		     task,
+		     export_handle->workers[ 0 ].mam_decoder,
+		     &( task->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( task->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process task: %d.",
+			 function,
+			 task_index );
+		}
+		task->status = EXPORT_HANDLE_TASK_STATUS_DONE;
+
+		if( export_handle_output_task(
+		     export_handle,
+		     task,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to output task: %d.",
+			 function,
+			 task_index );
+
+			return( -1 );
+		}
+		export_handle->next_output_index = task_index + 1;
+	}
+	return( 1 );
+}
+
+/* Processes the tasks
+ * The output of the tasks is written in the order the tasks were appended,
+ * regardless of the order in which the tasks are processed
+ * Returns 1 if successful, 0 if one or more tasks could not be processed or -1 on error
+ */
+int export_handle_process_tasks(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_process_tasks";
+	int number_of_workers = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing target path.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->next_output_index        = 0;
+	export_handle->number_of_exported_files = 0;
+	export_handle->number_of_failed_tasks   = 0;
+
+	if( export_handle->number_of_tasks == 0 )
+	{
+		return( 1 );
+	}
+	number_of_workers = export_handle->number_of_jobs;
+
+	if( number_of_workers > export_handle->number_of_tasks )
+	{
+		number_of_workers = export_handle->number_of_tasks;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_workers > 1 )
+	{
+		result = export_handle_process_tasks_concurrently(
+		          export_handle,
+		          number_of_workers,
+		          error );
+	}
+	else
+#endif
+	{
+		result = export_handle_process_tasks_sequentially(
+		          export_handle,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process tasks.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_flush(
+	     export_handle->output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output.",
+		 function );
+
+		return( -1 );
+	}
+	/* Tasks that were not output because of an abort are counted as failed
+	 */
+	export_handle->number_of_failed_tasks += export_handle->number_of_tasks - export_handle->next_output_index;
+
+	if( export_handle->number_of_failed_tasks > 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
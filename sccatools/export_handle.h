@@ -0,0 +1,255 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_HANDLE_H )
+#define _EXPORT_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "output_writer.h"
+#include "source_list.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcthreads.h"
+#include "sccatools_libscca.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of concurrent jobs
+ */
+#define EXPORT_HANDLE_DEFAULT_NUMBER_OF_JOBS	4
+
+/* The maximum number of concurrent jobs
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_JOBS	32
+
+enum EXPORT_HANDLE_TASK_STATUSES
+{
+	EXPORT_HANDLE_TASK_STATUS_PENDING	= 0,
+	EXPORT_HANDLE_TASK_STATUS_PROCESSING	= 1,
+	EXPORT_HANDLE_TASK_STATUS_DONE		= 2
+};
+
+typedef struct export_handle_task export_handle_task_t;
+
+struct export_handle_task
+{
+	/* The source
+	 */
+	const system_character_t *source;
+
+	/* The offset of the relative path in the source
+	 * The relative path is recreated in the target path
+	 */
+	size_t relative_path_offset;
+
+	/* The size of the exported data
+	 */
+	size_t data_size;
+
+	/* The error that occurred while exporting the source
+	 */
+	libcerror_error_t *error;
+
+	/* The status
+	 */
+	int status;
+};
+
+typedef struct export_handle export_handle_t;
+
+typedef struct export_handle_worker export_handle_worker_t;
+
+struct export_handle_worker
+{
+	/* The export handle
+	 */
+	export_handle_t *export_handle;
+
+	/* The MAM decoder used for the files of the worker
+	 */
+	libscca_mam_decoder_t *mam_decoder;
+
+	/* The index of the worker in the task scheduler
+	 */
+	int worker_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+struct export_handle
+{
+	/* The workers
+	 */
+	export_handle_worker_t *workers;
+
+	/* The number of jobs
+	 */
+	int number_of_jobs;
+
+	/* The source list, contains the sources of the tasks
+	 */
+	source_list_t *source_list;
+
+	/* The tasks
+	 */
+	export_handle_task_t *tasks;
+
+	/* The number of tasks
+	 */
+	int number_of_tasks;
+
+	/* The number of allocated tasks
+	 */
+	int number_of_allocated_tasks;
+
+	/* The index of the next task to output
+	 */
+	int next_output_index;
+
+	/* The target path, the directory the exported files are written to
+	 */
+	const system_character_t *target_path;
+
+	/* The output writer
+	 */
+	output_writer_t *output_writer;
+
+	/* The number of exported files
+	 */
+	int number_of_exported_files;
+
+	/* The number of tasks that could not be exported
+	 */
+	int number_of_failed_tasks;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the task statuses
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a task is done
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The task scheduler
+	 */
+	libscca_task_scheduler_t *task_scheduler;
+#endif
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     int number_of_jobs,
+     libcerror_error_t **error );
+
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_set_target_path(
+     export_handle_t *export_handle,
+     const system_character_t *target_path,
+     libcerror_error_t **error );
+
+int export_handle_path_is_prefetch_file(
+     const system_character_t *path,
+     size_t path_length );
+
+int export_handle_append_task(
+     export_handle_t *export_handle,
+     const system_character_t *source,
+     size_t relative_path_offset,
+     libcerror_error_t **error );
+
+int export_handle_append_path(
+     export_handle_t *export_handle,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int export_handle_get_target_path(
+     export_handle_t *export_handle,
+     export_handle_task_t *task,
+     system_character_t **target_path,
+     libcerror_error_t **error );
+
+int export_handle_create_parent_directories(
+     system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int export_handle_write_file(
+     const system_character_t *path,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int export_handle_process_task(
+     export_handle_t *export_handle,
+     export_handle_task_t *task,
+     libscca_mam_decoder_t *mam_decoder,
+     libcerror_error_t **error );
+
+int export_handle_output_task(
+     export_handle_t *export_handle,
+     export_handle_task_t *task,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_worker_callback_function(
+     export_handle_worker_t *worker );
+
+int export_handle_process_tasks_concurrently(
+     export_handle_t *export_handle,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int export_handle_process_tasks_sequentially(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_process_tasks(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_HANDLE_H ) */
+
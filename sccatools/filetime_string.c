@@ -0,0 +1,145 @@
+/*
+ * FILETIME string functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "filetime_string.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libscca.h"
+
+/* The three letter abbreviations of the month names
+ */
+static const char filetime_string_month_names[ 37 ] = \
+	"JanFebMarAprMayJunJulAugSepOctNovDec";
+
+/* The two digit decimal strings of the values 0 to 99
+ */
+static const char filetime_string_decimal_digit_pairs[ 201 ] = \
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+/* Copies a FILETIME to a string
+ * The string is formatted as: Mon DD, YYYY hh:mm:ss.nnnnnnnnn
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int filetime_string_copy_from_64bit(
+     uint8_t *string,
+     size_t string_size,
+     uint64_t filetime,
+     libcerror_error_t **error )
+{
+	static char *function       = "filetime_string_copy_from_64bit";
+	uint32_t fraction_of_second = 0;
+	uint16_t year               = 0;
+	uint8_t day_of_month        = 0;
+	uint8_t hours               = 0;
+	uint8_t minutes             = 0;
+	uint8_t month               = 0;
+	uint8_t seconds             = 0;
+	int digit_index             = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size < FILETIME_STRING_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_filetime_get_date_time_values(
+	     filetime,
+	     &year,
+	     &month,
+	     &day_of_month,
+	     &hours,
+	     &minutes,
+	     &seconds,
+	     &fraction_of_second,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve date and time values.",
+		 function );
+
+		return( -1 );
+	}
+	string[ 0 ]  = (uint8_t) filetime_string_month_names[ 3 * ( month - 1 ) ];
+	string[ 1 ]  = (uint8_t) filetime_string_month_names[ ( 3 * ( month - 1 ) ) + 1 ];
+	string[ 2 ]  = (uint8_t) filetime_string_month_names[ ( 3 * ( month - 1 ) ) + 2 ];
+	string[ 3 ]  = (uint8_t) ' ';
+	string[ 4 ]  = (uint8_t) filetime_string_decimal_digit_pairs[ 2 * day_of_month ];
+	string[ 5 ]  = (uint8_t) filetime_string_decimal_digit_pairs[ ( 2 * day_of_month ) + 1 ];
+	string[ 6 ]  = (uint8_t) ',';
+	string[ 7 ]  = (uint8_t) ' ';
+	string[ 8 ]  = (uint8_t) filetime_string_decimal_digit_pairs[ 2 * ( year / 100 ) ];
+	string[ 9 ]  = (uint8_t) filetime_string_decimal_digit_pairs[ ( 2 * ( year / 100 ) ) + 1 ];
+	string[ 10 ] = (uint8_t) filetime_string_decimal_digit_pairs[ 2 * ( year % 100 ) ];
+	string[ 11 ] = (uint8_t) filetime_string_decimal_digit_pairs[ ( 2 * ( year % 100 ) ) + 1 ];
+	string[ 12 ] = (uint8_t) ' ';
+	string[ 13 ] = (uint8_t) filetime_string_decimal_digit_pairs[ 2 * hours ];
+	string[ 14 ] = (uint8_t) filetime_string_decimal_digit_pairs[ ( 2 * hours ) + 1 ];
+	string[ 15 ] = (uint8_t) ':';
+	string[ 16 ] = (uint8_t) filetime_string_decimal_digit_pairs[ 2 * minutes ];
+	string[ 17 ] = (uint8_t) filetime_string_decimal_digit_pairs[ ( 2 * minutes ) + 1 ];
+	string[ 18 ] = (uint8_t) ':';
+	string[ 19 ] = (uint8_t) filetime_string_decimal_digit_pairs[ 2 * seconds ];
+	string[ 20 ] = (uint8_t) filetime_string_decimal_digit_pairs[ ( 2 * seconds ) + 1 ];
+	string[ 21 ] = (uint8_t) '.';
+
+	for( digit_index = 28;
+	     digit_index > 21;
+	     digit_index-- )
+	{
+		string[ digit_index ] = (uint8_t) '0' + (uint8_t) ( fraction_of_second % 10 );
+
+		fraction_of_second /= 10;
+	}
+	/* The FILETIME has a precision of 100 nano seconds
+	 */
+	string[ 29 ] = (uint8_t) '0';
+	string[ 30 ] = (uint8_t) '0';
+	string[ 31 ] = 0;
+
+	return( 1 );
+}
+
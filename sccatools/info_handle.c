@@ -27,11 +27,13 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "filetime_string.h"
 #include "info_handle.h"
+#include "output_writer.h"
 #include "path_string.h"
 #include "sccainput.h"
+#include "sccatools_libbfio.h"
 #include "sccatools_libcerror.h"
-#include "sccatools_libfdatetime.h"
 #include "sccatools_libscca.h"
 
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
@@ -109,13 +111,36 @@ int info_handle_initialize(
 
 		goto on_error;
 	}
+	if( output_writer_initialize(
+	     &( ( *info_handle )->output_writer ),
+	     INFO_HANDLE_NOTIFY_STREAM,
+	     OUTPUT_WRITER_DEFAULT_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output writer.",
+		 function );
+
+		goto on_error;
+	}
 	( *info_handle )->notify_stream = INFO_HANDLE_NOTIFY_STREAM;
+	( *info_handle )->output_format = INFO_HANDLE_OUTPUT_FORMAT_TEXT;
+	( *info_handle )->fields        = INFO_HANDLE_FIELDS_ALL;
 
 	return( 1 );
 
 on_error:
 	if( *info_handle != NULL )
 	{
+		if( ( *info_handle )->input_file != NULL )
+		{
+			libscca_file_free(
+			 &( ( *info_handle )->input_file ),
+			 NULL );
+		}
 		memory_free(
 		 *info_handle );
 
@@ -132,6 +157,7 @@ int info_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "info_handle_free";
+	int buffer_index      = 0;
 	int result            = 1;
 
 	if( info_handle == NULL )
@@ -163,6 +189,48 @@ int info_handle_free(
 				result = -1;
 			}
 		}
+		if( ( *info_handle )->input_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( ( *info_handle )->input_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *info_handle )->output_writer != NULL )
+		{
+			if( output_writer_free(
+			     &( ( *info_handle )->output_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free output writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		for( buffer_index = 0;
+		     buffer_index < INFO_HANDLE_NUMBER_OF_SCRATCH_BUFFERS;
+		     buffer_index++ )
+		{
+			if( ( *info_handle )->scratch_buffers[ buffer_index ] != NULL )
+			{
+				memory_free(
+				 ( *info_handle )->scratch_buffers[ buffer_index ] );
+			}
+		}
 		memory_free(
 		 *info_handle );
 
@@ -253,15 +321,17 @@ int info_handle_set_ascii_codepage(
 	return( result );
 }
 
-/* Opens the input
- * Returns 1 if successful or -1 on error
+/* Sets the output format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int info_handle_open_input(
+int info_handle_set_output_format(
      info_handle_t *info_handle,
-     const system_character_t *filename,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "info_handle_open_input";
+	static char *function = "info_handle_set_output_format";
+	size_t string_length  = 0;
+	int result            = 0;
 
 	if( info_handle == NULL )
 	{
@@ -274,40 +344,63 @@ int info_handle_open_input(
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libscca_file_open_wide(
-	     info_handle->input_file,
-	     filename,
-	     LIBSCCA_OPEN_READ,
-	     error ) != 1 )
-#else
-	if( libscca_file_open(
-	     info_handle->input_file,
-	     filename,
-	     LIBSCCA_OPEN_READ,
-	     error ) != 1 )
-#endif
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open input file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "text" ),
+		     4 ) == 0 )
+		{
+			info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_TEXT;
+			result                     = 1;
+		}
+	}
+	else if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "jsonl" ),
+		     5 ) == 0 )
+		{
+			info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_JSONL;
+			result                     = 1;
+		}
+	}
+	return( result );
 }
 
-/* Closes the input
- * Returns the 0 if successful or -1 on error
+/* Sets the fields to output
+ * The string contains a comma separated list of field names
+ * Sections of the file that are not needed by the fields are not parsed,
+ * a compressed file is still decompressed in full
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int info_handle_close_input(
+int info_handle_set_fields(
      info_handle_t *info_handle,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "info_handle_close_input";
+	static char *function = "info_handle_set_fields";
+	size_t field_length   = 0;
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	uint32_t field        = 0;
+	uint32_t fields       = 0;
+	uint8_t read_flags    = 0;
 
 	if( info_handle == NULL )
 	{
@@ -320,36 +413,169 @@ int info_handle_close_input(
 
 		return( -1 );
 	}
-	if( libscca_file_close(
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	while( string_index < string_length )
+	{
+		field_length = 0;
+
+		while( ( ( string_index + field_length ) < string_length )
+		    && ( string[ string_index + field_length ] != (system_character_t) ',' ) )
+		{
+			field_length++;
+		}
+		field = 0;
+
+		if( field_length == 3 )
+		{
+			if( system_string_compare(
+			     &( string[ string_index ] ),
+			     _SYSTEM_STRING( "all" ),
+			     3 ) == 0 )
+			{
+				field = INFO_HANDLE_FIELDS_ALL;
+			}
+		}
+		else if( field_length == 4 )
+		{
+			if( system_string_compare(
+			     &( string[ string_index ] ),
+			     _SYSTEM_STRING( "hash" ),
+			     4 ) == 0 )
+			{
+				field = INFO_HANDLE_FIELD_PREFETCH_HASH;
+			}
+		}
+		else if( field_length == 7 )
+		{
+			if( system_string_compare(
+			     &( string[ string_index ] ),
+			     _SYSTEM_STRING( "volumes" ),
+			     7 ) == 0 )
+			{
+				field = INFO_HANDLE_FIELD_VOLUMES;
+			}
+		}
+		else if( field_length == 9 )
+		{
+			if( system_string_compare(
+			     &( string[ string_index ] ),
+			     _SYSTEM_STRING( "filenames" ),
+			     9 ) == 0 )
+			{
+				field = INFO_HANDLE_FIELD_FILENAMES;
+			}
+			else if( system_string_compare(
+			          &( string[ string_index ] ),
+			          _SYSTEM_STRING( "run_count" ),
+			          9 ) == 0 )
+			{
+				field = INFO_HANDLE_FIELD_RUN_COUNT;
+			}
+		}
+		else if( field_length == 10 )
+		{
+			if( system_string_compare(
+			     &( string[ string_index ] ),
+			     _SYSTEM_STRING( "executable" ),
+			     10 ) == 0 )
+			{
+				field = INFO_HANDLE_FIELD_EXECUTABLE_FILENAME;
+			}
+		}
+		else if( field_length == 12 )
+		{
+			if( system_string_compare(
+			     &( string[ string_index ] ),
+			     _SYSTEM_STRING( "file_metrics" ),
+			     12 ) == 0 )
+			{
+				field = INFO_HANDLE_FIELD_FILE_METRICS;
+			}
+		}
+		else if( field_length == 14 )
+		{
+			if( system_string_compare(
+			     &( string[ string_index ] ),
+			     _SYSTEM_STRING( "format_version" ),
+			     14 ) == 0 )
+			{
+				field = INFO_HANDLE_FIELD_FORMAT_VERSION;
+			}
+			else if( system_string_compare(
+			          &( string[ string_index ] ),
+			          _SYSTEM_STRING( "last_run_times" ),
+			          14 ) == 0 )
+			{
+				field = INFO_HANDLE_FIELD_LAST_RUN_TIMES;
+			}
+		}
+		if( field == 0 )
+		{
+			return( 0 );
+		}
+		fields |= field;
+
+		string_index += field_length + 1;
+	}
+	if( fields == 0 )
+	{
+		return( 0 );
+	}
+	/* The directory strings of the volumes are currently not printed
+	 */
+	if( ( fields & INFO_HANDLE_FIELD_FILE_METRICS ) != 0 )
+	{
+		read_flags |= LIBSCCA_READ_FLAG_FILE_METRICS;
+	}
+	if( ( fields & INFO_HANDLE_FIELD_FILENAMES ) != 0 )
+	{
+		read_flags |= LIBSCCA_READ_FLAG_FILENAME_STRINGS;
+	}
+	if( ( fields & INFO_HANDLE_FIELD_VOLUMES ) != 0 )
+	{
+		read_flags |= LIBSCCA_READ_FLAG_VOLUMES;
+	}
+	if( libscca_file_set_read_flags(
 	     info_handle->input_file,
-	     error ) != 0 )
+	     read_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close input file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read flags.",
 		 function );
 
 		return( -1 );
 	}
-	return( 0 );
+	info_handle->fields = fields;
+
+	return( 1 );
 }
 
-/* Prints a FILETIME value
+/* Opens the input
  * Returns 1 if successful or -1 on error
  */
-int info_handle_filetime_value_fprint(
+int info_handle_open_input(
      info_handle_t *info_handle,
-     const char *value_name,
-     uint64_t value_64bit,
+     const system_character_t *filename,
      libcerror_error_t **error )
 {
-	system_character_t date_time_string[ 48 ];
-
-	libfdatetime_filetime_t *filetime = NULL;
-	static char *function             = "info_handle_filetime_value_fprint";
-	int result                        = 0;
+	static char *function = "info_handle_open_input";
 
 	if( info_handle == NULL )
 	{
@@ -362,112 +588,43 @@ int info_handle_filetime_value_fprint(
 
 		return( -1 );
 	}
-	if( value_64bit == 0 )
-	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "%s: Not set (0)\n",
-		 value_name );
-	}
-	else
-	{
-		if( libfdatetime_filetime_initialize(
-		     &filetime,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create FILETIME.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfdatetime_filetime_copy_from_64bit(
-		     filetime,
-		     value_64bit,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy 64-bit value to FILETIME.",
-			 function );
-
-			goto on_error;
-		}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfdatetime_filetime_copy_to_utf16_string(
-			  filetime,
-			  (uint16_t *) date_time_string,
-			  48,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			  error );
+	if( libscca_file_open_wide(
+	     info_handle->input_file,
+	     filename,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
 #else
-		result = libfdatetime_filetime_copy_to_utf8_string(
-			  filetime,
-			  (uint8_t *) date_time_string,
-			  48,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			  error );
+	if( libscca_file_open(
+	     info_handle->input_file,
+	     filename,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
 #endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy FILETIME to string.",
-			 function );
-
-			goto on_error;
-		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "%s: %" PRIs_SYSTEM " UTC\n",
-		 value_name,
-		 date_time_string );
-
-		if( libfdatetime_filetime_free(
-		     &filetime,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free FILETIME.",
-			 function );
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	if( filetime != NULL )
-	{
-		libfdatetime_filetime_free(
-		 &filetime,
-		 NULL );
-	}
-	return( -1 );
 }
 
-/* Prints a file entry name
+/* Opens the input from data in memory
+ * The data must remain available until the input is closed
  * Returns 1 if successful or -1 on error
  */
-int info_handle_name_value_fprint(
+int info_handle_open_input_data(
      info_handle_t *info_handle,
-     const system_character_t *value_string,
-     size_t value_string_length,
+     const uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
-	system_character_t *escaped_value_string = NULL;
-	static char *function                    = "info_handle_name_value_fprint";
-	size_t escaped_value_string_size         = 0;
+	static char *function = "info_handle_open_input_data";
 
 	if( info_handle == NULL )
 	{
@@ -480,76 +637,1353 @@ int info_handle_name_value_fprint(
 
 		return( -1 );
 	}
-	if( path_string_copy_from_file_entry_path(
-	     &escaped_value_string,
-	     &escaped_value_string_size,
-	     value_string,
-	     value_string_length,
+	if( info_handle->input_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - input file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_memory_range_initialize(
+	     &( info_handle->input_file_io_handle ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy path from file entry path.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	if( escaped_value_string == NULL )
+	if( libbfio_memory_range_set(
+	     info_handle->input_file_io_handle,
+	     (uint8_t *) data,
+	     data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing escaped value string.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of input file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "%" PRIs_SYSTEM "",
-	 escaped_value_string );
-
-	memory_free(
-	 escaped_value_string );
-
-	return( 1 );
-
-on_error:
-	if( escaped_value_string != NULL )
-	{
-		memory_free(
-		 escaped_value_string );
+	if( libscca_file_open_file_io_handle(
+	     info_handle->input_file,
+	     info_handle->input_file_io_handle,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( info_handle->input_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( info_handle->input_file_io_handle ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the input
+ * Returns the 0 if successful or -1 on error
+ */
+int info_handle_close_input(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_close_input";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_close(
+	     info_handle->input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->input_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( info_handle->input_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves a scratch buffer of at least a specific size
+ * The scratch buffers are retained by the info handle so that printing
+ * strings does not require an allocation per value
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_get_scratch_buffer(
+     info_handle_t *info_handle,
+     int buffer_index,
+     size_t buffer_size,
+     uint8_t **buffer,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation      = NULL;
+	static char *function      = "info_handle_get_scratch_buffer";
+	size_t scratch_buffer_size = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_index < 0 )
+	 || ( buffer_index >= INFO_HANDLE_NUMBER_OF_SCRATCH_BUFFERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > info_handle->scratch_buffer_sizes[ buffer_index ] )
+	{
+		scratch_buffer_size = INFO_HANDLE_MINIMUM_SCRATCH_BUFFER_SIZE;
+
+		while( scratch_buffer_size < buffer_size )
+		{
+			if( scratch_buffer_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				scratch_buffer_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+			}
+			else
+			{
+				scratch_buffer_size *= 2;
+			}
+		}
+		reallocation = (uint8_t *) memory_reallocate(
+		                            info_handle->scratch_buffers[ buffer_index ],
+		                            sizeof( uint8_t ) * scratch_buffer_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize scratch buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		info_handle->scratch_buffers[ buffer_index ]      = reallocation;
+		info_handle->scratch_buffer_sizes[ buffer_index ] = scratch_buffer_size;
+	}
+	*buffer = info_handle->scratch_buffers[ buffer_index ];
+
+	return( 1 );
+}
+
+/* Prints a decimal value
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_decimal_value_fprint(
+     info_handle_t *info_handle,
+     const char *value_name,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_decimal_value_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_string(
+	     info_handle->output_writer,
+	     value_name,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_string(
+	     info_handle->output_writer,
+	     ": ",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_decimal_uint64(
+	     info_handle->output_writer,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_string(
+	     info_handle->output_writer,
+	     "\n",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write value.",
+	 function );
+
+	return( -1 );
+}
+
+/* Prints a 32-bit hexadecimal value
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_hexadecimal_value_fprint(
+     info_handle_t *info_handle,
+     const char *value_name,
+     uint32_t value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_hexadecimal_value_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_string(
+	     info_handle->output_writer,
+	     value_name,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_string(
+	     info_handle->output_writer,
+	     ": 0x",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_hexadecimal_uint64(
+	     info_handle->output_writer,
+	     (uint64_t) value_32bit,
+	     8,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_string(
+	     info_handle->output_writer,
+	     "\n",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write value.",
+	 function );
+
+	return( -1 );
+}
+
+/* Prints a FILETIME value
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_filetime_value_fprint(
+     info_handle_t *info_handle,
+     const char *value_name,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	uint8_t date_time_string[ FILETIME_STRING_SIZE ];
+
+	static char *function = "info_handle_filetime_value_fprint";
+	int result            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_string(
+	     info_handle->output_writer,
+	     value_name,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( value_64bit == 0 )
+	{
+		if( output_writer_write_string(
+		     info_handle->output_writer,
+		     ": Not set (0)\n",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	else
+	{
+		/* A FILETIME that cannot be represented as a date and time string,
+		 * such as one past the year 9999, is printed as its raw value
+		 */
+		result = filetime_string_copy_from_64bit(
+		          date_time_string,
+		          FILETIME_STRING_SIZE,
+		          value_64bit,
+		          NULL );
+
+		if( output_writer_write_string(
+		     info_handle->output_writer,
+		     ": ",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( result != 1 )
+		{
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     "(0x",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( output_writer_write_hexadecimal_uint64(
+			     info_handle->output_writer,
+			     value_64bit >> 32,
+			     8,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     " 0x",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( output_writer_write_hexadecimal_uint64(
+			     info_handle->output_writer,
+			     value_64bit & 0xffffffffUL,
+			     8,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     ")\n",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+		else
+		{
+			if( output_writer_write_data(
+			     info_handle->output_writer,
+			     date_time_string,
+			     FILETIME_STRING_SIZE - 1,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     " UTC\n",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write value.",
+	 function );
+
+	return( -1 );
+}
+
+/* Prints a file entry name
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_name_value_fprint(
+     info_handle_t *info_handle,
+     const system_character_t *value_string,
+     size_t value_string_length,
+     libcerror_error_t **error )
+{
+	system_character_t *escaped_value_string = NULL;
+	uint8_t *scratch_buffer                  = NULL;
+	static char *function                    = "info_handle_name_value_fprint";
+	size_t escaped_value_string_size         = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_string_length == 0 )
+	 || ( value_string_length > ( ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) / ( sizeof( system_character_t ) * PATH_STRING_MAXIMUM_ESCAPED_CHARACTER_LENGTH ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	escaped_value_string_size = ( value_string_length * PATH_STRING_MAXIMUM_ESCAPED_CHARACTER_LENGTH ) + 1;
+
+	if( info_handle_get_scratch_buffer(
+	     info_handle,
+	     INFO_HANDLE_SCRATCH_BUFFER_ESCAPED_STRING,
+	     sizeof( system_character_t ) * escaped_value_string_size,
+	     &scratch_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve escaped value string buffer.",
+		 function );
+
+		return( -1 );
+	}
+	escaped_value_string = (system_character_t *) scratch_buffer;
+
+	if( path_string_copy_from_file_entry_path_to_buffer(
+	     escaped_value_string,
+	     escaped_value_string_size,
+	     value_string,
+	     value_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy path from file entry path.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_system_string(
+	     info_handle->output_writer,
+	     escaped_value_string,
+	     system_string_length(
+	      escaped_value_string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write escaped value string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the file information in the output format
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_file_fprint";
+	int result            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSONL )
+	{
+		result = info_handle_file_jsonl_fprint(
+		          info_handle,
+		          error );
+	}
+	else
+	{
+		result = info_handle_file_text_fprint(
+		          info_handle,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print file information.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the file information as text
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_text_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	libscca_volume_information_t *volume_information = NULL;
+	system_character_t *value_string                 = NULL;
+	uint8_t *scratch_buffer                          = NULL;
+	static char *function                            = "info_handle_file_text_fprint";
+	size_t value_string_size                         = 0;
+	uint64_t value_64bit                             = 0;
+	uint32_t format_version                          = 0;
+	uint32_t value_32bit                             = 0;
+	int filename_index                               = 0;
+	int last_run_time_index                          = 0;
+	int number_of_filenames                          = 0;
+	int number_of_last_run_times                     = 0;
+	int number_of_volumes                            = 0;
+	int result                                       = 0;
+	int volume_index                                 = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_string(
+	     info_handle->output_writer,
+	     "Windows Prefetch File (PF) information:\n",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( libscca_file_get_format_version(
+	     info_handle->input_file,
+	     &format_version,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve format version.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_FORMAT_VERSION ) != 0 )
+	{
+		if( info_handle_decimal_value_fprint(
+		     info_handle,
+		     "\tFormat version\t\t\t",
+		     (uint64_t) format_version,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_PREFETCH_HASH ) != 0 )
+	{
+		if( libscca_file_get_prefetch_hash(
+		     info_handle->input_file,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve prefetch hash.",
+			 function );
+
+			goto on_error;
+		}
+		if( info_handle_hexadecimal_value_fprint(
+		     info_handle,
+		     "\tPrefetch hash\t\t\t",
+		     value_32bit,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_EXECUTABLE_FILENAME ) != 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libscca_file_get_utf16_executable_filename_size(
+			  info_handle->input_file,
+			  &value_string_size,
+			  error );
+#else
+		result = libscca_file_get_utf8_executable_filename_size(
+			  info_handle->input_file,
+			  &value_string_size,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve executable filename size.",
+			 function );
+
+			goto on_error;
+		}
+		if( value_string_size > 0 )
+		{
+			if( info_handle_get_scratch_buffer(
+			     info_handle,
+			     INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING,
+			     sizeof( system_character_t ) * value_string_size,
+			     &scratch_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value string buffer.",
+				 function );
+
+				goto on_error;
+			}
+			value_string = (system_character_t *) scratch_buffer;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libscca_file_get_utf16_executable_filename(
+				  info_handle->input_file,
+				  (uint16_t *) value_string,
+				  value_string_size,
+				  error );
+#else
+			result = libscca_file_get_utf8_executable_filename(
+				  info_handle->input_file,
+				  (uint8_t *) value_string,
+				  value_string_size,
+				  error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve executable filename.",
+				 function );
+
+				goto on_error;
+			}
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     "\tExecutable filename\t\t: ",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( info_handle_name_value_fprint(
+			     info_handle,
+			     value_string,
+			     value_string_size - 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print executable filename string.",
+				 function );
+
+				goto on_error;
+			}
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     "\n",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+	}
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_RUN_COUNT ) != 0 )
+	{
+		if( libscca_file_get_run_count(
+		     info_handle->input_file,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run count.",
+			 function );
+
+			goto on_error;
+		}
+		if( info_handle_decimal_value_fprint(
+		     info_handle,
+		     "\tRun count\t\t\t",
+		     (uint64_t) value_32bit,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_LAST_RUN_TIMES ) != 0 )
+	{
+		if( format_version < 26 )
+		{
+			number_of_last_run_times = 1;
+		}
+		else
+		{
+			number_of_last_run_times = 8;
+		}
+		for( last_run_time_index = 0;
+		     last_run_time_index < number_of_last_run_times;
+		     last_run_time_index++ )
+		{
+			if( libscca_file_get_last_run_time(
+			     info_handle->input_file,
+			     last_run_time_index,
+			     &value_64bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve last run time: %d.",
+				 function,
+				 last_run_time_index );
+
+				goto on_error;
+			}
+			if( number_of_last_run_times == 1 )
+			{
+				result = info_handle_filetime_value_fprint(
+				          info_handle,
+				          "\tLast run time:\t\t\t",
+				          value_64bit,
+				          error );
+			}
+			else
+			{
+				if( output_writer_write_string(
+				     info_handle->output_writer,
+				     "\tLast run time: ",
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				if( output_writer_write_decimal_uint64(
+				     info_handle->output_writer,
+				     (uint64_t) last_run_time_index + 1,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				result = info_handle_filetime_value_fprint(
+				          info_handle,
+				          "\t\t",
+				          value_64bit,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print FILETIME value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_FILENAMES ) != 0 )
+	{
+		if( output_writer_write_string(
+		     info_handle->output_writer,
+		     "\nFilenames:\n",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( libscca_file_get_number_of_filenames(
+		     info_handle->input_file,
+		     &number_of_filenames,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of filenames.",
+			 function );
+
+			goto on_error;
+		}
+		if( info_handle_decimal_value_fprint(
+		     info_handle,
+		     "\tNumber of filenames\t\t",
+		     (uint64_t) number_of_filenames,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		for( filename_index = 0;
+		     filename_index < number_of_filenames;
+		     filename_index++ )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libscca_file_get_utf16_filename_size(
+				  info_handle->input_file,
+				  filename_index,
+				  &value_string_size,
+				  error );
+#else
+			result = libscca_file_get_utf8_filename_size(
+				  info_handle->input_file,
+				  filename_index,
+				  &value_string_size,
+				  error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve filename: %d size.",
+				 function,
+				 filename_index );
+
+				goto on_error;
+			}
+			if( value_string_size > 0 )
+			{
+				if( info_handle_get_scratch_buffer(
+				     info_handle,
+				     INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING,
+				     sizeof( system_character_t ) * value_string_size,
+				     &scratch_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value string buffer.",
+					 function );
+
+					goto on_error;
+				}
+				value_string = (system_character_t *) scratch_buffer;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				result = libscca_file_get_utf16_filename(
+					  info_handle->input_file,
+					  filename_index,
+					  (uint16_t *) value_string,
+					  value_string_size,
+					  error );
+#else
+				result = libscca_file_get_utf8_filename(
+					  info_handle->input_file,
+					  filename_index,
+					  (uint8_t *) value_string,
+					  value_string_size,
+					  error );
+#endif
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve filename: %d.",
+					 function,
+					 filename_index );
+
+					goto on_error;
+				}
+				if( output_writer_write_string(
+				     info_handle->output_writer,
+				     "\tFilename: ",
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				if( output_writer_write_decimal_uint64(
+				     info_handle->output_writer,
+				     (uint64_t) filename_index + 1,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				if( output_writer_write_string(
+				     info_handle->output_writer,
+				     "\t\t\t: ",
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				if( info_handle_name_value_fprint(
+				     info_handle,
+				     value_string,
+				     value_string_size - 1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+					 "%s: unable to print executable filename string.",
+					 function );
+
+					goto on_error;
+				}
+				if( output_writer_write_string(
+				     info_handle->output_writer,
+				     "\n",
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+			}
+		}
+	}
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_VOLUMES ) != 0 )
+	{
+		if( output_writer_write_string(
+		     info_handle->output_writer,
+		     "\nVolumes:\n",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( libscca_file_get_number_of_volumes(
+		     info_handle->input_file,
+		     &number_of_volumes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of volumes.",
+			 function );
+
+			goto on_error;
+		}
+		if( info_handle_decimal_value_fprint(
+		     info_handle,
+		     "\tNumber of volumes\t\t",
+		     (uint64_t) number_of_volumes,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( output_writer_write_string(
+		     info_handle->output_writer,
+		     "\n",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		for( volume_index = 0;
+		     volume_index < number_of_volumes;
+		     volume_index++ )
+		{
+			if( libscca_file_get_volume_information(
+			     info_handle->input_file,
+			     volume_index,
+			     &volume_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume information.",
+				 function );
+
+				return( -1 );
+			}
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     "Volume: ",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( output_writer_write_decimal_uint64(
+			     info_handle->output_writer,
+			     (uint64_t) volume_index + 1,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     " information:\n",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libscca_volume_information_get_utf16_device_path_size(
+				  volume_information,
+				  &value_string_size,
+				  error );
+#else
+			result = libscca_volume_information_get_utf8_device_path_size(
+				  volume_information,
+				  &value_string_size,
+				  error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve device path size.",
+				 function );
+
+				goto on_error;
+			}
+			if( value_string_size > 0 )
+			{
+				if( info_handle_get_scratch_buffer(
+				     info_handle,
+				     INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING,
+				     sizeof( system_character_t ) * value_string_size,
+				     &scratch_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value string buffer.",
+					 function );
+
+					goto on_error;
+				}
+				value_string = (system_character_t *) scratch_buffer;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				result = libscca_volume_information_get_utf16_device_path(
+					  volume_information,
+					  (uint16_t *) value_string,
+					  value_string_size,
+					  error );
+#else
+				result = libscca_volume_information_get_utf8_device_path(
+					  volume_information,
+					  (uint8_t *) value_string,
+					  value_string_size,
+					  error );
+#endif
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve device path.",
+					 function );
+
+					goto on_error;
+				}
+				if( output_writer_write_string(
+				     info_handle->output_writer,
+				     "\tDevice path\t\t\t: ",
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				if( output_writer_write_system_string(
+				     info_handle->output_writer,
+				     value_string,
+				     system_string_length(
+				      value_string ),
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				if( output_writer_write_string(
+				     info_handle->output_writer,
+				     "\n",
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+			}
+			if( libscca_volume_information_get_creation_time(
+			     volume_information,
+			     &value_64bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve creation time.",
+				 function );
+
+				goto on_error;
+			}
+			if( info_handle_filetime_value_fprint(
+			     info_handle,
+			     "\tCreation time\t\t\t",
+			     value_64bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print FILETIME value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libscca_volume_information_get_serial_number(
+			     volume_information,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve serial number.",
+				 function );
+
+				goto on_error;
+			}
+			if( info_handle_hexadecimal_value_fprint(
+			     info_handle,
+			     "\tSerial number\t\t\t",
+			     value_32bit,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+
+	/* TODO device path */
+	/* TODO file references */
+	/* TODO directories */
+
+			if( libscca_volume_information_free(
+			     &volume_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free volume information.",
+				 function );
+
+				goto on_error;
+			}
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     "\n",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+	}
+	if( output_writer_flush(
+	     info_handle->output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output writer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write text output.",
+	 function );
+
+on_error:
+	if( volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
 	}
 	return( -1 );
 }
 
-/* Prints the file information
+/* Prints the name of a JSON object member
  * Returns 1 if successful or -1 on error
  */
-int info_handle_file_fprint(
+int info_handle_jsonl_member_name_fprint(
      info_handle_t *info_handle,
+     const char *member_name,
+     int *number_of_members,
      libcerror_error_t **error )
 {
-	char value_name[ 32 ];
-
-	libscca_volume_information_t *volume_information = NULL;
-	system_character_t *value_string                 = NULL;
-	static char *function                            = "info_handle_file_fprint";
-	size_t value_string_size                         = 0;
-	uint64_t value_64bit                             = 0;
-	uint32_t format_version                          = 0;
-	uint32_t value_32bit                             = 0;
-	int filename_index                               = 0;
-	int last_run_time_index                          = 0;
-	int number_of_filenames                          = 0;
-	int number_of_last_run_times                     = 0;
-	int number_of_volumes                            = 0;
-	int print_count                                  = 0;
-	int result                                       = 0;
-	int volume_index                                 = 0;
+	static char *function = "info_handle_jsonl_member_name_fprint";
 
 	if( info_handle == NULL )
 	{
@@ -562,555 +1996,891 @@ int info_handle_file_fprint(
 
 		return( -1 );
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "Windows Prefetch File (PF) information:\n" );
-
-	if( libscca_file_get_format_version(
-	     info_handle->input_file,
-	     &format_version,
-	     error ) != 1 )
+	if( member_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve format version.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member name.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tFormat version\t\t\t: %" PRIu32 "\n",
-	 format_version );
-
-	if( libscca_file_get_prefetch_hash(
-	     info_handle->input_file,
-	     &value_32bit,
-	     error ) != 1 )
+	if( number_of_members == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve prefetch hash.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of members.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tPrefetch hash\t\t\t: 0x%08" PRIx32 "\n",
-	 value_32bit );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libscca_file_get_utf16_executable_filename_size(
-		  info_handle->input_file,
-		  &value_string_size,
-		  error );
-#else
-	result = libscca_file_get_utf8_executable_filename_size(
-		  info_handle->input_file,
-		  &value_string_size,
-		  error );
-#endif
-	if( result != 1 )
+	if( output_writer_write_string(
+	     info_handle->output_writer,
+	     ( *number_of_members == 0 ) ? "\"" : ",\"",
+	     error ) != 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve executable filename size.",
-		 function );
-
-		goto on_error;
+		goto on_write_error;
 	}
-	if( value_string_size > 0 )
+	if( output_writer_write_string(
+	     info_handle->output_writer,
+	     member_name,
+	     error ) != 1 )
 	{
-		value_string = system_string_allocate(
-				value_string_size );
-
-		if( value_string == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create value string.",
-			 function );
+		goto on_write_error;
+	}
+	if( output_writer_write_string(
+	     info_handle->output_writer,
+	     "\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	*number_of_members += 1;
 
-			goto on_error;
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libscca_file_get_utf16_executable_filename(
-			  info_handle->input_file,
-			  (uint16_t *) value_string,
-			  value_string_size,
-			  error );
-#else
-		result = libscca_file_get_utf8_executable_filename(
-			  info_handle->input_file,
-			  (uint8_t *) value_string,
-			  value_string_size,
-			  error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve executable filename.",
-			 function );
+	return( 1 );
 
-			goto on_error;
-		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tExecutable filename\t\t: " );
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write member name.",
+	 function );
 
-		if( info_handle_name_value_fprint(
-		     info_handle,
-		     value_string,
-		     value_string_size - 1,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print executable filename string.",
-			 function );
+	return( -1 );
+}
 
-			goto on_error;
-		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\n" );
+/* Prints the file information as a single line JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_jsonl_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	libscca_file_metrics_t *file_metrics             = NULL;
+	libscca_volume_information_t *volume_information = NULL;
+	uint8_t *utf8_string                             = NULL;
+	static char *function                            = "info_handle_file_jsonl_fprint";
+	size_t utf8_string_size                          = 0;
+	uint64_t value_64bit                             = 0;
+	uint32_t format_version                          = 0;
+	uint32_t value_32bit                             = 0;
+	int entry_index                                  = 0;
+	int last_run_time_index                          = 0;
+	int number_of_entries                            = 0;
+	int number_of_last_run_times                     = 0;
+	int number_of_members                            = 0;
+	int result                                       = 0;
 
-		memory_free(
-		 value_string );
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
 
-		value_string = NULL;
+		return( -1 );
 	}
-	if( libscca_file_get_run_count(
+	if( libscca_file_get_format_version(
 	     info_handle->input_file,
-	     &value_32bit,
+	     &format_version,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve run count.",
+		 "%s: unable to retrieve format version.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tRun count\t\t\t: %" PRIu32 "\n",
-	 value_32bit );
-
-	if( format_version < 26 )
+	if( output_writer_write_string(
+	     info_handle->output_writer,
+	     "{",
+	     error ) != 1 )
 	{
-		number_of_last_run_times = 1;
+		goto on_write_error;
 	}
-	else
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_FORMAT_VERSION ) != 0 )
 	{
-		number_of_last_run_times = 8;
+		if( info_handle_jsonl_member_name_fprint(
+		     info_handle,
+		     "format_version",
+		     &number_of_members,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( output_writer_write_decimal_uint64(
+		     info_handle->output_writer,
+		     (uint64_t) format_version,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
 	}
-	for( last_run_time_index = 0;
-	     last_run_time_index < number_of_last_run_times;
-	     last_run_time_index++ )
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_PREFETCH_HASH ) != 0 )
 	{
-		if( libscca_file_get_last_run_time(
+		if( libscca_file_get_prefetch_hash(
 		     info_handle->input_file,
-		     last_run_time_index,
-		     &value_64bit,
+		     &value_32bit,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve last run time: %d.",
-			 function,
-			 last_run_time_index );
+			 "%s: unable to retrieve prefetch hash.",
+			 function );
 
 			goto on_error;
 		}
-		if( number_of_last_run_times == 1 )
+		if( info_handle_jsonl_member_name_fprint(
+		     info_handle,
+		     "prefetch_hash",
+		     &number_of_members,
+		     error ) != 1 )
 		{
-			print_count = narrow_string_snprintf(
-			               value_name,
-			               32,
-			               "\tLast run time:\t\t\t" );
+			goto on_write_error;
 		}
-		else
+		if( output_writer_write_decimal_uint64(
+		     info_handle->output_writer,
+		     (uint64_t) value_32bit,
+		     error ) != 1 )
 		{
-			print_count = narrow_string_snprintf(
-			               value_name,
-			               32,
-			               "\tLast run time: %d\t\t",
-			               last_run_time_index + 1 );
+			goto on_write_error;
 		}
-		if( print_count < 0 )
+	}
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_EXECUTABLE_FILENAME ) != 0 )
+	{
+		if( libscca_file_get_utf8_executable_filename_size(
+		     info_handle->input_file,
+		     &utf8_string_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to format last run time: %d value name.",
-			 function,
-			 last_run_time_index );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve executable filename size.",
+			 function );
 
 			goto on_error;
 		}
-		if( info_handle_filetime_value_fprint(
+		if( info_handle_jsonl_member_name_fprint(
 		     info_handle,
-		     value_name,
-		     value_64bit,
+		     "executable_filename",
+		     &number_of_members,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( utf8_string_size == 0 )
+		{
+			result = output_writer_write_string(
+			          info_handle->output_writer,
+			          "\"\"",
+			          error );
+		}
+		else
+		{
+			if( info_handle_get_scratch_buffer(
+			     info_handle,
+			     INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING,
+			     sizeof( uint8_t ) * utf8_string_size,
+			     &utf8_string,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve UTF-8 string buffer.",
+				 function );
+
+				goto on_error;
+			}
+			if( libscca_file_get_utf8_executable_filename(
+			     info_handle->input_file,
+			     utf8_string,
+			     utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve executable filename.",
+				 function );
+
+				goto on_error;
+			}
+			result = output_writer_write_json_string(
+			          info_handle->output_writer,
+			          utf8_string,
+			          utf8_string_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_RUN_COUNT ) != 0 )
+	{
+		if( libscca_file_get_run_count(
+		     info_handle->input_file,
+		     &value_32bit,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print FILETIME value.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run count.",
 			 function );
 
 			goto on_error;
 		}
+		if( info_handle_jsonl_member_name_fprint(
+		     info_handle,
+		     "run_count",
+		     &number_of_members,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( output_writer_write_decimal_uint64(
+		     info_handle->output_writer,
+		     (uint64_t) value_32bit,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
-
-	fprintf(
-	 info_handle->notify_stream,
-	 "Filenames:\n" );
-
-	if( libscca_file_get_number_of_filenames(
-	     info_handle->input_file,
-	     &number_of_filenames,
-	     error ) != 1 )
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_LAST_RUN_TIMES ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of filenames.",
-		 function );
-
-		goto on_error;
-	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tNumber of filenames\t\t: %d\n",
-	 number_of_filenames );
+		if( info_handle_jsonl_member_name_fprint(
+		     info_handle,
+		     "last_run_times",
+		     &number_of_members,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( output_writer_write_string(
+		     info_handle->output_writer,
+		     "[",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( format_version < 26 )
+		{
+			number_of_last_run_times = 1;
+		}
+		else
+		{
+			number_of_last_run_times = 8;
+		}
+		for( last_run_time_index = 0;
+		     last_run_time_index < number_of_last_run_times;
+		     last_run_time_index++ )
+		{
+			if( libscca_file_get_last_run_time(
+			     info_handle->input_file,
+			     last_run_time_index,
+			     &value_64bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve last run time: %d.",
+				 function,
+				 last_run_time_index );
 
-	for( filename_index = 0;
-	     filename_index < number_of_filenames;
-	     filename_index++ )
-	{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libscca_file_get_utf16_filename_size(
-			  info_handle->input_file,
-			  filename_index,
-			  &value_string_size,
-			  error );
-#else
-		result = libscca_file_get_utf8_filename_size(
-			  info_handle->input_file,
-			  filename_index,
-			  &value_string_size,
-			  error );
-#endif
-		if( result != 1 )
+				goto on_error;
+			}
+			if( last_run_time_index > 0 )
+			{
+				if( output_writer_write_string(
+				     info_handle->output_writer,
+				     ",",
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+			}
+			if( output_writer_write_decimal_uint64(
+			     info_handle->output_writer,
+			     value_64bit,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+		if( output_writer_write_string(
+		     info_handle->output_writer,
+		     "]",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_FILE_METRICS ) != 0 )
+	{
+		if( info_handle_jsonl_member_name_fprint(
+		     info_handle,
+		     "file_metrics",
+		     &number_of_members,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( output_writer_write_string(
+		     info_handle->output_writer,
+		     "[",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( libscca_file_get_number_of_file_metrics_entries(
+		     info_handle->input_file,
+		     &number_of_entries,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve filename: %d size.",
-			 function,
-			 filename_index );
+			 "%s: unable to retrieve number of file metrics entries.",
+			 function );
 
 			goto on_error;
 		}
-		if( value_string_size > 0 )
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
 		{
-			value_string = system_string_allocate(
-					value_string_size );
+			if( libscca_file_get_file_metrics_entry(
+			     info_handle->input_file,
+			     entry_index,
+			     &file_metrics,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file metrics entry: %d.",
+				 function,
+				 entry_index );
 
-			if( value_string == NULL )
+				goto on_error;
+			}
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     ( entry_index == 0 ) ? "{\"filename\":" : ",{\"filename\":",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( libscca_file_metrics_get_utf8_filename_size(
+			     file_metrics,
+			     &utf8_string_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value string.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file metrics entry: %d filename size.",
+				 function,
+				 entry_index );
 
 				goto on_error;
 			}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libscca_file_get_utf16_filename(
-				  info_handle->input_file,
-				  filename_index,
-				  (uint16_t *) value_string,
-				  value_string_size,
-				  error );
-#else
-			result = libscca_file_get_utf8_filename(
-				  info_handle->input_file,
-				  filename_index,
-				  (uint8_t *) value_string,
-				  value_string_size,
-				  error );
-#endif
+			if( utf8_string_size == 0 )
+			{
+				result = output_writer_write_string(
+				          info_handle->output_writer,
+				          "\"\"",
+				          error );
+			}
+			else
+			{
+				if( info_handle_get_scratch_buffer(
+				     info_handle,
+				     INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING,
+				     sizeof( uint8_t ) * utf8_string_size,
+				     &utf8_string,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve UTF-8 string buffer.",
+					 function );
+
+					goto on_error;
+				}
+				if( libscca_file_metrics_get_utf8_filename(
+				     file_metrics,
+				     utf8_string,
+				     utf8_string_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve file metrics entry: %d filename.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				result = output_writer_write_json_string(
+				          info_handle->output_writer,
+				          utf8_string,
+				          utf8_string_size,
+				          error );
+			}
 			if( result != 1 )
+			{
+				goto on_write_error;
+			}
+			result = libscca_file_metrics_get_file_reference(
+			          file_metrics,
+			          &value_64bit,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve filename: %d.",
+				 "%s: unable to retrieve file metrics entry: %d file reference.",
 				 function,
-				 filename_index );
+				 entry_index );
 
 				goto on_error;
 			}
-			fprintf(
-			 info_handle->notify_stream,
-			 "\tFilename: %d\t\t\t: ",
-			 filename_index + 1 );
-
-			if( info_handle_name_value_fprint(
-			     info_handle,
-			     value_string,
-			     value_string_size - 1,
+			else if( result != 0 )
+			{
+				if( output_writer_write_string(
+				     info_handle->output_writer,
+				     ",\"file_reference\":",
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				if( output_writer_write_decimal_uint64(
+				     info_handle->output_writer,
+				     value_64bit,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+			}
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     "}",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( libscca_file_metrics_free(
+			     &file_metrics,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print executable filename string.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file metrics entry: %d.",
+				 function,
+				 entry_index );
 
 				goto on_error;
 			}
-			fprintf(
-			 info_handle->notify_stream,
-			 "\n" );
-
-			memory_free(
-			 value_string );
-
-			value_string = NULL;
+		}
+		if( output_writer_write_string(
+		     info_handle->output_writer,
+		     "]",
+		     error ) != 1 )
+		{
+			goto on_write_error;
 		}
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
-
-	fprintf(
-	 info_handle->notify_stream,
-	 "Volumes:\n" );
-
-	if( libscca_file_get_number_of_volumes(
-	     info_handle->input_file,
-	     &number_of_volumes,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of volumes.",
-		 function );
-
-		goto on_error;
-	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tNumber of volumes\t\t: %d\n",
-	 number_of_volumes );
-
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
-
-	for( volume_index = 0;
-	     volume_index < number_of_volumes;
-	     volume_index++ )
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_FILENAMES ) != 0 )
 	{
-		if( libscca_file_get_volume_information(
-		     info_handle->input_file,
-		     volume_index,
-		     &volume_information,
+		if( info_handle_jsonl_member_name_fprint(
+		     info_handle,
+		     "filenames",
+		     &number_of_members,
 		     error ) != 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve volume information.",
-			 function );
-
-			return( -1 );
+			goto on_write_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "Volume: %d information:\n",
-		 volume_index + 1 );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libscca_volume_information_get_utf16_device_path_size(
-			  volume_information,
-			  &value_string_size,
-			  error );
-#else
-		result = libscca_volume_information_get_utf8_device_path_size(
-			  volume_information,
-			  &value_string_size,
-			  error );
-#endif
-		if( result != 1 )
+		if( output_writer_write_string(
+		     info_handle->output_writer,
+		     "[",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( libscca_file_get_number_of_filenames(
+		     info_handle->input_file,
+		     &number_of_entries,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve device path size.",
+			 "%s: unable to retrieve number of filenames.",
 			 function );
 
 			goto on_error;
 		}
-		if( value_string_size > 0 )
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
 		{
-			value_string = system_string_allocate(
-					value_string_size );
-
-			if( value_string == NULL )
+			if( libscca_file_get_utf8_filename_size(
+			     info_handle->input_file,
+			     entry_index,
+			     &utf8_string_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value string.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve filename: %d size.",
+				 function,
+				 entry_index );
 
 				goto on_error;
 			}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libscca_volume_information_get_utf16_device_path(
-				  volume_information,
-				  (uint16_t *) value_string,
-				  value_string_size,
-				  error );
-#else
-			result = libscca_volume_information_get_utf8_device_path(
-				  volume_information,
-				  (uint8_t *) value_string,
-				  value_string_size,
-				  error );
-#endif
+			if( entry_index > 0 )
+			{
+				if( output_writer_write_string(
+				     info_handle->output_writer,
+				     ",",
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+			}
+			if( utf8_string_size == 0 )
+			{
+				result = output_writer_write_string(
+				          info_handle->output_writer,
+				          "\"\"",
+				          error );
+			}
+			else
+			{
+				if( info_handle_get_scratch_buffer(
+				     info_handle,
+				     INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING,
+				     sizeof( uint8_t ) * utf8_string_size,
+				     &utf8_string,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve UTF-8 string buffer.",
+					 function );
+
+					goto on_error;
+				}
+				if( libscca_file_get_utf8_filename(
+				     info_handle->input_file,
+				     entry_index,
+				     utf8_string,
+				     utf8_string_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve filename: %d.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				result = output_writer_write_json_string(
+				          info_handle->output_writer,
+				          utf8_string,
+				          utf8_string_size,
+				          error );
+			}
 			if( result != 1 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve device path.",
-				 function );
-
-				goto on_error;
+				goto on_write_error;
 			}
-			fprintf(
-			 info_handle->notify_stream,
-			 "\tDevice path\t\t\t: %" PRIs_SYSTEM "\n",
-			 value_string );
-
-			memory_free(
-			 value_string );
-
-			value_string = NULL;
 		}
-		if( libscca_volume_information_get_creation_time(
-		     volume_information,
-		     &value_64bit,
+		if( output_writer_write_string(
+		     info_handle->output_writer,
+		     "]",
 		     error ) != 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve creation time.",
-			 function );
-
-			goto on_error;
+			goto on_write_error;
 		}
-		if( info_handle_filetime_value_fprint(
+	}
+	if( ( info_handle->fields & INFO_HANDLE_FIELD_VOLUMES ) != 0 )
+	{
+		if( info_handle_jsonl_member_name_fprint(
 		     info_handle,
-		     "\tCreation time\t\t\t",
-		     value_64bit,
+		     "volumes",
+		     &number_of_members,
 		     error ) != 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print FILETIME value.",
-			 function );
-
-			goto on_error;
+			goto on_write_error;
 		}
-		if( libscca_volume_information_get_serial_number(
-		     volume_information,
-		     &value_32bit,
+		if( output_writer_write_string(
+		     info_handle->output_writer,
+		     "[",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( libscca_file_get_number_of_volumes(
+		     info_handle->input_file,
+		     &number_of_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve serial number.",
+			 "%s: unable to retrieve number of volumes.",
 			 function );
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tSerial number\t\t\t: 0x%08" PRIx32 "\n",
-		 value_32bit );
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libscca_file_get_volume_information(
+			     info_handle->input_file,
+			     entry_index,
+			     &volume_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume information: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     ( entry_index == 0 ) ? "{\"device_path\":" : ",{\"device_path\":",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( libscca_volume_information_get_utf8_device_path_size(
+			     volume_information,
+			     &utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d device path size.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( utf8_string_size == 0 )
+			{
+				result = output_writer_write_string(
+				          info_handle->output_writer,
+				          "\"\"",
+				          error );
+			}
+			else
+			{
+				if( info_handle_get_scratch_buffer(
+				     info_handle,
+				     INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING,
+				     sizeof( uint8_t ) * utf8_string_size,
+				     &utf8_string,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve UTF-8 string buffer.",
+					 function );
+
+					goto on_error;
+				}
+				if( libscca_volume_information_get_utf8_device_path(
+				     volume_information,
+				     utf8_string,
+				     utf8_string_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve volume: %d device path.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				result = output_writer_write_json_string(
+				          info_handle->output_writer,
+				          utf8_string,
+				          utf8_string_size,
+				          error );
+			}
+			if( result != 1 )
+			{
+				goto on_write_error;
+			}
+			if( libscca_volume_information_get_creation_time(
+			     volume_information,
+			     &value_64bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d creation time.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     ",\"creation_time\":",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( output_writer_write_decimal_uint64(
+			     info_handle->output_writer,
+			     value_64bit,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( libscca_volume_information_get_serial_number(
+			     volume_information,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d serial number.",
+				 function,
+				 entry_index );
 
-/* TODO device path */
-/* TODO file references */
-/* TODO directories */
+				goto on_error;
+			}
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     ",\"serial_number\":",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( output_writer_write_decimal_uint64(
+			     info_handle->output_writer,
+			     (uint64_t) value_32bit,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( output_writer_write_string(
+			     info_handle->output_writer,
+			     "}",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( libscca_volume_information_free(
+			     &volume_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free volume information: %d.",
+				 function,
+				 entry_index );
 
-		if( libscca_volume_information_free(
-		     &volume_information,
+				goto on_error;
+			}
+		}
+		if( output_writer_write_string(
+		     info_handle->output_writer,
+		     "]",
 		     error ) != 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free volume information.",
-			 function );
-
-			goto on_error;
+			goto on_write_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\n" );
+	}
+	if( output_writer_write_string(
+	     info_handle->output_writer,
+	     "}\n",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_flush(
+	     info_handle->output_writer,
+	     error ) != 1 )
+	{
+		goto on_write_error;
 	}
 	return( 1 );
 
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write JSON output.",
+	 function );
+
 on_error:
 	if( volume_information != NULL )
 	{
@@ -1118,10 +2888,11 @@ on_error:
 		 &volume_information,
 		 NULL );
 	}
-	if( value_string != NULL )
+	if( file_metrics != NULL )
 	{
-		memory_free(
-		 value_string );
+		libscca_file_metrics_free(
+		 &file_metrics,
+		 NULL );
 	}
 	return( -1 );
 }
@@ -26,6 +26,8 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "output_writer.h"
+#include "sccatools_libbfio.h"
 #include "sccatools_libcerror.h"
 #include "sccatools_libscca.h"
 
@@ -33,6 +35,41 @@
 extern "C" {
 #endif
 
+/* The number of reusable scratch buffers
+ */
+#define INFO_HANDLE_NUMBER_OF_SCRATCH_BUFFERS		2
+
+/* The minimum size of a scratch buffer
+ */
+#define INFO_HANDLE_MINIMUM_SCRATCH_BUFFER_SIZE		256
+
+enum INFO_HANDLE_OUTPUT_FORMATS
+{
+	INFO_HANDLE_OUTPUT_FORMAT_TEXT		= (int) 't',
+	INFO_HANDLE_OUTPUT_FORMAT_JSONL		= (int) 'j'
+};
+
+enum INFO_HANDLE_FIELDS
+{
+	INFO_HANDLE_FIELD_FORMAT_VERSION	= 0x00000001UL,
+	INFO_HANDLE_FIELD_PREFETCH_HASH		= 0x00000002UL,
+	INFO_HANDLE_FIELD_EXECUTABLE_FILENAME	= 0x00000004UL,
+	INFO_HANDLE_FIELD_RUN_COUNT		= 0x00000008UL,
+	INFO_HANDLE_FIELD_LAST_RUN_TIMES	= 0x00000010UL,
+	INFO_HANDLE_FIELD_FILE_METRICS		= 0x00000020UL,
+	INFO_HANDLE_FIELD_FILENAMES		= 0x00000040UL,
+	INFO_HANDLE_FIELD_VOLUMES		= 0x00000080UL
+};
+
+#define INFO_HANDLE_FIELDS_ALL \
+	( INFO_HANDLE_FIELD_FORMAT_VERSION | INFO_HANDLE_FIELD_PREFETCH_HASH | INFO_HANDLE_FIELD_EXECUTABLE_FILENAME | INFO_HANDLE_FIELD_RUN_COUNT | INFO_HANDLE_FIELD_LAST_RUN_TIMES | INFO_HANDLE_FIELD_FILE_METRICS | INFO_HANDLE_FIELD_FILENAMES | INFO_HANDLE_FIELD_VOLUMES )
+
+enum INFO_HANDLE_SCRATCH_BUFFERS
+{
+	INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING		= 0,
+	INFO_HANDLE_SCRATCH_BUFFER_ESCAPED_STRING	= 1
+};
+
 typedef struct info_handle info_handle_t;
 
 struct info_handle
@@ -41,10 +78,34 @@ struct info_handle
 	 */
 	libscca_file_t *input_file;
 
+	/* The file IO handle of the input data
+	 */
+	libbfio_handle_t *input_file_io_handle;
+
 	/* The ascii codepage
 	 */
 	int ascii_codepage;
 
+	/* The output format
+	 */
+	int output_format;
+
+	/* The fields to output
+	 */
+	uint32_t fields;
+
+	/* The output writer
+	 */
+	output_writer_t *output_writer;
+
+	/* The scratch buffers, reused for every value string
+	 */
+	uint8_t *scratch_buffers[ INFO_HANDLE_NUMBER_OF_SCRATCH_BUFFERS ];
+
+	/* The scratch buffer sizes
+	 */
+	size_t scratch_buffer_sizes[ INFO_HANDLE_NUMBER_OF_SCRATCH_BUFFERS ];
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -71,15 +132,50 @@ int info_handle_set_ascii_codepage(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int info_handle_set_output_format(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_set_fields(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int info_handle_open_input(
      info_handle_t *info_handle,
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int info_handle_open_input_data(
+     info_handle_t *info_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int info_handle_close_input(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_get_scratch_buffer(
+     info_handle_t *info_handle,
+     int buffer_index,
+     size_t buffer_size,
+     uint8_t **buffer,
+     libcerror_error_t **error );
+
+int info_handle_decimal_value_fprint(
+     info_handle_t *info_handle,
+     const char *value_name,
+     uint64_t value_64bit,
+     libcerror_error_t **error );
+
+int info_handle_hexadecimal_value_fprint(
+     info_handle_t *info_handle,
+     const char *value_name,
+     uint32_t value_32bit,
+     libcerror_error_t **error );
+
 int info_handle_filetime_value_fprint(
      info_handle_t *info_handle,
      const char *value_name,
@@ -96,6 +192,20 @@ int info_handle_file_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_file_text_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_jsonl_member_name_fprint(
+     info_handle_t *info_handle,
+     const char *member_name,
+     int *number_of_members,
+     libcerror_error_t **error );
+
+int info_handle_file_jsonl_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,456 @@
+/*
+ * Memory mapped file
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+/* Memory mapping is only supported with narrow system character paths
+ */
+#if defined( HAVE_SYS_MMAN_H ) && defined( HAVE_FCNTL_H ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define MAPPED_FILE_HAVE_MMAP
+#endif
+
+#if defined( MAPPED_FILE_HAVE_MMAP )
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "mapped_file.h"
+#include "sccatools_libcerror.h"
+
+/* The size of the buffer used to read a file without memory mapping
+ */
+#define MAPPED_FILE_READ_BUFFER_SIZE		( 1024 * 1024 )
+
+/* Creates a mapped file
+ * Make sure the value mapped_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int mapped_file_initialize(
+     mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "mapped_file_initialize";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*mapped_file = memory_allocate_structure(
+	                mapped_file_t );
+
+	if( *mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *mapped_file,
+	     0,
+	     sizeof( mapped_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear mapped file.",
+		 function );
+
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees a mapped file
+ * Returns 1 if successful or -1 on error
+ */
+int mapped_file_free(
+     mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "mapped_file_free";
+	int result            = 1;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file != NULL )
+	{
+		if( mapped_file_close(
+		     *mapped_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close mapped file.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens a mapped file
+ * The file is mapped into memory if supported otherwise it is read into memory
+ * Returns 1 if successful or -1 on error
+ */
+int mapped_file_open(
+     mapped_file_t *mapped_file,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+#if defined( MAPPED_FILE_HAVE_MMAP )
+	struct stat file_status;
+
+	void *mapped_data         = NULL;
+	int file_descriptor       = -1;
+#else
+	FILE *stream              = NULL;
+	void *reallocation        = NULL;
+	size_t allocated_size     = 0;
+	size_t read_count         = 0;
+#endif
+	static char *function     = "mapped_file_open";
+	size_t data_size          = 0;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( MAPPED_FILE_HAVE_MMAP )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_status ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_status.st_size <= 0 )
+	 || ( (uint64_t) file_status.st_size > (uint64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data_size = (size_t) file_status.st_size;
+
+	mapped_data = mmap(
+	               NULL,
+	               data_size,
+	               PROT_READ,
+	               MAP_PRIVATE,
+	               file_descriptor,
+	               0 );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to map file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	close(
+	 file_descriptor );
+
+	file_descriptor = -1;
+
+	mapped_file->data = (uint8_t *) mapped_data;
+#else
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	do
+	{
+		if( ( allocated_size - data_size ) < MAPPED_FILE_READ_BUFFER_SIZE )
+		{
+			if( allocated_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - MAPPED_FILE_READ_BUFFER_SIZE ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid file size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			allocated_size += MAPPED_FILE_READ_BUFFER_SIZE;
+
+			reallocation = memory_reallocate(
+			                mapped_file->data,
+			                allocated_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize data.",
+				 function );
+
+				goto on_error;
+			}
+			mapped_file->data = (uint8_t *) reallocation;
+		}
+		read_count = file_stream_read(
+		              stream,
+		              &( mapped_file->data[ data_size ] ),
+		              allocated_size - data_size );
+
+		data_size += read_count;
+	}
+	while( read_count > 0 );
+
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	stream = NULL;
+#endif /* defined( MAPPED_FILE_HAVE_MMAP ) */
+
+	mapped_file->data_size = data_size;
+
+	return( 1 );
+
+on_error:
+#if defined( MAPPED_FILE_HAVE_MMAP )
+	if( mapped_file->data != NULL )
+	{
+		munmap(
+		 mapped_file->data,
+		 data_size );
+
+		mapped_file->data = NULL;
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+#else
+	if( mapped_file->data != NULL )
+	{
+		memory_free(
+		 mapped_file->data );
+
+		mapped_file->data = NULL;
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+#endif
+	return( -1 );
+}
+
+/* Closes a mapped file
+ * Returns 0 if successful or -1 on error
+ */
+int mapped_file_close(
+     mapped_file_t *mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "mapped_file_close";
+	int result            = 0;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file->data != NULL )
+	{
+#if defined( MAPPED_FILE_HAVE_MMAP )
+		if( munmap(
+		     mapped_file->data,
+		     mapped_file->data_size ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to unmap data.",
+			 function );
+
+			result = -1;
+		}
+#else
+		memory_free(
+		 mapped_file->data );
+#endif
+		mapped_file->data = NULL;
+	}
+	mapped_file->data_size = 0;
+
+	return( result );
+}
+
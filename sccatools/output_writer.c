@@ -0,0 +1,1163 @@
+/*
+ * Buffered output writer
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDARG_H ) || defined( WINAPI )
+#include <stdarg.h>
+#else
+#error Missing header stdarg.h
+#endif
+
+#include "output_writer.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libuna.h"
+
+/* Creates an output writer
+ * Make sure the value output_writer is referencing, is set to NULL
+ * If stream is NULL the output is retained in the buffer, which grows as needed
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_initialize(
+     output_writer_t **output_writer,
+     FILE *stream,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_initialize";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*output_writer = memory_allocate_structure(
+	                  output_writer_t );
+
+	if( *output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *output_writer,
+	     0,
+	     sizeof( output_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output writer.",
+		 function );
+
+		goto on_error;
+	}
+	( *output_writer )->buffer = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * buffer_size );
+
+	if( ( *output_writer )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *output_writer )->stream      = stream;
+	( *output_writer )->buffer_size = buffer_size;
+
+	return( 1 );
+
+on_error:
+	if( *output_writer != NULL )
+	{
+		memory_free(
+		 *output_writer );
+
+		*output_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an output writer
+ * Note that buffered data that has not been flushed is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_free(
+     output_writer_t **output_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_free";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_writer != NULL )
+	{
+		if( ( *output_writer )->buffer != NULL )
+		{
+			memory_free(
+			 ( *output_writer )->buffer );
+		}
+		memory_free(
+		 *output_writer );
+
+		*output_writer = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the stream
+ * The buffered data should be flushed before changing the stream
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_set_stream(
+     output_writer_t *output_writer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_set_stream";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->buffer_offset != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output writer - buffer contains data.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer->stream = stream;
+
+	return( 1 );
+}
+
+/* Resizes the buffer so that it can contain at least an additional number of bytes
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_resize_buffer(
+     output_writer_t *output_writer,
+     size_t additional_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "output_writer_resize_buffer";
+	size_t buffer_size    = 0;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( additional_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - output_writer->buffer_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid additional size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_size = output_writer->buffer_size;
+
+	while( ( buffer_size - output_writer->buffer_offset ) < additional_size )
+	{
+		if( buffer_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+		{
+			buffer_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+		}
+		else
+		{
+			buffer_size *= 2;
+		}
+	}
+	if( buffer_size == output_writer->buffer_size )
+	{
+		return( 1 );
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            output_writer->buffer,
+	                            sizeof( uint8_t ) * buffer_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer->buffer      = reallocation;
+	output_writer->buffer_size = buffer_size;
+
+	return( 1 );
+}
+
+/* Makes sure a number of bytes can be written contiguously into the buffer
+ * The buffer is flushed or, if no stream was set, resized
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_reserve(
+     output_writer_t *output_writer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_reserve";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size <= ( output_writer->buffer_size - output_writer->buffer_offset ) )
+	{
+		return( 1 );
+	}
+	if( output_writer_flush(
+	     output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > ( output_writer->buffer_size - output_writer->buffer_offset ) )
+	{
+		if( output_writer_resize_buffer(
+		     output_writer,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the buffered data to the stream
+ * If no stream was set the buffered data is retained
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_flush(
+     output_writer_t *output_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_flush";
+	size_t write_count    = 0;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_writer->stream == NULL )
+	 || ( output_writer->buffer_offset == 0 ) )
+	{
+		return( 1 );
+	}
+	write_count = file_stream_write(
+	               output_writer->stream,
+	               output_writer->buffer,
+	               output_writer->buffer_offset );
+
+	if( write_count != output_writer->buffer_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer to stream.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer->buffer_offset = 0;
+
+	return( 1 );
+}
+
+/* Writes data
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_data(
+     output_writer_t *output_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_write_data";
+	size_t write_count    = 0;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_writer->stream == NULL )
+	 && ( data_size > ( output_writer->buffer_size - output_writer->buffer_offset ) ) )
+	{
+		if( output_writer_resize_buffer(
+		     output_writer,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( data_size > ( output_writer->buffer_size - output_writer->buffer_offset ) )
+	{
+		if( output_writer_flush(
+		     output_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output writer.",
+			 function );
+
+			return( -1 );
+		}
+		/* Data that does not fit in the buffer is written directly
+		 */
+		if( data_size > output_writer->buffer_size )
+		{
+			write_count = file_stream_write(
+			               output_writer->stream,
+			               data,
+			               data_size );
+
+			if( write_count != data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write data to stream.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+	if( memory_copy(
+	     &( output_writer->buffer[ output_writer->buffer_offset ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer->buffer_offset += data_size;
+
+	return( 1 );
+}
+
+/* Writes a narrow string without the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_string(
+     output_writer_t *output_writer,
+     const char *string,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_write_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_data(
+	     output_writer,
+	     (uint8_t *) string,
+	     narrow_string_length(
+	      string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a formatted narrow string
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_printf(
+     output_writer_t *output_writer,
+     const char *format,
+     ... )
+{
+	va_list argument_list;
+
+	size_t available_size = 0;
+	int attempt           = 0;
+	int print_count       = 0;
+
+	if( output_writer == NULL )
+	{
+		return( -1 );
+	}
+	if( format == NULL )
+	{
+		return( -1 );
+	}
+	/* The string is formatted directly into the buffer, if it does not fit
+	 * the buffer is flushed or resized and the string is formatted again
+	 */
+	for( attempt = 0;
+	     attempt < 2;
+	     attempt++ )
+	{
+		available_size = output_writer->buffer_size - output_writer->buffer_offset;
+
+		va_start(
+		 argument_list,
+		 format );
+
+		print_count = narrow_string_vsnprintf(
+		               (char *) &( output_writer->buffer[ output_writer->buffer_offset ] ),
+		               available_size,
+		               format,
+		               argument_list );
+
+		va_end(
+		 argument_list );
+
+		if( print_count < 0 )
+		{
+			return( -1 );
+		}
+		if( (size_t) print_count < available_size )
+		{
+			output_writer->buffer_offset += (size_t) print_count;
+
+			return( 1 );
+		}
+		if( output_writer_flush(
+		     output_writer,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( ( (size_t) print_count + 1 ) > ( output_writer->buffer_size - output_writer->buffer_offset ) )
+		{
+			if( output_writer_resize_buffer(
+			     output_writer,
+			     (size_t) print_count + 1,
+			     NULL ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+	}
+	return( -1 );
+}
+
+/* Writes an unsigned 64-bit value as a decimal string
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_decimal_uint64(
+     output_writer_t *output_writer,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	uint8_t value_string[ 20 ];
+
+	static char *function     = "output_writer_write_decimal_uint64";
+	size_t value_string_index = 20;
+
+	do
+	{
+		value_string_index--;
+
+		value_string[ value_string_index ] = (uint8_t) '0' + (uint8_t) ( value_64bit % 10 );
+
+		value_64bit /= 10;
+	}
+	while( value_64bit > 0 );
+
+	if( output_writer_write_data(
+	     output_writer,
+	     &( value_string[ value_string_index ] ),
+	     20 - value_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write value string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes an unsigned 64-bit value as a lower case hexadecimal string without prefix
+ * The string is padded with leading zeros up to the number of digits
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_hexadecimal_uint64(
+     output_writer_t *output_writer,
+     uint64_t value_64bit,
+     int number_of_digits,
+     libcerror_error_t **error )
+{
+	static const char *hexadecimal_digits = "0123456789abcdef";
+	static char *function                 = "output_writer_write_hexadecimal_uint64";
+	uint8_t *value_string                 = NULL;
+	int digit_index                       = 0;
+
+	if( ( number_of_digits < 1 )
+	 || ( number_of_digits > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of digits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Values that do not fit are written with additional digits
+	 */
+	while( ( number_of_digits < 16 )
+	    && ( ( value_64bit >> ( 4 * number_of_digits ) ) != 0 ) )
+	{
+		number_of_digits++;
+	}
+	if( output_writer_reserve(
+	     output_writer,
+	     (size_t) number_of_digits,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in output writer.",
+		 function );
+
+		return( -1 );
+	}
+	value_string = &( output_writer->buffer[ output_writer->buffer_offset ] );
+
+	for( digit_index = number_of_digits - 1;
+	     digit_index >= 0;
+	     digit_index-- )
+	{
+		value_string[ digit_index ] = (uint8_t) hexadecimal_digits[ value_64bit & 0x0f ];
+
+		value_64bit >>= 4;
+	}
+	output_writer->buffer_offset += (size_t) number_of_digits;
+
+	return( 1 );
+}
+
+/* Writes a system string without the end-of-string character
+ * A wide system string is converted to UTF-8 directly into the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_system_string(
+     output_writer_t *output_writer,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	static char *function   = "output_writer_write_system_string";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t utf8_string_size = 0;
+	int result              = 0;
+#endif
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#if SIZEOF_WCHAR_T == 4
+	result = libuna_utf8_string_size_from_utf32(
+	          (libuna_utf32_character_t *) string,
+	          string_length,
+	          &utf8_string_size,
+	          error );
+#elif SIZEOF_WCHAR_T == 2
+	result = libuna_utf8_string_size_from_utf16(
+	          (libuna_utf16_character_t *) string,
+	          string_length,
+	          &utf8_string_size,
+	          error );
+#else
+#error Unsupported size of wchar_t
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The UTF-8 string size includes an end-of-string character that is not retained
+	 */
+	if( output_writer_reserve(
+	     output_writer,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in output writer.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_WCHAR_T == 4
+	result = libuna_utf8_string_copy_from_utf32(
+	          &( output_writer->buffer[ output_writer->buffer_offset ] ),
+	          utf8_string_size,
+	          (libuna_utf32_character_t *) string,
+	          string_length,
+	          error );
+#elif SIZEOF_WCHAR_T == 2
+	result = libuna_utf8_string_copy_from_utf16(
+	          &( output_writer->buffer[ output_writer->buffer_offset ] ),
+	          utf8_string_size,
+	          (libuna_utf16_character_t *) string,
+	          string_length,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer->buffer_offset += utf8_string_size - 1;
+#else
+	if( output_writer_write_data(
+	     output_writer,
+	     (uint8_t *) string,
+	     string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
+/* Writes an UTF-8 string as a quoted and escaped JSON string
+ * The string is written up to the size or the first end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_json_string(
+     output_writer_t *output_writer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t escaped_character[ 6 ];
+
+	const char *hexadecimal_digits = "0123456789abcdef";
+	static char *function          = "output_writer_write_json_string";
+	size_t segment_start           = 0;
+	size_t string_index            = 0;
+	size_t escaped_character_size  = 0;
+	uint8_t byte_value             = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_data(
+	     output_writer,
+	     (uint8_t *) "\"",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Runs of characters that need no escaping are written as one segment
+	 */
+	for( string_index = 0;
+	     string_index < utf8_string_size;
+	     string_index++ )
+	{
+		byte_value = utf8_string[ string_index ];
+
+		if( byte_value == 0 )
+		{
+			break;
+		}
+		if( ( byte_value >= 0x20 )
+		 && ( byte_value != (uint8_t) '"' )
+		 && ( byte_value != (uint8_t) '\\' )
+		 && ( byte_value != 0x7f ) )
+		{
+			continue;
+		}
+		escaped_character[ 0 ] = (uint8_t) '\\';
+		escaped_character_size = 2;
+
+		switch( byte_value )
+		{
+			case (uint8_t) '"':
+			case (uint8_t) '\\':
+				escaped_character[ 1 ] = byte_value;
+				break;
+
+			case (uint8_t) '\b':
+				escaped_character[ 1 ] = (uint8_t) 'b';
+				break;
+
+			case (uint8_t) '\f':
+				escaped_character[ 1 ] = (uint8_t) 'f';
+				break;
+
+			case (uint8_t) '\n':
+				escaped_character[ 1 ] = (uint8_t) 'n';
+				break;
+
+			case (uint8_t) '\r':
+				escaped_character[ 1 ] = (uint8_t) 'r';
+				break;
+
+			case (uint8_t) '\t':
+				escaped_character[ 1 ] = (uint8_t) 't';
+				break;
+
+			default:
+				escaped_character[ 1 ] = (uint8_t) 'u';
+				escaped_character[ 2 ] = (uint8_t) '0';
+				escaped_character[ 3 ] = (uint8_t) '0';
+				escaped_character[ 4 ] = (uint8_t) hexadecimal_digits[ byte_value >> 4 ];
+				escaped_character[ 5 ] = (uint8_t) hexadecimal_digits[ byte_value & 0x0f ];
+
+				escaped_character_size = 6;
+
+				break;
+		}
+		if( string_index > segment_start )
+		{
+			if( output_writer_write_data(
+			     output_writer,
+			     &( utf8_string[ segment_start ] ),
+			     string_index - segment_start,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		if( output_writer_write_data(
+		     output_writer,
+		     escaped_character,
+		     escaped_character_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		segment_start = string_index + 1;
+	}
+	if( string_index > segment_start )
+	{
+		if( output_writer_write_data(
+		     output_writer,
+		     &( utf8_string[ segment_start ] ),
+		     string_index - segment_start,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( output_writer_write_data(
+	     output_writer,
+	     (uint8_t *) "\"",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write JSON string.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes a system string as a quoted and escaped JSON string
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_json_system_string(
+     output_writer_t *output_writer,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	uint8_t *utf8_string    = NULL;
+	size_t utf8_string_size = 0;
+	int result              = 0;
+#endif
+	static char *function   = "output_writer_write_json_system_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#if SIZEOF_WCHAR_T == 4
+	result = libuna_utf8_string_size_from_utf32(
+	          (libuna_utf32_character_t *) string,
+	          string_length,
+	          &utf8_string_size,
+	          error );
+#elif SIZEOF_WCHAR_T == 2
+	result = libuna_utf8_string_size_from_utf16(
+	          (libuna_utf16_character_t *) string,
+	          string_length,
+	          &utf8_string_size,
+	          error );
+#else
+#error Unsupported size of wchar_t
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	utf8_string = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+#if SIZEOF_WCHAR_T == 4
+	result = libuna_utf8_string_copy_from_utf32(
+	          utf8_string,
+	          utf8_string_size,
+	          (libuna_utf32_character_t *) string,
+	          string_length,
+	          error );
+#elif SIZEOF_WCHAR_T == 2
+	result = libuna_utf8_string_copy_from_utf16(
+	          utf8_string,
+	          utf8_string_size,
+	          (libuna_utf16_character_t *) string,
+	          string_length,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_json_string(
+	     output_writer,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf8_string );
+
+	return( 1 );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+#else
+	/* Narrow system strings are passed through as-is
+	 */
+	if( output_writer_write_json_string(
+	     output_writer,
+	     (uint8_t *) string,
+	     string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+}
+
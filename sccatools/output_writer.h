@@ -0,0 +1,137 @@
+/*
+ * Buffered output writer
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _OUTPUT_WRITER_H )
+#define _OUTPUT_WRITER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define OUTPUT_WRITER_DEFAULT_BUFFER_SIZE	65536
+
+typedef struct output_writer output_writer_t;
+
+struct output_writer
+{
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The buffer offset
+	 */
+	size_t buffer_offset;
+};
+
+int output_writer_initialize(
+     output_writer_t **output_writer,
+     FILE *stream,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int output_writer_free(
+     output_writer_t **output_writer,
+     libcerror_error_t **error );
+
+int output_writer_set_stream(
+     output_writer_t *output_writer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int output_writer_resize_buffer(
+     output_writer_t *output_writer,
+     size_t additional_size,
+     libcerror_error_t **error );
+
+int output_writer_reserve(
+     output_writer_t *output_writer,
+     size_t size,
+     libcerror_error_t **error );
+
+int output_writer_flush(
+     output_writer_t *output_writer,
+     libcerror_error_t **error );
+
+int output_writer_write_data(
+     output_writer_t *output_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int output_writer_write_string(
+     output_writer_t *output_writer,
+     const char *string,
+     libcerror_error_t **error );
+
+int output_writer_printf(
+     output_writer_t *output_writer,
+     const char *format,
+     ... );
+
+int output_writer_write_decimal_uint64(
+     output_writer_t *output_writer,
+     uint64_t value_64bit,
+     libcerror_error_t **error );
+
+int output_writer_write_hexadecimal_uint64(
+     output_writer_t *output_writer,
+     uint64_t value_64bit,
+     int number_of_digits,
+     libcerror_error_t **error );
+
+int output_writer_write_system_string(
+     output_writer_t *output_writer,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int output_writer_write_json_string(
+     output_writer_t *output_writer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int output_writer_write_json_system_string(
+     output_writer_t *output_writer,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _OUTPUT_WRITER_H ) */
+
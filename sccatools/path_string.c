@@ -41,15 +41,9 @@ int path_string_copy_from_file_entry_path(
      size_t file_entry_path_length,
      libcerror_error_t **error )
 {
-	system_character_t *safe_path                = NULL;
-	static char *function                        = "path_string_copy_from_file_entry_path";
-	libuna_unicode_character_t unicode_character = 0;
-	system_character_t escape_character          = 0;
-	size_t file_entry_path_index                 = 0;
-	size_t path_index                            = 0;
-	size_t safe_path_size                        = 0;
-	int print_count                              = 0;
-	int result                                   = 0;
+	system_character_t *safe_path = NULL;
+	static char *function         = "path_string_copy_from_file_entry_path";
+	size_t safe_path_size         = 0;
 
 	if( path == NULL )
 	{
@@ -73,17 +67,6 @@ int path_string_copy_from_file_entry_path(
 
 		return( -1 );
 	}
-	if( file_entry_path == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry path.",
-		 function );
-
-		return( -1 );
-	}
 	if( ( file_entry_path_length == 0 )
 	 || ( file_entry_path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
 	{
@@ -98,7 +81,7 @@ int path_string_copy_from_file_entry_path(
 	}
 	/* Note that there is a worst-case of a 1 to 10 ratio for each escaped character.
 	 */
-	if( file_entry_path_length > (size_t) ( ( SSIZE_MAX - 1 ) / ( sizeof( system_character_t ) * 10 ) ) )
+	if( file_entry_path_length > (size_t) ( ( SSIZE_MAX - 1 ) / ( sizeof( system_character_t ) * PATH_STRING_MAXIMUM_ESCAPED_CHARACTER_LENGTH ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -109,7 +92,7 @@ int path_string_copy_from_file_entry_path(
 
 		return( -1 );
 	}
-	safe_path_size = ( file_entry_path_length * 10 ) + 1;
+	safe_path_size = ( file_entry_path_length * PATH_STRING_MAXIMUM_ESCAPED_CHARACTER_LENGTH ) + 1;
 
 	safe_path = system_string_allocate(
 	             safe_path_size );
@@ -125,6 +108,104 @@ int path_string_copy_from_file_entry_path(
 
 		goto on_error;
 	}
+	if( path_string_copy_from_file_entry_path_to_buffer(
+	     safe_path,
+	     safe_path_size,
+	     file_entry_path,
+	     file_entry_path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy path from file entry path.",
+		 function );
+
+		goto on_error;
+	}
+	*path      = safe_path;
+	*path_size = safe_path_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_path != NULL )
+	{
+		memory_free(
+		 safe_path );
+	}
+	return( -1 );
+}
+
+/* Copies the path from a comparable file entry path into a buffer
+ * The path size should be at least PATH_STRING_MAXIMUM_ESCAPED_CHARACTER_LENGTH times
+ * the file entry path length, plus 1 for the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int path_string_copy_from_file_entry_path_to_buffer(
+     system_character_t *path,
+     size_t path_size,
+     const system_character_t *file_entry_path,
+     size_t file_entry_path_length,
+     libcerror_error_t **error )
+{
+	static char *function                        = "path_string_copy_from_file_entry_path_to_buffer";
+	libuna_unicode_character_t unicode_character = 0;
+	system_character_t escape_character          = 0;
+	size_t file_entry_path_index                 = 0;
+	size_t path_index                            = 0;
+	int print_count                              = 0;
+	int result                                   = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_entry_path_length == 0 )
+	 || ( file_entry_path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file entry path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Note that there is a worst-case of a 1 to 10 ratio for each escaped character.
+	 */
+	if( ( file_entry_path_length > (size_t) ( ( SSIZE_MAX - 1 ) / ( sizeof( system_character_t ) * PATH_STRING_MAXIMUM_ESCAPED_CHARACTER_LENGTH ) ) )
+	 || ( path_size < ( ( file_entry_path_length * PATH_STRING_MAXIMUM_ESCAPED_CHARACTER_LENGTH ) + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid path size value too small.",
+		 function );
+
+		return( -1 );
+	}
 	escape_character = (system_character_t) '\\';
 
 	/* Using UCS-2 or RFC 2279 UTF-8 to support unpaired UTF-16 surrogates
@@ -155,7 +236,7 @@ int path_string_copy_from_file_entry_path(
 			 "%s: unable to copy Unicode character from value string.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		/* Replace by \x##:
 		 *   Control characters ([U+0-U+1f, U+7f-U+9f])
@@ -165,8 +246,8 @@ int path_string_copy_from_file_entry_path(
 		  &&  ( unicode_character <= 0x9f ) ) )
 		{
 			print_count = system_string_sprintf(
-			               &( safe_path[ path_index ] ),
-			               safe_path_size - path_index,
+			               &( path[ path_index ] ),
+			               path_size - path_index,
 			               _SYSTEM_STRING( "%" PRIc_SYSTEM "x%02" PRIx32 "" ),
 			               escape_character,
 			               unicode_character );
@@ -180,7 +261,7 @@ int path_string_copy_from_file_entry_path(
 				 "%s: unable to copy escaped Unicode character to path.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			path_index += print_count;
 		}
@@ -211,8 +292,8 @@ int path_string_copy_from_file_entry_path(
 		      || ( unicode_character >= 0x0010fffdUL ) )
 		{
 			print_count = system_string_sprintf(
-			               &( safe_path[ path_index ] ),
-			               safe_path_size - path_index,
+			               &( path[ path_index ] ),
+			               path_size - path_index,
 			               _SYSTEM_STRING( "%" PRIc_SYSTEM "U%08" PRIx32 "" ),
 			               escape_character,
 			               unicode_character );
@@ -226,7 +307,7 @@ int path_string_copy_from_file_entry_path(
 				 "%s: unable to copy escaped Unicode character to path.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			path_index += print_count;
 		}
@@ -235,7 +316,7 @@ int path_string_copy_from_file_entry_path(
 		 */
 		else if( unicode_character == (libuna_unicode_character_t) escape_character )
 		{
-			if( ( path_index + 2 ) > safe_path_size )
+			if( ( path_index + 2 ) > path_size )
 			{
 				libcerror_error_set(
 				 error,
@@ -244,25 +325,25 @@ int path_string_copy_from_file_entry_path(
 				 "%s: invalid path index value out of bounds.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			safe_path[ path_index++ ] = escape_character;
-			safe_path[ path_index++ ] = (system_character_t) unicode_character;
+			path[ path_index++ ] = escape_character;
+			path[ path_index++ ] = (system_character_t) unicode_character;
 		}
 		else
 		{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 			result = libuna_unicode_character_copy_to_utf16(
 			          unicode_character,
-			          (libuna_utf16_character_t *) safe_path,
-			          safe_path_size,
+			          (libuna_utf16_character_t *) path,
+			          path_size,
 			          &path_index,
 			          error );
 #else
 			result = libuna_unicode_character_copy_to_utf8(
 			          unicode_character,
-			          (libuna_utf8_character_t *) safe_path,
-			          safe_path_size,
+			          (libuna_utf8_character_t *) path,
+			          path_size,
 			          &path_index,
 			          error );
 #endif
@@ -275,23 +356,12 @@ int path_string_copy_from_file_entry_path(
 				 "%s: unable to copy Unicode character to path.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 		}
 	}
-	safe_path[ path_index ] = 0;
-
-	*path      = safe_path;
-	*path_size = safe_path_size;
+	path[ path_index ] = 0;
 
 	return( 1 );
-
-on_error:
-	if( safe_path != NULL )
-	{
-		memory_free(
-		 safe_path );
-	}
-	return( -1 );
 }
 
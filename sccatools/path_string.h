@@ -31,6 +31,10 @@
 extern "C" {
 #endif
 
+/* The maximum number of characters an escaped character can take up
+ */
+#define PATH_STRING_MAXIMUM_ESCAPED_CHARACTER_LENGTH	10
+
 int path_string_copy_from_file_entry_path(
      system_character_t **path,
      size_t *path_size,
@@ -38,6 +42,13 @@ int path_string_copy_from_file_entry_path(
      size_t file_entry_path_length,
      libcerror_error_t **error );
 
+int path_string_copy_from_file_entry_path_to_buffer(
+     system_character_t *path,
+     size_t path_size,
+     const system_character_t *file_entry_path,
+     size_t file_entry_path_length,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,2396 @@
+/*
+ * Query handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#elif defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+
+#endif /* defined( WINAPI ) */
+
+#include "info_handle.h"
+#include "output_writer.h"
+#include "query_handle.h"
+#include "result_cache.h"
+#include "source_list.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libscca.h"
+
+/* The maximum supported size of a request member name, including the end-of-string character
+ */
+#define QUERY_HANDLE_MAXIMUM_MEMBER_NAME_SIZE	32
+
+/* Creates a query handle
+ * Make sure the value query_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int query_handle_initialize(
+     query_handle_t **query_handle,
+     int maximum_number_of_cache_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "query_handle_initialize";
+
+	if( query_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *query_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid query handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*query_handle = memory_allocate_structure(
+	                 query_handle_t );
+
+	if( *query_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create query handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *query_handle,
+	     0,
+	     sizeof( query_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear query handle.",
+		 function );
+
+		memory_free(
+		 *query_handle );
+
+		*query_handle = NULL;
+
+		return( -1 );
+	}
+	if( result_cache_initialize(
+	     &( ( *query_handle )->result_cache ),
+	     maximum_number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize result cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_list_initialize(
+	     &( ( *query_handle )->sources ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize sources.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_initialize(
+	     &( ( *query_handle )->info_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize info handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *query_handle )->info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_JSONL;
+
+	/* The description of a parsed file is kept in memory
+	 */
+	if( output_writer_set_stream(
+	     ( *query_handle )->info_handle->output_writer,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set output stream of info handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_initialize(
+	     &( ( *query_handle )->output_writer ),
+	     NULL,
+	     OUTPUT_WRITER_DEFAULT_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output writer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *query_handle != NULL )
+	{
+		if( ( *query_handle )->info_handle != NULL )
+		{
+			info_handle_free(
+			 &( ( *query_handle )->info_handle ),
+			 NULL );
+		}
+		if( ( *query_handle )->sources != NULL )
+		{
+			source_list_free(
+			 &( ( *query_handle )->sources ),
+			 NULL );
+		}
+		if( ( *query_handle )->result_cache != NULL )
+		{
+			result_cache_free(
+			 &( ( *query_handle )->result_cache ),
+			 NULL );
+		}
+		memory_free(
+		 *query_handle );
+
+		*query_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a query handle
+ * Returns 1 if successful or -1 on error
+ */
+int query_handle_free(
+     query_handle_t **query_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "query_handle_free";
+	int result            = 1;
+
+	if( query_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *query_handle != NULL )
+	{
+		if( output_writer_free(
+		     &( ( *query_handle )->output_writer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output writer.",
+			 function );
+
+			result = -1;
+		}
+		if( info_handle_free(
+		     &( ( *query_handle )->info_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free info handle.",
+			 function );
+
+			result = -1;
+		}
+		if( source_list_free(
+		     &( ( *query_handle )->sources ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sources.",
+			 function );
+
+			result = -1;
+		}
+		if( result_cache_free(
+		     &( ( *query_handle )->result_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free result cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *query_handle );
+
+		*query_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the query handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int query_handle_signal_abort(
+     query_handle_t *query_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "query_handle_signal_abort";
+
+	if( query_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query handle.",
+		 function );
+
+		return( -1 );
+	}
+	query_handle->abort = 1;
+
+	if( query_handle->info_handle != NULL )
+	{
+		if( info_handle_signal_abort(
+		     query_handle->info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal info handle to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a source that is queried
+ * A directory source is read again for every query so that new files are found
+ * Returns 1 if successful or -1 on error
+ */
+int query_handle_append_source(
+     query_handle_t *query_handle,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	static char *function = "query_handle_append_source";
+
+	if( query_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_list_append_source(
+	     query_handle->sources,
+	     source,
+	     system_string_length(
+	      source ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses a JSON string
+ * The data offset must point to the opening quote and is set to the first byte after the closing quote
+ * Escaped characters are converted to UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int query_handle_parse_json_string(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function        = "query_handle_parse_json_string";
+	size_t digit_index           = 0;
+	size_t safe_data_offset      = 0;
+	size_t string_index          = 0;
+	uint32_t code_point          = 0;
+	uint32_t escaped_value       = 0;
+	uint8_t byte_value           = 0;
+	int number_of_escaped_values = 0;
+	int value_index              = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	if( ( safe_data_offset >= data_size )
+	 || ( data[ safe_data_offset ] != (uint8_t) '"' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: missing opening quote.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset++;
+
+	while( safe_data_offset < data_size )
+	{
+		byte_value = data[ safe_data_offset++ ];
+
+		if( byte_value == (uint8_t) '"' )
+		{
+			utf8_string[ string_index ] = 0;
+
+			*data_offset        = safe_data_offset;
+			*utf8_string_length = string_index;
+
+			return( 1 );
+		}
+		if( byte_value < 0x20 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported control character in string.",
+			 function );
+
+			return( -1 );
+		}
+		code_point = byte_value;
+
+		if( byte_value == (uint8_t) '\\' )
+		{
+			if( safe_data_offset >= data_size )
+			{
+				break;
+			}
+			byte_value = data[ safe_data_offset++ ];
+
+			switch( byte_value )
+			{
+				case (uint8_t) '"':
+				case (uint8_t) '/':
+				case (uint8_t) '\\':
+					code_point = byte_value;
+					break;
+
+				case (uint8_t) 'b':
+					code_point = 0x08;
+					break;
+
+				case (uint8_t) 'f':
+					code_point = 0x0c;
+					break;
+
+				case (uint8_t) 'n':
+					code_point = 0x0a;
+					break;
+
+				case (uint8_t) 'r':
+					code_point = 0x0d;
+					break;
+
+				case (uint8_t) 't':
+					code_point = 0x09;
+					break;
+
+				case (uint8_t) 'u':
+					/* A high surrogate must be followed by an escaped low surrogate
+					 */
+					number_of_escaped_values = 1;
+
+					for( value_index = 0;
+					     value_index < number_of_escaped_values;
+					     value_index++ )
+					{
+						if( value_index > 0 )
+						{
+							if( ( ( data_size - safe_data_offset ) < 2 )
+							 || ( data[ safe_data_offset ] != (uint8_t) '\\' )
+							 || ( data[ safe_data_offset + 1 ] != (uint8_t) 'u' ) )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+								 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+								 "%s: missing low surrogate.",
+								 function );
+
+								return( -1 );
+							}
+							safe_data_offset += 2;
+						}
+						if( ( data_size - safe_data_offset ) < 4 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid escaped character value out of bounds.",
+							 function );
+
+							return( -1 );
+						}
+						escaped_value = 0;
+
+						for( digit_index = 0;
+						     digit_index < 4;
+						     digit_index++ )
+						{
+							byte_value = data[ safe_data_offset++ ];
+
+							escaped_value <<= 4;
+
+							if( ( byte_value >= (uint8_t) '0' )
+							 && ( byte_value <= (uint8_t) '9' ) )
+							{
+								escaped_value |= (uint32_t) ( byte_value - (uint8_t) '0' );
+							}
+							else if( ( byte_value >= (uint8_t) 'a' )
+							      && ( byte_value <= (uint8_t) 'f' ) )
+							{
+								escaped_value |= (uint32_t) ( byte_value - (uint8_t) 'a' + 10 );
+							}
+							else if( ( byte_value >= (uint8_t) 'A' )
+							      && ( byte_value <= (uint8_t) 'F' ) )
+							{
+								escaped_value |= (uint32_t) ( byte_value - (uint8_t) 'A' + 10 );
+							}
+							else
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+								 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+								 "%s: unsupported escaped character.",
+								 function );
+
+								return( -1 );
+							}
+						}
+						if( value_index == 0 )
+						{
+							code_point = escaped_value;
+
+							if( ( code_point >= 0xd800UL )
+							 && ( code_point <= 0xdbffUL ) )
+							{
+								number_of_escaped_values = 2;
+							}
+							else if( ( code_point >= 0xdc00UL )
+							      && ( code_point <= 0xdfffUL ) )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+								 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+								 "%s: unsupported low surrogate without high surrogate.",
+								 function );
+
+								return( -1 );
+							}
+						}
+						else
+						{
+							if( ( escaped_value < 0xdc00UL )
+							 || ( escaped_value > 0xdfffUL ) )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+								 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+								 "%s: unsupported low surrogate.",
+								 function );
+
+								return( -1 );
+							}
+							code_point = 0x10000UL + ( ( code_point - 0xd800UL ) << 10 ) + ( escaped_value - 0xdc00UL );
+						}
+					}
+					break;
+
+				default:
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported escaped character.",
+					 function );
+
+					return( -1 );
+			}
+		}
+		else if( byte_value >= 0x80 )
+		{
+			/* Non-ASCII bytes are copied as-is and are expected to be UTF-8
+			 */
+			if( ( string_index + 1 ) >= utf8_string_size )
+			{
+				break;
+			}
+			utf8_string[ string_index++ ] = byte_value;
+
+			continue;
+		}
+		if( code_point < 0x80 )
+		{
+			if( ( string_index + 1 ) >= utf8_string_size )
+			{
+				break;
+			}
+			utf8_string[ string_index++ ] = (uint8_t) code_point;
+		}
+		else if( code_point < 0x800 )
+		{
+			if( ( string_index + 2 ) >= utf8_string_size )
+			{
+				break;
+			}
+			utf8_string[ string_index++ ] = (uint8_t) ( 0xc0 | ( code_point >> 6 ) );
+			utf8_string[ string_index++ ] = (uint8_t) ( 0x80 | ( code_point & 0x3f ) );
+		}
+		else if( code_point < 0x10000UL )
+		{
+			if( ( string_index + 3 ) >= utf8_string_size )
+			{
+				break;
+			}
+			utf8_string[ string_index++ ] = (uint8_t) ( 0xe0 | ( code_point >> 12 ) );
+			utf8_string[ string_index++ ] = (uint8_t) ( 0x80 | ( ( code_point >> 6 ) & 0x3f ) );
+			utf8_string[ string_index++ ] = (uint8_t) ( 0x80 | ( code_point & 0x3f ) );
+		}
+		else
+		{
+			if( ( string_index + 4 ) >= utf8_string_size )
+			{
+				break;
+			}
+			utf8_string[ string_index++ ] = (uint8_t) ( 0xf0 | ( code_point >> 18 ) );
+			utf8_string[ string_index++ ] = (uint8_t) ( 0x80 | ( ( code_point >> 12 ) & 0x3f ) );
+			utf8_string[ string_index++ ] = (uint8_t) ( 0x80 | ( ( code_point >> 6 ) & 0x3f ) );
+			utf8_string[ string_index++ ] = (uint8_t) ( 0x80 | ( code_point & 0x3f ) );
+		}
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid string value out of bounds.",
+	 function );
+
+	return( -1 );
+}
+
+/* Parses a request
+ * A request is a JSON object with a single member, either:
+ * {"executable":"name"}, {"filename":"substring"}, {"file_reference":number} or {"stats":true}
+ * Returns 1 if successful or -1 on error
+ */
+int query_handle_parse_request(
+     query_handle_t *query_handle,
+     const uint8_t *request,
+     size_t request_size,
+     libcerror_error_t **error )
+{
+	uint8_t member_name[ QUERY_HANDLE_MAXIMUM_MEMBER_NAME_SIZE ];
+
+	static char *function     = "query_handle_parse_request";
+	size_t member_name_length = 0;
+	size_t request_offset     = 0;
+	uint64_t file_reference   = 0;
+	uint8_t byte_value        = 0;
+	int number_of_digits      = 0;
+
+	if( query_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request.",
+		 function );
+
+		return( -1 );
+	}
+	if( request_size > (size_t) QUERY_HANDLE_MAXIMUM_REQUEST_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid request size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	query_handle->query_type           = QUERY_HANDLE_QUERY_TYPE_UNDEFINED;
+	query_handle->query_value[ 0 ]     = 0;
+	query_handle->query_value_length   = 0;
+	query_handle->query_file_reference = 0;
+
+	while( ( request_offset < request_size )
+	    && ( ( request[ request_offset ] == (uint8_t) ' ' )
+	     ||  ( request[ request_offset ] == (uint8_t) '\t' ) ) )
+	{
+		request_offset++;
+	}
+	if( ( request_offset >= request_size )
+	 || ( request[ request_offset ] != (uint8_t) '{' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported request - missing object.",
+		 function );
+
+		return( -1 );
+	}
+	request_offset++;
+
+	while( ( request_offset < request_size )
+	    && ( ( request[ request_offset ] == (uint8_t) ' ' )
+	     ||  ( request[ request_offset ] == (uint8_t) '\t' ) ) )
+	{
+		request_offset++;
+	}
+	if( query_handle_parse_json_string(
+	     request,
+	     request_size,
+	     &request_offset,
+	     member_name,
+	     QUERY_HANDLE_MAXIMUM_MEMBER_NAME_SIZE,
+	     &member_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse member name.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( request_offset < request_size )
+	    && ( ( request[ request_offset ] == (uint8_t) ' ' )
+	     ||  ( request[ request_offset ] == (uint8_t) '\t' ) ) )
+	{
+		request_offset++;
+	}
+	if( ( request_offset >= request_size )
+	 || ( request[ request_offset ] != (uint8_t) ':' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported request - missing member value.",
+		 function );
+
+		return( -1 );
+	}
+	request_offset++;
+
+	while( ( request_offset < request_size )
+	    && ( ( request[ request_offset ] == (uint8_t) ' ' )
+	     ||  ( request[ request_offset ] == (uint8_t) '\t' ) ) )
+	{
+		request_offset++;
+	}
+	if( ( ( member_name_length == 10 )
+	  &&  ( narrow_string_compare(
+	         (char *) member_name,
+	         "executable",
+	         10 ) == 0 ) )
+	 || ( ( member_name_length == 8 )
+	  &&  ( narrow_string_compare(
+	         (char *) member_name,
+	         "filename",
+	         8 ) == 0 ) ) )
+	{
+		if( query_handle_parse_json_string(
+		     request,
+		     request_size,
+		     &request_offset,
+		     query_handle->query_value,
+		     QUERY_HANDLE_MAXIMUM_VALUE_SIZE,
+		     &( query_handle->query_value_length ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to parse member value.",
+			 function );
+
+			return( -1 );
+		}
+		if( query_handle->query_value_length == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported request - empty member value.",
+			 function );
+
+			return( -1 );
+		}
+		if( member_name[ 0 ] == (uint8_t) 'e' )
+		{
+			query_handle->query_type = QUERY_HANDLE_QUERY_TYPE_EXECUTABLE;
+		}
+		else
+		{
+			query_handle->query_type = QUERY_HANDLE_QUERY_TYPE_FILENAME;
+		}
+	}
+	else if( ( member_name_length == 14 )
+	      && ( narrow_string_compare(
+	            (char *) member_name,
+	            "file_reference",
+	            14 ) == 0 ) )
+	{
+		while( request_offset < request_size )
+		{
+			byte_value = request[ request_offset ];
+
+			if( ( byte_value < (uint8_t) '0' )
+			 || ( byte_value > (uint8_t) '9' ) )
+			{
+				break;
+			}
+			if( file_reference > ( ( 0xffffffffffffffffULL - (uint64_t) ( byte_value - (uint8_t) '0' ) ) / 10 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid file reference value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			file_reference *= 10;
+			file_reference += byte_value - (uint8_t) '0';
+
+			number_of_digits++;
+			request_offset++;
+		}
+		if( number_of_digits == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported request - file reference is not a number.",
+			 function );
+
+			return( -1 );
+		}
+		query_handle->query_type           = QUERY_HANDLE_QUERY_TYPE_FILE_REFERENCE;
+		query_handle->query_file_reference = file_reference;
+	}
+	else if( ( member_name_length == 5 )
+	      && ( narrow_string_compare(
+	            (char *) member_name,
+	            "stats",
+	            5 ) == 0 ) )
+	{
+		if( ( ( request_size - request_offset ) < 4 )
+		 || ( narrow_string_compare(
+		       (char *) &( request[ request_offset ] ),
+		       "true",
+		       4 ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported request - stats value is not true.",
+			 function );
+
+			return( -1 );
+		}
+		request_offset += 4;
+
+		query_handle->query_type = QUERY_HANDLE_QUERY_TYPE_STATISTICS;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported request member: %s.",
+		 function,
+		 (char *) member_name );
+
+		return( -1 );
+	}
+	while( ( request_offset < request_size )
+	    && ( ( request[ request_offset ] == (uint8_t) ' ' )
+	     ||  ( request[ request_offset ] == (uint8_t) '\t' ) ) )
+	{
+		request_offset++;
+	}
+	if( ( request_offset >= request_size )
+	 || ( request[ request_offset ] != (uint8_t) '}' ) )
+	{
+		query_handle->query_type = QUERY_HANDLE_QUERY_TYPE_UNDEFINED;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported request - only a single member is supported.",
+		 function );
+
+		return( -1 );
+	}
+	request_offset++;
+
+	while( ( request_offset < request_size )
+	    && ( ( request[ request_offset ] == (uint8_t) ' ' )
+	     ||  ( request[ request_offset ] == (uint8_t) '\t' ) ) )
+	{
+		request_offset++;
+	}
+	if( request_offset != request_size )
+	{
+		query_handle->query_type = QUERY_HANDLE_QUERY_TYPE_UNDEFINED;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported trailing data in request.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if an entry matches the query
+ * The executable and filename are compared case-insensitive for the ASCII characters
+ * A file reference without a sequence number matches any sequence number of the MFT entry
+ * Returns 1 if the entry matches, 0 if not or -1 on error
+ */
+int query_handle_entry_matches(
+     query_handle_t *query_handle,
+     result_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function    = "query_handle_entry_matches";
+	size_t filename_length   = 0;
+	size_t filename_offset   = 0;
+	size_t string_index      = 0;
+	size_t substring_index   = 0;
+	uint64_t file_reference  = 0;
+	uint8_t first_byte       = 0;
+	uint8_t second_byte      = 0;
+	int file_reference_index = 0;
+
+	if( query_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	switch( query_handle->query_type )
+	{
+		case QUERY_HANDLE_QUERY_TYPE_EXECUTABLE:
+			if( ( entry->executable_filename == NULL )
+			 || ( entry->executable_filename_size != ( query_handle->query_value_length + 1 ) ) )
+			{
+				return( 0 );
+			}
+			for( string_index = 0;
+			     string_index < query_handle->query_value_length;
+			     string_index++ )
+			{
+				first_byte  = entry->executable_filename[ string_index ];
+				second_byte = query_handle->query_value[ string_index ];
+
+				if( ( first_byte >= (uint8_t) 'a' )
+				 && ( first_byte <= (uint8_t) 'z' ) )
+				{
+					first_byte -= (uint8_t) 'a' - (uint8_t) 'A';
+				}
+				if( ( second_byte >= (uint8_t) 'a' )
+				 && ( second_byte <= (uint8_t) 'z' ) )
+				{
+					second_byte -= (uint8_t) 'a' - (uint8_t) 'A';
+				}
+				if( first_byte != second_byte )
+				{
+					return( 0 );
+				}
+			}
+			return( 1 );
+
+		case QUERY_HANDLE_QUERY_TYPE_FILENAME:
+			if( entry->filenames == NULL )
+			{
+				return( 0 );
+			}
+			filename_offset = 0;
+
+			while( filename_offset < entry->filenames_size )
+			{
+				for( filename_length = 0;
+				     ( filename_offset + filename_length ) < entry->filenames_size;
+				     filename_length++ )
+				{
+					if( entry->filenames[ filename_offset + filename_length ] == 0 )
+					{
+						break;
+					}
+				}
+				for( string_index = 0;
+				     ( string_index + query_handle->query_value_length ) <= filename_length;
+				     string_index++ )
+				{
+					for( substring_index = 0;
+					     substring_index < query_handle->query_value_length;
+					     substring_index++ )
+					{
+						first_byte  = entry->filenames[ filename_offset + string_index + substring_index ];
+						second_byte = query_handle->query_value[ substring_index ];
+
+						if( ( first_byte >= (uint8_t) 'a' )
+						 && ( first_byte <= (uint8_t) 'z' ) )
+						{
+							first_byte -= (uint8_t) 'a' - (uint8_t) 'A';
+						}
+						if( ( second_byte >= (uint8_t) 'a' )
+						 && ( second_byte <= (uint8_t) 'z' ) )
+						{
+							second_byte -= (uint8_t) 'a' - (uint8_t) 'A';
+						}
+						if( first_byte != second_byte )
+						{
+							break;
+						}
+					}
+					if( substring_index == query_handle->query_value_length )
+					{
+						return( 1 );
+					}
+				}
+				filename_offset += filename_length + 1;
+			}
+			return( 0 );
+
+		case QUERY_HANDLE_QUERY_TYPE_FILE_REFERENCE:
+			for( file_reference_index = 0;
+			     file_reference_index < entry->number_of_file_references;
+			     file_reference_index++ )
+			{
+				file_reference = entry->file_references[ file_reference_index ];
+
+				if( ( query_handle->query_file_reference >> 48 ) == 0 )
+				{
+					file_reference &= 0x0000ffffffffffffULL;
+				}
+				if( file_reference == query_handle->query_file_reference )
+				{
+					return( 1 );
+				}
+			}
+			return( 0 );
+
+		default:
+			break;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unsupported query type.",
+	 function );
+
+	return( -1 );
+}
+
+/* Retrieves the size and modification time of a file
+ * Returns 1 if successful, 0 if the path is not a regular file or -1 on error
+ */
+int query_handle_get_file_status(
+     const system_character_t *path,
+     uint64_t *file_size,
+     int64_t *modification_time,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	WIN32_FILE_ATTRIBUTE_DATA file_attribute_data;
+#elif defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	struct stat file_status;
+#endif
+
+	static char *function = "query_handle_get_file_status";
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( modification_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modification time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( GetFileAttributesExW(
+	     path,
+	     GetFileExInfoStandard,
+	     &file_attribute_data ) == 0 )
+#else
+	if( GetFileAttributesExA(
+	     path,
+	     GetFileExInfoStandard,
+	     &file_attribute_data ) == 0 )
+#endif
+	{
+		return( 0 );
+	}
+	if( ( file_attribute_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 )
+	{
+		return( 0 );
+	}
+	*file_size         = ( (uint64_t) file_attribute_data.nFileSizeHigh << 32 ) | file_attribute_data.nFileSizeLow;
+	*modification_time = (int64_t) ( ( (uint64_t) file_attribute_data.ftLastWriteTime.dwHighDateTime << 32 ) | file_attribute_data.ftLastWriteTime.dwLowDateTime );
+
+#elif defined( HAVE_WIDE_SYSTEM_CHARACTER ) || !defined( HAVE_SYS_STAT_H )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: file status not supported.",
+	 function );
+
+	return( -1 );
+#else
+	if( stat(
+	     path,
+	     &file_status ) != 0 )
+	{
+		return( 0 );
+	}
+	if( !S_ISREG( file_status.st_mode ) )
+	{
+		return( 0 );
+	}
+	*file_size         = (uint64_t) file_status.st_size;
+	*modification_time = (int64_t) file_status.st_mtime;
+
+#endif /* defined( WINAPI ) */
+
+	return( 1 );
+}
+
+/* Reads the values of an entry from the file it describes
+ * Returns 1 if successful or -1 on error
+ */
+int query_handle_read_entry(
+     query_handle_t *query_handle,
+     result_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	libscca_file_metrics_t *file_metrics = NULL;
+	output_writer_t *output_writer       = NULL;
+	uint8_t *filenames                   = NULL;
+	void *reallocation                   = NULL;
+	static char *function                = "query_handle_read_entry";
+	size_t filenames_size                = 0;
+	size_t record_offset                 = 0;
+	size_t utf8_string_size              = 0;
+	uint64_t file_reference              = 0;
+	int filename_index                   = 0;
+	int input_is_open                    = 0;
+	int metrics_index                    = 0;
+	int number_of_filenames              = 0;
+	int number_of_metrics_entries        = 0;
+	int result                           = 0;
+
+	if( query_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry->executable_filename != NULL )
+	 || ( entry->filenames != NULL )
+	 || ( entry->file_references != NULL )
+	 || ( entry->record != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entry - values already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_open_input(
+	     query_handle->info_handle,
+	     entry->path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 entry->path );
+
+		goto on_error;
+	}
+	input_is_open = 1;
+
+	if( libscca_file_get_utf8_executable_filename_size(
+	     query_handle->info_handle->input_file,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable filename size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid executable filename size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	entry->executable_filename = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * utf8_string_size );
+
+	if( entry->executable_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create executable filename.",
+		 function );
+
+		goto on_error;
+	}
+	entry->executable_filename_size = utf8_string_size;
+
+	if( libscca_file_get_utf8_executable_filename(
+	     query_handle->info_handle->input_file,
+	     entry->executable_filename,
+	     entry->executable_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_number_of_filenames(
+	     query_handle->info_handle->input_file,
+	     &number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		goto on_error;
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		if( libscca_file_get_utf8_filename_size(
+		     query_handle->info_handle->input_file,
+		     filename_index,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d size.",
+			 function,
+			 filename_index );
+
+			goto on_error;
+		}
+		if( ( utf8_string_size == 0 )
+		 || ( utf8_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - filenames_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filename: %d size value out of bounds.",
+			 function,
+			 filename_index );
+
+			goto on_error;
+		}
+		reallocation = memory_reallocate(
+		                filenames,
+		                sizeof( uint8_t ) * ( filenames_size + utf8_string_size ) );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize filenames.",
+			 function );
+
+			goto on_error;
+		}
+		filenames = (uint8_t *) reallocation;
+
+		if( libscca_file_get_utf8_filename(
+		     query_handle->info_handle->input_file,
+		     filename_index,
+		     &( filenames[ filenames_size ] ),
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d.",
+			 function,
+			 filename_index );
+
+			goto on_error;
+		}
+		filenames_size += utf8_string_size;
+	}
+	entry->filenames      = filenames;
+	entry->filenames_size = filenames_size;
+
+	filenames = NULL;
+
+	if( libscca_file_get_number_of_file_metrics_entries(
+	     query_handle->info_handle->input_file,
+	     &number_of_metrics_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_metrics_entries > 0 )
+	{
+		if( (size_t) number_of_metrics_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of file metrics entries value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		entry->file_references = (uint64_t *) memory_allocate(
+		                                       sizeof( uint64_t ) * number_of_metrics_entries );
+
+		if( entry->file_references == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file references.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( metrics_index = 0;
+	     metrics_index < number_of_metrics_entries;
+	     metrics_index++ )
+	{
+		if( libscca_file_get_file_metrics_entry(
+		     query_handle->info_handle->input_file,
+		     metrics_index,
+		     &file_metrics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry: %d.",
+			 function,
+			 metrics_index );
+
+			goto on_error;
+		}
+		result = libscca_file_metrics_get_file_reference(
+		          file_metrics,
+		          &file_reference,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry: %d file reference.",
+			 function,
+			 metrics_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			entry->file_references[ entry->number_of_file_references++ ] = file_reference;
+		}
+		if( libscca_file_metrics_free(
+		     &file_metrics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file metrics entry: %d.",
+			 function,
+			 metrics_index );
+
+			goto on_error;
+		}
+	}
+	/* The record is the JSON object of the info handle extended with the source as its first member
+	 */
+	output_writer = query_handle->info_handle->output_writer;
+
+	output_writer->buffer_offset = 0;
+
+	if( output_writer_write_string(
+	     output_writer,
+	     "{\"source\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_json_system_string(
+	     output_writer,
+	     entry->path,
+	     entry->path_length,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	record_offset = output_writer->buffer_offset;
+
+	if( info_handle_file_jsonl_fprint(
+	     query_handle->info_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to describe file.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( ( output_writer->buffer_offset - record_offset ) < 3 )
+	 || ( output_writer->buffer[ record_offset ] != (uint8_t) '{' )
+	 || ( output_writer->buffer[ output_writer->buffer_offset - 1 ] != (uint8_t) '\n' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file description.",
+		 function );
+
+		goto on_error;
+	}
+	output_writer->buffer_offset -= 1;
+
+	if( output_writer->buffer[ record_offset + 1 ] == (uint8_t) '}' )
+	{
+		output_writer->buffer[ record_offset ] = (uint8_t) '}';
+
+		output_writer->buffer_offset = record_offset + 1;
+	}
+	else
+	{
+		output_writer->buffer[ record_offset ] = (uint8_t) ',';
+	}
+	entry->record = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * output_writer->buffer_offset );
+
+	if( entry->record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     entry->record,
+	     output_writer->buffer,
+	     output_writer->buffer_offset ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy record.",
+		 function );
+
+		goto on_error;
+	}
+	entry->record_size = output_writer->buffer_offset;
+
+	output_writer->buffer_offset = 0;
+
+	input_is_open = 0;
+
+	if( info_handle_close_input(
+	     query_handle->info_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close: %" PRIs_SYSTEM ".",
+		 function,
+		 entry->path );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write record.",
+	 function );
+
+on_error:
+	if( output_writer != NULL )
+	{
+		output_writer->buffer_offset = 0;
+	}
+	if( file_metrics != NULL )
+	{
+		libscca_file_metrics_free(
+		 &file_metrics,
+		 NULL );
+	}
+	if( input_is_open != 0 )
+	{
+		info_handle_close_input(
+		 query_handle->info_handle,
+		 NULL );
+	}
+	if( filenames != NULL )
+	{
+		memory_free(
+		 filenames );
+	}
+	if( entry->executable_filename != NULL )
+	{
+		memory_free(
+		 entry->executable_filename );
+
+		entry->executable_filename = NULL;
+	}
+	entry->executable_filename_size = 0;
+
+	if( entry->filenames != NULL )
+	{
+		memory_free(
+		 entry->filenames );
+
+		entry->filenames = NULL;
+	}
+	entry->filenames_size = 0;
+
+	if( entry->file_references != NULL )
+	{
+		memory_free(
+		 entry->file_references );
+
+		entry->file_references = NULL;
+	}
+	entry->number_of_file_references = 0;
+
+	if( entry->record != NULL )
+	{
+		memory_free(
+		 entry->record );
+
+		entry->record = NULL;
+	}
+	entry->record_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the entry of a specific path from the cache
+ * A file that is not in the cache or that changed since it was cached is read and cached
+ * Returns 1 if successful, 0 if the path could not be read or -1 on error
+ */
+int query_handle_get_entry(
+     query_handle_t *query_handle,
+     const system_character_t *path,
+     result_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error   = NULL;
+	result_cache_entry_t *new_entry = NULL;
+	static char *function           = "query_handle_get_entry";
+	size_t path_length              = 0;
+	uint64_t file_size              = 0;
+	int64_t modification_time       = 0;
+	int result                      = 0;
+
+	if( query_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = query_handle_get_file_status(
+	          path,
+	          &file_size,
+	          &modification_time,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file status.",
+			 function );
+		}
+		return( result );
+	}
+	path_length = system_string_length(
+	               path );
+
+	result = result_cache_get_entry(
+	          query_handle->result_cache,
+	          path,
+	          path_length,
+	          file_size,
+	          modification_time,
+	          entry,
+	          error );
+
+	if( result != 0 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry from cache.",
+			 function );
+		}
+		return( result );
+	}
+	if( result_cache_entry_initialize(
+	     &new_entry,
+	     path,
+	     path_length,
+	     file_size,
+	     modification_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	/* A file that cannot be read is skipped and not cached so that it is read again once it changed
+	 */
+	if( query_handle_read_entry(
+	     query_handle,
+	     new_entry,
+	     &read_error ) != 1 )
+	{
+		libcnotify_print_error_backtrace(
+		 read_error );
+		libcerror_error_free(
+		 &read_error );
+
+		result_cache_entry_free(
+		 &new_entry,
+		 NULL );
+
+		return( 0 );
+	}
+	if( result_cache_insert_entry(
+	     query_handle->result_cache,
+	     new_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert entry into cache.",
+		 function );
+
+		goto on_error;
+	}
+	*entry = new_entry;
+
+	return( 1 );
+
+on_error:
+	if( new_entry != NULL )
+	{
+		result_cache_entry_free(
+		 &new_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the statistics of the result cache as a JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int query_handle_statistics_fprint(
+     query_handle_t *query_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "query_handle_statistics_fprint";
+
+	if( query_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_string(
+	     query_handle->output_writer,
+	     "{\"entries\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_decimal_uint64(
+	     query_handle->output_writer,
+	     (uint64_t) query_handle->result_cache->number_of_entries,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_string(
+	     query_handle->output_writer,
+	     ",\"maximum_entries\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_decimal_uint64(
+	     query_handle->output_writer,
+	     (uint64_t) query_handle->result_cache->maximum_number_of_entries,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_string(
+	     query_handle->output_writer,
+	     ",\"hits\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_decimal_uint64(
+	     query_handle->output_writer,
+	     query_handle->result_cache->number_of_hits,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_string(
+	     query_handle->output_writer,
+	     ",\"misses\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_decimal_uint64(
+	     query_handle->output_writer,
+	     query_handle->result_cache->number_of_misses,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_string(
+	     query_handle->output_writer,
+	     ",\"evictions\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_decimal_uint64(
+	     query_handle->output_writer,
+	     query_handle->result_cache->number_of_evictions,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_string(
+	     query_handle->output_writer,
+	     "}\n",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write statistics.",
+	 function );
+
+	return( -1 );
+}
+
+/* Prints a request error as a JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int query_handle_error_fprint(
+     query_handle_t *query_handle,
+     libcerror_error_t *request_error,
+     libcerror_error_t **error )
+{
+	char error_string[ 512 ];
+
+	static char *function = "query_handle_error_fprint";
+
+	if( query_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the first (innermost) error describes what is wrong with the request
+	 */
+	if( ( request_error == NULL )
+	 || ( libcerror_error_sprint(
+	       request_error,
+	       error_string,
+	       512 ) == -1 ) )
+	{
+		error_string[ 0 ] = 0;
+	}
+	if( output_writer_write_string(
+	     query_handle->output_writer,
+	     "{\"error\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_json_string(
+	     query_handle->output_writer,
+	     (uint8_t *) error_string,
+	     narrow_string_length(
+	      error_string ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_string(
+	     query_handle->output_writer,
+	     "}\n",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write error.",
+	 function );
+
+	return( -1 );
+}
+
+/* Processes a request and writes the response to the output writer
+ * The response is a single line that contains a JSON object
+ * An invalid request is answered with an error object and is not considered a failure
+ * Returns 1 if successful or -1 on error
+ */
+int query_handle_process_request(
+     query_handle_t *query_handle,
+     const uint8_t *request,
+     size_t request_size,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *request_error = NULL;
+	result_cache_entry_t *entry      = NULL;
+	source_list_t *source_list       = NULL;
+	static char *function            = "query_handle_process_request";
+	uint64_t number_of_failures      = 0;
+	uint64_t number_of_hits          = 0;
+	uint64_t number_of_misses        = 0;
+	int number_of_matches            = 0;
+	int result                       = 0;
+	int source_index                 = 0;
+
+	if( query_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( query_handle_parse_request(
+	     query_handle,
+	     request,
+	     request_size,
+	     &request_error ) != 1 )
+	{
+		result = query_handle_error_fprint(
+		          query_handle,
+		          request_error,
+		          error );
+
+		libcerror_error_free(
+		 &request_error );
+
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( query_handle->query_type == QUERY_HANDLE_QUERY_TYPE_STATISTICS )
+	{
+		if( query_handle_statistics_fprint(
+		     query_handle,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		return( 1 );
+	}
+	/* The sources are expanded for every request so that added and removed files are noticed
+	 */
+	if( source_list_initialize(
+	     &source_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize source list.",
+		 function );
+
+		goto on_error;
+	}
+	for( source_index = 0;
+	     source_index < query_handle->sources->number_of_sources;
+	     source_index++ )
+	{
+		if( source_list_append_path(
+		     source_list,
+		     query_handle->sources->sources[ source_index ],
+		     &request_error ) == -1 )
+		{
+			libcnotify_print_error_backtrace(
+			 request_error );
+			libcerror_error_free(
+			 &request_error );
+
+			number_of_failures++;
+		}
+	}
+	number_of_hits   = query_handle->result_cache->number_of_hits;
+	number_of_misses = query_handle->result_cache->number_of_misses;
+
+	if( output_writer_write_string(
+	     query_handle->output_writer,
+	     "{\"matches\":[",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	for( source_index = 0;
+	     source_index < source_list->number_of_sources;
+	     source_index++ )
+	{
+		if( query_handle->abort != 0 )
+		{
+			break;
+		}
+		result = query_handle_get_entry(
+		          query_handle,
+		          source_list->sources[ source_index ],
+		          &entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %" PRIs_SYSTEM ".",
+			 function,
+			 source_list->sources[ source_index ] );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			number_of_failures++;
+
+			continue;
+		}
+		result = query_handle_entry_matches(
+		          query_handle,
+		          entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if entry matches.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( number_of_matches > 0 )
+			{
+				if( output_writer_write_data(
+				     query_handle->output_writer,
+				     (uint8_t *) ",",
+				     1,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+			}
+			if( output_writer_write_data(
+			     query_handle->output_writer,
+			     entry->record,
+			     entry->record_size,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			number_of_matches++;
+		}
+	}
+	if( output_writer_write_string(
+	     query_handle->output_writer,
+	     "],\"hits\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_decimal_uint64(
+	     query_handle->output_writer,
+	     query_handle->result_cache->number_of_hits - number_of_hits,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_string(
+	     query_handle->output_writer,
+	     ",\"misses\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_decimal_uint64(
+	     query_handle->output_writer,
+	     query_handle->result_cache->number_of_misses - number_of_misses,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_string(
+	     query_handle->output_writer,
+	     ",\"failures\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_decimal_uint64(
+	     query_handle->output_writer,
+	     number_of_failures,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_string(
+	     query_handle->output_writer,
+	     "}\n",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( source_list_free(
+	     &source_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free source list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write response.",
+	 function );
+
+on_error:
+	if( source_list != NULL )
+	{
+		source_list_free(
+		 &source_list,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,171 @@
+/*
+ * Query handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _QUERY_HANDLE_H )
+#define _QUERY_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "info_handle.h"
+#include "output_writer.h"
+#include "result_cache.h"
+#include "source_list.h"
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum supported request size
+ */
+#define QUERY_HANDLE_MAXIMUM_REQUEST_SIZE	65536
+
+/* The maximum supported query value size, including the end-of-string character
+ */
+#define QUERY_HANDLE_MAXIMUM_VALUE_SIZE		4096
+
+enum QUERY_HANDLE_QUERY_TYPES
+{
+	QUERY_HANDLE_QUERY_TYPE_UNDEFINED	= 0,
+	QUERY_HANDLE_QUERY_TYPE_EXECUTABLE	= (int) 'e',
+	QUERY_HANDLE_QUERY_TYPE_FILENAME	= (int) 'f',
+	QUERY_HANDLE_QUERY_TYPE_FILE_REFERENCE	= (int) 'r',
+	QUERY_HANDLE_QUERY_TYPE_STATISTICS	= (int) 's'
+};
+
+typedef struct query_handle query_handle_t;
+
+struct query_handle
+{
+	/* The info handle, used to describe a parsed file
+	 */
+	info_handle_t *info_handle;
+
+	/* The result cache
+	 */
+	result_cache_t *result_cache;
+
+	/* The sources that are queried
+	 */
+	source_list_t *sources;
+
+	/* The output writer of the response
+	 */
+	output_writer_t *output_writer;
+
+	/* The query type
+	 */
+	int query_type;
+
+	/* The UTF-8 query value
+	 */
+	uint8_t query_value[ QUERY_HANDLE_MAXIMUM_VALUE_SIZE ];
+
+	/* The UTF-8 query value length
+	 */
+	size_t query_value_length;
+
+	/* The query file reference
+	 */
+	uint64_t query_file_reference;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int query_handle_initialize(
+     query_handle_t **query_handle,
+     int maximum_number_of_cache_entries,
+     libcerror_error_t **error );
+
+int query_handle_free(
+     query_handle_t **query_handle,
+     libcerror_error_t **error );
+
+int query_handle_signal_abort(
+     query_handle_t *query_handle,
+     libcerror_error_t **error );
+
+int query_handle_append_source(
+     query_handle_t *query_handle,
+     const system_character_t *source,
+     libcerror_error_t **error );
+
+int query_handle_parse_json_string(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+int query_handle_parse_request(
+     query_handle_t *query_handle,
+     const uint8_t *request,
+     size_t request_size,
+     libcerror_error_t **error );
+
+int query_handle_entry_matches(
+     query_handle_t *query_handle,
+     result_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int query_handle_get_file_status(
+     const system_character_t *path,
+     uint64_t *file_size,
+     int64_t *modification_time,
+     libcerror_error_t **error );
+
+int query_handle_read_entry(
+     query_handle_t *query_handle,
+     result_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int query_handle_get_entry(
+     query_handle_t *query_handle,
+     const system_character_t *path,
+     result_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int query_handle_statistics_fprint(
+     query_handle_t *query_handle,
+     libcerror_error_t **error );
+
+int query_handle_error_fprint(
+     query_handle_t *query_handle,
+     libcerror_error_t *request_error,
+     libcerror_error_t **error );
+
+int query_handle_process_request(
+     query_handle_t *query_handle,
+     const uint8_t *request,
+     size_t request_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _QUERY_HANDLE_H ) */
+
@@ -0,0 +1,795 @@
+/*
+ * Least recently used cache of parsed prefetch results
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "result_cache.h"
+#include "sccatools_libcerror.h"
+
+/* Creates a result cache entry
+ * Make sure the value entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int result_cache_entry_initialize(
+     result_cache_entry_t **entry,
+     const system_character_t *path,
+     size_t path_length,
+     uint64_t file_size,
+     int64_t modification_time,
+     libcerror_error_t **error )
+{
+	static char *function = "result_cache_entry_initialize";
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = memory_allocate_structure(
+	          result_cache_entry_t );
+
+	if( *entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *entry,
+	     0,
+	     sizeof( result_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+
+		return( -1 );
+	}
+	( *entry )->path = system_string_allocate(
+	                    path_length + 1 );
+
+	if( ( *entry )->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *entry )->path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	( *entry )->path[ path_length ] = 0;
+
+	( *entry )->path_length       = path_length;
+	( *entry )->path_hash         = result_cache_calculate_path_hash(
+	                                 path,
+	                                 path_length );
+	( *entry )->file_size         = file_size;
+	( *entry )->modification_time = modification_time;
+
+	return( 1 );
+
+on_error:
+	if( *entry != NULL )
+	{
+		if( ( *entry )->path != NULL )
+		{
+			memory_free(
+			 ( *entry )->path );
+		}
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a result cache entry
+ * The entry must not be part of a cache
+ * Returns 1 if successful or -1 on error
+ */
+int result_cache_entry_free(
+     result_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "result_cache_entry_free";
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		if( ( *entry )->path != NULL )
+		{
+			memory_free(
+			 ( *entry )->path );
+		}
+		if( ( *entry )->executable_filename != NULL )
+		{
+			memory_free(
+			 ( *entry )->executable_filename );
+		}
+		if( ( *entry )->filenames != NULL )
+		{
+			memory_free(
+			 ( *entry )->filenames );
+		}
+		if( ( *entry )->file_references != NULL )
+		{
+			memory_free(
+			 ( *entry )->file_references );
+		}
+		if( ( *entry )->record != NULL )
+		{
+			memory_free(
+			 ( *entry )->record );
+		}
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of a path
+ * The hash is the 32-bit FNV-1a of the system characters of the path
+ * Returns the hash
+ */
+uint32_t result_cache_calculate_path_hash(
+          const system_character_t *path,
+          size_t path_length )
+{
+	size_t path_index  = 0;
+	uint32_t path_hash = 0x811c9dc5UL;
+
+	if( path == NULL )
+	{
+		return( 0 );
+	}
+	for( path_index = 0;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		path_hash ^= (uint32_t) path[ path_index ];
+		path_hash *= 0x01000193UL;
+	}
+	return( path_hash );
+}
+
+/* Creates a result cache
+ * Make sure the value result_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int result_cache_initialize(
+     result_cache_t **result_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function      = "result_cache_initialize";
+	uint32_t number_of_buckets = 16;
+
+	if( result_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *result_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid result cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries < 1 )
+	 || ( maximum_number_of_entries > RESULT_CACHE_MAXIMUM_NUMBER_OF_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the load factor of the hash buckets at or below 1
+	 */
+	while( number_of_buckets < (uint32_t) maximum_number_of_entries )
+	{
+		number_of_buckets *= 2;
+	}
+	*result_cache = memory_allocate_structure(
+	                 result_cache_t );
+
+	if( *result_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create result cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *result_cache,
+	     0,
+	     sizeof( result_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear result cache.",
+		 function );
+
+		memory_free(
+		 *result_cache );
+
+		*result_cache = NULL;
+
+		return( -1 );
+	}
+	( *result_cache )->buckets = (result_cache_entry_t **) memory_allocate(
+	                                                        sizeof( result_cache_entry_t * ) * number_of_buckets );
+
+	if( ( *result_cache )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *result_cache )->buckets,
+	     0,
+	     sizeof( result_cache_entry_t * ) * number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *result_cache )->number_of_buckets         = number_of_buckets;
+	( *result_cache )->maximum_number_of_entries = maximum_number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *result_cache != NULL )
+	{
+		if( ( *result_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *result_cache )->buckets );
+		}
+		memory_free(
+		 *result_cache );
+
+		*result_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a result cache
+ * Returns 1 if successful or -1 on error
+ */
+int result_cache_free(
+     result_cache_t **result_cache,
+     libcerror_error_t **error )
+{
+	result_cache_entry_t *entry      = NULL;
+	result_cache_entry_t *next_entry = NULL;
+	static char *function            = "result_cache_free";
+	int result                       = 1;
+
+	if( result_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *result_cache != NULL )
+	{
+		entry = ( *result_cache )->first_entry;
+
+		while( entry != NULL )
+		{
+			next_entry = entry->next_entry;
+
+			if( result_cache_entry_free(
+			     &entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free entry.",
+				 function );
+
+				result = -1;
+			}
+			entry = next_entry;
+		}
+		if( ( *result_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *result_cache )->buckets );
+		}
+		memory_free(
+		 *result_cache );
+
+		*result_cache = NULL;
+	}
+	return( result );
+}
+
+/* Removes an entry from the cache
+ * The entry is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int result_cache_remove_entry(
+     result_cache_t *result_cache,
+     result_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	result_cache_entry_t **bucket_entry = NULL;
+	static char *function               = "result_cache_remove_entry";
+
+	if( result_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_entry = &( result_cache->buckets[ entry->path_hash & ( result_cache->number_of_buckets - 1 ) ] );
+
+	while( ( *bucket_entry != NULL )
+	    && ( *bucket_entry != entry ) )
+	{
+		bucket_entry = &( ( *bucket_entry )->next_bucket_entry );
+	}
+	if( *bucket_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entry - not part of cache.",
+		 function );
+
+		return( -1 );
+	}
+	*bucket_entry = entry->next_bucket_entry;
+
+	if( entry->previous_entry != NULL )
+	{
+		entry->previous_entry->next_entry = entry->next_entry;
+	}
+	else
+	{
+		result_cache->first_entry = entry->next_entry;
+	}
+	if( entry->next_entry != NULL )
+	{
+		entry->next_entry->previous_entry = entry->previous_entry;
+	}
+	else
+	{
+		result_cache->last_entry = entry->previous_entry;
+	}
+	entry->previous_entry    = NULL;
+	entry->next_entry        = NULL;
+	entry->next_bucket_entry = NULL;
+
+	result_cache->number_of_entries -= 1;
+
+	return( 1 );
+}
+
+/* Retrieves the entry of a specific path
+ * An entry of which the file size or modification time differ is stale and is removed
+ * A retrieved entry becomes the most recently used entry
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int result_cache_get_entry(
+     result_cache_t *result_cache,
+     const system_character_t *path,
+     size_t path_length,
+     uint64_t file_size,
+     int64_t modification_time,
+     result_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	result_cache_entry_t *bucket_entry = NULL;
+	static char *function              = "result_cache_get_entry";
+	uint32_t path_hash                 = 0;
+
+	if( result_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = NULL;
+
+	path_hash = result_cache_calculate_path_hash(
+	             path,
+	             path_length );
+
+	bucket_entry = result_cache->buckets[ path_hash & ( result_cache->number_of_buckets - 1 ) ];
+
+	while( bucket_entry != NULL )
+	{
+		if( ( bucket_entry->path_hash == path_hash )
+		 && ( bucket_entry->path_length == path_length )
+		 && ( system_string_compare(
+		       bucket_entry->path,
+		       path,
+		       path_length ) == 0 ) )
+		{
+			break;
+		}
+		bucket_entry = bucket_entry->next_bucket_entry;
+	}
+	if( bucket_entry == NULL )
+	{
+		result_cache->number_of_misses += 1;
+
+		return( 0 );
+	}
+	if( ( bucket_entry->file_size != file_size )
+	 || ( bucket_entry->modification_time != modification_time ) )
+	{
+		if( result_cache_remove_entry(
+		     result_cache,
+		     bucket_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove stale entry.",
+			 function );
+
+			return( -1 );
+		}
+		if( result_cache_entry_free(
+		     &bucket_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free stale entry.",
+			 function );
+
+			return( -1 );
+		}
+		result_cache->number_of_misses += 1;
+
+		return( 0 );
+	}
+	/* Move the entry to the front of the least recently used list
+	 */
+	if( bucket_entry->previous_entry != NULL )
+	{
+		bucket_entry->previous_entry->next_entry = bucket_entry->next_entry;
+
+		if( bucket_entry->next_entry != NULL )
+		{
+			bucket_entry->next_entry->previous_entry = bucket_entry->previous_entry;
+		}
+		else
+		{
+			result_cache->last_entry = bucket_entry->previous_entry;
+		}
+		bucket_entry->previous_entry = NULL;
+		bucket_entry->next_entry     = result_cache->first_entry;
+
+		result_cache->first_entry->previous_entry = bucket_entry;
+		result_cache->first_entry                 = bucket_entry;
+	}
+	result_cache->number_of_hits += 1;
+
+	*entry = bucket_entry;
+
+	return( 1 );
+}
+
+/* Inserts an entry as the most recently used entry
+ * The cache takes over management of the entry
+ * When the cache is full the least recently used entry is evicted
+ * Returns 1 if successful or -1 on error
+ */
+int result_cache_insert_entry(
+     result_cache_t *result_cache,
+     result_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	result_cache_entry_t *bucket_entry  = NULL;
+	result_cache_entry_t *evicted_entry = NULL;
+	static char *function               = "result_cache_insert_entry";
+	uint32_t bucket_index               = 0;
+
+	if( result_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry->previous_entry != NULL )
+	 || ( entry->next_entry != NULL )
+	 || ( entry->next_bucket_entry != NULL )
+	 || ( result_cache->first_entry == entry ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry - already part of a cache.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = entry->path_hash & ( result_cache->number_of_buckets - 1 );
+
+	for( bucket_entry = result_cache->buckets[ bucket_index ];
+	     bucket_entry != NULL;
+	     bucket_entry = bucket_entry->next_bucket_entry )
+	{
+		if( ( bucket_entry->path_hash == entry->path_hash )
+		 && ( bucket_entry->path_length == entry->path_length )
+		 && ( system_string_compare(
+		       bucket_entry->path,
+		       entry->path,
+		       entry->path_length ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid result cache - entry for path already set.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result_cache->number_of_entries >= result_cache->maximum_number_of_entries )
+	{
+		evicted_entry = result_cache->last_entry;
+
+		if( result_cache_remove_entry(
+		     result_cache,
+		     evicted_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used entry.",
+			 function );
+
+			return( -1 );
+		}
+		if( result_cache_entry_free(
+		     &evicted_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free least recently used entry.",
+			 function );
+
+			return( -1 );
+		}
+		result_cache->number_of_evictions += 1;
+	}
+	entry->next_bucket_entry              = result_cache->buckets[ bucket_index ];
+	result_cache->buckets[ bucket_index ] = entry;
+
+	entry->next_entry = result_cache->first_entry;
+
+	if( result_cache->first_entry != NULL )
+	{
+		result_cache->first_entry->previous_entry = entry;
+	}
+	else
+	{
+		result_cache->last_entry = entry;
+	}
+	result_cache->first_entry = entry;
+
+	result_cache->number_of_entries += 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,201 @@
+/*
+ * Least recently used cache of parsed prefetch results
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RESULT_CACHE_H )
+#define _RESULT_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default maximum number of cache entries
+ */
+#define RESULT_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES	1024
+
+/* The maximum supported maximum number of cache entries
+ */
+#define RESULT_CACHE_MAXIMUM_NUMBER_OF_ENTRIES		( 1024 * 1024 )
+
+typedef struct result_cache_entry result_cache_entry_t;
+
+struct result_cache_entry
+{
+	/* The path
+	 */
+	system_character_t *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The hash of the path
+	 */
+	uint32_t path_hash;
+
+	/* The file size
+	 */
+	uint64_t file_size;
+
+	/* The modification time
+	 */
+	int64_t modification_time;
+
+	/* The UTF-8 executable filename, including the end-of-string character
+	 */
+	uint8_t *executable_filename;
+
+	/* The UTF-8 executable filename size
+	 */
+	size_t executable_filename_size;
+
+	/* The UTF-8 filenames, stored as consecutive end-of-string character terminated strings
+	 */
+	uint8_t *filenames;
+
+	/* The UTF-8 filenames size
+	 */
+	size_t filenames_size;
+
+	/* The file references
+	 */
+	uint64_t *file_references;
+
+	/* The number of file references
+	 */
+	int number_of_file_references;
+
+	/* The JSON object that describes the file
+	 */
+	uint8_t *record;
+
+	/* The JSON object size
+	 */
+	size_t record_size;
+
+	/* The previous (more recently used) entry
+	 */
+	result_cache_entry_t *previous_entry;
+
+	/* The next (less recently used) entry
+	 */
+	result_cache_entry_t *next_entry;
+
+	/* The next entry in the same hash bucket
+	 */
+	result_cache_entry_t *next_bucket_entry;
+};
+
+typedef struct result_cache result_cache_t;
+
+struct result_cache
+{
+	/* The hash buckets
+	 */
+	result_cache_entry_t **buckets;
+
+	/* The number of hash buckets, which is a power of 2
+	 */
+	uint32_t number_of_buckets;
+
+	/* The most recently used entry
+	 */
+	result_cache_entry_t *first_entry;
+
+	/* The least recently used entry
+	 */
+	result_cache_entry_t *last_entry;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The number of lookups that were answered from the cache
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of lookups that were not answered from the cache
+	 */
+	uint64_t number_of_misses;
+
+	/* The number of entries that were evicted
+	 */
+	uint64_t number_of_evictions;
+};
+
+int result_cache_entry_initialize(
+     result_cache_entry_t **entry,
+     const system_character_t *path,
+     size_t path_length,
+     uint64_t file_size,
+     int64_t modification_time,
+     libcerror_error_t **error );
+
+int result_cache_entry_free(
+     result_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+uint32_t result_cache_calculate_path_hash(
+          const system_character_t *path,
+          size_t path_length );
+
+int result_cache_initialize(
+     result_cache_t **result_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int result_cache_free(
+     result_cache_t **result_cache,
+     libcerror_error_t **error );
+
+int result_cache_remove_entry(
+     result_cache_t *result_cache,
+     result_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int result_cache_get_entry(
+     result_cache_t *result_cache,
+     const system_character_t *path,
+     size_t path_length,
+     uint64_t file_size,
+     int64_t modification_time,
+     result_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int result_cache_insert_entry(
+     result_cache_t *result_cache,
+     result_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RESULT_CACHE_H ) */
+
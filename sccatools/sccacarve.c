@@ -0,0 +1,429 @@
+/*
+ * Carves Windows Prefetch Files (PF) from a disk image or memory dump.
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "carve_handle.h"
+#include "sccatools_getopt.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libclocale.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libscca.h"
+#include "sccatools_output.h"
+#include "sccatools_signal.h"
+#include "sccatools_unused.h"
+
+carve_handle_t *sccacarve_carve_handle = NULL;
+int sccacarve_abort                    = 0;
+
+/* Signal handler for sccacarve
+ */
+void sccacarve_signal_handler(
+      sccatools_signal_t signal SCCATOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "sccacarve_signal_handler";
+
+	SCCATOOLS_UNREFERENCED_PARAMETER( signal )
+
+	sccacarve_abort = 1;
+
+	if( sccacarve_carve_handle != NULL )
+	{
+		if( carve_handle_signal_abort(
+		     sccacarve_carve_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal carve handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use sccacarve to carve Windows Prefetch Files (PF) from a disk image or memory dump.";
+
+	sccatools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'j', "jobs", "number of concurrent jobs (threads) used to scan the source, between 1 and 32, default is 4" },
+		{ 't', "target", "the existing directory to write the carved files to, by default the files are only listed" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source file, such as a disk image or memory dump" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libscca_error_t *error            = NULL;
+	system_character_t *option_jobs   = NULL;
+	system_character_t *option_target = NULL;
+	system_character_t *source        = NULL;
+	char *program                     = "sccacarve";
+	system_integer_t option           = 0;
+	size_t string_index               = 0;
+	int number_of_jobs                = CARVE_HANDLE_DEFAULT_NUMBER_OF_JOBS;
+	int number_of_options             = (int) ( sizeof( options ) / sizeof( sccatools_option_t ) );
+	int result                        = 0;
+	int verbose                       = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdin ), _O_BINARY );
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "sccatools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				sccatools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				option_jobs = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_target = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		sccatools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libscca_notify_set_stream(
+	 stderr,
+	 NULL );
+	libscca_notify_set_verbose(
+	 verbose );
+
+	if( option_jobs != NULL )
+	{
+		number_of_jobs = 0;
+
+		for( string_index = 0;
+		     option_jobs[ string_index ] != 0;
+		     string_index++ )
+		{
+			if( ( option_jobs[ string_index ] < (system_character_t) '0' )
+			 || ( option_jobs[ string_index ] > (system_character_t) '9' )
+			 || ( number_of_jobs > CARVE_HANDLE_MAXIMUM_NUMBER_OF_JOBS ) )
+			{
+				number_of_jobs = 0;
+
+				break;
+			}
+			number_of_jobs *= 10;
+			number_of_jobs += (int) ( option_jobs[ string_index ] - (system_character_t) '0' );
+		}
+		if( ( number_of_jobs < 1 )
+		 || ( number_of_jobs > CARVE_HANDLE_MAXIMUM_NUMBER_OF_JOBS ) )
+		{
+			number_of_jobs = CARVE_HANDLE_DEFAULT_NUMBER_OF_JOBS;
+
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs defaulting to: %d.\n",
+			 number_of_jobs );
+		}
+	}
+	if( carve_handle_initialize(
+	     &sccacarve_carve_handle,
+	     number_of_jobs,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize carve handle.\n" );
+
+		goto on_error;
+	}
+	if( option_target != NULL )
+	{
+		if( carve_handle_set_target_path(
+		     sccacarve_carve_handle,
+		     option_target,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set target path.\n" );
+
+			goto on_error;
+		}
+	}
+	sccatools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( carve_handle_open_source(
+	     sccacarve_carve_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( sccatools_signal_attach(
+	     sccacarve_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	result = carve_handle_process_source(
+	          sccacarve_carve_handle,
+	          &error );
+
+	if( sccatools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to process source file.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "\nNumber of carved files\t: %d\n",
+	 sccacarve_carve_handle->number_of_files );
+
+	if( sccacarve_carve_handle->number_of_failed_chunks > 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Number of failed chunks\t: %d\n",
+		 sccacarve_carve_handle->number_of_failed_chunks );
+	}
+	if( sccacarve_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: ABORTED\n",
+		 program );
+	}
+	if( carve_handle_close_source(
+	     sccacarve_carve_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close source file.\n" );
+
+		goto on_error;
+	}
+	if( carve_handle_free(
+	     &sccacarve_carve_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free carve handle.\n" );
+
+		goto on_error;
+	}
+	if( ( result != 1 )
+	 || ( sccacarve_abort != 0 ) )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( sccacarve_carve_handle != NULL )
+	{
+		carve_handle_free(
+		 &sccacarve_carve_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,955 @@
+/*
+ * Answers queries about Windows Prefetch Files (PF) on a Unix domain socket.
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+/* Unix domain sockets are only supported with narrow system character paths
+ */
+#if defined( HAVE_SYS_SOCKET_H ) && defined( HAVE_SYS_UN_H ) && !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define SCCAD_HAVE_UNIX_DOMAIN_SOCKETS
+#endif
+
+#if defined( SCCAD_HAVE_UNIX_DOMAIN_SOCKETS )
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#endif
+
+#include "query_handle.h"
+#include "result_cache.h"
+#include "sccatools_getopt.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libclocale.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libscca.h"
+#include "sccatools_output.h"
+#include "sccatools_signal.h"
+#include "sccatools_unused.h"
+
+/* The maximum number of pending connections
+ */
+#define SCCAD_LISTEN_BACKLOG		16
+
+/* The number of seconds to wait for a client to send a request
+ */
+#define SCCAD_RECEIVE_TIMEOUT		30
+
+#if !defined( MSG_NOSIGNAL )
+#define MSG_NOSIGNAL			0
+#endif
+
+query_handle_t *sccad_query_handle = NULL;
+int sccad_socket_descriptor        = -1;
+int sccad_abort                    = 0;
+
+#if defined( SCCAD_HAVE_UNIX_DOMAIN_SOCKETS )
+
+/* Signal handler for sccad
+ */
+void sccad_signal_handler(
+      sccatools_signal_t signal SCCATOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "sccad_signal_handler";
+	int socket_descriptor    = 0;
+
+	SCCATOOLS_UNREFERENCED_PARAMETER( signal )
+
+	sccad_abort = 1;
+
+	if( sccad_query_handle != NULL )
+	{
+		if( query_handle_signal_abort(
+		     sccad_query_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal query handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Close the listening socket otherwise accept will remain blocked
+	 */
+	socket_descriptor = sccad_socket_descriptor;
+
+	if( socket_descriptor != -1 )
+	{
+		sccad_socket_descriptor = -1;
+
+		if( close(
+		     socket_descriptor ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to close socket.\n",
+			 function );
+		}
+	}
+}
+
+/* Opens the listening socket
+ * An existing socket at the path is replaced, any other type of file is not
+ * Returns 1 if successful or -1 on error
+ */
+int sccad_open_socket(
+     const system_character_t *socket_path,
+     int *socket_descriptor,
+     libcerror_error_t **error )
+{
+	struct sockaddr_un socket_address;
+	struct stat file_status;
+
+	static char *function      = "sccad_open_socket";
+	size_t socket_path_length  = 0;
+	mode_t previous_mode       = 0;
+	int result                 = 0;
+	int safe_socket_descriptor = -1;
+
+	if( socket_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid socket path.",
+		 function );
+
+		return( -1 );
+	}
+	if( socket_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	socket_path_length = narrow_string_length(
+	                      socket_path );
+
+	if( ( socket_path_length == 0 )
+	 || ( socket_path_length >= sizeof( socket_address.sun_path ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid socket path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( lstat(
+	     socket_path,
+	     &file_status ) == 0 )
+	{
+		if( !S_ISSOCK( file_status.st_mode ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unsupported socket path: %s - file exists and is not a socket.",
+			 function,
+			 socket_path );
+
+			return( -1 );
+		}
+		if( unlink(
+		     socket_path ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 "%s: unable to remove existing socket: %s.",
+			 function,
+			 socket_path );
+
+			return( -1 );
+		}
+	}
+	if( memory_set(
+	     &socket_address,
+	     0,
+	     sizeof( struct sockaddr_un ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear socket address.",
+		 function );
+
+		return( -1 );
+	}
+	socket_address.sun_family = AF_UNIX;
+
+	if( memory_copy(
+	     socket_address.sun_path,
+	     socket_path,
+	     socket_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy socket path.",
+		 function );
+
+		return( -1 );
+	}
+	safe_socket_descriptor = socket(
+	                          AF_UNIX,
+	                          SOCK_STREAM,
+	                          0 );
+
+	if( safe_socket_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create socket.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the owner is allowed to connect to the socket
+	 */
+	previous_mode = umask(
+	                 0077 );
+
+	result = bind(
+	          safe_socket_descriptor,
+	          (struct sockaddr *) &socket_address,
+	          sizeof( struct sockaddr_un ) );
+
+	umask(
+	 previous_mode );
+
+	if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to bind socket to: %s.",
+		 function,
+		 socket_path );
+
+		goto on_error;
+	}
+	if( listen(
+	     safe_socket_descriptor,
+	     SCCAD_LISTEN_BACKLOG ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to listen on socket.",
+		 function );
+
+		goto on_error;
+	}
+	*socket_descriptor = safe_socket_descriptor;
+
+	return( 1 );
+
+on_error:
+	close(
+	 safe_socket_descriptor );
+
+	return( -1 );
+}
+
+/* Writes the response of the query handle to a connection
+ * Returns 1 if successful or -1 on error
+ */
+int sccad_write_response(
+     query_handle_t *query_handle,
+     int connection_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function  = "sccad_write_response";
+	size_t response_offset = 0;
+	ssize_t write_count    = 0;
+
+	if( query_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query handle.",
+		 function );
+
+		return( -1 );
+	}
+	while( response_offset < query_handle->output_writer->buffer_offset )
+	{
+		write_count = send(
+		               connection_descriptor,
+		               &( query_handle->output_writer->buffer[ response_offset ] ),
+		               query_handle->output_writer->buffer_offset - response_offset,
+		               MSG_NOSIGNAL );
+
+		if( write_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write response.",
+			 function );
+
+			query_handle->output_writer->buffer_offset = 0;
+
+			return( -1 );
+		}
+		response_offset += (size_t) write_count;
+	}
+	query_handle->output_writer->buffer_offset = 0;
+
+	return( 1 );
+}
+
+/* Processes the requests of a connection
+ * Every request is a single line and is answered with a single line
+ * Returns 1 if successful or -1 on error
+ */
+int sccad_process_connection(
+     query_handle_t *query_handle,
+     int connection_descriptor,
+     libcerror_error_t **error )
+{
+	struct timeval receive_timeout;
+
+	libcerror_error_t *request_error = NULL;
+	uint8_t *request_buffer          = NULL;
+	static char *function            = "sccad_process_connection";
+	size_t line_end_offset           = 0;
+	size_t line_start_offset         = 0;
+	size_t request_buffer_offset     = 0;
+	size_t scan_offset               = 0;
+	ssize_t read_count               = 0;
+	int end_of_input                 = 0;
+
+	if( query_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* A client that does not send a request in time must not block other clients indefinitely
+	 */
+	receive_timeout.tv_sec  = SCCAD_RECEIVE_TIMEOUT;
+	receive_timeout.tv_usec = 0;
+
+	if( setsockopt(
+	     connection_descriptor,
+	     SOL_SOCKET,
+	     SO_RCVTIMEO,
+	     &receive_timeout,
+	     sizeof( struct timeval ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to set receive timeout.",
+		 function );
+
+		goto on_error;
+	}
+	request_buffer = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * QUERY_HANDLE_MAXIMUM_REQUEST_SIZE );
+
+	if( request_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create request buffer.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( end_of_input == 0 )
+	    && ( sccad_abort == 0 ) )
+	{
+		read_count = recv(
+		              connection_descriptor,
+		              &( request_buffer[ request_buffer_offset ] ),
+		              QUERY_HANDLE_MAXIMUM_REQUEST_SIZE - request_buffer_offset,
+		              0 );
+
+		if( read_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			/* The receive timeout expired or the client went away
+			 */
+			break;
+		}
+		else if( read_count == 0 )
+		{
+			end_of_input = 1;
+
+			/* A last request without a line feed is still answered
+			 */
+			if( request_buffer_offset == 0 )
+			{
+				break;
+			}
+			request_buffer[ request_buffer_offset++ ] = (uint8_t) '\n';
+		}
+		else
+		{
+			request_buffer_offset += (size_t) read_count;
+		}
+		line_start_offset = 0;
+
+		for( scan_offset = 0;
+		     scan_offset < request_buffer_offset;
+		     scan_offset++ )
+		{
+			if( request_buffer[ scan_offset ] != (uint8_t) '\n' )
+			{
+				continue;
+			}
+			line_end_offset = scan_offset;
+
+			if( ( line_end_offset > line_start_offset )
+			 && ( request_buffer[ line_end_offset - 1 ] == (uint8_t) '\r' ) )
+			{
+				line_end_offset--;
+			}
+			if( line_end_offset > line_start_offset )
+			{
+				if( query_handle_process_request(
+				     query_handle,
+				     &( request_buffer[ line_start_offset ] ),
+				     line_end_offset - line_start_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to process request.",
+					 function );
+
+					goto on_error;
+				}
+				if( sccad_write_response(
+				     query_handle,
+				     connection_descriptor,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write response.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			line_start_offset = scan_offset + 1;
+		}
+		if( line_start_offset > 0 )
+		{
+			/* The remainder overlaps with the start of the buffer and is moved forward byte by byte
+			 */
+			for( scan_offset = line_start_offset;
+			     scan_offset < request_buffer_offset;
+			     scan_offset++ )
+			{
+				request_buffer[ scan_offset - line_start_offset ] = request_buffer[ scan_offset ];
+			}
+			request_buffer_offset -= line_start_offset;
+		}
+		else if( request_buffer_offset >= QUERY_HANDLE_MAXIMUM_REQUEST_SIZE )
+		{
+			libcerror_error_set(
+			 &request_error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid request size value exceeds maximum.",
+			 function );
+
+			query_handle_error_fprint(
+			 query_handle,
+			 request_error,
+			 NULL );
+
+			libcerror_error_free(
+			 &request_error );
+
+			sccad_write_response(
+			 query_handle,
+			 connection_descriptor,
+			 NULL );
+
+			break;
+		}
+	}
+	memory_free(
+	 request_buffer );
+
+	return( 1 );
+
+on_error:
+	query_handle->output_writer->buffer_offset = 0;
+
+	if( request_buffer != NULL )
+	{
+		memory_free(
+		 request_buffer );
+	}
+	return( -1 );
+}
+
+#endif /* defined( SCCAD_HAVE_UNIX_DOMAIN_SOCKETS ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use sccad to answer queries about Windows Prefetch Files (PF) on a Unix domain socket. Every request is a line with a JSON object: {\"executable\":\"name\"}, {\"filename\":\"substring\"}, {\"file_reference\":number} or {\"stats\":true}.";
+
+	sccatools_option_t options[ ] = {
+		{ 'c', "entries", "maximum number of parsed files kept in the cache, default is 1024" },
+		{ 'h', NULL, "shows this help" },
+		{ 's', "socket", "path of the Unix domain socket to listen on" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source file or directory, multiple sources can be specified" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libscca_error_t *error                   = NULL;
+	system_character_t *option_cache_entries = NULL;
+	system_character_t *option_socket_path   = NULL;
+	char *program                            = "sccad";
+	system_integer_t option                  = 0;
+	size_t string_index                      = 0;
+	int maximum_number_of_cache_entries      = RESULT_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES;
+	int number_of_options                    = (int) ( sizeof( options ) / sizeof( sccatools_option_t ) );
+	int verbose                              = 0;
+
+#if defined( SCCAD_HAVE_UNIX_DOMAIN_SOCKETS )
+	libcerror_error_t *connection_error      = NULL;
+	int connection_descriptor                = -1;
+	int source_index                         = 0;
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "sccatools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				sccatools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				option_cache_entries = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 's':
+				option_socket_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( ( optind == argc )
+	 || ( option_socket_path == NULL ) )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		if( option_socket_path == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Missing socket path.\n" );
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Missing source file or directory.\n" );
+		}
+		sccatools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libscca_notify_set_stream(
+	 stderr,
+	 NULL );
+	libscca_notify_set_verbose(
+	 verbose );
+
+	if( option_cache_entries != NULL )
+	{
+		maximum_number_of_cache_entries = 0;
+
+		for( string_index = 0;
+		     option_cache_entries[ string_index ] != 0;
+		     string_index++ )
+		{
+			if( ( option_cache_entries[ string_index ] < (system_character_t) '0' )
+			 || ( option_cache_entries[ string_index ] > (system_character_t) '9' )
+			 || ( maximum_number_of_cache_entries > RESULT_CACHE_MAXIMUM_NUMBER_OF_ENTRIES ) )
+			{
+				maximum_number_of_cache_entries = 0;
+
+				break;
+			}
+			maximum_number_of_cache_entries *= 10;
+			maximum_number_of_cache_entries += (int) ( option_cache_entries[ string_index ] - (system_character_t) '0' );
+		}
+		if( ( maximum_number_of_cache_entries < 1 )
+		 || ( maximum_number_of_cache_entries > RESULT_CACHE_MAXIMUM_NUMBER_OF_ENTRIES ) )
+		{
+			maximum_number_of_cache_entries = RESULT_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES;
+
+			fprintf(
+			 stderr,
+			 "Unsupported number of cache entries defaulting to: %d.\n",
+			 maximum_number_of_cache_entries );
+		}
+	}
+#if !defined( SCCAD_HAVE_UNIX_DOMAIN_SOCKETS )
+	sccatools_output_version_fprint(
+	 stdout,
+	 program );
+
+	fprintf(
+	 stderr,
+	 "Unix domain sockets are not supported on this platform.\n" );
+
+	return( EXIT_FAILURE );
+#else
+	if( query_handle_initialize(
+	     &sccad_query_handle,
+	     maximum_number_of_cache_entries,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize query handle.\n" );
+
+		goto on_error;
+	}
+	for( source_index = optind;
+	     source_index < argc;
+	     source_index++ )
+	{
+		if( query_handle_append_source(
+		     sccad_query_handle,
+		     argv[ source_index ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append source.\n" );
+
+			goto on_error;
+		}
+	}
+	if( sccad_open_socket(
+	     option_socket_path,
+	     &sccad_socket_descriptor,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open socket: %" PRIs_SYSTEM ".\n",
+		 option_socket_path );
+
+		goto on_error;
+	}
+	if( sccatools_signal_attach(
+	     sccad_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	sccatools_output_version_fprint(
+	 stdout,
+	 program );
+
+	fprintf(
+	 stdout,
+	 "Listening on: %" PRIs_SYSTEM "\n",
+	 option_socket_path );
+
+	while( sccad_abort == 0 )
+	{
+		connection_descriptor = accept(
+		                         sccad_socket_descriptor,
+		                         NULL,
+		                         NULL );
+
+		if( connection_descriptor == -1 )
+		{
+			if( ( sccad_abort == 0 )
+			 && ( errno == EINTR ) )
+			{
+				continue;
+			}
+			break;
+		}
+		/* A failing connection is reported but does not stop the daemon
+		 */
+		if( sccad_process_connection(
+		     sccad_query_handle,
+		     connection_descriptor,
+		     &connection_error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 connection_error );
+			libcerror_error_free(
+			 &connection_error );
+		}
+		close(
+		 connection_descriptor );
+	}
+	if( sccad_abort == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to accept connection.\n" );
+	}
+	if( sccatools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( sccad_socket_descriptor != -1 )
+	{
+		close(
+		 sccad_socket_descriptor );
+
+		sccad_socket_descriptor = -1;
+	}
+	unlink(
+	 option_socket_path );
+
+	if( query_handle_free(
+	     &sccad_query_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free query handle.\n" );
+
+		goto on_error;
+	}
+	if( sccad_abort == 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+#endif /* !defined( SCCAD_HAVE_UNIX_DOMAIN_SOCKETS ) */
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( SCCAD_HAVE_UNIX_DOMAIN_SOCKETS )
+	if( sccad_socket_descriptor != -1 )
+	{
+		close(
+		 sccad_socket_descriptor );
+
+		sccad_socket_descriptor = -1;
+
+		unlink(
+		 option_socket_path );
+	}
+#endif
+	if( sccad_query_handle != NULL )
+	{
+		query_handle_free(
+		 &sccad_query_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,438 @@
+/*
+ * Exports the uncompressed data of Windows Prefetch Files (PF).
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "export_handle.h"
+#include "sccatools_getopt.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libclocale.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libscca.h"
+#include "sccatools_output.h"
+#include "sccatools_signal.h"
+#include "sccatools_unused.h"
+
+export_handle_t *sccaexport_export_handle = NULL;
+int sccaexport_abort                    = 0;
+
+/* Signal handler for sccaexport
+ */
+void sccaexport_signal_handler(
+      sccatools_signal_t signal SCCATOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "sccaexport_signal_handler";
+
+	SCCATOOLS_UNREFERENCED_PARAMETER( signal )
+
+	sccaexport_abort = 1;
+
+	if( sccaexport_export_handle != NULL )
+	{
+		if( export_handle_signal_abort(
+		     sccaexport_export_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal export handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use sccaexport to export the uncompressed data of Windows Prefetch Files (PF).";
+
+	sccatools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'j', "jobs", "number of concurrent jobs (threads) used to export the sources, between 1 and 32, default is 4" },
+		{ 't', "target", "the directory to write the exported files to, sub directories of the sources are recreated" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source file(s) or directory(ies), directories are read recursively" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libscca_error_t *error            = NULL;
+	system_character_t *option_jobs   = NULL;
+	system_character_t *option_target = NULL;
+	char *program                     = "sccaexport";
+	system_integer_t option           = 0;
+	size_t string_index               = 0;
+	int argument_index                = 0;
+	int number_of_jobs                = EXPORT_HANDLE_DEFAULT_NUMBER_OF_JOBS;
+	int number_of_options             = (int) ( sizeof( options ) / sizeof( sccatools_option_t ) );
+	int result                        = 0;
+	int verbose                       = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdin ), _O_BINARY );
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "sccatools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				sccatools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				option_jobs = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_target = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing source file or directory.\n" );
+
+		sccatools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_target == NULL )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing target directory.\n" );
+
+		sccatools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libscca_notify_set_stream(
+	 stderr,
+	 NULL );
+	libscca_notify_set_verbose(
+	 verbose );
+
+	if( option_jobs != NULL )
+	{
+		number_of_jobs = 0;
+
+		for( string_index = 0;
+		     option_jobs[ string_index ] != 0;
+		     string_index++ )
+		{
+			if( ( option_jobs[ string_index ] < (system_character_t) '0' )
+			 || ( option_jobs[ string_index ] > (system_character_t) '9' )
+			 || ( number_of_jobs > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_JOBS ) )
+			{
+				number_of_jobs = 0;
+
+				break;
+			}
+			number_of_jobs *= 10;
+			number_of_jobs += (int) ( option_jobs[ string_index ] - (system_character_t) '0' );
+		}
+		if( ( number_of_jobs < 1 )
+		 || ( number_of_jobs > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_JOBS ) )
+		{
+			number_of_jobs = EXPORT_HANDLE_DEFAULT_NUMBER_OF_JOBS;
+
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs defaulting to: %d.\n",
+			 number_of_jobs );
+		}
+	}
+	if( export_handle_initialize(
+	     &sccaexport_export_handle,
+	     number_of_jobs,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize export handle.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_set_target_path(
+	     sccaexport_export_handle,
+	     option_target,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set target path.\n" );
+
+		goto on_error;
+	}
+	for( argument_index = optind;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( export_handle_append_path(
+		     sccaexport_export_handle,
+		     argv[ argument_index ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append source: %" PRIs_SYSTEM ".\n",
+			 argv[ argument_index ] );
+
+			goto on_error;
+		}
+	}
+	sccatools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( sccatools_signal_attach(
+	     sccaexport_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	result = export_handle_process_tasks(
+	          sccaexport_export_handle,
+	          &error );
+
+	if( sccatools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to process sources.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "\nNumber of exported files\t: %d\n",
+	 sccaexport_export_handle->number_of_exported_files );
+
+	if( sccaexport_export_handle->number_of_failed_tasks > 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Number of failed files\t\t: %d\n",
+		 sccaexport_export_handle->number_of_failed_tasks );
+	}
+	if( sccaexport_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: ABORTED\n",
+		 program );
+	}
+	if( export_handle_free(
+	     &sccaexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free export handle.\n" );
+
+		goto on_error;
+	}
+	if( ( result != 1 )
+	 || ( sccaexport_abort != 0 ) )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( sccaexport_export_handle != NULL )
+	{
+		export_handle_free(
+		 &sccaexport_export_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
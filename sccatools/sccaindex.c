@@ -0,0 +1,867 @@
+/*
+ * Builds a filename index of Windows Prefetch Files (PF).
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sccatools_getopt.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libclocale.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libscca.h"
+#include "sccatools_output.h"
+#include "source_list.h"
+
+/* Appends the filenames of a specific file metrics entry to the filename index builder
+ * The filename is indexed by its full path and by its final path component
+ * Returns 1 if successful or -1 on error
+ */
+int sccaindex_append_file_metrics(
+     libscca_filename_index_builder_t *builder,
+     uint32_t source_index,
+     libscca_file_metrics_t *file_metrics,
+     uint32_t metrics_index,
+     libcerror_error_t **error )
+{
+	uint16_t *utf16_string     = NULL;
+	static char *function      = "sccaindex_append_file_metrics";
+	size_t string_index        = 0;
+	size_t utf16_string_length = 0;
+	size_t utf16_string_size   = 0;
+
+	if( libscca_file_metrics_get_utf16_filename_size(
+	     file_metrics,
+	     &utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename size.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf16_string_size <= 1 )
+	{
+		return( 1 );
+	}
+	if( utf16_string_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	utf16_string = (uint16_t *) memory_allocate(
+	                             sizeof( uint16_t ) * utf16_string_size );
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_metrics_get_utf16_filename(
+	     file_metrics,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_upper_case_utf16_string(
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to upper case filename.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( utf16_string_length < utf16_string_size )
+	    && ( utf16_string[ utf16_string_length ] != 0 ) )
+	{
+		utf16_string_length++;
+	}
+	if( libscca_filename_index_builder_append_utf16_filename(
+	     builder,
+	     source_index,
+	     metrics_index,
+	     utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filename.",
+		 function );
+
+		goto on_error;
+	}
+	string_index = utf16_string_length;
+
+	while( string_index > 0 )
+	{
+		if( utf16_string[ string_index - 1 ] == (uint16_t) '\\' )
+		{
+			break;
+		}
+		string_index--;
+	}
+	if( ( string_index > 0 )
+	 && ( string_index < utf16_string_length ) )
+	{
+		if( libscca_filename_index_builder_append_utf16_filename(
+		     builder,
+		     source_index,
+		     metrics_index,
+		     &( utf16_string[ string_index ] ),
+		     utf16_string_length - string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append final path component of filename.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 utf16_string );
+
+	return( 1 );
+
+on_error:
+	if( utf16_string != NULL )
+	{
+		memory_free(
+		 utf16_string );
+	}
+	return( -1 );
+}
+
+/* Appends the filenames of a specific source to the filename index builder
+ * Returns 1 if successful, 0 if the source could not be opened or -1 on error
+ */
+int sccaindex_append_source(
+     libscca_filename_index_builder_t *builder,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	libscca_file_metrics_t *file_metrics = NULL;
+	libscca_file_t *file                 = NULL;
+	static char *function                = "sccaindex_append_source";
+	uint32_t source_index                = 0;
+	int metrics_index                    = 0;
+	int number_of_file_metrics_entries   = 0;
+
+	if( libscca_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libscca_file_open_wide(
+	     file,
+	     source,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libscca_file_open(
+	     file,
+	     source,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+
+		return( 0 );
+	}
+	if( libscca_file_get_number_of_file_metrics_entries(
+	     file,
+	     &number_of_file_metrics_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libscca_filename_index_builder_append_source_path_wide(
+	     builder,
+	     source,
+	     system_string_length(
+	      source ),
+	     &source_index,
+	     error ) != 1 )
+#else
+	if( libscca_filename_index_builder_append_source_path(
+	     builder,
+	     source,
+	     system_string_length(
+	      source ),
+	     &source_index,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source.",
+		 function );
+
+		goto on_error;
+	}
+	for( metrics_index = 0;
+	     metrics_index < number_of_file_metrics_entries;
+	     metrics_index++ )
+	{
+		if( libscca_file_get_file_metrics_entry(
+		     file,
+		     metrics_index,
+		     &file_metrics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry: %d.",
+			 function,
+			 metrics_index );
+
+			goto on_error;
+		}
+		if( sccaindex_append_file_metrics(
+		     builder,
+		     source_index,
+		     file_metrics,
+		     (uint32_t) metrics_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file metrics entry: %d.",
+			 function,
+			 metrics_index );
+
+			goto on_error;
+		}
+		if( libscca_file_metrics_free(
+		     &file_metrics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file metrics entry: %d.",
+			 function,
+			 metrics_index );
+
+			goto on_error;
+		}
+	}
+	if( libscca_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_metrics != NULL )
+	{
+		libscca_file_metrics_free(
+		 &file_metrics,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the filename index data to a file
+ * Returns 1 if successful or -1 on error
+ */
+int sccaindex_write_index(
+     libscca_filename_index_builder_t *builder,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	uint8_t *data         = NULL;
+	static char *function = "sccaindex_write_index";
+	size_t data_size      = 0;
+	size_t write_count    = 0;
+
+	if( libscca_filename_index_builder_get_data_size(
+	     builder,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_filename_index_builder_write_data(
+	     builder,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	write_count = file_stream_write(
+	               stream,
+	               data,
+	               data_size );
+
+	if( write_count != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use sccaindex to build an index of the filenames referenced by Windows Prefetch Files (PF).";
+
+	sccatools_option_t options[ ] = {
+		{ 'f', "filelist", "read the sources from a file that contains one source per line" },
+		{ 'h', NULL, "shows this help" },
+		{ 'o', "index_file", "the index file to write" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source file or directory, multiple sources can be specified" },
+	};
+	system_character_t options_string[ 16 ];
+
+	libscca_filename_index_builder_t *builder = NULL;
+	libscca_error_t *error                    = NULL;
+	source_list_t *source_list                = NULL;
+	system_character_t *option_filelist       = NULL;
+	system_character_t *option_index_file     = NULL;
+	char *program                             = "sccaindex";
+	system_integer_t option                   = 0;
+	int number_of_failed_sources              = 0;
+	int number_of_keys                        = 0;
+	int number_of_options                     = (int) ( sizeof( options ) / sizeof( sccatools_option_t ) );
+	int result                                = 0;
+	int source_index                          = 0;
+	int verbose                               = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "sccatools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     16 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				sccatools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'f':
+				option_filelist = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'o':
+				option_index_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( option_index_file == NULL )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing index file.\n" );
+
+		sccatools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( optind == argc )
+	 && ( option_filelist == NULL ) )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		sccatools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libscca_notify_set_stream(
+	 stderr,
+	 NULL );
+	libscca_notify_set_verbose(
+	 verbose );
+
+	if( source_list_initialize(
+	     &source_list,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize source list.\n" );
+
+		goto on_error;
+	}
+	if( option_filelist != NULL )
+	{
+		if( source_list_read_file(
+		     source_list,
+		     option_filelist,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read file list.\n" );
+
+			goto on_error;
+		}
+	}
+	for( source_index = optind;
+	     source_index < argc;
+	     source_index++ )
+	{
+		if( source_list_append_path(
+		     source_list,
+		     argv[ source_index ],
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append source: %" PRIs_SYSTEM ".\n",
+			 argv[ source_index ] );
+
+			goto on_error;
+		}
+	}
+	if( libscca_filename_index_builder_initialize(
+	     &builder,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize filename index builder.\n" );
+
+		goto on_error;
+	}
+	for( source_index = 0;
+	     source_index < source_list->number_of_sources;
+	     source_index++ )
+	{
+		result = sccaindex_append_source(
+		          builder,
+		          source_list->sources[ source_index ],
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to index source: %" PRIs_SYSTEM ".\n",
+			 source_list->sources[ source_index ] );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source: %" PRIs_SYSTEM ", skipping.\n",
+			 source_list->sources[ source_index ] );
+
+			number_of_failed_sources++;
+		}
+	}
+	if( sccaindex_write_index(
+	     builder,
+	     option_index_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write index file: %" PRIs_SYSTEM ".\n",
+		 option_index_file );
+
+		goto on_error;
+	}
+	if( libscca_filename_index_builder_get_number_of_keys(
+	     builder,
+	     &number_of_keys,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve number of keys.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Indexed %d filenames of %d sources.\n",
+	 number_of_keys,
+	 source_list->number_of_sources - number_of_failed_sources );
+
+	if( libscca_filename_index_builder_free(
+	     &builder,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free filename index builder.\n" );
+
+		goto on_error;
+	}
+	if( source_list_free(
+	     &source_list,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source list.\n" );
+
+		goto on_error;
+	}
+	if( number_of_failed_sources > 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( builder != NULL )
+	{
+		libscca_filename_index_builder_free(
+		 &builder,
+		 NULL );
+	}
+	if( source_list != NULL )
+	{
+		source_list_free(
+		 &source_list,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
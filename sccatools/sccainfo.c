@@ -40,6 +40,7 @@
 #include <unistd.h>
 #endif
 
+#include "batch_handle.h"
 #include "info_handle.h"
 #include "sccatools_getopt.h"
 #include "sccatools_libcerror.h"
@@ -49,9 +50,12 @@
 #include "sccatools_output.h"
 #include "sccatools_signal.h"
 #include "sccatools_unused.h"
+#include "source_list.h"
+#include "tar_reader.h"
 
-info_handle_t *sccainfo_info_handle = NULL;
-int sccainfo_abort                  = 0;
+batch_handle_t *sccainfo_batch_handle = NULL;
+info_handle_t *sccainfo_info_handle   = NULL;
+int sccainfo_abort                    = 0;
 
 /* Signal handler for sccainfo
  */
@@ -65,6 +69,22 @@ void sccainfo_signal_handler(
 
 	sccainfo_abort = 1;
 
+	if( sccainfo_batch_handle != NULL )
+	{
+		if( batch_handle_signal_abort(
+		     sccainfo_batch_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal batch handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	if( sccainfo_info_handle != NULL )
 	{
 		if( info_handle_signal_abort(
@@ -97,6 +117,183 @@ void sccainfo_signal_handler(
 	}
 }
 
+/* Processes the sources in batch mode
+ * When a tar archive is specified its members are processed instead of the source list
+ * Returns 1 if successful, 0 if one or more sources could not be processed or -1 on error
+ */
+int sccainfo_process_batch(
+     const char *program,
+     source_list_t *source_list,
+     const system_character_t *tar_filename,
+     int number_of_jobs,
+     const system_character_t *option_output_format,
+     const system_character_t *option_fields,
+     libcerror_error_t **error )
+{
+	tar_reader_t *tar_reader = NULL;
+	static char *function    = "sccainfo_process_batch";
+	int result               = 0;
+
+	if( batch_handle_initialize(
+	     &sccainfo_batch_handle,
+	     number_of_jobs,
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize batch handle.\n" );
+
+		goto on_error;
+	}
+	if( option_output_format != NULL )
+	{
+		result = batch_handle_set_output_format(
+		          sccainfo_batch_handle,
+		          option_output_format,
+		          error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format defaulting to: text.\n" );
+		}
+	}
+	if( option_fields != NULL )
+	{
+		result = batch_handle_set_fields(
+		          sccainfo_batch_handle,
+		          option_fields,
+		          error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set fields.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported fields defaulting to: all.\n" );
+		}
+	}
+	if( sccainfo_batch_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_TEXT )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	if( tar_filename != NULL )
+	{
+		if( tar_reader_initialize(
+		     &tar_reader,
+		     error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize tar reader.\n" );
+
+			goto on_error;
+		}
+		if( tar_reader_open(
+		     tar_reader,
+		     tar_filename,
+		     error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open tar archive: %" PRIs_SYSTEM ".\n",
+			 tar_filename );
+
+			goto on_error;
+		}
+		result = batch_handle_process_tar_stream(
+		          sccainfo_batch_handle,
+		          tar_reader,
+		          error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to process tar archive.\n" );
+
+			goto on_error;
+		}
+		if( tar_reader_free(
+		     &tar_reader,
+		     error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free tar reader.\n" );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		result = batch_handle_process_sources(
+		          sccainfo_batch_handle,
+		          source_list,
+		          error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to process sources.\n" );
+
+			goto on_error;
+		}
+	}
+	if( batch_handle_free(
+	     &sccainfo_batch_handle,
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free batch handle.\n" );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: unable to process sources in batch mode.",
+	 function );
+
+	if( tar_reader != NULL )
+	{
+		tar_reader_free(
+		 &tar_reader,
+		 NULL );
+	}
+	if( sccainfo_batch_handle != NULL )
+	{
+		batch_handle_free(
+		 &sccainfo_batch_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -109,21 +306,38 @@ int main( int argc, char * const argv[] )
 		"Use sccainfo to determine information about a Windows Prefetch File (PF).";
 
 	sccatools_option_t options[ ] = {
+		{ 'f', "filelist", "read the sources from a file that contains one source per line" },
+		{ 'F', "fields", "comma separated list of fields to print, options: all (default), format_version, hash, executable, run_count, last_run_times, file_metrics, filenames, volumes" },
 		{ 'h', NULL, "shows this help" },
+		{ 'j', "jobs", "number of concurrent jobs (threads) used for multiple sources, between 1 and 32, default is 4" },
+		{ 'o', "format", "output format, options: text (default), jsonl" },
+		{ 't', "tarfile", "read the sources from the regular file members of a tar archive, use - to read the archive from stdin" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
-		{ 0, "source", "the source file" },
+		{ 0, "source", "the source file or directory, multiple sources can be specified" },
 	};
 	system_character_t options_string[ 32 ];
 
-	libscca_error_t *error     = NULL;
-	system_character_t *source = NULL;
-	char *program              = "sccainfo";
-	system_integer_t option    = 0;
-	int number_of_options      = (int) ( sizeof( options ) / sizeof( sccatools_option_t ) );
-	int verbose                = 0;
+	libscca_error_t *error                   = NULL;
+	source_list_t *source_list               = NULL;
+	system_character_t *option_fields        = NULL;
+	system_character_t *option_filelist      = NULL;
+	system_character_t *option_jobs          = NULL;
+	system_character_t *option_output_format = NULL;
+	system_character_t *option_tarfile       = NULL;
+	system_character_t *source               = NULL;
+	char *program                            = "sccainfo";
+	system_integer_t option                  = 0;
+	size_t string_index                      = 0;
+	int batch_mode                           = 0;
+	int number_of_jobs                       = BATCH_HANDLE_DEFAULT_NUMBER_OF_JOBS;
+	int number_of_options                    = (int) ( sizeof( options ) / sizeof( sccatools_option_t ) );
+	int result                               = 0;
+	int source_index                         = 0;
+	int verbose                              = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdin ), _O_BINARY );
 	_setmode( _fileno( stdout ), _O_BINARY );
 	_setmode( _fileno( stderr ), _O_BINARY );
 #endif
@@ -154,10 +368,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	sccatools_output_version_fprint(
-	 stdout,
-	 program );
-
 	if( sccatools_getopt_get_options_string(
 	     options,
 	     number_of_options,
@@ -179,6 +389,10 @@ int main( int argc, char * const argv[] )
 		{
 			case (system_integer_t) '?':
 			default:
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -193,7 +407,21 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'f':
+				option_filelist = optarg;
+
+				break;
+
+			case (system_integer_t) 'F':
+				option_fields = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
 				sccatools_getopt_usage_fprint(
 				 stdout,
 				 program,
@@ -203,20 +431,59 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'j':
+				option_jobs = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_output_format = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_tarfile = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
 				break;
 
 			case (system_integer_t) 'V':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
 				sccatools_output_copyright_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 		}
 	}
-	if( optind == argc )
+	if( ( option_tarfile != NULL )
+	 && ( ( optind != argc )
+	  ||  ( option_filelist != NULL ) ) )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "A tar archive cannot be combined with other sources.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( optind == argc )
+	 && ( option_filelist == NULL )
+	 && ( option_tarfile == NULL ) )
 	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
 		fprintf(
 		 stderr,
 		 "Missing source file.\n" );
@@ -230,8 +497,6 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind ];
-
 	libcnotify_verbose_set(
 	 verbose );
 	libscca_notify_set_stream(
@@ -240,6 +505,138 @@ int main( int argc, char * const argv[] )
 	libscca_notify_set_verbose(
 	 verbose );
 
+	if( option_jobs != NULL )
+	{
+		number_of_jobs = 0;
+
+		for( string_index = 0;
+		     option_jobs[ string_index ] != 0;
+		     string_index++ )
+		{
+			if( ( option_jobs[ string_index ] < (system_character_t) '0' )
+			 || ( option_jobs[ string_index ] > (system_character_t) '9' )
+			 || ( number_of_jobs > BATCH_HANDLE_MAXIMUM_NUMBER_OF_JOBS ) )
+			{
+				number_of_jobs = 0;
+
+				break;
+			}
+			number_of_jobs *= 10;
+			number_of_jobs += (int) ( option_jobs[ string_index ] - (system_character_t) '0' );
+		}
+		if( ( number_of_jobs < 1 )
+		 || ( number_of_jobs > BATCH_HANDLE_MAXIMUM_NUMBER_OF_JOBS ) )
+		{
+			number_of_jobs = BATCH_HANDLE_DEFAULT_NUMBER_OF_JOBS;
+
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs defaulting to: %d.\n",
+			 number_of_jobs );
+		}
+	}
+	/* Multiple sources, a file list or a directory are processed in batch mode
+	 */
+	if( source_list_initialize(
+	     &source_list,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize source list.\n" );
+
+		goto on_error;
+	}
+	if( option_filelist != NULL )
+	{
+		if( source_list_read_file(
+		     source_list,
+		     option_filelist,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read file list.\n" );
+
+			goto on_error;
+		}
+		batch_mode = 1;
+	}
+	if( ( option_tarfile != NULL )
+	 || ( ( argc - optind ) > 1 ) )
+	{
+		batch_mode = 1;
+	}
+	for( source_index = optind;
+	     source_index < argc;
+	     source_index++ )
+	{
+		result = source_list_append_path(
+		          source_list,
+		          argv[ source_index ],
+		          &error );
+
+		if( result == -1 )
+		{
+			/* In batch mode the error is reported when the source is processed
+			 */
+			libcerror_error_free(
+			 &error );
+
+			result = source_list_append_source(
+			          source_list,
+			          argv[ source_index ],
+			          system_string_length(
+			           argv[ source_index ] ),
+			          &error );
+
+			if( result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to append source.\n" );
+
+				goto on_error;
+			}
+		}
+		else if( result == 2 )
+		{
+			batch_mode = 1;
+		}
+	}
+	if( batch_mode != 0 )
+	{
+		result = sccainfo_process_batch(
+		          program,
+		          source_list,
+		          option_tarfile,
+		          number_of_jobs,
+		          option_output_format,
+		          option_fields,
+		          &error );
+
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		if( source_list_free(
+		     &source_list,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free source list.\n" );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			return( EXIT_FAILURE );
+		}
+		return( EXIT_SUCCESS );
+	}
+	source = argv[ optind ];
+
 	if( info_handle_initialize(
 	     &sccainfo_info_handle,
 	     &error ) != 1 )
@@ -250,6 +647,58 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( option_output_format != NULL )
+	{
+		result = info_handle_set_output_format(
+		          sccainfo_info_handle,
+		          option_output_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format defaulting to: text.\n" );
+		}
+	}
+	if( option_fields != NULL )
+	{
+		result = info_handle_set_fields(
+		          sccainfo_info_handle,
+		          option_fields,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set fields.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported fields defaulting to: all.\n" );
+		}
+	}
+	/* The version is not printed for machine readable output formats
+	 */
+	if( sccainfo_info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_TEXT )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+	}
 	if( info_handle_open_input(
 	     sccainfo_info_handle,
 	     source,
@@ -291,6 +740,16 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( source_list_free(
+	     &source_list,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source list.\n" );
+
+		goto on_error;
+	}
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -307,6 +766,12 @@ on_error:
 		 &sccainfo_info_handle,
 		 NULL );
 	}
+	if( source_list != NULL )
+	{
+		source_list_free(
+		 &source_list,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
 
@@ -0,0 +1,649 @@
+/*
+ * Looks up filenames in a filename index of Windows Prefetch Files (PF).
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mapped_file.h"
+#include "sccatools_getopt.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libclocale.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libscca.h"
+#include "sccatools_libuna.h"
+#include "sccatools_output.h"
+
+/* Converts a query into a normalized UTF-16 string
+ * Returns 1 if successful or -1 on error
+ */
+int sccalookup_get_utf16_query(
+     const system_character_t *query,
+     uint16_t **utf16_string,
+     size_t *utf16_string_length,
+     libcerror_error_t **error )
+{
+	uint16_t *safe_utf16_string   = NULL;
+	static char *function         = "sccalookup_get_utf16_query";
+	size_t query_length           = 0;
+	size_t safe_utf16_string_size = 0;
+
+	if( query == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string length.",
+		 function );
+
+		return( -1 );
+	}
+	query_length = system_string_length(
+	                query );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && ( SIZEOF_WCHAR_T == 2 )
+	safe_utf16_string_size = query_length + 1;
+#else
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libuna_utf16_string_size_from_utf32(
+	     (libuna_utf32_character_t *) query,
+	     query_length + 1,
+	     &safe_utf16_string_size,
+	     error ) != 1 )
+#else
+	if( libuna_utf16_string_size_from_utf8(
+	     (libuna_utf8_character_t *) query,
+	     query_length + 1,
+	     &safe_utf16_string_size,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-16 string size.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) && ( SIZEOF_WCHAR_T == 2 ) */
+
+	if( ( safe_utf16_string_size == 0 )
+	 || ( safe_utf16_string_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_utf16_string = (uint16_t *) memory_allocate(
+	                                  sizeof( uint16_t ) * safe_utf16_string_size );
+
+	if( safe_utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && ( SIZEOF_WCHAR_T == 2 )
+	if( memory_copy(
+	     safe_utf16_string,
+	     query,
+	     sizeof( uint16_t ) * safe_utf16_string_size ) == NULL )
+#elif defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libuna_utf16_string_copy_from_utf32(
+	     (libuna_utf16_character_t *) safe_utf16_string,
+	     safe_utf16_string_size,
+	     (libuna_utf32_character_t *) query,
+	     query_length + 1,
+	     error ) != 1 )
+#else
+	if( libuna_utf16_string_copy_from_utf8(
+	     (libuna_utf16_character_t *) safe_utf16_string,
+	     safe_utf16_string_size,
+	     (libuna_utf8_character_t *) query,
+	     query_length + 1,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	/* The keys in the index are normalized the same way
+	 */
+	if( libscca_upper_case_utf16_string(
+	     safe_utf16_string,
+	     safe_utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to upper case UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	*utf16_string_length = 0;
+
+	while( ( *utf16_string_length < safe_utf16_string_size )
+	    && ( safe_utf16_string[ *utf16_string_length ] != 0 ) )
+	{
+		*utf16_string_length += 1;
+	}
+	*utf16_string = safe_utf16_string;
+
+	return( 1 );
+
+on_error:
+	if( safe_utf16_string != NULL )
+	{
+		memory_free(
+		 safe_utf16_string );
+	}
+	return( -1 );
+}
+
+/* Prints the sources that reference a specific filename
+ * Returns 1 if successful, 0 if the filename was not found or -1 on error
+ */
+int sccalookup_query_fprint(
+     libscca_filename_index_t *filename_index,
+     const system_character_t *query,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_path          = NULL;
+	uint16_t *utf16_string      = NULL;
+	static char *function       = "sccalookup_query_fprint";
+	size_t utf16_string_length  = 0;
+	size_t utf8_path_size       = 0;
+	uint32_t first_posting      = 0;
+	uint32_t metrics_index      = 0;
+	uint32_t number_of_postings = 0;
+	uint32_t posting_index      = 0;
+	uint32_t source_index       = 0;
+	int result                  = 0;
+
+	if( sccalookup_get_utf16_query(
+	     query,
+	     &utf16_string,
+	     &utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 query.",
+		 function );
+
+		goto on_error;
+	}
+	result = libscca_filename_index_find_utf16_filename(
+	          filename_index,
+	          utf16_string,
+	          utf16_string_length,
+	          &first_posting,
+	          &number_of_postings,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to find filename.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf16_string );
+
+	utf16_string = NULL;
+
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	for( posting_index = first_posting;
+	     posting_index < first_posting + number_of_postings;
+	     posting_index++ )
+	{
+		if( libscca_filename_index_get_posting(
+		     filename_index,
+		     posting_index,
+		     &source_index,
+		     &metrics_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve posting: %" PRIu32 ".",
+			 function,
+			 posting_index );
+
+			goto on_error;
+		}
+		if( libscca_filename_index_get_utf8_source_path_size(
+		     filename_index,
+		     source_index,
+		     &utf8_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %" PRIu32 " path size.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		utf8_path = (uint8_t *) memory_allocate(
+		                         sizeof( uint8_t ) * utf8_path_size );
+
+		if( utf8_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create source path.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_filename_index_get_utf8_source_path(
+		     filename_index,
+		     source_index,
+		     utf8_path,
+		     utf8_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %" PRIu32 " path.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		fprintf(
+		 stream,
+		 "%s\t%" PRIu32 "\n",
+		 (char *) utf8_path,
+		 metrics_index );
+
+		memory_free(
+		 utf8_path );
+
+		utf8_path = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( utf8_path != NULL )
+	{
+		memory_free(
+		 utf8_path );
+	}
+	if( utf16_string != NULL )
+	{
+		memory_free(
+		 utf16_string );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use sccalookup to find the Windows Prefetch Files (PF) that reference a filename in an index created by sccaindex.";
+
+	sccatools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "index_file", "the index file" },
+		{ 0, "filename", "the filename or full path to look up, case insensitive, multiple filenames can be specified" },
+	};
+	system_character_t options_string[ 16 ];
+
+	libscca_error_t *error                   = NULL;
+	libscca_filename_index_t *filename_index = NULL;
+	mapped_file_t *mapped_file               = NULL;
+	char *program                            = "sccalookup";
+	system_integer_t option                  = 0;
+	int number_of_missing_queries            = 0;
+	int number_of_options                    = (int) ( sizeof( options ) / sizeof( sccatools_option_t ) );
+	int query_index                          = 0;
+	int result                               = 0;
+	int verbose                              = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "sccatools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     16 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				sccatools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( ( argc - optind ) < 2 )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing index file or filename.\n" );
+
+		sccatools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libscca_notify_set_stream(
+	 stderr,
+	 NULL );
+	libscca_notify_set_verbose(
+	 verbose );
+
+	if( mapped_file_initialize(
+	     &mapped_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize mapped file.\n" );
+
+		goto on_error;
+	}
+	if( mapped_file_open(
+	     mapped_file,
+	     argv[ optind ],
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open index file: %" PRIs_SYSTEM ".\n",
+		 argv[ optind ] );
+
+		goto on_error;
+	}
+	if( libscca_filename_index_initialize(
+	     &filename_index,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize filename index.\n" );
+
+		goto on_error;
+	}
+	if( libscca_filename_index_set_data(
+	     filename_index,
+	     mapped_file->data,
+	     mapped_file->data_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read index file: %" PRIs_SYSTEM ".\n",
+		 argv[ optind ] );
+
+		goto on_error;
+	}
+	for( query_index = optind + 1;
+	     query_index < argc;
+	     query_index++ )
+	{
+		result = sccalookup_query_fprint(
+		          filename_index,
+		          argv[ query_index ],
+		          stdout,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to look up filename: %" PRIs_SYSTEM ".\n",
+			 argv[ query_index ] );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "No such filename: %" PRIs_SYSTEM ".\n",
+			 argv[ query_index ] );
+
+			number_of_missing_queries++;
+		}
+	}
+	if( libscca_filename_index_free(
+	     &filename_index,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free filename index.\n" );
+
+		goto on_error;
+	}
+	if( mapped_file_free(
+	     &mapped_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free mapped file.\n" );
+
+		goto on_error;
+	}
+	if( number_of_missing_queries > 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index != NULL )
+	{
+		libscca_filename_index_free(
+		 &filename_index,
+		 NULL );
+	}
+	if( mapped_file != NULL )
+	{
+		mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
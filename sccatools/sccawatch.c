@@ -0,0 +1,797 @@
+/*
+ * Watches directories for created, modified and removed Windows Prefetch Files (PF).
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+/* inotify is only supported with narrow system character paths
+ */
+#if defined( HAVE_SYS_INOTIFY_H ) && defined( HAVE_DIRENT_H ) && !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define SCCAWATCH_HAVE_INOTIFY
+#endif
+
+#if defined( SCCAWATCH_HAVE_INOTIFY )
+#include <dirent.h>
+#include <errno.h>
+#include <sys/inotify.h>
+#endif
+
+#include "sccatools_getopt.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libclocale.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libscca.h"
+#include "sccatools_output.h"
+#include "sccatools_signal.h"
+#include "sccatools_unused.h"
+#include "watch_handle.h"
+
+/* The size of the buffer used to read inotify events
+ */
+#define SCCAWATCH_EVENT_BUFFER_SIZE	65536
+
+watch_handle_t *sccawatch_watch_handle = NULL;
+int sccawatch_inotify_descriptor       = -1;
+int sccawatch_abort                    = 0;
+
+#if defined( SCCAWATCH_HAVE_INOTIFY )
+
+/* Signal handler for sccawatch
+ */
+void sccawatch_signal_handler(
+      sccatools_signal_t signal SCCATOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "sccawatch_signal_handler";
+	int inotify_descriptor   = 0;
+
+	SCCATOOLS_UNREFERENCED_PARAMETER( signal )
+
+	sccawatch_abort = 1;
+
+	if( sccawatch_watch_handle != NULL )
+	{
+		if( watch_handle_signal_abort(
+		     sccawatch_watch_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal watch handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Close the inotify descriptor otherwise read will remain blocked
+	 */
+	inotify_descriptor = sccawatch_inotify_descriptor;
+
+	if( inotify_descriptor != -1 )
+	{
+		sccawatch_inotify_descriptor = -1;
+
+		if( close(
+		     inotify_descriptor ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to close inotify descriptor.\n",
+			 function );
+		}
+	}
+}
+
+/* Processes a directory entry
+ * Returns 1 if an event was reported, 0 if not or -1 on error
+ */
+int sccawatch_process_directory_entry(
+     watch_handle_t *watch_handle,
+     const char *directory,
+     const char *name,
+     uint8_t is_removed,
+     uint8_t report_events,
+     libcerror_error_t **error )
+{
+	char *path              = NULL;
+	static char *function   = "sccawatch_process_directory_entry";
+	size_t directory_length = 0;
+	size_t name_length      = 0;
+	size_t path_size        = 0;
+	int result              = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	directory_length = narrow_string_length(
+	                    directory );
+
+	name_length = narrow_string_length(
+	               name );
+
+	if( watch_handle_path_is_prefetch_file(
+	     name,
+	     name_length ) == 0 )
+	{
+		return( 0 );
+	}
+	while( ( directory_length > 1 )
+	    && ( directory[ directory_length - 1 ] == '/' ) )
+	{
+		directory_length--;
+	}
+	path_size = directory_length + name_length + 2;
+
+	path = narrow_string_allocate(
+	        path_size );
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     path,
+	     directory,
+	     directory_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory to path.",
+		 function );
+
+		goto on_error;
+	}
+	path[ directory_length ] = '/';
+
+	if( narrow_string_copy(
+	     &( path[ directory_length + 1 ] ),
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to path.",
+		 function );
+
+		goto on_error;
+	}
+	path[ path_size - 1 ] = 0;
+
+	if( is_removed != 0 )
+	{
+		result = watch_handle_remove_file(
+		          watch_handle,
+		          path,
+		          error );
+	}
+	else
+	{
+		result = watch_handle_process_file(
+		          watch_handle,
+		          path,
+		          report_events,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process: %s.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	memory_free(
+	 path );
+
+	return( result );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( -1 );
+}
+
+/* Reads the prefetch files in a directory, sub directories are not read
+ * Returns 1 if successful or -1 on error
+ */
+int sccawatch_scan_directory(
+     watch_handle_t *watch_handle,
+     const char *directory,
+     uint8_t report_events,
+     libcerror_error_t **error )
+{
+	struct dirent *directory_entry = NULL;
+	DIR *directory_stream          = NULL;
+	static char *function          = "sccawatch_scan_directory";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	directory_stream = opendir(
+	                    directory );
+
+	if( directory_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %s.",
+		 function,
+		 directory );
+
+		return( -1 );
+	}
+	while( watch_handle->abort == 0 )
+	{
+		directory_entry = readdir(
+		                   directory_stream );
+
+		if( directory_entry == NULL )
+		{
+			break;
+		}
+		if( sccawatch_process_directory_entry(
+		     watch_handle,
+		     directory,
+		     directory_entry->d_name,
+		     0,
+		     report_events,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	closedir(
+	 directory_stream );
+
+	return( 1 );
+
+on_error:
+	closedir(
+	 directory_stream );
+
+	return( -1 );
+}
+
+#endif /* defined( SCCAWATCH_HAVE_INOTIFY ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use sccawatch to watch directories for created, modified and removed Windows Prefetch Files (PF). Only the files that changed are read again and every change is written as a JSON object on a single line.";
+
+	sccatools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "directory", "the directory to watch, multiple directories can be specified" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libscca_error_t *error                = NULL;
+	char *program                         = "sccawatch";
+	system_integer_t option               = 0;
+	int number_of_options                 = (int) ( sizeof( options ) / sizeof( sccatools_option_t ) );
+	int verbose                           = 0;
+
+#if defined( SCCAWATCH_HAVE_INOTIFY )
+	struct inotify_event *inotify_event   = NULL;
+	libcerror_error_t *event_error        = NULL;
+	uint8_t *event_buffer                 = NULL;
+	int *watch_descriptors                = NULL;
+	ssize_t read_count                    = 0;
+	size_t event_buffer_offset            = 0;
+	int directory_index                   = 0;
+	int number_of_directories             = 0;
+	int number_of_watched_directories     = 0;
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "sccatools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				sccatools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing directory.\n" );
+
+		sccatools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libscca_notify_set_stream(
+	 stderr,
+	 NULL );
+	libscca_notify_set_verbose(
+	 verbose );
+
+#if !defined( SCCAWATCH_HAVE_INOTIFY )
+	sccatools_output_version_fprint(
+	 stdout,
+	 program );
+
+	fprintf(
+	 stderr,
+	 "Watching directories is not supported on this platform.\n" );
+
+	return( EXIT_FAILURE );
+#else
+	number_of_directories = argc - optind;
+
+	watch_descriptors = (int *) memory_allocate(
+	                             sizeof( int ) * number_of_directories );
+
+	event_buffer = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * SCCAWATCH_EVENT_BUFFER_SIZE );
+
+	if( ( watch_descriptors == NULL )
+	 || ( event_buffer == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffers.\n" );
+
+		goto on_error;
+	}
+	if( watch_handle_initialize(
+	     &sccawatch_watch_handle,
+	     stdout,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize watch handle.\n" );
+
+		goto on_error;
+	}
+	sccawatch_inotify_descriptor = inotify_init();
+
+	if( sccawatch_inotify_descriptor == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize inotify.\n" );
+
+		goto on_error;
+	}
+	/* The directories are watched before they are read so that no change is missed
+	 */
+	for( directory_index = 0;
+	     directory_index < number_of_directories;
+	     directory_index++ )
+	{
+		watch_descriptors[ directory_index ] = inotify_add_watch(
+		                                        sccawatch_inotify_descriptor,
+		                                        argv[ optind + directory_index ],
+		                                        IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_ONLYDIR );
+
+		if( watch_descriptors[ directory_index ] == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to watch directory: %" PRIs_SYSTEM ".\n",
+			 argv[ optind + directory_index ] );
+
+			goto on_error;
+		}
+		number_of_watched_directories++;
+	}
+	for( directory_index = 0;
+	     directory_index < number_of_directories;
+	     directory_index++ )
+	{
+		if( sccawatch_scan_directory(
+		     sccawatch_watch_handle,
+		     argv[ optind + directory_index ],
+		     0,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read directory: %" PRIs_SYSTEM ".\n",
+			 argv[ optind + directory_index ] );
+
+			goto on_error;
+		}
+	}
+	if( sccatools_signal_attach(
+	     sccawatch_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	while( ( sccawatch_abort == 0 )
+	    && ( number_of_watched_directories > 0 ) )
+	{
+		read_count = read(
+		              sccawatch_inotify_descriptor,
+		              event_buffer,
+		              SCCAWATCH_EVENT_BUFFER_SIZE );
+
+		if( read_count <= 0 )
+		{
+			if( ( sccawatch_abort == 0 )
+			 && ( read_count == -1 )
+			 && ( errno == EINTR ) )
+			{
+				continue;
+			}
+			break;
+		}
+		for( event_buffer_offset = 0;
+		     ( event_buffer_offset + sizeof( struct inotify_event ) ) <= (size_t) read_count;
+		     event_buffer_offset += sizeof( struct inotify_event ) + inotify_event->len )
+		{
+			inotify_event = (struct inotify_event *) &( event_buffer[ event_buffer_offset ] );
+
+			if( ( inotify_event->mask & IN_Q_OVERFLOW ) != 0 )
+			{
+				/* Events were lost, compare all files to their previous state
+				 */
+				for( directory_index = 0;
+				     directory_index < number_of_directories;
+				     directory_index++ )
+				{
+					if( watch_descriptors[ directory_index ] == -1 )
+					{
+						continue;
+					}
+					if( sccawatch_scan_directory(
+					     sccawatch_watch_handle,
+					     argv[ optind + directory_index ],
+					     1,
+					     &event_error ) != 1 )
+					{
+						libcnotify_print_error_backtrace(
+						 event_error );
+						libcerror_error_free(
+						 &event_error );
+					}
+				}
+				continue;
+			}
+			for( directory_index = 0;
+			     directory_index < number_of_directories;
+			     directory_index++ )
+			{
+				if( watch_descriptors[ directory_index ] == inotify_event->wd )
+				{
+					break;
+				}
+			}
+			if( directory_index >= number_of_directories )
+			{
+				continue;
+			}
+			if( ( inotify_event->mask & IN_IGNORED ) != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Directory no longer watched: %" PRIs_SYSTEM ".\n",
+				 argv[ optind + directory_index ] );
+
+				watch_descriptors[ directory_index ] = -1;
+
+				number_of_watched_directories--;
+
+				continue;
+			}
+			if( ( inotify_event->len == 0 )
+			 || ( ( inotify_event->mask & IN_ISDIR ) != 0 ) )
+			{
+				continue;
+			}
+			if( sccawatch_process_directory_entry(
+			     sccawatch_watch_handle,
+			     argv[ optind + directory_index ],
+			     inotify_event->name,
+			     (uint8_t) ( ( inotify_event->mask & ( IN_MOVED_FROM | IN_DELETE ) ) != 0 ),
+			     1,
+			     &error ) == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to process event.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	if( sccatools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( sccawatch_abort == 0 )
+	{
+		if( number_of_watched_directories == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "No directories left to watch.\n" );
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read inotify events.\n" );
+		}
+	}
+	if( sccawatch_inotify_descriptor != -1 )
+	{
+		close(
+		 sccawatch_inotify_descriptor );
+
+		sccawatch_inotify_descriptor = -1;
+	}
+	if( watch_handle_free(
+	     &sccawatch_watch_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free watch handle.\n" );
+
+		goto on_error;
+	}
+	memory_free(
+	 event_buffer );
+
+	event_buffer = NULL;
+
+	memory_free(
+	 watch_descriptors );
+
+	watch_descriptors = NULL;
+
+	if( sccawatch_abort == 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+#endif /* !defined( SCCAWATCH_HAVE_INOTIFY ) */
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( SCCAWATCH_HAVE_INOTIFY )
+	if( sccawatch_inotify_descriptor != -1 )
+	{
+		close(
+		 sccawatch_inotify_descriptor );
+
+		sccawatch_inotify_descriptor = -1;
+	}
+	if( event_buffer != NULL )
+	{
+		memory_free(
+		 event_buffer );
+	}
+	if( watch_descriptors != NULL )
+	{
+		memory_free(
+		 watch_descriptors );
+	}
+#endif
+	if( sccawatch_watch_handle != NULL )
+	{
+		watch_handle_free(
+		 &sccawatch_watch_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
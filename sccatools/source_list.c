@@ -0,0 +1,1123 @@
+/*
+ * Source list functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#else
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#endif /* defined( WINAPI ) */
+
+#include "source_list.h"
+#include "sccatools_libcerror.h"
+
+#if defined( WINAPI )
+#define SOURCE_LIST_PATH_SEPARATOR	'\\'
+#else
+#define SOURCE_LIST_PATH_SEPARATOR	'/'
+#endif
+
+/* Creates a source list
+ * Make sure the value source_list is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int source_list_initialize(
+     source_list_t **source_list,
+     libcerror_error_t **error )
+{
+	static char *function = "source_list_initialize";
+
+	if( source_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid source list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*source_list = memory_allocate_structure(
+	                source_list_t );
+
+	if( *source_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source list.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *source_list,
+	     0,
+	     sizeof( source_list_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear source list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *source_list != NULL )
+	{
+		memory_free(
+		 *source_list );
+
+		*source_list = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a source list
+ * Returns 1 if successful or -1 on error
+ */
+int source_list_free(
+     source_list_t **source_list,
+     libcerror_error_t **error )
+{
+	static char *function = "source_list_free";
+	int source_index      = 0;
+
+	if( source_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source_list != NULL )
+	{
+		if( ( *source_list )->sources != NULL )
+		{
+			for( source_index = 0;
+			     source_index < ( *source_list )->number_of_sources;
+			     source_index++ )
+			{
+				memory_free(
+				 ( *source_list )->sources[ source_index ] );
+			}
+			memory_free(
+			 ( *source_list )->sources );
+		}
+		memory_free(
+		 *source_list );
+
+		*source_list = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two sources
+ * Returns a negative value if first < second, 0 if equal or a positive value if first > second
+ */
+int source_list_compare_sources(
+     const void *first_source,
+     const void *second_source )
+{
+	const system_character_t *first_string  = NULL;
+	const system_character_t *second_string = NULL;
+
+	first_string  = *( (const system_character_t * const *) first_source );
+	second_string = *( (const system_character_t * const *) second_source );
+
+	while( ( *first_string != 0 )
+	    && ( *first_string == *second_string ) )
+	{
+		first_string++;
+		second_string++;
+	}
+	if( *first_string < *second_string )
+	{
+		return( -1 );
+	}
+	else if( *first_string > *second_string )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Appends a source
+ * Returns 1 if successful or -1 on error
+ */
+int source_list_append_source(
+     source_list_t *source_list,
+     const system_character_t *source,
+     size_t source_length,
+     libcerror_error_t **error )
+{
+	system_character_t *safe_source = NULL;
+	void *reallocation              = NULL;
+	static char *function           = "source_list_append_source";
+	int number_of_allocated_sources = 0;
+
+	if( source_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source list.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_length == 0 )
+	 || ( source_length >= (size_t) SOURCE_LIST_MAXIMUM_PATH_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_list->number_of_sources >= source_list->number_of_allocated_sources )
+	{
+		if( source_list->number_of_allocated_sources == 0 )
+		{
+			number_of_allocated_sources = 64;
+		}
+		else if( source_list->number_of_allocated_sources < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_sources = source_list->number_of_allocated_sources * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of sources value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) number_of_allocated_sources > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated sources value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                source_list->sources,
+		                sizeof( system_character_t * ) * number_of_allocated_sources );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize sources.",
+			 function );
+
+			return( -1 );
+		}
+		source_list->sources                     = (system_character_t **) reallocation;
+		source_list->number_of_allocated_sources = number_of_allocated_sources;
+	}
+	safe_source = system_string_allocate(
+	               source_length + 1 );
+
+	if( safe_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     safe_source,
+	     source,
+	     source_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source.",
+		 function );
+
+		memory_free(
+		 safe_source );
+
+		return( -1 );
+	}
+	safe_source[ source_length ] = 0;
+
+	source_list->sources[ source_list->number_of_sources ] = safe_source;
+
+	source_list->number_of_sources += 1;
+
+	return( 1 );
+}
+
+/* Appends a path
+ * A directory is read recursively and every file it contains is appended
+ * Returns 1 if a file was appended, 2 if a directory was read or -1 on error
+ */
+int source_list_append_path(
+     source_list_t *source_list,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	DWORD file_attributes = 0;
+#else
+	struct stat file_status;
+#endif
+
+	static char *function = "source_list_append_path";
+	int is_directory      = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_attributes = GetFileAttributesW(
+	                   path );
+#else
+	file_attributes = GetFileAttributesA(
+	                   path );
+#endif
+	if( file_attributes == INVALID_FILE_ATTRIBUTES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine attributes of path: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	is_directory = (int) ( ( file_attributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 );
+
+#elif defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: wide character paths not supported.",
+	 function );
+
+	return( -1 );
+#else
+	if( stat(
+	     path,
+	     &file_status ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine status of path: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	is_directory = (int) S_ISDIR( file_status.st_mode );
+
+#endif /* defined( WINAPI ) */
+
+	if( is_directory != 0 )
+	{
+		if( source_list_append_directory(
+		     source_list,
+		     path,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory: %" PRIs_SYSTEM ".",
+			 function,
+			 path );
+
+			return( -1 );
+		}
+		return( 2 );
+	}
+	if( source_list_append_source(
+	     source_list,
+	     path,
+	     system_string_length(
+	      path ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the files in a directory and its sub directories
+ * The entries of every directory are appended in sorted order so that
+ * the resulting list does not depend on the order of the file system
+ * Symbolic links to directories are not followed
+ * Returns 1 if successful or -1 on error
+ */
+int source_list_append_directory(
+     source_list_t *source_list,
+     const system_character_t *path,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	WIN32_FIND_DATAW find_data;
+#else
+	WIN32_FIND_DATAA find_data;
+#endif
+
+	HANDLE find_handle                     = INVALID_HANDLE_VALUE;
+#else
+	struct stat file_status;
+
+	struct dirent *directory_entry         = NULL;
+	DIR *directory                         = NULL;
+#endif
+
+	source_list_t *entries_list            = NULL;
+	system_character_t *entry_path         = NULL;
+	const system_character_t *entry_name   = NULL;
+	static char *function                  = "source_list_append_directory";
+	size_t entry_name_length               = 0;
+	size_t entry_path_length               = 0;
+	size_t path_length                     = 0;
+	int entry_index                        = 0;
+	int is_directory                       = 0;
+	int is_file                            = 0;
+
+	if( source_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source list.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > SOURCE_LIST_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+	while( ( path_length > 1 )
+	    && ( path[ path_length - 1 ] == (system_character_t) SOURCE_LIST_PATH_SEPARATOR ) )
+	{
+		path_length--;
+	}
+	if( ( path_length == 0 )
+	 || ( path_length >= ( (size_t) SOURCE_LIST_MAXIMUM_PATH_SIZE - 3 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_path = system_string_allocate(
+	              SOURCE_LIST_MAXIMUM_PATH_SIZE );
+
+	if( entry_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     entry_path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	entry_path[ path_length++ ] = (system_character_t) SOURCE_LIST_PATH_SEPARATOR;
+
+	if( source_list_initialize(
+	     &entries_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries list.",
+		 function );
+
+		goto on_error;
+	}
+	/* Collect the full paths of the entries first so that they can be sorted
+	 */
+#if defined( WINAPI )
+	entry_path[ path_length ]     = (system_character_t) '*';
+	entry_path[ path_length + 1 ] = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	find_handle = FindFirstFileW(
+	               entry_path,
+	               &find_data );
+#else
+	find_handle = FindFirstFileA(
+	               entry_path,
+	               &find_data );
+#endif
+	if( find_handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	do
+	{
+		entry_name = find_data.cFileName;
+#else
+	directory = opendir(
+	             path );
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	while( ( directory_entry = readdir( directory ) ) != NULL )
+	{
+		entry_name = directory_entry->d_name;
+#endif
+		entry_name_length = system_string_length(
+		                     entry_name );
+
+		if( ( ( entry_name_length == 1 )
+		  &&  ( entry_name[ 0 ] == (system_character_t) '.' ) )
+		 || ( ( entry_name_length == 2 )
+		  &&  ( entry_name[ 0 ] == (system_character_t) '.' )
+		  &&  ( entry_name[ 1 ] == (system_character_t) '.' ) ) )
+		{
+			continue;
+		}
+		if( entry_name_length >= ( (size_t) SOURCE_LIST_MAXIMUM_PATH_SIZE - path_length ) )
+		{
+			continue;
+		}
+		if( system_string_copy(
+		     &( entry_path[ path_length ] ),
+		     entry_name,
+		     entry_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry name.",
+			 function );
+
+			goto on_error;
+		}
+		if( source_list_append_source(
+		     entries_list,
+		     entry_path,
+		     path_length + entry_name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( WINAPI )
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( FindNextFileW(
+	        find_handle,
+	        &find_data ) != 0 );
+#else
+	while( FindNextFileA(
+	        find_handle,
+	        &find_data ) != 0 );
+#endif
+	FindClose(
+	 find_handle );
+
+	find_handle = INVALID_HANDLE_VALUE;
+#else
+	}
+	closedir(
+	 directory );
+
+	directory = NULL;
+#endif
+	if( entries_list->number_of_sources > 1 )
+	{
+		qsort(
+		 entries_list->sources,
+		 (size_t) entries_list->number_of_sources,
+		 sizeof( system_character_t * ),
+		 &source_list_compare_sources );
+	}
+	for( entry_index = 0;
+	     entry_index < entries_list->number_of_sources;
+	     entry_index++ )
+	{
+		entry_name        = entries_list->sources[ entry_index ];
+		entry_path_length = system_string_length(
+		                     entry_name );
+
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		find_data.dwFileAttributes = GetFileAttributesW(
+		                              entry_name );
+#else
+		find_data.dwFileAttributes = GetFileAttributesA(
+		                              entry_name );
+#endif
+		if( find_data.dwFileAttributes == INVALID_FILE_ATTRIBUTES )
+		{
+			continue;
+		}
+		is_directory = (int) ( ( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 )
+		                    && ( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT ) == 0 ) );
+		is_file      = (int) ( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) == 0 );
+#else
+		if( lstat(
+		     entry_name,
+		     &file_status ) != 0 )
+		{
+			continue;
+		}
+		is_directory = (int) S_ISDIR( file_status.st_mode );
+		is_file      = (int) S_ISREG( file_status.st_mode );
+
+		if( S_ISLNK( file_status.st_mode ) )
+		{
+			if( stat(
+			     entry_name,
+			     &file_status ) != 0 )
+			{
+				continue;
+			}
+			is_file = (int) S_ISREG( file_status.st_mode );
+		}
+#endif
+		if( is_directory != 0 )
+		{
+			if( source_list_append_directory(
+			     source_list,
+			     entry_name,
+			     recursion_depth + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append directory: %" PRIs_SYSTEM ".",
+				 function,
+				 entry_name );
+
+				goto on_error;
+			}
+		}
+		else if( is_file != 0 )
+		{
+			if( source_list_append_source(
+			     source_list,
+			     entry_name,
+			     entry_path_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append source: %" PRIs_SYSTEM ".",
+				 function,
+				 entry_name );
+
+				goto on_error;
+			}
+		}
+	}
+	if( source_list_free(
+	     &entries_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free entries list.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 entry_path );
+
+	return( 1 );
+
+on_error:
+#if defined( WINAPI )
+	if( find_handle != INVALID_HANDLE_VALUE )
+	{
+		FindClose(
+		 find_handle );
+	}
+#else
+	if( directory != NULL )
+	{
+		closedir(
+		 directory );
+	}
+#endif
+	if( entries_list != NULL )
+	{
+		source_list_free(
+		 &entries_list,
+		 NULL );
+	}
+	if( entry_path != NULL )
+	{
+		memory_free(
+		 entry_path );
+	}
+	return( -1 );
+}
+
+/* Reads the sources from a file that contains one source per line
+ * Empty lines are ignored and directories are read recursively
+ * Returns 1 if successful or -1 on error
+ */
+int source_list_read_file(
+     source_list_t *source_list,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t *line = NULL;
+	static char *function    = "source_list_read_file";
+	FILE *stream             = NULL;
+	size_t line_length       = 0;
+	int line_number          = 0;
+
+	if( source_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source list.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	line = system_string_allocate(
+	        SOURCE_LIST_MAXIMUM_PATH_SIZE );
+
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	while( file_stream_at_end(
+	        stream ) == 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( file_stream_get_string_wide(
+		     stream,
+		     line,
+		     SOURCE_LIST_MAXIMUM_PATH_SIZE ) == NULL )
+#else
+		if( file_stream_get_string(
+		     stream,
+		     line,
+		     SOURCE_LIST_MAXIMUM_PATH_SIZE ) == NULL )
+#endif
+		{
+			break;
+		}
+		line_number++;
+
+		line_length = system_string_length(
+		               line );
+
+		if( ( line_length == ( SOURCE_LIST_MAXIMUM_PATH_SIZE - 1 ) )
+		 && ( line[ line_length - 1 ] != (system_character_t) '\n' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: line: %d exceeds maximum length.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == (system_character_t) '\n' )
+		     ||  ( line[ line_length - 1 ] == (system_character_t) '\r' ) ) )
+		{
+			line_length--;
+		}
+		if( line_length == 0 )
+		{
+			continue;
+		}
+		line[ line_length ] = 0;
+
+		if( source_list_append_path(
+		     source_list,
+		     line,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source of line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		stream = NULL;
+
+		goto on_error;
+	}
+	memory_free(
+	 line );
+
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( line != NULL )
+	{
+		memory_free(
+		 line );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of the file of a source
+ * Only the file system metadata is read, which makes the size a cheap estimate
+ * of the cost of processing the source
+ * Returns 1 if successful or -1 on error
+ */
+int source_list_get_file_size(
+     const system_character_t *source,
+     size64_t *file_size,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	WIN32_FILE_ATTRIBUTE_DATA file_attribute_data;
+#elif !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	struct stat file_status;
+#endif
+
+	static char *function = "source_list_get_file_size";
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( GetFileAttributesExW(
+	     source,
+	     GetFileExInfoStandard,
+	     &file_attribute_data ) == 0 )
+#else
+	if( GetFileAttributesExA(
+	     source,
+	     GetFileExInfoStandard,
+	     &file_attribute_data ) == 0 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine attributes of source: %" PRIs_SYSTEM ".",
+		 function,
+		 source );
+
+		return( -1 );
+	}
+	*file_size = ( (size64_t) file_attribute_data.nFileSizeHigh << 32 )
+	           | (size64_t) file_attribute_data.nFileSizeLow;
+
+#elif defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: wide character paths not supported.",
+	 function );
+
+	return( -1 );
+#else
+	if( stat(
+	     source,
+	     &file_status ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine status of source: %" PRIs_SYSTEM ".",
+		 function,
+		 source );
+
+		return( -1 );
+	}
+	if( file_status.st_size < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source - file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*file_size = (size64_t) file_status.st_size;
+
+#endif /* defined( WINAPI ) */
+
+	return( 1 );
+}
+
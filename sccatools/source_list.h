@@ -0,0 +1,99 @@
+/*
+ * Source list functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SOURCE_LIST_H )
+#define _SOURCE_LIST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum supported source path length, including the end-of-string character
+ */
+#define SOURCE_LIST_MAXIMUM_PATH_SIZE		32768
+
+/* The maximum directory recursion depth
+ */
+#define SOURCE_LIST_MAXIMUM_RECURSION_DEPTH	64
+
+typedef struct source_list source_list_t;
+
+struct source_list
+{
+	/* The sources
+	 */
+	system_character_t **sources;
+
+	/* The number of sources
+	 */
+	int number_of_sources;
+
+	/* The number of allocated sources
+	 */
+	int number_of_allocated_sources;
+};
+
+int source_list_initialize(
+     source_list_t **source_list,
+     libcerror_error_t **error );
+
+int source_list_free(
+     source_list_t **source_list,
+     libcerror_error_t **error );
+
+int source_list_append_source(
+     source_list_t *source_list,
+     const system_character_t *source,
+     size_t source_length,
+     libcerror_error_t **error );
+
+int source_list_append_path(
+     source_list_t *source_list,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int source_list_append_directory(
+     source_list_t *source_list,
+     const system_character_t *path,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int source_list_read_file(
+     source_list_t *source_list,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int source_list_get_file_size(
+     const system_character_t *source,
+     size64_t *file_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SOURCE_LIST_H ) */
+
@@ -0,0 +1,1474 @@
+/*
+ * Tar archive stream reader
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "sccatools_libcerror.h"
+#include "sccatools_libuna.h"
+#include "tar_reader.h"
+
+/* Creates a tar reader
+ * Make sure the value tar_reader is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int tar_reader_initialize(
+     tar_reader_t **tar_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "tar_reader_initialize";
+
+	if( tar_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tar reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tar_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid tar reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*tar_reader = memory_allocate_structure(
+	               tar_reader_t );
+
+	if( *tar_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tar reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *tar_reader,
+	     0,
+	     sizeof( tar_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tar reader.",
+		 function );
+
+		memory_free(
+		 *tar_reader );
+
+		*tar_reader = NULL;
+
+		return( -1 );
+	}
+	( *tar_reader )->utf8_name = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * TAR_READER_MAXIMUM_NAME_SIZE );
+
+	if( ( *tar_reader )->utf8_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 name.",
+		 function );
+
+		goto on_error;
+	}
+	( *tar_reader )->utf8_long_name = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * TAR_READER_MAXIMUM_NAME_SIZE );
+
+	if( ( *tar_reader )->utf8_long_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 long name.",
+		 function );
+
+		goto on_error;
+	}
+	( *tar_reader )->member_name = system_string_allocate(
+	                                TAR_READER_MAXIMUM_NAME_SIZE );
+
+	if( ( *tar_reader )->member_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create member name.",
+		 function );
+
+		goto on_error;
+	}
+	( *tar_reader )->utf8_name[ 0 ]   = 0;
+	( *tar_reader )->member_name[ 0 ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( *tar_reader != NULL )
+	{
+		if( ( *tar_reader )->utf8_long_name != NULL )
+		{
+			memory_free(
+			 ( *tar_reader )->utf8_long_name );
+		}
+		if( ( *tar_reader )->utf8_name != NULL )
+		{
+			memory_free(
+			 ( *tar_reader )->utf8_name );
+		}
+		memory_free(
+		 *tar_reader );
+
+		*tar_reader = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a tar reader
+ * Returns 1 if successful or -1 on error
+ */
+int tar_reader_free(
+     tar_reader_t **tar_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "tar_reader_free";
+	int result            = 1;
+
+	if( tar_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tar reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tar_reader != NULL )
+	{
+		if( ( *tar_reader )->stream != NULL )
+		{
+			if( tar_reader_close(
+			     *tar_reader,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close tar reader.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *tar_reader )->member_data != NULL )
+		{
+			memory_free(
+			 ( *tar_reader )->member_data );
+		}
+		memory_free(
+		 ( *tar_reader )->member_name );
+
+		memory_free(
+		 ( *tar_reader )->utf8_long_name );
+
+		memory_free(
+		 ( *tar_reader )->utf8_name );
+
+		memory_free(
+		 *tar_reader );
+
+		*tar_reader = NULL;
+	}
+	return( result );
+}
+
+/* Opens a tar archive
+ * The filename "-" refers to the standard input
+ * Returns 1 if successful or -1 on error
+ */
+int tar_reader_open(
+     tar_reader_t *tar_reader,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "tar_reader_open";
+
+	if( tar_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tar reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename[ 0 ] == (system_character_t) '-' )
+	 && ( filename[ 1 ] == 0 ) )
+	{
+		return( tar_reader_open_stream(
+		         tar_reader,
+		         stdin,
+		         error ) );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	if( tar_reader_open_stream(
+	     tar_reader,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open stream.",
+		 function );
+
+		file_stream_close(
+		 stream );
+
+		return( -1 );
+	}
+	tar_reader->stream_is_owned = 1;
+
+	return( 1 );
+}
+
+/* Opens a tar archive from a stream
+ * The stream is read sequentially and is not closed by the reader
+ * Returns 1 if successful or -1 on error
+ */
+int tar_reader_open_stream(
+     tar_reader_t *tar_reader,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "tar_reader_open_stream";
+
+	if( tar_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tar reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( tar_reader->stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid tar reader - stream already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	tar_reader->stream              = stream;
+	tar_reader->stream_is_owned     = 0;
+	tar_reader->utf8_long_name_size = 0;
+	tar_reader->has_pax_size        = 0;
+	tar_reader->member_data_size    = 0;
+	tar_reader->end_of_archive      = 0;
+
+	return( 1 );
+}
+
+/* Closes a tar archive
+ * Returns 0 if successful or -1 on error
+ */
+int tar_reader_close(
+     tar_reader_t *tar_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "tar_reader_close";
+	int result            = 0;
+
+	if( tar_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tar reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( tar_reader->stream != NULL )
+	 && ( tar_reader->stream_is_owned != 0 ) )
+	{
+		if( file_stream_close(
+		     tar_reader->stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+	tar_reader->stream          = NULL;
+	tar_reader->stream_is_owned = 0;
+
+	return( result );
+}
+
+/* Parses a numeric header field
+ * The field contains an octal number or, when the most significant bit is set, a big-endian base-256 number
+ * Returns 1 if successful or -1 on error
+ */
+int tar_reader_parse_number(
+     const uint8_t *field,
+     size_t field_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function = "tar_reader_parse_number";
+	size_t field_index    = 0;
+	uint64_t safe_value   = 0;
+
+	if( field == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( field_size == 0 )
+	 || ( field_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid field size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( field[ 0 ] & 0x80 ) != 0 )
+	{
+		/* Negative base-256 numbers are not supported
+		 */
+		if( ( field[ 0 ] & 0x40 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported negative base-256 number.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value = field[ 0 ] & 0x3f;
+
+		for( field_index = 1;
+		     field_index < field_size;
+		     field_index++ )
+		{
+			if( safe_value > ( (uint64_t) UINT64_MAX >> 8 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: base-256 number value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			safe_value <<= 8;
+			safe_value  |= field[ field_index ];
+		}
+		*value_64bit = safe_value;
+
+		return( 1 );
+	}
+	while( ( field_index < field_size )
+	    && ( field[ field_index ] == (uint8_t) ' ' ) )
+	{
+		field_index++;
+	}
+	while( field_index < field_size )
+	{
+		if( ( field[ field_index ] == 0 )
+		 || ( field[ field_index ] == (uint8_t) ' ' ) )
+		{
+			break;
+		}
+		if( ( field[ field_index ] < (uint8_t) '0' )
+		 || ( field[ field_index ] > (uint8_t) '7' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in octal number.",
+			 function );
+
+			return( -1 );
+		}
+		if( safe_value > ( (uint64_t) UINT64_MAX >> 3 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: octal number value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value <<= 3;
+		safe_value  |= (uint64_t) ( field[ field_index ] - (uint8_t) '0' );
+
+		field_index++;
+	}
+	*value_64bit = safe_value;
+
+	return( 1 );
+}
+
+/* Determines if a header block has a valid checksum
+ * Both the unsigned and the historic signed checksum are accepted
+ * Returns 1 if valid, 0 if not or -1 on error
+ */
+int tar_reader_header_is_valid(
+     const uint8_t *header,
+     libcerror_error_t **error )
+{
+	static char *function      = "tar_reader_header_is_valid";
+	size_t header_index        = 0;
+	uint64_t stored_checksum   = 0;
+	uint32_t unsigned_checksum = 0;
+	int32_t signed_checksum    = 0;
+
+	if( header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header.",
+		 function );
+
+		return( -1 );
+	}
+	if( tar_reader_parse_number(
+	     &( header[ 148 ] ),
+	     8,
+	     &stored_checksum,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	for( header_index = 0;
+	     header_index < TAR_READER_BLOCK_SIZE;
+	     header_index++ )
+	{
+		/* The checksum field is summed as if it contains spaces
+		 */
+		if( ( header_index >= 148 )
+		 && ( header_index < 156 ) )
+		{
+			unsigned_checksum += (uint32_t) ' ';
+			signed_checksum   += (int32_t) ' ';
+		}
+		else
+		{
+			unsigned_checksum += (uint32_t) header[ header_index ];
+			signed_checksum   += (int32_t) ( (int8_t) header[ header_index ] );
+		}
+	}
+	if( stored_checksum == (uint64_t) unsigned_checksum )
+	{
+		return( 1 );
+	}
+	if( ( signed_checksum >= 0 )
+	 && ( stored_checksum == (uint64_t) signed_checksum ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Parses pax extended header records
+ * The path and size records are retained for the next member, other records are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int tar_reader_parse_pax_records(
+     tar_reader_t *tar_reader,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "tar_reader_parse_pax_records";
+	size_t data_offset    = 0;
+	size_t key_offset     = 0;
+	size_t record_end     = 0;
+	size_t record_size    = 0;
+	size_t value_offset   = 0;
+	size_t value_length   = 0;
+	uint64_t value_64bit  = 0;
+
+	if( tar_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tar reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		if( data[ data_offset ] == 0 )
+		{
+			break;
+		}
+		/* A record is formatted as: "<size> <key>=<value>\n"
+		 * where size is the decimal size of the record including the size itself
+		 */
+		record_size = 0;
+		key_offset  = data_offset;
+
+		while( ( key_offset < data_size )
+		    && ( data[ key_offset ] >= (uint8_t) '0' )
+		    && ( data[ key_offset ] <= (uint8_t) '9' ) )
+		{
+			if( record_size > ( data_size / 10 ) )
+			{
+				break;
+			}
+			record_size *= 10;
+			record_size += (size_t) ( data[ key_offset ] - (uint8_t) '0' );
+
+			key_offset++;
+		}
+		if( ( key_offset >= data_size )
+		 || ( data[ key_offset ] != (uint8_t) ' ' )
+		 || ( record_size <= ( key_offset - data_offset + 1 ) )
+		 || ( record_size > ( data_size - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid pax record at offset: %" PRIzd ".",
+			 function,
+			 data_offset );
+
+			return( -1 );
+		}
+		record_end = data_offset + record_size - 1;
+
+		if( data[ record_end ] != (uint8_t) '\n' )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid pax record at offset: %" PRIzd " - missing end of record.",
+			 function,
+			 data_offset );
+
+			return( -1 );
+		}
+		key_offset++;
+
+		value_offset = key_offset;
+
+		while( ( value_offset < record_end )
+		    && ( data[ value_offset ] != (uint8_t) '=' ) )
+		{
+			value_offset++;
+		}
+		if( value_offset >= record_end )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid pax record at offset: %" PRIzd " - missing value.",
+			 function,
+			 data_offset );
+
+			return( -1 );
+		}
+		value_length = record_end - ( value_offset + 1 );
+
+		if( ( ( value_offset - key_offset ) == 4 )
+		 && ( memory_compare(
+		       &( data[ key_offset ] ),
+		       "path",
+		       4 ) == 0 ) )
+		{
+			if( ( value_length == 0 )
+			 || ( value_length >= TAR_READER_MAXIMUM_NAME_SIZE ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid pax path value length value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     tar_reader->utf8_long_name,
+			     &( data[ value_offset + 1 ] ),
+			     value_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy pax path.",
+				 function );
+
+				return( -1 );
+			}
+			tar_reader->utf8_long_name[ value_length ] = 0;
+
+			tar_reader->utf8_long_name_size = value_length + 1;
+		}
+		else if( ( ( value_offset - key_offset ) == 4 )
+		      && ( memory_compare(
+		            &( data[ key_offset ] ),
+		            "size",
+		            4 ) == 0 ) )
+		{
+			value_64bit = 0;
+
+			for( value_offset += 1;
+			     value_offset < record_end;
+			     value_offset++ )
+			{
+				if( ( data[ value_offset ] < (uint8_t) '0' )
+				 || ( data[ value_offset ] > (uint8_t) '9' )
+				 || ( value_64bit > ( (uint64_t) UINT64_MAX / 10 ) - 1 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported pax size value.",
+					 function );
+
+					return( -1 );
+				}
+				value_64bit *= 10;
+				value_64bit += (uint64_t) ( data[ value_offset ] - (uint8_t) '0' );
+			}
+			tar_reader->pax_size     = value_64bit;
+			tar_reader->has_pax_size = 1;
+		}
+		data_offset += record_size;
+	}
+	return( 1 );
+}
+
+/* Reads a block
+ * Returns 1 if successful, 0 if the end of the stream was reached or -1 on error
+ */
+int tar_reader_read_block(
+     tar_reader_t *tar_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "tar_reader_read_block";
+	size_t read_count     = 0;
+
+	if( tar_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tar reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( tar_reader->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid tar reader - missing stream.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = file_stream_read(
+	              tar_reader->stream,
+	              tar_reader->block,
+	              TAR_READER_BLOCK_SIZE );
+
+	if( read_count == 0 )
+	{
+		if( file_stream_at_end(
+		     tar_reader->stream ) != 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( read_count != (size_t) TAR_READER_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the data of a member into the member data
+ * The padding up to the next block is read and discarded
+ * Returns 1 if successful or -1 on error
+ */
+int tar_reader_read_data(
+     tar_reader_t *tar_reader,
+     uint64_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "tar_reader_read_data";
+	size_t padding_size   = 0;
+	size_t read_count     = 0;
+
+	if( tar_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tar reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( tar_reader->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid tar reader - missing stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (uint64_t) TAR_READER_MAXIMUM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	tar_reader->member_data_size = 0;
+
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) data_size > tar_reader->allocated_data_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            tar_reader->member_data,
+		                            sizeof( uint8_t ) * (size_t) data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize member data.",
+			 function );
+
+			return( -1 );
+		}
+		tar_reader->member_data         = reallocation;
+		tar_reader->allocated_data_size = (size_t) data_size;
+	}
+	read_count = file_stream_read(
+	              tar_reader->stream,
+	              tar_reader->member_data,
+	              (size_t) data_size );
+
+	if( read_count != (size_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read member data.",
+		 function );
+
+		return( -1 );
+	}
+	padding_size = (size_t) ( data_size % TAR_READER_BLOCK_SIZE );
+
+	if( padding_size != 0 )
+	{
+		padding_size = TAR_READER_BLOCK_SIZE - padding_size;
+
+		read_count = file_stream_read(
+		              tar_reader->stream,
+		              tar_reader->block,
+		              padding_size );
+
+		if( read_count != padding_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read member data padding.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	tar_reader->member_data_size = (size_t) data_size;
+
+	return( 1 );
+}
+
+/* Skips the data of a member
+ * The data is read since the stream is not necessarily seekable
+ * Returns 1 if successful or -1 on error
+ */
+int tar_reader_skip_data(
+     tar_reader_t *tar_reader,
+     uint64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "tar_reader_skip_data";
+	uint64_t block_index      = 0;
+	uint64_t number_of_blocks = 0;
+
+	if( tar_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tar reader.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = data_size / TAR_READER_BLOCK_SIZE;
+
+	if( ( data_size % TAR_READER_BLOCK_SIZE ) != 0 )
+	{
+		number_of_blocks++;
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		if( tar_reader_read_block(
+		     tar_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block: %" PRIu64 ".",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the name of the current member from an UTF-8 string
+ * Returns 1 if successful or -1 on error
+ */
+int tar_reader_set_member_name(
+     tar_reader_t *tar_reader,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "tar_reader_set_member_name";
+
+	if( tar_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tar reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length >= TAR_READER_MAXIMUM_NAME_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string != tar_reader->utf8_name )
+	{
+		if( memory_copy(
+		     tar_reader->utf8_name,
+		     utf8_string,
+		     utf8_string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	tar_reader->utf8_name[ utf8_string_length ] = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#if SIZEOF_WCHAR_T == 4
+	if( libuna_utf32_string_copy_from_utf8(
+	     (libuna_utf32_character_t *) tar_reader->member_name,
+	     TAR_READER_MAXIMUM_NAME_SIZE,
+	     tar_reader->utf8_name,
+	     utf8_string_length + 1,
+	     error ) != 1 )
+#elif SIZEOF_WCHAR_T == 2
+	if( libuna_utf16_string_copy_from_utf8(
+	     (libuna_utf16_character_t *) tar_reader->member_name,
+	     TAR_READER_MAXIMUM_NAME_SIZE,
+	     tar_reader->utf8_name,
+	     utf8_string_length + 1,
+	     error ) != 1 )
+#else
+#error Unsupported size of wchar_t
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set member name.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( memory_copy(
+	     tar_reader->member_name,
+	     tar_reader->utf8_name,
+	     utf8_string_length + 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy member name.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
+/* Reads the next regular file member
+ * Directories, links and other non-regular members are skipped
+ * The name and data of the member are available in the reader until the next member is read
+ * Returns 1 if successful, 0 if the end of the archive was reached or -1 on error
+ */
+int tar_reader_read_member(
+     tar_reader_t *tar_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "tar_reader_read_member";
+	size_t name_length    = 0;
+	size_t prefix_length  = 0;
+	size_t block_index    = 0;
+	uint64_t data_size    = 0;
+	uint8_t type_flag     = 0;
+	int result            = 0;
+
+	if( tar_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tar reader.",
+		 function );
+
+		return( -1 );
+	}
+	tar_reader->member_data_size = 0;
+
+	while( tar_reader->end_of_archive == 0 )
+	{
+		result = tar_reader_read_block(
+		          tar_reader,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read header.",
+			 function );
+
+			return( -1 );
+		}
+		/* An archive that ends without the end of archive blocks is tolerated
+		 */
+		else if( result == 0 )
+		{
+			tar_reader->end_of_archive = 1;
+
+			break;
+		}
+		for( block_index = 0;
+		     block_index < TAR_READER_BLOCK_SIZE;
+		     block_index++ )
+		{
+			if( tar_reader->block[ block_index ] != 0 )
+			{
+				break;
+			}
+		}
+		if( block_index >= TAR_READER_BLOCK_SIZE )
+		{
+			tar_reader->end_of_archive = 1;
+
+			break;
+		}
+		result = tar_reader_header_is_valid(
+		          tar_reader->block,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid header - checksum mismatch.",
+			 function );
+
+			return( -1 );
+		}
+		if( tar_reader_parse_number(
+		     &( tar_reader->block[ 124 ] ),
+		     12,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to parse size.",
+			 function );
+
+			return( -1 );
+		}
+		type_flag = tar_reader->block[ 156 ];
+
+		if( type_flag == (uint8_t) 'x' )
+		{
+			/* A pax extended header applies to the next member
+			 */
+			if( tar_reader_read_data(
+			     tar_reader,
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read pax extended header.",
+				 function );
+
+				return( -1 );
+			}
+			if( tar_reader_parse_pax_records(
+			     tar_reader,
+			     tar_reader->member_data,
+			     tar_reader->member_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to parse pax extended header.",
+				 function );
+
+				return( -1 );
+			}
+			tar_reader->member_data_size = 0;
+
+			continue;
+		}
+		else if( type_flag == (uint8_t) 'L' )
+		{
+			/* A GNU long name header applies to the next member
+			 */
+			if( ( data_size == 0 )
+			 || ( data_size >= TAR_READER_MAXIMUM_NAME_SIZE ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid long name size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( tar_reader_read_data(
+			     tar_reader,
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read long name.",
+				 function );
+
+				return( -1 );
+			}
+			for( name_length = 0;
+			     name_length < tar_reader->member_data_size;
+			     name_length++ )
+			{
+				if( tar_reader->member_data[ name_length ] == 0 )
+				{
+					break;
+				}
+			}
+			if( memory_copy(
+			     tar_reader->utf8_long_name,
+			     tar_reader->member_data,
+			     name_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy long name.",
+				 function );
+
+				return( -1 );
+			}
+			tar_reader->utf8_long_name[ name_length ] = 0;
+
+			tar_reader->utf8_long_name_size = name_length + 1;
+			tar_reader->member_data_size    = 0;
+
+			continue;
+		}
+		else if( ( type_flag != 0 )
+		      && ( type_flag != (uint8_t) '0' )
+		      && ( type_flag != (uint8_t) '7' ) )
+		{
+			/* Directories, links, global pax headers and other members are skipped
+			 */
+			if( tar_reader_skip_data(
+			     tar_reader,
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to skip member data.",
+				 function );
+
+				return( -1 );
+			}
+			if( type_flag != (uint8_t) 'g' )
+			{
+				tar_reader->utf8_long_name_size = 0;
+				tar_reader->has_pax_size        = 0;
+			}
+			continue;
+		}
+		if( tar_reader->has_pax_size != 0 )
+		{
+			data_size = tar_reader->pax_size;
+		}
+		if( tar_reader->utf8_long_name_size > 0 )
+		{
+			name_length = tar_reader->utf8_long_name_size - 1;
+
+			result = tar_reader_set_member_name(
+			          tar_reader,
+			          tar_reader->utf8_long_name,
+			          name_length,
+			          error );
+		}
+		else
+		{
+			for( name_length = 0;
+			     name_length < 100;
+			     name_length++ )
+			{
+				if( tar_reader->block[ name_length ] == 0 )
+				{
+					break;
+				}
+			}
+			/* The POSIX ustar format stores the leading part of long names in the prefix
+			 */
+			prefix_length = 0;
+
+			if( memory_compare(
+			     &( tar_reader->block[ 257 ] ),
+			     "ustar\0",
+			     6 ) == 0 )
+			{
+				for( prefix_length = 0;
+				     prefix_length < 155;
+				     prefix_length++ )
+				{
+					if( tar_reader->block[ 345 + prefix_length ] == 0 )
+					{
+						break;
+					}
+				}
+			}
+			if( prefix_length > 0 )
+			{
+				if( memory_copy(
+				     tar_reader->utf8_name,
+				     &( tar_reader->block[ 345 ] ),
+				     prefix_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy name prefix.",
+					 function );
+
+					return( -1 );
+				}
+				tar_reader->utf8_name[ prefix_length++ ] = (uint8_t) '/';
+			}
+			if( memory_copy(
+			     &( tar_reader->utf8_name[ prefix_length ] ),
+			     tar_reader->block,
+			     name_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy name.",
+				 function );
+
+				return( -1 );
+			}
+			result = tar_reader_set_member_name(
+			          tar_reader,
+			          tar_reader->utf8_name,
+			          prefix_length + name_length,
+			          error );
+		}
+		tar_reader->utf8_long_name_size = 0;
+		tar_reader->has_pax_size        = 0;
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set member name.",
+			 function );
+
+			return( -1 );
+		}
+		if( tar_reader_read_data(
+		     tar_reader,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read member data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,171 @@
+/*
+ * Tar archive stream reader
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _TAR_READER_H )
+#define _TAR_READER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a tar block
+ */
+#define TAR_READER_BLOCK_SIZE			512
+
+/* The maximum supported member name size, including the end-of-string character
+ */
+#define TAR_READER_MAXIMUM_NAME_SIZE		32768
+
+/* The maximum supported member data size
+ */
+#define TAR_READER_MAXIMUM_DATA_SIZE		( 256 * 1024 * 1024 )
+
+typedef struct tar_reader tar_reader_t;
+
+struct tar_reader
+{
+	/* The stream
+	 */
+	FILE *stream;
+
+	/* Value to indicate the stream was opened by the reader
+	 */
+	uint8_t stream_is_owned;
+
+	/* The current block
+	 */
+	uint8_t block[ TAR_READER_BLOCK_SIZE ];
+
+	/* The UTF-8 name of the current member
+	 */
+	uint8_t *utf8_name;
+
+	/* The UTF-8 name of the next member, as set by a pax or GNU long name header
+	 */
+	uint8_t *utf8_long_name;
+
+	/* The size of the UTF-8 name of the next member, including the end-of-string character
+	 */
+	size_t utf8_long_name_size;
+
+	/* The size of the next member, as set by a pax header
+	 */
+	uint64_t pax_size;
+
+	/* Value to indicate the pax size is set
+	 */
+	uint8_t has_pax_size;
+
+	/* The name of the current member
+	 */
+	system_character_t *member_name;
+
+	/* The data of the current member
+	 */
+	uint8_t *member_data;
+
+	/* The size of the data of the current member
+	 */
+	size_t member_data_size;
+
+	/* The allocated size of the member data
+	 */
+	size_t allocated_data_size;
+
+	/* Value to indicate the end of the archive was reached
+	 */
+	uint8_t end_of_archive;
+};
+
+int tar_reader_initialize(
+     tar_reader_t **tar_reader,
+     libcerror_error_t **error );
+
+int tar_reader_free(
+     tar_reader_t **tar_reader,
+     libcerror_error_t **error );
+
+int tar_reader_open(
+     tar_reader_t *tar_reader,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int tar_reader_open_stream(
+     tar_reader_t *tar_reader,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int tar_reader_close(
+     tar_reader_t *tar_reader,
+     libcerror_error_t **error );
+
+int tar_reader_parse_number(
+     const uint8_t *field,
+     size_t field_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int tar_reader_header_is_valid(
+     const uint8_t *header,
+     libcerror_error_t **error );
+
+int tar_reader_parse_pax_records(
+     tar_reader_t *tar_reader,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int tar_reader_read_block(
+     tar_reader_t *tar_reader,
+     libcerror_error_t **error );
+
+int tar_reader_read_data(
+     tar_reader_t *tar_reader,
+     uint64_t data_size,
+     libcerror_error_t **error );
+
+int tar_reader_skip_data(
+     tar_reader_t *tar_reader,
+     uint64_t data_size,
+     libcerror_error_t **error );
+
+int tar_reader_set_member_name(
+     tar_reader_t *tar_reader,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int tar_reader_read_member(
+     tar_reader_t *tar_reader,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _TAR_READER_H ) */
+
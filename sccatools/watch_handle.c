@@ -0,0 +1,1609 @@
+/*
+ * Watch handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "info_handle.h"
+#include "output_writer.h"
+#include "result_cache.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libscca.h"
+#include "watch_handle.h"
+
+/* Creates a watch state
+ * Make sure the value state is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int watch_state_initialize(
+     watch_state_t **state,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	static char *function = "watch_state_initialize";
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *state != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid state value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*state = memory_allocate_structure(
+	          watch_state_t );
+
+	if( *state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create state.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *state,
+	     0,
+	     sizeof( watch_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear state.",
+		 function );
+
+		memory_free(
+		 *state );
+
+		*state = NULL;
+
+		return( -1 );
+	}
+	( *state )->path = system_string_allocate(
+	                    path_length + 1 );
+
+	if( ( *state )->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *state )->path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	( *state )->path[ path_length ] = 0;
+
+	( *state )->path_length = path_length;
+	( *state )->path_hash   = result_cache_calculate_path_hash(
+	                           path,
+	                           path_length );
+
+	return( 1 );
+
+on_error:
+	if( *state != NULL )
+	{
+		if( ( *state )->path != NULL )
+		{
+			memory_free(
+			 ( *state )->path );
+		}
+		memory_free(
+		 *state );
+
+		*state = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a watch state
+ * The state must not be part of a watch handle
+ * Returns 1 if successful or -1 on error
+ */
+int watch_state_free(
+     watch_state_t **state,
+     libcerror_error_t **error )
+{
+	static char *function = "watch_state_free";
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *state != NULL )
+	{
+		if( ( *state )->path != NULL )
+		{
+			memory_free(
+			 ( *state )->path );
+		}
+		if( ( *state )->executable_filename != NULL )
+		{
+			memory_free(
+			 ( *state )->executable_filename );
+		}
+		memory_free(
+		 *state );
+
+		*state = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines if the values of a file have changed
+ * Returns 1 if changed, 0 if not or -1 on error
+ */
+int watch_state_has_changed(
+     watch_state_t *previous_state,
+     watch_state_t *current_state,
+     libcerror_error_t **error )
+{
+	static char *function   = "watch_state_has_changed";
+	int last_run_time_index = 0;
+
+	if( previous_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous state.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( previous_state->prefetch_hash != current_state->prefetch_hash )
+	 || ( previous_state->run_count != current_state->run_count )
+	 || ( previous_state->number_of_last_run_times != current_state->number_of_last_run_times )
+	 || ( previous_state->executable_filename_size != current_state->executable_filename_size ) )
+	{
+		return( 1 );
+	}
+	for( last_run_time_index = 0;
+	     last_run_time_index < current_state->number_of_last_run_times;
+	     last_run_time_index++ )
+	{
+		if( previous_state->last_run_times[ last_run_time_index ] != current_state->last_run_times[ last_run_time_index ] )
+		{
+			return( 1 );
+		}
+	}
+	if( ( previous_state->executable_filename != NULL )
+	 && ( current_state->executable_filename != NULL ) )
+	{
+		if( memory_compare(
+		     previous_state->executable_filename,
+		     current_state->executable_filename,
+		     current_state->executable_filename_size ) != 0 )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Creates a watch handle
+ * Make sure the value watch_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_initialize(
+     watch_handle_t **watch_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "watch_handle_initialize";
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *watch_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid watch handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*watch_handle = memory_allocate_structure(
+	                 watch_handle_t );
+
+	if( *watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create watch handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *watch_handle,
+	     0,
+	     sizeof( watch_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear watch handle.",
+		 function );
+
+		memory_free(
+		 *watch_handle );
+
+		*watch_handle = NULL;
+
+		return( -1 );
+	}
+	if( info_handle_initialize(
+	     &( ( *watch_handle )->info_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize info handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only the file header and file information are needed to detect a change
+	 */
+	if( info_handle_set_fields(
+	     ( *watch_handle )->info_handle,
+	     _SYSTEM_STRING( "executable,hash,run_count,last_run_times" ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set fields of info handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_initialize(
+	     &( ( *watch_handle )->output_writer ),
+	     stream,
+	     OUTPUT_WRITER_DEFAULT_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output writer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *watch_handle != NULL )
+	{
+		if( ( *watch_handle )->info_handle != NULL )
+		{
+			info_handle_free(
+			 &( ( *watch_handle )->info_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *watch_handle );
+
+		*watch_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a watch handle
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_free(
+     watch_handle_t **watch_handle,
+     libcerror_error_t **error )
+{
+	watch_state_t *state  = NULL;
+	static char *function = "watch_handle_free";
+	int bucket_index      = 0;
+	int result            = 1;
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *watch_handle != NULL )
+	{
+		for( bucket_index = 0;
+		     bucket_index < WATCH_HANDLE_NUMBER_OF_BUCKETS;
+		     bucket_index++ )
+		{
+			while( ( *watch_handle )->buckets[ bucket_index ] != NULL )
+			{
+				state = ( *watch_handle )->buckets[ bucket_index ];
+
+				( *watch_handle )->buckets[ bucket_index ] = state->next_bucket_state;
+
+				if( watch_state_free(
+				     &state,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free state.",
+					 function );
+
+					result = -1;
+				}
+			}
+		}
+		if( output_writer_free(
+		     &( ( *watch_handle )->output_writer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output writer.",
+			 function );
+
+			result = -1;
+		}
+		if( info_handle_free(
+		     &( ( *watch_handle )->info_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free info handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *watch_handle );
+
+		*watch_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the watch handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_signal_abort(
+     watch_handle_t *watch_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "watch_handle_signal_abort";
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	watch_handle->abort = 1;
+
+	if( watch_handle->info_handle != NULL )
+	{
+		if( info_handle_signal_abort(
+		     watch_handle->info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal info handle to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if a path refers to a prefetch file
+ * A prefetch file has the .pf extension, compared case-insensitive
+ * Returns 1 if the path refers to a prefetch file or 0 if not
+ */
+int watch_handle_path_is_prefetch_file(
+     const system_character_t *path,
+     size_t path_length )
+{
+	if( ( path == NULL )
+	 || ( path_length < 4 ) )
+	{
+		return( 0 );
+	}
+	if( ( path[ path_length - 3 ] != (system_character_t) '.' )
+	 || ( ( path[ path_length - 2 ] != (system_character_t) 'p' )
+	  &&  ( path[ path_length - 2 ] != (system_character_t) 'P' ) )
+	 || ( ( path[ path_length - 1 ] != (system_character_t) 'f' )
+	  &&  ( path[ path_length - 1 ] != (system_character_t) 'F' ) ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the state of a file
+ * Returns 1 if successful, 0 if no such state or -1 on error
+ */
+int watch_handle_get_state(
+     watch_handle_t *watch_handle,
+     const system_character_t *path,
+     size_t path_length,
+     watch_state_t **state,
+     libcerror_error_t **error )
+{
+	watch_state_t *bucket_state = NULL;
+	static char *function       = "watch_handle_get_state";
+	uint32_t path_hash          = 0;
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	*state = NULL;
+
+	path_hash = result_cache_calculate_path_hash(
+	             path,
+	             path_length );
+
+	for( bucket_state = watch_handle->buckets[ path_hash % WATCH_HANDLE_NUMBER_OF_BUCKETS ];
+	     bucket_state != NULL;
+	     bucket_state = bucket_state->next_bucket_state )
+	{
+		if( ( bucket_state->path_hash == path_hash )
+		 && ( bucket_state->path_length == path_length )
+		 && ( system_string_compare(
+		       bucket_state->path,
+		       path,
+		       path_length ) == 0 ) )
+		{
+			*state = bucket_state;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Inserts the state of a file
+ * The watch handle takes over management of the state
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_insert_state(
+     watch_handle_t *watch_handle,
+     watch_state_t *state,
+     libcerror_error_t **error )
+{
+	watch_state_t *existing_state = NULL;
+	static char *function         = "watch_handle_insert_state";
+	uint32_t bucket_index         = 0;
+	int result                    = 0;
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( state->next_bucket_state != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state - already part of a watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = watch_handle_get_state(
+	          watch_handle,
+	          state->path,
+	          state->path_length,
+	          &existing_state,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve existing state.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid watch handle - state for path already set.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = state->path_hash % WATCH_HANDLE_NUMBER_OF_BUCKETS;
+
+	state->next_bucket_state = watch_handle->buckets[ bucket_index ];
+
+	watch_handle->buckets[ bucket_index ] = state;
+
+	watch_handle->number_of_states += 1;
+
+	return( 1 );
+}
+
+/* Removes the state of a file
+ * The state is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_remove_state(
+     watch_handle_t *watch_handle,
+     watch_state_t *state,
+     libcerror_error_t **error )
+{
+	watch_state_t *bucket_state = NULL;
+	static char *function       = "watch_handle_remove_state";
+	uint32_t bucket_index       = 0;
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = state->path_hash % WATCH_HANDLE_NUMBER_OF_BUCKETS;
+
+	if( watch_handle->buckets[ bucket_index ] == state )
+	{
+		watch_handle->buckets[ bucket_index ] = state->next_bucket_state;
+	}
+	else
+	{
+		for( bucket_state = watch_handle->buckets[ bucket_index ];
+		     bucket_state != NULL;
+		     bucket_state = bucket_state->next_bucket_state )
+		{
+			if( bucket_state->next_bucket_state == state )
+			{
+				break;
+			}
+		}
+		if( bucket_state == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid state - not part of the watch handle.",
+			 function );
+
+			return( -1 );
+		}
+		bucket_state->next_bucket_state = state->next_bucket_state;
+	}
+	state->next_bucket_state = NULL;
+
+	watch_handle->number_of_states -= 1;
+
+	return( 1 );
+}
+
+/* Reads the values of a state from the file it describes
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_read_state(
+     watch_handle_t *watch_handle,
+     watch_state_t *state,
+     libcerror_error_t **error )
+{
+	static char *function   = "watch_handle_read_state";
+	size_t utf8_string_size = 0;
+	uint32_t format_version = 0;
+	int input_is_open       = 0;
+	int last_run_time_index = 0;
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( state->executable_filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid state - values already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_open_input(
+	     watch_handle->info_handle,
+	     state->path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 state->path );
+
+		goto on_error;
+	}
+	input_is_open = 1;
+
+	if( libscca_file_get_format_version(
+	     watch_handle->info_handle->input_file,
+	     &format_version,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve format version.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_prefetch_hash(
+	     watch_handle->info_handle->input_file,
+	     &( state->prefetch_hash ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_run_count(
+	     watch_handle->info_handle->input_file,
+	     &( state->run_count ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run count.",
+		 function );
+
+		goto on_error;
+	}
+	if( format_version < 26 )
+	{
+		state->number_of_last_run_times = 1;
+	}
+	else
+	{
+		state->number_of_last_run_times = WATCH_HANDLE_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES;
+	}
+	for( last_run_time_index = 0;
+	     last_run_time_index < state->number_of_last_run_times;
+	     last_run_time_index++ )
+	{
+		if( libscca_file_get_last_run_time(
+		     watch_handle->info_handle->input_file,
+		     last_run_time_index,
+		     &( state->last_run_times[ last_run_time_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last run time: %d.",
+			 function,
+			 last_run_time_index );
+
+			goto on_error;
+		}
+	}
+	if( libscca_file_get_utf8_executable_filename_size(
+	     watch_handle->info_handle->input_file,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable filename size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid executable filename size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	state->executable_filename = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * utf8_string_size );
+
+	if( state->executable_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create executable filename.",
+		 function );
+
+		goto on_error;
+	}
+	state->executable_filename_size = utf8_string_size;
+
+	if( libscca_file_get_utf8_executable_filename(
+	     watch_handle->info_handle->input_file,
+	     state->executable_filename,
+	     state->executable_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable filename.",
+		 function );
+
+		goto on_error;
+	}
+	input_is_open = 0;
+
+	if( info_handle_close_input(
+	     watch_handle->info_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close: %" PRIs_SYSTEM ".",
+		 function,
+		 state->path );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( input_is_open != 0 )
+	{
+		info_handle_close_input(
+		 watch_handle->info_handle,
+		 NULL );
+	}
+	if( state->executable_filename != NULL )
+	{
+		memory_free(
+		 state->executable_filename );
+
+		state->executable_filename = NULL;
+	}
+	state->executable_filename_size = 0;
+
+	return( -1 );
+}
+
+/* Prints an event as a JSON object on a single line
+ * The previous state is used to determine the run count delta and the new last run times
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_event_fprint(
+     watch_handle_t *watch_handle,
+     int event_type,
+     watch_state_t *previous_state,
+     watch_state_t *current_state,
+     libcerror_error_t **error )
+{
+	const char *event_name        = NULL;
+	static char *function         = "watch_handle_event_fprint";
+	uint64_t latest_last_run_time = 0;
+	uint64_t value_64bit          = 0;
+	int last_run_time_index       = 0;
+	int number_of_new_run_times   = 0;
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current state.",
+		 function );
+
+		return( -1 );
+	}
+	switch( event_type )
+	{
+		case WATCH_HANDLE_EVENT_TYPE_CREATED:
+			event_name = "created";
+			break;
+
+		case WATCH_HANDLE_EVENT_TYPE_DELETED:
+			event_name = "deleted";
+			break;
+
+		case WATCH_HANDLE_EVENT_TYPE_MODIFIED:
+			if( previous_state == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+				 "%s: invalid previous state.",
+				 function );
+
+				return( -1 );
+			}
+			event_name = "modified";
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported event type.",
+			 function );
+
+			return( -1 );
+	}
+	if( output_writer_write_string(
+	     watch_handle->output_writer,
+	     "{\"event\":\"",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_string(
+	     watch_handle->output_writer,
+	     event_name,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_string(
+	     watch_handle->output_writer,
+	     "\",\"source\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_json_system_string(
+	     watch_handle->output_writer,
+	     current_state->path,
+	     current_state->path_length,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( current_state->executable_filename != NULL )
+	{
+		if( output_writer_write_string(
+		     watch_handle->output_writer,
+		     ",\"executable_filename\":",
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( output_writer_write_json_string(
+		     watch_handle->output_writer,
+		     current_state->executable_filename,
+		     current_state->executable_filename_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( output_writer_write_string(
+	     watch_handle->output_writer,
+	     ",\"prefetch_hash\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_decimal_uint64(
+	     watch_handle->output_writer,
+	     (uint64_t) current_state->prefetch_hash,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_string(
+	     watch_handle->output_writer,
+	     ",\"run_count\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_decimal_uint64(
+	     watch_handle->output_writer,
+	     (uint64_t) current_state->run_count,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( event_type != WATCH_HANDLE_EVENT_TYPE_DELETED )
+	{
+		if( output_writer_write_string(
+		     watch_handle->output_writer,
+		     ",\"run_count_delta\":",
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( ( previous_state == NULL )
+		 || ( current_state->run_count >= previous_state->run_count ) )
+		{
+			value_64bit = (uint64_t) current_state->run_count;
+
+			if( previous_state != NULL )
+			{
+				value_64bit -= (uint64_t) previous_state->run_count;
+			}
+		}
+		else
+		{
+			/* The run count decreases when the file was recreated
+			 */
+			if( output_writer_write_string(
+			     watch_handle->output_writer,
+			     "-",
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			value_64bit = (uint64_t) ( previous_state->run_count - current_state->run_count );
+		}
+		if( output_writer_write_decimal_uint64(
+		     watch_handle->output_writer,
+		     value_64bit,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		/* A last run time is new when it is more recent than all the previous last run times
+		 */
+		if( previous_state != NULL )
+		{
+			for( last_run_time_index = 0;
+			     last_run_time_index < previous_state->number_of_last_run_times;
+			     last_run_time_index++ )
+			{
+				if( previous_state->last_run_times[ last_run_time_index ] > latest_last_run_time )
+				{
+					latest_last_run_time = previous_state->last_run_times[ last_run_time_index ];
+				}
+			}
+		}
+		if( output_writer_write_string(
+		     watch_handle->output_writer,
+		     ",\"new_last_run_times\":[",
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		for( last_run_time_index = 0;
+		     last_run_time_index < current_state->number_of_last_run_times;
+		     last_run_time_index++ )
+		{
+			value_64bit = current_state->last_run_times[ last_run_time_index ];
+
+			if( value_64bit <= latest_last_run_time )
+			{
+				continue;
+			}
+			if( number_of_new_run_times > 0 )
+			{
+				if( output_writer_write_string(
+				     watch_handle->output_writer,
+				     ",",
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+			}
+			if( output_writer_write_decimal_uint64(
+			     watch_handle->output_writer,
+			     value_64bit,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			number_of_new_run_times++;
+		}
+		if( output_writer_write_string(
+		     watch_handle->output_writer,
+		     "]",
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( output_writer_write_string(
+	     watch_handle->output_writer,
+	     "}\n",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Events are written as they occur
+	 */
+	if( output_writer_flush(
+	     watch_handle->output_writer,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write event.",
+	 function );
+
+	return( -1 );
+}
+
+/* Processes a file that was created or modified
+ * The file is read again and compared to its previous state
+ * A file that cannot be read, such as a file that is still being written, is skipped
+ * Returns 1 if an event was reported, 0 if not or -1 on error
+ */
+int watch_handle_process_file(
+     watch_handle_t *watch_handle,
+     const system_character_t *path,
+     uint8_t report_events,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error = NULL;
+	watch_state_t *current_state  = NULL;
+	watch_state_t *previous_state = NULL;
+	static char *function         = "watch_handle_process_file";
+	size_t path_length            = 0;
+	int event_type                = 0;
+	int result                    = 0;
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+	if( watch_handle_path_is_prefetch_file(
+	     path,
+	     path_length ) == 0 )
+	{
+		return( 0 );
+	}
+	if( watch_state_initialize(
+	     &current_state,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create state.",
+		 function );
+
+		goto on_error;
+	}
+	if( watch_handle_read_state(
+	     watch_handle,
+	     current_state,
+	     &read_error ) != 1 )
+	{
+		libcnotify_print_error_backtrace(
+		 read_error );
+		libcerror_error_free(
+		 &read_error );
+
+		watch_state_free(
+		 &current_state,
+		 NULL );
+
+		return( 0 );
+	}
+	result = watch_handle_get_state(
+	          watch_handle,
+	          path,
+	          path_length,
+	          &previous_state,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous state.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		event_type = WATCH_HANDLE_EVENT_TYPE_CREATED;
+	}
+	else
+	{
+		result = watch_state_has_changed(
+		          previous_state,
+		          current_state,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if state has changed.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			watch_state_free(
+			 &current_state,
+			 NULL );
+
+			return( 0 );
+		}
+		event_type = WATCH_HANDLE_EVENT_TYPE_MODIFIED;
+	}
+	if( report_events != 0 )
+	{
+		if( watch_handle_event_fprint(
+		     watch_handle,
+		     event_type,
+		     previous_state,
+		     current_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print event.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( previous_state != NULL )
+	{
+		if( watch_handle_remove_state(
+		     watch_handle,
+		     previous_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove previous state.",
+			 function );
+
+			goto on_error;
+		}
+		if( watch_state_free(
+		     &previous_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free previous state.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( watch_handle_insert_state(
+	     watch_handle,
+	     current_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert state.",
+		 function );
+
+		goto on_error;
+	}
+	if( report_events == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( current_state != NULL )
+	{
+		watch_state_free(
+		 &current_state,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Processes a file that was removed
+ * Returns 1 if an event was reported, 0 if not or -1 on error
+ */
+int watch_handle_remove_file(
+     watch_handle_t *watch_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	watch_state_t *previous_state = NULL;
+	static char *function         = "watch_handle_remove_file";
+	size_t path_length            = 0;
+	int result                    = 0;
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+	result = watch_handle_get_state(
+	          watch_handle,
+	          path,
+	          path_length,
+	          &previous_state,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve previous state.",
+			 function );
+		}
+		return( result );
+	}
+	if( watch_handle_remove_state(
+	     watch_handle,
+	     previous_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove previous state.",
+		 function );
+
+		return( -1 );
+	}
+	result = watch_handle_event_fprint(
+	          watch_handle,
+	          WATCH_HANDLE_EVENT_TYPE_DELETED,
+	          NULL,
+	          previous_state,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print event.",
+		 function );
+	}
+	if( watch_state_free(
+	     &previous_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free previous state.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
@@ -0,0 +1,199 @@
+/*
+ * Watch handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _WATCH_HANDLE_H )
+#define _WATCH_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "info_handle.h"
+#include "output_writer.h"
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of hash buckets of the file states
+ */
+#define WATCH_HANDLE_NUMBER_OF_BUCKETS			256
+
+/* The maximum number of last run times of a file
+ */
+#define WATCH_HANDLE_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES	8
+
+enum WATCH_HANDLE_EVENT_TYPES
+{
+	WATCH_HANDLE_EVENT_TYPE_CREATED		= (int) 'c',
+	WATCH_HANDLE_EVENT_TYPE_DELETED		= (int) 'd',
+	WATCH_HANDLE_EVENT_TYPE_MODIFIED	= (int) 'm'
+};
+
+typedef struct watch_state watch_state_t;
+
+struct watch_state
+{
+	/* The path
+	 */
+	system_character_t *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The hash of the path
+	 */
+	uint32_t path_hash;
+
+	/* The UTF-8 executable filename, including the end-of-string character
+	 */
+	uint8_t *executable_filename;
+
+	/* The UTF-8 executable filename size
+	 */
+	size_t executable_filename_size;
+
+	/* The prefetch hash
+	 */
+	uint32_t prefetch_hash;
+
+	/* The run count
+	 */
+	uint32_t run_count;
+
+	/* The last run times, the most recent first
+	 */
+	uint64_t last_run_times[ WATCH_HANDLE_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	/* The number of last run times
+	 */
+	int number_of_last_run_times;
+
+	/* The next state in the same hash bucket
+	 */
+	watch_state_t *next_bucket_state;
+};
+
+typedef struct watch_handle watch_handle_t;
+
+struct watch_handle
+{
+	/* The info handle, used to read a file
+	 */
+	info_handle_t *info_handle;
+
+	/* The output writer of the events
+	 */
+	output_writer_t *output_writer;
+
+	/* The hash buckets of the file states
+	 */
+	watch_state_t *buckets[ WATCH_HANDLE_NUMBER_OF_BUCKETS ];
+
+	/* The number of file states
+	 */
+	int number_of_states;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int watch_state_initialize(
+     watch_state_t **state,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int watch_state_free(
+     watch_state_t **state,
+     libcerror_error_t **error );
+
+int watch_state_has_changed(
+     watch_state_t *previous_state,
+     watch_state_t *current_state,
+     libcerror_error_t **error );
+
+int watch_handle_initialize(
+     watch_handle_t **watch_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int watch_handle_free(
+     watch_handle_t **watch_handle,
+     libcerror_error_t **error );
+
+int watch_handle_signal_abort(
+     watch_handle_t *watch_handle,
+     libcerror_error_t **error );
+
+int watch_handle_path_is_prefetch_file(
+     const system_character_t *path,
+     size_t path_length );
+
+int watch_handle_get_state(
+     watch_handle_t *watch_handle,
+     const system_character_t *path,
+     size_t path_length,
+     watch_state_t **state,
+     libcerror_error_t **error );
+
+int watch_handle_insert_state(
+     watch_handle_t *watch_handle,
+     watch_state_t *state,
+     libcerror_error_t **error );
+
+int watch_handle_remove_state(
+     watch_handle_t *watch_handle,
+     watch_state_t *state,
+     libcerror_error_t **error );
+
+int watch_handle_read_state(
+     watch_handle_t *watch_handle,
+     watch_state_t *state,
+     libcerror_error_t **error );
+
+int watch_handle_event_fprint(
+     watch_handle_t *watch_handle,
+     int event_type,
+     watch_state_t *previous_state,
+     watch_state_t *current_state,
+     libcerror_error_t **error );
+
+int watch_handle_process_file(
+     watch_handle_t *watch_handle,
+     const system_character_t *path,
+     uint8_t report_events,
+     libcerror_error_t **error );
+
+int watch_handle_remove_file(
+     watch_handle_t *watch_handle,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _WATCH_HANDLE_H ) */
+
@@ -245,6 +245,100 @@ class FileTypeTests(unittest.TestCase):
 
     scca_file.close()
 
+  def test_get_filenames_list(self):
+    """Tests the get_filenames_list function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(test_source)
+
+    filenames = scca_file.get_filenames_list()
+    self.assertEqual(len(filenames), scca_file.get_number_of_filenames())
+
+    if filenames:
+      self.assertEqual(filenames[0], scca_file.get_filename(0))
+
+    scca_file.close()
+
+  def test_get_file_metrics_as_tuples(self):
+    """Tests the get_file_metrics_as_tuples function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(test_source)
+
+    file_metrics = scca_file.get_file_metrics_as_tuples()
+    self.assertEqual(
+        len(file_metrics), scca_file.get_number_of_file_metrics_entries())
+
+    if file_metrics:
+      file_metrics_entry = scca_file.get_file_metrics_entry(0)
+      self.assertEqual(file_metrics[0][0], file_metrics_entry.filename)
+
+    scca_file.close()
+
+  def test_get_volumes_as_dicts(self):
+    """Tests the get_volumes_as_dicts function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(test_source)
+
+    volumes = scca_file.get_volumes_as_dicts()
+    self.assertEqual(len(volumes), scca_file.get_number_of_volumes())
+
+    if volumes:
+      volume_information = scca_file.get_volume_information(0)
+      self.assertEqual(
+          volumes[0]["device_path"], volume_information.device_path)
+      self.assertEqual(
+          volumes[0]["serial_number"], volume_information.serial_number)
+
+    scca_file.close()
+
+  def test_get_file_metrics_columns(self):
+    """Tests the get_file_metrics_columns function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(test_source)
+
+    number_of_file_metrics_entries = (
+        scca_file.get_number_of_file_metrics_entries())
+
+    columns = scca_file.get_file_metrics_columns()
+    self.assertEqual(sorted(columns.keys()), [
+        "duration", "file_reference", "filename_index", "flags",
+        "start_time"])
+
+    for name, value_format in (
+        ("start_time", "I"), ("duration", "I"), ("flags", "I"),
+        ("file_reference", "Q"), ("filename_index", "i")):
+      column = memoryview(columns[name])
+      self.assertTrue(column.readonly)
+      self.assertEqual(column.format, value_format)
+      self.assertEqual(len(column), number_of_file_metrics_entries)
+
+    if number_of_file_metrics_entries:
+      file_metrics_entry = scca_file.get_file_metrics_entry(0)
+      self.assertEqual(
+          memoryview(columns["file_reference"])[0],
+          file_metrics_entry.file_reference or 0)
+
+    scca_file.close()
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
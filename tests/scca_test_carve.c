@@ -0,0 +1,644 @@
+/*
+ * Library carving functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_carve.h"
+
+/* Creates data that contains an uncompressed file header at offset 37,
+ * a compressed file header at offset 85 and several near matches
+ */
+void scca_test_carve_create_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	memory_set(
+	 data,
+	 0,
+	 data_size );
+
+	/* Near match of a compressed file header with an unsupported version
+	 */
+	memory_copy(
+	 &( data[ 3 ] ),
+	 "MAM\x05",
+	 4 );
+
+	/* Near match of an uncompressed file header with an unsupported format version
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 10 ] ),
+	 99 );
+
+	memory_copy(
+	 &( data[ 14 ] ),
+	 "SCCA",
+	 4 );
+
+	/* Near match of a compressed file header with a too small uncompressed data size
+	 */
+	memory_copy(
+	 &( data[ 20 ] ),
+	 "MAM\x04",
+	 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 24 ] ),
+	 16 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 37 ] ),
+	 30 );
+
+	memory_copy(
+	 &( data[ 41 ] ),
+	 "SCCA",
+	 4 );
+
+	memory_copy(
+	 &( data[ 85 ] ),
+	 "MAM\x04",
+	 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 89 ] ),
+	 4096 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_carve_check_candidate function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_carve_check_candidate(
+     void )
+{
+	uint8_t data[ 96 ];
+
+	int file_type = 0;
+	int result    = 0;
+
+	scca_test_carve_create_data(
+	 data,
+	 96 );
+
+	/* Test regular cases
+	 */
+	result = libscca_carve_check_candidate(
+	          &( data[ 37 ] ),
+	          &file_type );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_type",
+	 file_type,
+	 LIBSCCA_FILE_TYPE_UNCOMPRESSED );
+
+	result = libscca_carve_check_candidate(
+	          &( data[ 85 ] ),
+	          &file_type );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_type",
+	 file_type,
+	 LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10 );
+
+	/* Test with near matches
+	 */
+	result = libscca_carve_check_candidate(
+	          &( data[ 3 ] ),
+	          &file_type );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_carve_check_candidate(
+	          &( data[ 10 ] ),
+	          &file_type );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_carve_check_candidate(
+	          &( data[ 20 ] ),
+	          &file_type );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* Tests the libscca_carve_find_signature function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_carve_find_signature(
+     void )
+{
+	uint8_t data[ 96 ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	int file_type            = 0;
+	int result               = 0;
+
+	scca_test_carve_create_data(
+	 data,
+	 96 );
+
+	/* Test regular cases
+	 */
+	data_offset = 0;
+
+	result = libscca_carve_find_signature(
+	          data,
+	          96,
+	          &data_offset,
+	          &file_type,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 37 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_type",
+	 file_type,
+	 LIBSCCA_FILE_TYPE_UNCOMPRESSED );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a signature in the last 16 bytes of the data
+	 */
+	data_offset += 1;
+
+	result = libscca_carve_find_signature(
+	          data,
+	          96,
+	          &data_offset,
+	          &file_type,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 85 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_type",
+	 file_type,
+	 LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_offset += 1;
+
+	result = libscca_carve_find_signature(
+	          data,
+	          96,
+	          &data_offset,
+	          &file_type,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 89 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a signature that is not entirely in the data
+	 */
+	data_offset = 0;
+
+	result = libscca_carve_find_signature(
+	          data,
+	          92,
+	          &data_offset,
+	          &file_type,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 37 );
+
+	data_offset += 1;
+
+	result = libscca_carve_find_signature(
+	          data,
+	          92,
+	          &data_offset,
+	          &file_type,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 85 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	data_offset = 0;
+
+	result = libscca_carve_find_signature(
+	          NULL,
+	          96,
+	          &data_offset,
+	          &file_type,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_carve_find_signature(
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &data_offset,
+	          &file_type,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_carve_find_signature(
+	          data,
+	          96,
+	          NULL,
+	          &file_type,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_offset = 97;
+
+	result = libscca_carve_find_signature(
+	          data,
+	          96,
+	          &data_offset,
+	          &file_type,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_offset = 0;
+
+	result = libscca_carve_find_signature(
+	          data,
+	          96,
+	          &data_offset,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_carve_validate_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_carve_validate_data(
+     void )
+{
+	uint8_t data[ 96 ];
+
+	libcerror_error_t *error = NULL;
+	size_t file_size         = 0;
+	int result               = 0;
+
+	scca_test_carve_create_data(
+	 data,
+	 96 );
+
+	/* Test with data that is too small
+	 */
+	result = libscca_carve_validate_data(
+	          &( data[ 37 ] ),
+	          59,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with data that does not start with a signature
+	 */
+	result = libscca_carve_validate_data(
+	          data,
+	          96,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a file size that exceeds the data
+	 */
+	memory_copy(
+	 &( data[ 4 ] ),
+	 "SCCA",
+	 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 0 ] ),
+	 30 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 4096 );
+
+	result = libscca_carve_validate_data(
+	          data,
+	          96,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a file size that is smaller than the file header
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 16 );
+
+	result = libscca_carve_validate_data(
+	          data,
+	          96,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_carve_validate_data(
+	          NULL,
+	          96,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_carve_validate_data(
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_carve_validate_data(
+	          data,
+	          96,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_carve_check_candidate",
+	 scca_test_carve_check_candidate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	SCCA_TEST_RUN(
+	 "libscca_carve_find_signature",
+	 scca_test_carve_find_signature );
+
+	SCCA_TEST_RUN(
+	 "libscca_carve_validate_data",
+	 scca_test_carve_validate_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -37,6 +39,7 @@
 #include "scca_test_libscca.h"
 #include "scca_test_macros.h"
 #include "scca_test_memory.h"
+#include "scca_test_unused.h"
 
 #include "../libscca/libscca_file.h"
 
@@ -64,6 +67,89 @@ int libscca_file_open_file_io_handle(
 
 #endif /* !defined( LIBSCCA_HAVE_BFIO ) */
 
+/* The data of a MAM compressed format version 17 file with a consistent layout
+ */
+uint8_t scca_test_file_compressed_data1[ 305 ] = {
+	0x4d, 0x41, 0x4d, 0x04, 0x00, 0x02, 0x00, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x80, 0x08, 0x00, 0x00, 0x99, 0x02, 0x86, 0x0c,
+	0x90, 0x41, 0x00, 0x60, 0x0a, 0x00, 0x43, 0x45, 0x16, 0xd3, 0xd8, 0xc2, 0x2f, 0x00, 0x12, 0x20,
+	0x21, 0x12, 0x1a, 0x03, 0x00, 0x0b, 0x20, 0xf9, 0x16, 0xe0, 0xe1, 0x34, 0x00, 0x00, 0xff, 0x42,
+	0x01 };
+
+/* Creates the data of a format version 17 file with a consistent layout
+ * The data size must be at least 296
+ */
+void scca_test_file_create_layout_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	memory_set(
+	 data,
+	 0,
+	 data_size );
+
+	/* The file header
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 0 ] ),
+	 17 );
+
+	memory_copy(
+	 &( data[ 4 ] ),
+	 "SCCA",
+	 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 296 );
+
+	/* The file information with 2 file metrics entries at offset 152,
+	 * 16 bytes of filename strings at offset 192 and 1 volume at offset 208
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 84 ] ),
+	 152 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 88 ] ),
+	 2 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 100 ] ),
+	 192 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 104 ] ),
+	 16 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 108 ] ),
+	 208 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 112 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 116 ] ),
+	 88 );
+}
+
 /* Creates and opens a source file
  * Returns 1 if successful or -1 on error
  */
@@ -422,35 +508,18 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_open function
+/* Tests the libscca_file_set_error_mode function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_open(
-     const system_character_t *source )
+int scca_test_file_set_error_mode(
+     void )
 {
-	char narrow_source[ 256 ];
-
 	libcerror_error_t *error = NULL;
 	libscca_file_t *file     = NULL;
 	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = scca_test_get_narrow_source(
-	          source,
-	          narrow_source,
-	          256,
-	          &error );
-
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libscca_file_initialize(
 	          &file,
 	          &error );
@@ -468,12 +537,11 @@ int scca_test_file_open(
 	 "error",
 	 error );
 
-	/* Test open
+	/* Test regular cases
 	 */
-	result = libscca_file_open(
+	result = libscca_file_set_error_mode(
 	          file,
-	          narrow_source,
-	          LIBSCCA_OPEN_READ,
+	          LIBSCCA_ERROR_MODE_CODES_ONLY,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -485,48 +553,25 @@ int scca_test_file_open(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libscca_file_open(
-	          NULL,
-	          narrow_source,
-	          LIBSCCA_OPEN_READ,
-	          &error );
-
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libscca_file_open(
+	result = libscca_file_set_error_mode(
 	          file,
-	          NULL,
-	          LIBSCCA_OPEN_READ,
+	          LIBSCCA_ERROR_MODE_DEFAULT,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libscca_file_open(
-	          file,
-	          narrow_source,
-	          -1,
+	/* Test error cases
+	 */
+	result = libscca_file_set_error_mode(
+	          NULL,
+	          LIBSCCA_ERROR_MODE_CODES_ONLY,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -541,12 +586,9 @@ int scca_test_file_open(
 	libcerror_error_free(
 	 &error );
 
-	/* Test open when already opened
-	 */
-	result = libscca_file_open(
+	result = libscca_file_set_error_mode(
 	          file,
-	          narrow_source,
-	          LIBSCCA_OPEN_READ,
+	          0xff,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -597,26 +639,27 @@ on_error:
 	return( 0 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Tests the libscca_file_open_wide function
+/* Tests the libscca_file_get_read_failure function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_open_wide(
-     const system_character_t *source )
+int scca_test_file_get_read_failure(
+     void )
 {
-	wchar_t wide_source[ 256 ];
+	uint8_t data[ 16 ];
 
-	libcerror_error_t *error = NULL;
-	libscca_file_t *file     = NULL;
-	int result               = 0;
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libscca_file_t *file             = NULL;
+	off64_t offset                   = 0;
+	int error_code                   = 0;
+	int error_domain                 = 0;
+	int result                       = 0;
+	int section_type                 = 0;
 
 	/* Initialize test
 	 */
-	result = scca_test_get_wide_source(
-	          source,
-	          wide_source,
-	          256,
+	result = libscca_file_initialize(
+	          &file,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -624,12 +667,44 @@ int scca_test_file_open_wide(
 	 result,
 	 1 );
 
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libscca_file_initialize(
-	          &file,
+	/* Test regular cases
+	 */
+	result = libscca_file_get_read_failure(
+	          file,
+	          &section_type,
+	          &error_domain,
+	          &error_code,
+	          &offset,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the read failure of data with an unsupported signature in the codes only error mode
+	 */
+	memory_set(
+	 data,
+	 0,
+	 16 );
+
+	result = scca_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          16,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -638,21 +713,63 @@ int scca_test_file_open_wide(
 	 1 );
 
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
+	 "file_io_handle",
+	 file_io_handle );
 
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open
-	 */
-	result = libscca_file_open_wide(
+	result = libscca_file_set_error_mode(
 	          file,
-	          wide_source,
+	          LIBSCCA_ERROR_MODE_CODES_ONLY,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
 	          LIBSCCA_OPEN_READ,
 	          &error );
 
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_read_failure(
+	          file,
+	          &section_type,
+	          &error_domain,
+	          &error_code,
+	          &offset,
+	          &error );
+
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -662,12 +779,47 @@ int scca_test_file_open_wide(
 	 "error",
 	 error );
 
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "section_type",
+	 section_type,
+	 LIBSCCA_FILE_SECTION_TYPE_FILE_HEADER );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "error_domain",
+	 error_domain,
+	 (int) LIBCERROR_ERROR_DOMAIN_RUNTIME );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 (int) LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	result = scca_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	result = libscca_file_open_wide(
+	result = libscca_file_get_read_failure(
 	          NULL,
-	          wide_source,
-	          LIBSCCA_OPEN_READ,
+	          &section_type,
+	          &error_domain,
+	          &error_code,
+	          &offset,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -682,10 +834,12 @@ int scca_test_file_open_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_open_wide(
+	result = libscca_file_get_read_failure(
 	          file,
 	          NULL,
-	          LIBSCCA_OPEN_READ,
+	          &error_domain,
+	          &error_code,
+	          &offset,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -700,10 +854,12 @@ int scca_test_file_open_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_open_wide(
+	result = libscca_file_get_read_failure(
 	          file,
-	          wide_source,
-	          -1,
+	          &section_type,
+	          NULL,
+	          &error_code,
+	          &offset,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -718,12 +874,32 @@ int scca_test_file_open_wide(
 	libcerror_error_free(
 	 &error );
 
-	/* Test open when already opened
-	 */
-	result = libscca_file_open_wide(
+	result = libscca_file_get_read_failure(
 	          file,
-	          wide_source,
-	          LIBSCCA_OPEN_READ,
+	          &section_type,
+	          &error_domain,
+	          NULL,
+	          &offset,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_read_failure(
+	          file,
+	          &section_type,
+	          &error_domain,
+	          &error_code,
+	          NULL,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -765,6 +941,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	if( file != NULL )
 	{
 		libscca_file_free(
@@ -774,64 +956,174 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Tests the libscca_file_open_file_io_handle function
- * Returns 1 if successful or 0 if not
+/* Section callback for the libscca_file_set_section_callback tests
+ * Returns 1 to continue reading or 0 to stop after the file information
  */
-int scca_test_file_open_file_io_handle(
-     const system_character_t *source )
+int scca_test_file_section_callback(
+     libscca_file_t *file SCCA_TEST_ATTRIBUTE_UNUSED,
+     int section_type,
+     intptr_t *user_data )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	libscca_file_t *file             = NULL;
-	size_t string_length             = 0;
-	int result                       = 0;
+	int *sections = (int *) user_data;
 
-	/* Initialize test
-	 */
-	result = libbfio_file_initialize(
-	          &file_io_handle,
-	          &error );
+	SCCA_TEST_UNREFERENCED_PARAMETER( file )
 
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	sections[ 0 ] += 1;
+	sections[ 1 ]  = section_type;
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
+	if( section_type == LIBSCCA_FILE_SECTION_TYPE_FILE_INFORMATION )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
 
-	SCCA_TEST_ASSERT_IS_NULL(
+/* Failing section callback for the libscca_file_set_section_callback tests
+ * Returns -1
+ */
+int scca_test_file_section_callback_failing(
+     libscca_file_t *file SCCA_TEST_ATTRIBUTE_UNUSED,
+     int section_type SCCA_TEST_ATTRIBUTE_UNUSED,
+     intptr_t *user_data SCCA_TEST_ATTRIBUTE_UNUSED )
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( file )
+	SCCA_TEST_UNREFERENCED_PARAMETER( section_type )
+	SCCA_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	return( -1 );
+}
+
+/* Tests the libscca_file_set_section_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_set_section_callback(
+     void )
+{
+	int sections[ 2 ];
+
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	string_length = system_string_length(
-	                 source );
+	/* Test regular cases
+	 */
+	result = libscca_file_set_section_callback(
+	          file,
+	          &scca_test_file_section_callback,
+	          (intptr_t *) sections,
+	          &error );
 
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libbfio_file_set_name_wide(
-	          file_io_handle,
-	          source,
-	          string_length,
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_set_section_callback(
+	          file,
+	          NULL,
+	          NULL,
 	          &error );
-#else
-	result = libbfio_file_set_name(
-	          file_io_handle,
-	          source,
-	          string_length,
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_set_section_callback(
+	          NULL,
+	          &scca_test_file_section_callback,
+	          (intptr_t *) sections,
 	          &error );
-#endif
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 1 );
 
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_set_maximum_memory_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_set_maximum_memory_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
 	result = libscca_file_initialize(
 	          &file,
 	          &error );
@@ -849,12 +1141,25 @@ int scca_test_file_open_file_io_handle(
 	 "error",
 	 error );
 
-	/* Test open
+	/* Test regular cases
 	 */
-	result = libscca_file_open_file_io_handle(
+	result = libscca_file_set_maximum_memory_size(
 	          file,
-	          file_io_handle,
-	          LIBSCCA_OPEN_READ,
+	          1024 * 1024,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_set_maximum_memory_size(
+	          file,
+	          0,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -868,10 +1173,9 @@ int scca_test_file_open_file_io_handle(
 
 	/* Test error cases
 	 */
-	result = libscca_file_open_file_io_handle(
+	result = libscca_file_set_maximum_memory_size(
 	          NULL,
-	          file_io_handle,
-	          LIBSCCA_OPEN_READ,
+	          1024 * 1024,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -886,10 +1190,9 @@ int scca_test_file_open_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_open_file_io_handle(
+	result = libscca_file_set_maximum_memory_size(
 	          file,
-	          NULL,
-	          LIBSCCA_OPEN_READ,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -904,10 +1207,100 @@ int scca_test_file_open_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_open_file_io_handle(
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_memory_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_memory_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	size_t memory_size       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	memory_size = 1;
+
+	result = libscca_file_get_memory_size(
 	          file,
-	          file_io_handle,
-	          -1,
+	          &memory_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "memory_size",
+	 memory_size,
+	 (size_t) 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_memory_size(
+	          NULL,
+	          &memory_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -922,12 +1315,9 @@ int scca_test_file_open_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	/* Test open when already opened
-	 */
-	result = libscca_file_open_file_io_handle(
+	result = libscca_file_get_memory_size(
 	          file,
-	          file_io_handle,
-	          LIBSCCA_OPEN_READ,
+	          NULL,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -961,23 +1351,6 @@ int scca_test_file_open_file_io_handle(
 	 "error",
 	 error );
 
-	result = libbfio_handle_free(
-	          &file_io_handle,
-	          &error );
-
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	return( 1 );
 
 on_error:
@@ -992,27 +1365,1930 @@ on_error:
 		 &file,
 		 NULL );
 	}
-	if( file_io_handle != NULL )
+	return( 0 );
+}
+
+/* Tests opening a file with a maximum memory size
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_open_with_maximum_memory_size(
+     void )
+{
+	libbfio_handle_t *file_io_handle   = NULL;
+	libcerror_error_t *error           = NULL;
+	libscca_file_t *file               = NULL;
+	libscca_mam_decoder_t *mam_decoder = NULL;
+	off64_t offset                     = 0;
+	size_t memory_size                 = 0;
+	int error_code                     = 0;
+	int error_domain                   = 0;
+	int result                         = 0;
+	int section_type                   = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_mam_decoder_initialize(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_set_mam_decoder(
+	          file,
+	          mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scca_test_open_file_io_handle(
+	          &file_io_handle,
+	          scca_test_file_compressed_data1,
+	          305,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with a maximum memory size smaller than the uncompressed data size of 512 bytes
+	 */
+	result = libscca_file_set_maximum_memory_size(
+	          file,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_read_failure(
+	          file,
+	          &section_type,
+	          &error_domain,
+	          &error_code,
+	          &offset,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "error_domain",
+	 error_domain,
+	 (int) LIBCERROR_ERROR_DOMAIN_MEMORY );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 (int) LIBCERROR_MEMORY_ERROR_INSUFFICIENT );
+
+	/* The failed open should not leave memory reserved
+	 */
+	result = libscca_file_get_memory_size(
+	          file,
+	          &memory_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "memory_size",
+	 memory_size,
+	 (size_t) 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open of the same file with a sufficient maximum memory size
+	 */
+	result = libscca_file_set_maximum_memory_size(
+	          file,
+	          64 * 1024,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_close(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = scca_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_mam_decoder_free(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
 		 &file_io_handle,
 		 NULL );
 	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	if( mam_decoder != NULL )
+	{
+		libscca_mam_decoder_free(
+		 &mam_decoder,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libscca_file_close function
+/* Tests the libscca_file_set_mam_decoder function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_close(
+int scca_test_file_set_mam_decoder(
      void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error           = NULL;
+	libscca_file_t *file               = NULL;
+	libscca_mam_decoder_t *mam_decoder = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_mam_decoder_initialize(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_file_set_mam_decoder(
+	          file,
+	          mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_set_mam_decoder(
+	          NULL,
+	          mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_set_mam_decoder(
+	          file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The MAM decoder is not freed by the file
+	 */
+	result = libscca_mam_decoder_free(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	if( mam_decoder != NULL )
+	{
+		libscca_mam_decoder_free(
+		 &mam_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_open function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_open(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = scca_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libscca_file_open(
+	          file,
+	          narrow_source,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_open(
+	          NULL,
+	          narrow_source,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open(
+	          file,
+	          NULL,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open(
+	          file,
+	          narrow_source,
+	          -1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libscca_file_open(
+	          file,
+	          narrow_source,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libscca_file_open_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_open_wide(
+     const system_character_t *source )
+{
+	wchar_t wide_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = scca_test_get_wide_source(
+	          source,
+	          wide_source,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libscca_file_open_wide(
+	          file,
+	          wide_source,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_open_wide(
+	          NULL,
+	          wide_source,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open_wide(
+	          file,
+	          NULL,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open_wide(
+	          file,
+	          wide_source,
+	          -1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libscca_file_open_wide(
+	          file,
+	          wide_source,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libscca_file_open_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_open_file_io_handle(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libscca_file_t *file             = NULL;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libscca_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_open_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open_file_io_handle(
+	          file,
+	          NULL,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          -1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libscca_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_close function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_file_close(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_open and libscca_file_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_open_close(
+     const system_character_t *source )
+{
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libscca_file_open_wide(
+	          file,
+	          source,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+#else
+	result = libscca_file_open(
+	          file,
+	          source,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+#endif
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_close(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libscca_file_open_wide(
+	          file,
+	          source,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+#else
+	result = libscca_file_open(
+	          file,
+	          source,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+#endif
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_close(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests opening a file with a section callback that stops reading
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_open_with_section_callback(
+     libbfio_handle_t *file_io_handle )
+{
+	int sections[ 2 ];
+
+	libcerror_error_t *error   = NULL;
+	libscca_file_t *file       = NULL;
+	off64_t offset             = 0;
+	int error_code             = 0;
+	int error_domain           = 0;
+	int number_of_file_metrics = 0;
+	int result                 = 0;
+	int section_type           = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 sections,
+	 0,
+	 sizeof( int ) * 2 );
+
+	result = libscca_file_set_section_callback(
+	          file,
+	          &scca_test_file_section_callback,
+	          (intptr_t *) sections,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open stops after the file information
+	 */
+	result = libscca_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "sections[ 0 ]",
+	 sections[ 0 ],
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "sections[ 1 ]",
+	 sections[ 1 ],
+	 LIBSCCA_FILE_SECTION_TYPE_FILE_INFORMATION );
+
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          file,
+	          &number_of_file_metrics,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_metrics",
+	 number_of_file_metrics,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_close(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the section callback fails
+	 */
+	result = libscca_file_set_section_callback(
+	          file,
+	          &scca_test_file_section_callback_failing,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_read_failure(
+	          file,
+	          &section_type,
+	          &error_domain,
+	          &error_code,
+	          &offset,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "section_type",
+	 section_type,
+	 LIBSCCA_FILE_SECTION_TYPE_FILE_HEADER );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "error_domain",
+	 error_domain,
+	 (int) LIBCERROR_ERROR_DOMAIN_RUNTIME );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 (int) LIBCERROR_RUNTIME_ERROR_GENERIC );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_signal_abort(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_signal_abort(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_signal_abort(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_set_read_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_set_read_flags(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_file_set_read_flags(
+	          file,
+	          LIBSCCA_READ_FLAG_FILENAME_STRINGS,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_set_read_flags(
+	          file,
+	          LIBSCCA_READ_FLAGS_ALL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_set_read_flags(
+	          NULL,
+	          LIBSCCA_READ_FLAGS_ALL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_set_read_flags(
+	          file,
+	          0x80,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_format_version function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_format_version(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t format_version  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_format_version(
+	          file,
+	          &format_version,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_format_version(
+	          NULL,
+	          &format_version,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_format_version(
+	          file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_utf8_executable_filename_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_utf8_executable_filename_size(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_utf8_executable_filename_size(
+	          file,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_utf8_executable_filename_size(
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_executable_filename_size(
+	          file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_utf8_executable_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_utf8_executable_filename(
+     libscca_file_t *file )
+{
+	uint8_t utf8_string[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_utf8_executable_filename(
+	          file,
+	          utf8_string,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_utf8_executable_filename(
+	          NULL,
+	          utf8_string,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_executable_filename(
+	          file,
+	          NULL,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_executable_filename(
+	          file,
+	          utf8_string,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_executable_filename(
+	          file,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_utf16_executable_filename_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_utf16_executable_filename_size(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_utf16_executable_filename_size(
+	          file,
+	          &utf16_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_utf16_executable_filename_size(
+	          NULL,
+	          &utf16_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	/* Test error cases
-	 */
-	result = libscca_file_close(
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_executable_filename_size(
+	          file,
 	          NULL,
 	          &error );
 
@@ -1039,20 +3315,23 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_open and libscca_file_close functions
+/* Tests the libscca_file_get_utf16_executable_filename function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_open_close(
-     const system_character_t *source )
+int scca_test_file_get_utf16_executable_filename(
+     libscca_file_t *file )
 {
+	uint16_t utf16_string[ 512 ];
+
 	libcerror_error_t *error = NULL;
-	libscca_file_t *file     = NULL;
 	int result               = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = libscca_file_initialize(
-	          &file,
+	result = libscca_file_get_utf16_executable_filename(
+	          file,
+	          utf16_string,
+	          512,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1060,109 +3339,157 @@ int scca_test_file_open_close(
 	 result,
 	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
-
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close
+	/* Test error cases
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libscca_file_open_wide(
-	          file,
-	          source,
-	          LIBSCCA_OPEN_READ,
-	          &error );
-#else
-	result = libscca_file_open(
-	          file,
-	          source,
-	          LIBSCCA_OPEN_READ,
+	result = libscca_file_get_utf16_executable_filename(
+	          NULL,
+	          utf16_string,
+	          512,
 	          &error );
-#endif
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libscca_file_close(
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_executable_filename(
 	          file,
+	          NULL,
+	          512,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
-	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libscca_file_open_wide(
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_executable_filename(
 	          file,
-	          source,
-	          LIBSCCA_OPEN_READ,
+	          utf16_string,
+	          0,
 	          &error );
-#else
-	result = libscca_file_open(
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_executable_filename(
 	          file,
-	          source,
-	          LIBSCCA_OPEN_READ,
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
-#endif
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libscca_file_close(
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_prefetch_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_prefetch_hash(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t prefetch_hash   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_prefetch_hash(
 	          file,
+	          &prefetch_hash,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
+	/* Test error cases
 	 */
-	result = libscca_file_free(
-	          &file,
+	result = libscca_file_get_prefetch_hash(
+	          NULL,
+	          &prefetch_hash,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "file",
-	 file );
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	SCCA_TEST_ASSERT_IS_NULL(
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_prefetch_hash(
+	          file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -1171,28 +3498,25 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file != NULL )
-	{
-		libscca_file_free(
-		 &file,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libscca_file_signal_abort function
+/* Tests the libscca_file_get_last_run_time function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_signal_abort(
+int scca_test_file_get_last_run_time(
      libscca_file_t *file )
 {
 	libcerror_error_t *error = NULL;
+	uint64_t filetime        = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_signal_abort(
+	result = libscca_file_get_last_run_time(
 	          file,
+	          0,
+	          &filetime,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1206,7 +3530,45 @@ int scca_test_file_signal_abort(
 
 	/* Test error cases
 	 */
-	result = libscca_file_signal_abort(
+	result = libscca_file_get_last_run_time(
+	          NULL,
+	          0,
+	          &filetime,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_last_run_time(
+	          file,
+	          -1,
+	          &filetime,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_last_run_time(
+	          file,
+	          0,
 	          NULL,
 	          &error );
 
@@ -1233,21 +3595,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_format_version function
+/* Tests the libscca_file_get_run_count function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_format_version(
+int scca_test_file_get_run_count(
      libscca_file_t *file )
 {
 	libcerror_error_t *error = NULL;
-	uint32_t format_version  = 0;
+	uint32_t run_count       = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_format_version(
+	result = libscca_file_get_run_count(
 	          file,
-	          &format_version,
+	          &run_count,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1261,9 +3623,9 @@ int scca_test_file_get_format_version(
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_format_version(
+	result = libscca_file_get_run_count(
 	          NULL,
-	          &format_version,
+	          &run_count,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1278,7 +3640,7 @@ int scca_test_file_get_format_version(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_format_version(
+	result = libscca_file_get_run_count(
 	          file,
 	          NULL,
 	          &error );
@@ -1306,21 +3668,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf8_executable_filename_size function
+/* Tests the libscca_file_get_number_of_file_metrics_entries function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf8_executable_filename_size(
+int scca_test_file_get_number_of_file_metrics_entries(
      libscca_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	size_t utf8_string_size  = 0;
-	int result               = 0;
+	libcerror_error_t *error           = NULL;
+	int number_of_file_metrics_entries = 0;
+	int result                         = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_utf8_executable_filename_size(
+	result = libscca_file_get_number_of_file_metrics_entries(
 	          file,
-	          &utf8_string_size,
+	          &number_of_file_metrics_entries,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1334,9 +3696,9 @@ int scca_test_file_get_utf8_executable_filename_size(
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_utf8_executable_filename_size(
+	result = libscca_file_get_number_of_file_metrics_entries(
 	          NULL,
-	          &utf8_string_size,
+	          &number_of_file_metrics_entries,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1351,7 +3713,7 @@ int scca_test_file_get_utf8_executable_filename_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_executable_filename_size(
+	result = libscca_file_get_number_of_file_metrics_entries(
 	          file,
 	          NULL,
 	          &error );
@@ -1379,23 +3741,22 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf8_executable_filename function
+/* Tests the libscca_file_get_file_metrics_entry function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf8_executable_filename(
+int scca_test_file_get_file_metrics_entry(
      libscca_file_t *file )
 {
-	uint8_t utf8_string[ 512 ];
-
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error             = NULL;
+	libscca_file_metrics_t *file_metrics = NULL;
+	int result                           = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_utf8_executable_filename(
+	result = libscca_file_get_file_metrics_entry(
 	          file,
-	          utf8_string,
-	          512,
+	          0,
+	          &file_metrics,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1407,30 +3768,29 @@ int scca_test_file_get_utf8_executable_filename(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libscca_file_get_utf8_executable_filename(
-	          NULL,
-	          utf8_string,
-	          512,
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_metrics",
+	 file_metrics );
+
+	result = libscca_file_metrics_free(
+	          &file_metrics,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libscca_file_get_utf8_executable_filename(
-	          file,
+	/* Test error cases
+	 */
+	result = libscca_file_get_file_metrics_entry(
 	          NULL,
-	          512,
+	          0,
+	          &file_metrics,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1438,6 +3798,10 @@ int scca_test_file_get_utf8_executable_filename(
 	 result,
 	 -1 );
 
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_metrics",
+	 file_metrics );
+
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1445,10 +3809,10 @@ int scca_test_file_get_utf8_executable_filename(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_executable_filename(
+	result = libscca_file_get_file_metrics_entry(
 	          file,
-	          utf8_string,
-	          0,
+	          -1,
+	          &file_metrics,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1456,6 +3820,10 @@ int scca_test_file_get_utf8_executable_filename(
 	 result,
 	 -1 );
 
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_metrics",
+	 file_metrics );
+
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1463,10 +3831,10 @@ int scca_test_file_get_utf8_executable_filename(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_executable_filename(
+	result = libscca_file_get_file_metrics_entry(
 	          file,
-	          utf8_string,
-	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          NULL,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1474,6 +3842,10 @@ int scca_test_file_get_utf8_executable_filename(
 	 result,
 	 -1 );
 
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_metrics",
+	 file_metrics );
+
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1489,24 +3861,69 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file_metrics != NULL )
+	{
+		libscca_file_metrics_free(
+		 &file_metrics,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf16_executable_filename_size function
+/* Tests the libscca_file_get_file_metrics_columns function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf16_executable_filename_size(
+int scca_test_file_get_file_metrics_columns(
      libscca_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	size_t utf16_string_size = 0;
-	int result               = 0;
+	libcerror_error_t *error             = NULL;
+	libscca_file_metrics_t *file_metrics = NULL;
+	int32_t *filename_indexes            = NULL;
+	uint64_t *file_references            = NULL;
+	uint64_t file_reference              = 0;
+	int number_of_entries                = 0;
+	int result                           = 0;
+
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          file,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_entries > 0 )
+	{
+		file_references = (uint64_t *) memory_allocate(
+		                                sizeof( uint64_t ) * number_of_entries );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "file_references",
+		 file_references );
+
+		filename_indexes = (int32_t *) memory_allocate(
+		                                sizeof( int32_t ) * number_of_entries );
 
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "filename_indexes",
+		 filename_indexes );
+	}
 	/* Test regular cases
 	 */
-	result = libscca_file_get_utf16_executable_filename_size(
+	result = libscca_file_get_file_metrics_columns(
 	          file,
-	          &utf16_string_size,
+	          number_of_entries,
+	          NULL,
+	          NULL,
+	          NULL,
+	          file_references,
+	          filename_indexes,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1518,11 +3935,74 @@ int scca_test_file_get_utf16_executable_filename_size(
 	 "error",
 	 error );
 
+	if( number_of_entries > 0 )
+	{
+		SCCA_TEST_ASSERT_GREATER_THAN_INT(
+		 "filename_indexes[ 0 ]",
+		 (int) filename_indexes[ 0 ],
+		 -2 );
+
+		result = libscca_file_get_file_metrics_entry(
+		          file,
+		          0,
+		          &file_metrics,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libscca_file_metrics_get_file_reference(
+		          file_metrics,
+		          &file_reference,
+		          &error );
+
+		SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			file_reference = 0;
+		}
+		SCCA_TEST_ASSERT_EQUAL_UINT64(
+		 "file_references[ 0 ]",
+		 file_references[ 0 ],
+		 file_reference );
+
+		result = libscca_file_metrics_free(
+		          &file_metrics,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
 	/* Test error cases
 	 */
-	result = libscca_file_get_utf16_executable_filename_size(
+	result = libscca_file_get_file_metrics_columns(
 	          NULL,
-	          &utf16_string_size,
+	          number_of_entries,
+	          NULL,
+	          NULL,
+	          NULL,
+	          file_references,
+	          filename_indexes,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1537,8 +4017,13 @@ int scca_test_file_get_utf16_executable_filename_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf16_executable_filename_size(
+	result = libscca_file_get_file_metrics_columns(
 	          file,
+	          number_of_entries + 1,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
 	          NULL,
 	          &error );
 
@@ -1554,6 +4039,22 @@ int scca_test_file_get_utf16_executable_filename_size(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	if( filename_indexes != NULL )
+	{
+		memory_free(
+		 filename_indexes );
+
+		filename_indexes = NULL;
+	}
+	if( file_references != NULL )
+	{
+		memory_free(
+		 file_references );
+
+		file_references = NULL;
+	}
 	return( 1 );
 
 on_error:
@@ -1562,26 +4063,40 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file_metrics != NULL )
+	{
+		libscca_file_metrics_free(
+		 &file_metrics,
+		 NULL );
+	}
+	if( filename_indexes != NULL )
+	{
+		memory_free(
+		 filename_indexes );
+	}
+	if( file_references != NULL )
+	{
+		memory_free(
+		 file_references );
+	}
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf16_executable_filename function
+/* Tests the libscca_file_get_number_of_filenames function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf16_executable_filename(
+int scca_test_file_get_number_of_filenames(
      libscca_file_t *file )
 {
-	uint16_t utf16_string[ 512 ];
-
 	libcerror_error_t *error = NULL;
+	int number_of_filenames  = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_utf16_executable_filename(
+	result = libscca_file_get_number_of_filenames(
 	          file,
-	          utf16_string,
-	          512,
+	          &number_of_filenames,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1595,10 +4110,9 @@ int scca_test_file_get_utf16_executable_filename(
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_utf16_executable_filename(
+	result = libscca_file_get_number_of_filenames(
 	          NULL,
-	          utf16_string,
-	          512,
+	          &number_of_filenames,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1613,46 +4127,9 @@ int scca_test_file_get_utf16_executable_filename(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf16_executable_filename(
+	result = libscca_file_get_number_of_filenames(
 	          file,
 	          NULL,
-	          512,
-	          &error );
-
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libscca_file_get_utf16_executable_filename(
-	          file,
-	          utf16_string,
-	          0,
-	          &error );
-
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libscca_file_get_utf16_executable_filename(
-	          file,
-	          utf16_string,
-	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1678,37 +4155,57 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_prefetch_hash function
+/* Tests the libscca_file_get_utf8_filename_size function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_prefetch_hash(
+int scca_test_file_get_utf8_filename_size(
      libscca_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	uint32_t prefetch_hash   = 0;
-	int result               = 0;
+	libcerror_error_t *error  = NULL;
+	size_t utf8_filename_size = 0;
+	int result                = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_prefetch_hash(
+	result = libscca_file_get_utf8_filename_size(
 	          file,
-	          &prefetch_hash,
+	          0,
+	          &utf8_filename_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_utf8_filename_size(
+	          NULL,
+	          0,
+	          &utf8_filename_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libscca_file_get_prefetch_hash(
-	          NULL,
-	          &prefetch_hash,
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_filename_size(
+	          file,
+	          -1,
+	          &utf8_filename_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1723,8 +4220,9 @@ int scca_test_file_get_prefetch_hash(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_prefetch_hash(
+	result = libscca_file_get_utf8_filename_size(
 	          file,
+	          0,
 	          NULL,
 	          &error );
 
@@ -1751,28 +4249,30 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_last_run_time function
+/* Tests the libscca_file_get_utf8_filename function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_last_run_time(
+int scca_test_file_get_utf8_filename(
      libscca_file_t *file )
 {
+	uint8_t utf8_filename[ 512 ];
+
 	libcerror_error_t *error = NULL;
-	uint64_t filetime        = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_last_run_time(
+	result = libscca_file_get_utf8_filename(
 	          file,
 	          0,
-	          &filetime,
+	          utf8_filename,
+	          512,
 	          &error );
 
-	SCCA_TEST_ASSERT_EQUAL_INT(
+	SCCA_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1780,10 +4280,11 @@ int scca_test_file_get_last_run_time(
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_last_run_time(
+	result = libscca_file_get_utf8_filename(
 	          NULL,
 	          0,
-	          &filetime,
+	          utf8_filename,
+	          512,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1798,10 +4299,11 @@ int scca_test_file_get_last_run_time(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_last_run_time(
+	result = libscca_file_get_utf8_filename(
 	          file,
 	          -1,
-	          &filetime,
+	          utf8_filename,
+	          512,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1816,10 +4318,11 @@ int scca_test_file_get_last_run_time(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_last_run_time(
+	result = libscca_file_get_utf8_filename(
 	          file,
 	          0,
 	          NULL,
+	          512,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1834,48 +4337,11 @@ int scca_test_file_get_last_run_time(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libscca_file_get_run_count function
- * Returns 1 if successful or 0 if not
- */
-int scca_test_file_get_run_count(
-     libscca_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	uint32_t run_count       = 0;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
-	result = libscca_file_get_run_count(
+	result = libscca_file_get_utf8_filename(
 	          file,
-	          &run_count,
-	          &error );
-
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test error cases
-	 */
-	result = libscca_file_get_run_count(
-	          NULL,
-	          &run_count,
+	          0,
+	          utf8_filename,
+	          0,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1890,9 +4356,11 @@ int scca_test_file_get_run_count(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_run_count(
+	result = libscca_file_get_utf8_filename(
 	          file,
-	          NULL,
+	          0,
+	          utf8_filename,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1918,21 +4386,22 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_number_of_file_metrics_entries function
+/* Tests the libscca_file_get_utf16_filename_size function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_number_of_file_metrics_entries(
+int scca_test_file_get_utf16_filename_size(
      libscca_file_t *file )
 {
-	libcerror_error_t *error           = NULL;
-	int number_of_file_metrics_entries = 0;
-	int result                         = 0;
+	libcerror_error_t *error   = NULL;
+	size_t utf16_filename_size = 0;
+	int result                 = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_number_of_file_metrics_entries(
+	result = libscca_file_get_utf16_filename_size(
 	          file,
-	          &number_of_file_metrics_entries,
+	          0,
+	          &utf16_filename_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1946,9 +4415,10 @@ int scca_test_file_get_number_of_file_metrics_entries(
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_number_of_file_metrics_entries(
+	result = libscca_file_get_utf16_filename_size(
 	          NULL,
-	          &number_of_file_metrics_entries,
+	          0,
+	          &utf16_filename_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1963,8 +4433,27 @@ int scca_test_file_get_number_of_file_metrics_entries(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_number_of_file_metrics_entries(
+	result = libscca_file_get_utf16_filename_size(
+	          file,
+	          -1,
+	          &utf16_filename_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_filename_size(
 	          file,
+	          0,
 	          NULL,
 	          &error );
 
@@ -1991,56 +4480,80 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_file_metrics_entry function
+/* Tests the libscca_file_get_utf16_filename function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_file_metrics_entry(
+int scca_test_file_get_utf16_filename(
      libscca_file_t *file )
 {
-	libcerror_error_t *error             = NULL;
-	libscca_file_metrics_t *file_metrics = NULL;
-	int result                           = 0;
+	uint16_t utf16_filename[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_file_metrics_entry(
+	result = libscca_file_get_utf16_filename(
 	          file,
 	          0,
-	          &file_metrics,
+	          utf16_filename,
+	          512,
 	          &error );
 
-	SCCA_TEST_ASSERT_EQUAL_INT(
+	SCCA_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	/* Test error cases
+	 */
+	result = libscca_file_get_utf16_filename(
+	          NULL,
+	          0,
+	          utf16_filename,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "file_metrics",
-	 file_metrics );
+	 "error",
+	 error );
 
-	result = libscca_file_metrics_free(
-	          &file_metrics,
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_filename(
+	          file,
+	          -1,
+	          utf16_filename,
+	          512,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libscca_file_get_file_metrics_entry(
-	          NULL,
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_filename(
+	          file,
 	          0,
-	          &file_metrics,
+	          NULL,
+	          512,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2048,10 +4561,6 @@ int scca_test_file_get_file_metrics_entry(
 	 result,
 	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "file_metrics",
-	 file_metrics );
-
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2059,10 +4568,11 @@ int scca_test_file_get_file_metrics_entry(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_file_metrics_entry(
+	result = libscca_file_get_utf16_filename(
 	          file,
-	          -1,
-	          &file_metrics,
+	          0,
+	          utf16_filename,
+	          0,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2070,10 +4580,6 @@ int scca_test_file_get_file_metrics_entry(
 	 result,
 	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "file_metrics",
-	 file_metrics );
-
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2081,10 +4587,11 @@ int scca_test_file_get_file_metrics_entry(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_file_metrics_entry(
+	result = libscca_file_get_utf16_filename(
 	          file,
 	          0,
-	          NULL,
+	          utf16_filename,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2092,10 +4599,6 @@ int scca_test_file_get_file_metrics_entry(
 	 result,
 	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "file_metrics",
-	 file_metrics );
-
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2111,30 +4614,24 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file_metrics != NULL )
-	{
-		libscca_file_metrics_free(
-		 &file_metrics,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_number_of_filenames function
+/* Tests the libscca_file_get_number_of_volumes function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_number_of_filenames(
+int scca_test_file_get_number_of_volumes(
      libscca_file_t *file )
 {
 	libcerror_error_t *error = NULL;
-	int number_of_filenames  = 0;
+	int number_of_volumes    = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_number_of_filenames(
+	result = libscca_file_get_number_of_volumes(
 	          file,
-	          &number_of_filenames,
+	          &number_of_volumes,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2148,9 +4645,9 @@ int scca_test_file_get_number_of_filenames(
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_number_of_filenames(
+	result = libscca_file_get_number_of_volumes(
 	          NULL,
-	          &number_of_filenames,
+	          &number_of_volumes,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2165,7 +4662,7 @@ int scca_test_file_get_number_of_filenames(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_number_of_filenames(
+	result = libscca_file_get_number_of_volumes(
 	          file,
 	          NULL,
 	          &error );
@@ -2193,22 +4690,39 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf8_filename_size function
+/* Tests the libscca_file_get_volume_information function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf8_filename_size(
+int scca_test_file_get_volume_information(
      libscca_file_t *file )
 {
-	libcerror_error_t *error  = NULL;
-	size_t utf8_filename_size = 0;
-	int result                = 0;
+	libcerror_error_t *error                         = NULL;
+	libscca_volume_information_t *volume_information = NULL;
+	int result                                       = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_utf8_filename_size(
+	result = libscca_file_get_volume_information(
 	          file,
 	          0,
-	          &utf8_filename_size,
+	          &volume_information,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_information",
+	 volume_information );
+
+	result = libscca_volume_information_free(
+	          &volume_information,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2222,10 +4736,10 @@ int scca_test_file_get_utf8_filename_size(
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_utf8_filename_size(
+	result = libscca_file_get_volume_information(
 	          NULL,
 	          0,
-	          &utf8_filename_size,
+	          &volume_information,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2233,6 +4747,10 @@ int scca_test_file_get_utf8_filename_size(
 	 result,
 	 -1 );
 
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2240,10 +4758,10 @@ int scca_test_file_get_utf8_filename_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_filename_size(
+	result = libscca_file_get_volume_information(
 	          file,
 	          -1,
-	          &utf8_filename_size,
+	          &volume_information,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2251,6 +4769,10 @@ int scca_test_file_get_utf8_filename_size(
 	 result,
 	 -1 );
 
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2258,7 +4780,7 @@ int scca_test_file_get_utf8_filename_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_filename_size(
+	result = libscca_file_get_volume_information(
 	          file,
 	          0,
 	          NULL,
@@ -2269,6 +4791,10 @@ int scca_test_file_get_utf8_filename_size(
 	 result,
 	 -1 );
 
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2284,33 +4810,41 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf8_filename function
+/* Tests the libscca_file_get_uncompressed_data_size function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf8_filename(
+int scca_test_file_get_uncompressed_data_size(
      libscca_file_t *file )
 {
-	uint8_t utf8_filename[ 512 ];
-
 	libcerror_error_t *error = NULL;
+	size64_t data_size       = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_utf8_filename(
+	result = libscca_file_get_uncompressed_data_size(
 	          file,
-	          0,
-	          utf8_filename,
-	          512,
+	          &data_size,
 	          &error );
 
-	SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	SCCA_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "data_size",
+	 (int64_t) data_size,
+	 (int64_t) 0 );
 
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2318,11 +4852,9 @@ int scca_test_file_get_utf8_filename(
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_utf8_filename(
+	result = libscca_file_get_uncompressed_data_size(
 	          NULL,
-	          0,
-	          utf8_filename,
-	          512,
+	          &data_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2337,36 +4869,121 @@ int scca_test_file_get_utf8_filename(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_filename(
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_read_uncompressed_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_read_uncompressed_data(
+     libscca_file_t *file )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	size64_t data_size       = 0;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_get_uncompressed_data_size(
 	          file,
-	          -1,
-	          utf8_filename,
-	          512,
+	          &data_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* Test regular cases
+	 */
+	read_count = libscca_file_read_uncompressed_data(
+	              file,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
 
-	result = libscca_file_get_utf8_filename(
-	          file,
-	          0,
-	          NULL,
-	          512,
-	          &error );
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The uncompressed data starts with the file header
+	 */
+	result = memory_compare(
+	          &( buffer[ 4 ] ),
+	          "SCCA",
+	          4 );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
+
+	read_count = libscca_file_read_uncompressed_data(
+	              file,
+	              buffer,
+	              16,
+	              (off64_t) data_size - 8,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libscca_file_read_uncompressed_data(
+	              file,
+	              buffer,
+	              16,
+	              (off64_t) data_size,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libscca_file_read_uncompressed_data(
+	              NULL,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2375,17 +4992,17 @@ int scca_test_file_get_utf8_filename(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_filename(
-	          file,
-	          0,
-	          utf8_filename,
-	          0,
-	          &error );
+	read_count = libscca_file_read_uncompressed_data(
+	              file,
+	              NULL,
+	              16,
+	              0,
+	              &error );
 
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2394,17 +5011,36 @@ int scca_test_file_get_utf8_filename(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_filename(
-	          file,
-	          0,
-	          utf8_filename,
-	          (size_t) SSIZE_MAX + 1,
-	          &error );
+	read_count = libscca_file_read_uncompressed_data(
+	              file,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
 
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libscca_file_read_uncompressed_data(
+	              file,
+	              buffer,
+	              16,
+	              -1,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2424,22 +5060,77 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf16_filename_size function
+/* Tests the libscca_file_get_uncompressed_data function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf16_filename_size(
+int scca_test_file_get_uncompressed_data(
      libscca_file_t *file )
 {
+	const uint8_t *cached_data = NULL;
+	const uint8_t *data        = NULL;
 	libcerror_error_t *error   = NULL;
-	size_t utf16_filename_size = 0;
+	size64_t expected_size     = 0;
+	size_t data_size           = 0;
 	int result                 = 0;
 
+	/* Initialize test
+	 */
+	result = libscca_file_get_uncompressed_data_size(
+	          file,
+	          &expected_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test regular cases
 	 */
-	result = libscca_file_get_utf16_filename_size(
+	result = libscca_file_get_uncompressed_data(
 	          file,
-	          0,
-	          &utf16_filename_size,
+	          &data,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 (uint64_t) data_size,
+	 (uint64_t) expected_size );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( data[ 4 ] ),
+	          "SCCA",
+	          4 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The data is read once
+	 */
+	result = libscca_file_get_uncompressed_data(
+	          file,
+	          &cached_data,
+	          &data_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2447,16 +5138,21 @@ int scca_test_file_get_utf16_filename_size(
 	 result,
 	 1 );
 
+	SCCA_TEST_ASSERT_EQUAL_INTPTR(
+	 "cached_data",
+	 (intptr_t) cached_data,
+	 (intptr_t) data );
+
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_utf16_filename_size(
+	result = libscca_file_get_uncompressed_data(
 	          NULL,
-	          0,
-	          &utf16_filename_size,
+	          &data,
+	          &data_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2471,10 +5167,10 @@ int scca_test_file_get_utf16_filename_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf16_filename_size(
+	result = libscca_file_get_uncompressed_data(
 	          file,
-	          -1,
-	          &utf16_filename_size,
+	          NULL,
+	          &data_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2489,9 +5185,9 @@ int scca_test_file_get_utf16_filename_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf16_filename_size(
+	result = libscca_file_get_uncompressed_data(
 	          file,
-	          0,
+	          &data,
 	          NULL,
 	          &error );
 
@@ -2507,110 +5203,259 @@ int scca_test_file_get_utf16_filename_size(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* File metrics entry callback for the libscca_file_visit test
+ * Returns 1 to continue visiting
+ */
+int scca_test_file_visit_on_metrics_entry(
+     intptr_t *user_data,
+     int entry_index SCCA_TEST_ATTRIBUTE_UNUSED,
+     uint32_t start_time SCCA_TEST_ATTRIBUTE_UNUSED,
+     uint32_t duration SCCA_TEST_ATTRIBUTE_UNUSED,
+     uint32_t flags SCCA_TEST_ATTRIBUTE_UNUSED,
+     uint64_t file_reference SCCA_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *utf16_filename SCCA_TEST_ATTRIBUTE_UNUSED,
+     size_t utf16_filename_size SCCA_TEST_ATTRIBUTE_UNUSED )
+{
+	int *counts = (int *) user_data;
+
+	SCCA_TEST_UNREFERENCED_PARAMETER( entry_index )
+	SCCA_TEST_UNREFERENCED_PARAMETER( start_time )
+	SCCA_TEST_UNREFERENCED_PARAMETER( duration )
+	SCCA_TEST_UNREFERENCED_PARAMETER( flags )
+	SCCA_TEST_UNREFERENCED_PARAMETER( file_reference )
+	SCCA_TEST_UNREFERENCED_PARAMETER( utf16_filename )
+	SCCA_TEST_UNREFERENCED_PARAMETER( utf16_filename_size )
+
+	counts[ 0 ] += 1;
+
+	return( 1 );
+}
+
+/* Filename callback for the libscca_file_visit test
+ * Returns 1 to continue visiting
+ */
+int scca_test_file_visit_on_filename(
+     intptr_t *user_data,
+     int filename_index SCCA_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *utf16_filename SCCA_TEST_ATTRIBUTE_UNUSED,
+     size_t utf16_filename_size SCCA_TEST_ATTRIBUTE_UNUSED )
+{
+	int *counts = (int *) user_data;
+
+	SCCA_TEST_UNREFERENCED_PARAMETER( filename_index )
+	SCCA_TEST_UNREFERENCED_PARAMETER( utf16_filename )
+	SCCA_TEST_UNREFERENCED_PARAMETER( utf16_filename_size )
+
+	counts[ 1 ] += 1;
+
+	return( 1 );
+}
+
+/* Volume callback for the libscca_file_visit test
+ * Returns 1 to continue visiting
+ */
+int scca_test_file_visit_on_volume(
+     intptr_t *user_data,
+     int volume_index SCCA_TEST_ATTRIBUTE_UNUSED,
+     uint64_t creation_time SCCA_TEST_ATTRIBUTE_UNUSED,
+     uint32_t serial_number SCCA_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *utf16_device_path SCCA_TEST_ATTRIBUTE_UNUSED,
+     size_t utf16_device_path_size SCCA_TEST_ATTRIBUTE_UNUSED )
+{
+	int *counts = (int *) user_data;
+
+	SCCA_TEST_UNREFERENCED_PARAMETER( volume_index )
+	SCCA_TEST_UNREFERENCED_PARAMETER( creation_time )
+	SCCA_TEST_UNREFERENCED_PARAMETER( serial_number )
+	SCCA_TEST_UNREFERENCED_PARAMETER( utf16_device_path )
+	SCCA_TEST_UNREFERENCED_PARAMETER( utf16_device_path_size )
+
+	counts[ 2 ] += 1;
+
+	return( 1 );
+}
+
+/* Header callback for the libscca_file_visit test
+ * Returns 0 to stop visiting
+ */
+int scca_test_file_visit_on_header(
+     intptr_t *user_data,
+     uint32_t format_version SCCA_TEST_ATTRIBUTE_UNUSED,
+     uint32_t prefetch_hash SCCA_TEST_ATTRIBUTE_UNUSED,
+     uint32_t run_count SCCA_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *utf16_executable_filename SCCA_TEST_ATTRIBUTE_UNUSED,
+     size_t utf16_executable_filename_size SCCA_TEST_ATTRIBUTE_UNUSED )
+{
+	int *counts = (int *) user_data;
+
+	SCCA_TEST_UNREFERENCED_PARAMETER( format_version )
+	SCCA_TEST_UNREFERENCED_PARAMETER( prefetch_hash )
+	SCCA_TEST_UNREFERENCED_PARAMETER( run_count )
+	SCCA_TEST_UNREFERENCED_PARAMETER( utf16_executable_filename )
+	SCCA_TEST_UNREFERENCED_PARAMETER( utf16_executable_filename_size )
+
+	counts[ 3 ] += 1;
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf16_filename function
+/* Tests the libscca_file_visit function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf16_filename(
+int scca_test_file_visit(
      libscca_file_t *file )
 {
-	uint16_t utf16_filename[ 512 ];
+	int counts[ 4 ];
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libscca_file_visitor_t visitor;
 
-	/* Test regular cases
+	libcerror_error_t *error   = NULL;
+	int number_of_filenames    = 0;
+	int number_of_file_metrics = 0;
+	int number_of_volumes      = 0;
+	int result                 = 0;
+
+	/* Initialize test
 	 */
-	result = libscca_file_get_utf16_filename(
+	result = libscca_file_get_number_of_file_metrics_entries(
 	          file,
-	          0,
-	          utf16_filename,
-	          512,
+	          &number_of_file_metrics,
 	          &error );
 
-	SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libscca_file_get_utf16_filename(
-	          NULL,
-	          0,
-	          utf16_filename,
-	          512,
+	result = libscca_file_get_number_of_filenames(
+	          file,
+	          &number_of_filenames,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libscca_file_get_utf16_filename(
+	result = libscca_file_get_number_of_volumes(
 	          file,
-	          -1,
-	          utf16_filename,
-	          512,
+	          &number_of_volumes,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	memory_set(
+	 &visitor,
+	 0,
+	 sizeof( libscca_file_visitor_t ) );
 
-	result = libscca_file_get_utf16_filename(
+	visitor.on_metrics_entry = &scca_test_file_visit_on_metrics_entry;
+	visitor.on_filename      = &scca_test_file_visit_on_filename;
+	visitor.on_volume        = &scca_test_file_visit_on_volume;
+
+	memory_set(
+	 counts,
+	 0,
+	 sizeof( int ) * 4 );
+
+	/* Test regular cases
+	 */
+	result = libscca_file_visit(
 	          file,
-	          0,
-	          NULL,
-	          512,
+	          &visitor,
+	          (intptr_t *) counts,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "counts[ 0 ]",
+	 counts[ 0 ],
+	 number_of_file_metrics );
 
-	result = libscca_file_get_utf16_filename(
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "counts[ 1 ]",
+	 counts[ 1 ],
+	 number_of_filenames );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "counts[ 2 ]",
+	 counts[ 2 ],
+	 number_of_volumes );
+
+	/* Test with a callback that stops visiting
+	 */
+	visitor.on_header = &scca_test_file_visit_on_header;
+
+	memory_set(
+	 counts,
+	 0,
+	 sizeof( int ) * 4 );
+
+	result = libscca_file_visit(
 	          file,
-	          0,
-	          utf16_filename,
-	          0,
+	          &visitor,
+	          (intptr_t *) counts,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "counts[ 3 ]",
+	 counts[ 3 ],
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "counts[ 0 ]",
+	 counts[ 0 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_file_visit(
+	          NULL,
+	          &visitor,
+	          (intptr_t *) counts,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2625,11 +5470,10 @@ int scca_test_file_get_utf16_filename(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf16_filename(
+	result = libscca_file_visit(
 	          file,
-	          0,
-	          utf16_filename,
-	          (size_t) SSIZE_MAX + 1,
+	          NULL,
+	          (intptr_t *) counts,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2655,21 +5499,27 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_number_of_volumes function
+/* Tests the libscca_file_validate_layout function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_number_of_volumes(
-     libscca_file_t *file )
+int scca_test_file_validate_layout(
+     void )
 {
+	uint8_t data[ 296 ];
+
 	libcerror_error_t *error = NULL;
-	int number_of_volumes    = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_number_of_volumes(
-	          file,
-	          &number_of_volumes,
+	scca_test_file_create_layout_data(
+	 data,
+	 296 );
+
+	result = libscca_file_validate_layout(
+	          data,
+	          296,
+	          296,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2681,125 +5531,154 @@ int scca_test_file_get_number_of_volumes(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test with an uncompressed data size that does not match the file size
 	 */
-	result = libscca_file_get_number_of_volumes(
-	          NULL,
-	          &number_of_volumes,
+	scca_test_file_create_layout_data(
+	 data,
+	 296 );
+
+	result = libscca_file_validate_layout(
+	          data,
+	          296,
+	          295,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libscca_file_get_number_of_volumes(
-	          file,
-	          NULL,
+	/* Test with data that is too small
+	 */
+	scca_test_file_create_layout_data(
+	 data,
+	 296 );
+
+	result = libscca_file_validate_layout(
+	          data,
+	          40,
+	          296,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
+	/* Test with file metrics entries that overlap the filename strings
+	 */
+	scca_test_file_create_layout_data(
+	 data,
+	 296 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 88 ] ),
+	 3 );
+
+	result = libscca_file_validate_layout(
+	          data,
+	          296,
+	          296,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-/* Tests the libscca_file_get_volume_information function
- * Returns 1 if successful or 0 if not
- */
-int scca_test_file_get_volume_information(
-     libscca_file_t *file )
-{
-	libcerror_error_t *error                         = NULL;
-	libscca_volume_information_t *volume_information = NULL;
-	int result                                       = 0;
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
+	/* Test with filename strings that overlap the volumes information
 	 */
-	result = libscca_file_get_volume_information(
-	          file,
-	          0,
-	          &volume_information,
+	scca_test_file_create_layout_data(
+	 data,
+	 296 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 104 ] ),
+	 24 );
+
+	result = libscca_file_validate_layout(
+	          data,
+	          296,
+	          296,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_information",
-	 volume_information );
-
-	result = libscca_volume_information_free(
-	          &volume_information,
+	/* Test with volumes that exceed the volumes information size
+	 */
+	scca_test_file_create_layout_data(
+	 data,
+	 296 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 112 ] ),
+	 3 );
+
+	result = libscca_file_validate_layout(
+	          data,
+	          296,
+	          296,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test with volumes information that exceeds the file size
 	 */
-	result = libscca_file_get_volume_information(
-	          NULL,
-	          0,
-	          &volume_information,
+	scca_test_file_create_layout_data(
+	 data,
+	 296 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 116 ] ),
+	 100 );
+
+	result = libscca_file_validate_layout(
+	          data,
+	          296,
+	          296,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
 	SCCA_TEST_ASSERT_IS_NULL(
-	 "volume_information",
-	 volume_information );
-
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libscca_file_get_volume_information(
-	          file,
-	          -1,
-	          &volume_information,
+	/* Test error cases
+	 */
+	result = libscca_file_validate_layout(
+	          NULL,
+	          296,
+	          296,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2807,10 +5686,6 @@ int scca_test_file_get_volume_information(
 	 result,
 	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "volume_information",
-	 volume_information );
-
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2818,10 +5693,10 @@ int scca_test_file_get_volume_information(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_volume_information(
-	          file,
-	          0,
-	          NULL,
+	result = libscca_file_validate_layout(
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          296,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2829,10 +5704,6 @@ int scca_test_file_get_volume_information(
 	 result,
 	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "volume_information",
-	 volume_information );
-
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2848,12 +5719,6 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( volume_information != NULL )
-	{
-		libscca_volume_information_free(
-		 &volume_information,
-		 NULL );
-	}
 	return( 0 );
 }
 
@@ -2914,6 +5779,42 @@ int main(
 	 "libscca_file_free",
 	 scca_test_file_free );
 
+	SCCA_TEST_RUN(
+	 "libscca_file_set_read_flags",
+	 scca_test_file_set_read_flags );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_set_error_mode",
+	 scca_test_file_set_error_mode );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_get_read_failure",
+	 scca_test_file_get_read_failure );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_set_section_callback",
+	 scca_test_file_set_section_callback );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_set_maximum_memory_size",
+	 scca_test_file_set_maximum_memory_size );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_get_memory_size",
+	 scca_test_file_get_memory_size );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_set_mam_decoder",
+	 scca_test_file_set_mam_decoder );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_open_with_maximum_memory_size",
+	 scca_test_file_open_with_maximum_memory_size );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_validate_layout",
+	 scca_test_file_validate_layout );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -3002,6 +5903,11 @@ int main(
 		 scca_test_file_open_close,
 		 source );
 
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_open_with_section_callback",
+		 scca_test_file_open_with_section_callback,
+		 file_io_handle );
+
 		/* Initialize file for tests
 		 */
 		result = scca_test_file_open_source(
@@ -3083,6 +5989,11 @@ int main(
 		 scca_test_file_get_file_metrics_entry,
 		 file );
 
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_get_file_metrics_columns",
+		 scca_test_file_get_file_metrics_columns,
+		 file );
+
 		SCCA_TEST_RUN_WITH_ARGS(
 		 "libscca_file_get_number_of_filenames",
 		 scca_test_file_get_number_of_filenames,
@@ -3118,6 +6029,26 @@ int main(
 		 scca_test_file_get_volume_information,
 		 file );
 
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_get_uncompressed_data_size",
+		 scca_test_file_get_uncompressed_data_size,
+		 file );
+
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_read_uncompressed_data",
+		 scca_test_file_read_uncompressed_data,
+		 file );
+
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_get_uncompressed_data",
+		 scca_test_file_get_uncompressed_data,
+		 file );
+
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_visit",
+		 scca_test_file_visit,
+		 file );
+
 		/* Clean up
 		 */
 		result = scca_test_file_close_source(
@@ -0,0 +1,762 @@
+/*
+ * Library file visitor functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_file_visitor.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+typedef struct scca_test_file_visitor_context scca_test_file_visitor_context_t;
+
+struct scca_test_file_visitor_context
+{
+	/* The number of times every callback was invoked
+	 */
+	int number_of_headers;
+	int number_of_run_times;
+	int number_of_metrics_entries;
+	int number_of_filenames;
+	int number_of_volumes;
+	int number_of_directory_strings;
+	int number_of_file_references;
+
+	/* The sum of the sizes of the strings passed to the callbacks
+	 */
+	size_t strings_size;
+
+	/* The sum of the values passed to the callbacks
+	 */
+	uint64_t values_sum;
+
+	/* The return value of the callbacks
+	 */
+	int return_value;
+};
+
+/* Creates the uncompressed data of a format version 17 file with 2 file metrics entries,
+ * 2 filenames and a volume with 2 file references and 2 directory strings
+ */
+void scca_test_file_visitor_create_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	memory_set(
+	 data,
+	 0,
+	 data_size );
+
+	/* The file header
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 0 ] ),
+	 17 );
+
+	memory_copy(
+	 &( data[ 4 ] ),
+	 "SCCA",
+	 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 296 );
+
+	memory_copy(
+	 &( data[ 16 ] ),
+	 "A\0B\0",
+	 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 76 ] ),
+	 0x12345678UL );
+
+	/* The file information
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 84 ] ),
+	 152 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 88 ] ),
+	 2 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 100 ] ),
+	 192 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 104 ] ),
+	 16 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 108 ] ),
+	 208 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 112 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 116 ] ),
+	 88 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 120 ] ),
+	 0x01d0a1b2c3d4e5f6ULL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 144 ] ),
+	 5 );
+
+	/* The file metrics array
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 152 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 156 ] ),
+	 2 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 164 ] ),
+	 3 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 172 ] ),
+	 3 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 176 ] ),
+	 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 180 ] ),
+	 8 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 184 ] ),
+	 3 );
+
+	/* The filename strings
+	 */
+	memory_copy(
+	 &( data[ 192 ] ),
+	 "A\0B\0C\0\0\0D\0E\0F\0\0\0",
+	 16 );
+
+	/* The volume information
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 208 ] ),
+	 40 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 212 ] ),
+	 2 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 216 ] ),
+	 0x01d0000000000000ULL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 224 ] ),
+	 0xabcd1234UL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 228 ] ),
+	 48 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 232 ] ),
+	 24 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 236 ] ),
+	 72 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 240 ] ),
+	 2 );
+
+	/* The volume device path
+	 */
+	memory_copy(
+	 &( data[ 248 ] ),
+	 "C\0:\0",
+	 4 );
+
+	/* The volume file references
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 256 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 260 ] ),
+	 2 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 264 ] ),
+	 (uint64_t) 10 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 272 ] ),
+	 (uint64_t) 20 );
+
+	/* The volume directory strings
+	 */
+	byte_stream_copy_from_uint16_little_endian(
+	 &( data[ 280 ] ),
+	 2 );
+
+	memory_copy(
+	 &( data[ 282 ] ),
+	 "X\0Y\0",
+	 4 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( data[ 288 ] ),
+	 1 );
+
+	memory_copy(
+	 &( data[ 290 ] ),
+	 "Z\0",
+	 2 );
+}
+
+/* Header callback
+ * Returns the return value of the context
+ */
+int scca_test_file_visitor_on_header(
+     intptr_t *user_data,
+     uint32_t format_version,
+     uint32_t prefetch_hash,
+     uint32_t run_count,
+     const uint8_t *utf16_executable_filename SCCA_TEST_ATTRIBUTE_UNUSED,
+     size_t utf16_executable_filename_size )
+{
+	scca_test_file_visitor_context_t *context = (scca_test_file_visitor_context_t *) user_data;
+
+	SCCA_TEST_UNREFERENCED_PARAMETER( utf16_executable_filename )
+
+	context->number_of_headers += 1;
+	context->strings_size      += utf16_executable_filename_size;
+	context->values_sum        += format_version + prefetch_hash + run_count;
+
+	return( context->return_value );
+}
+
+/* Run time callback
+ * Returns the return value of the context
+ */
+int scca_test_file_visitor_on_run_time(
+     intptr_t *user_data,
+     int run_time_index SCCA_TEST_ATTRIBUTE_UNUSED,
+     uint64_t filetime )
+{
+	scca_test_file_visitor_context_t *context = (scca_test_file_visitor_context_t *) user_data;
+
+	SCCA_TEST_UNREFERENCED_PARAMETER( run_time_index )
+
+	context->number_of_run_times += 1;
+	context->values_sum          += filetime;
+
+	return( context->return_value );
+}
+
+/* File metrics entry callback
+ * Returns the return value of the context
+ */
+int scca_test_file_visitor_on_metrics_entry(
+     intptr_t *user_data,
+     int entry_index SCCA_TEST_ATTRIBUTE_UNUSED,
+     uint32_t start_time,
+     uint32_t duration,
+     uint32_t flags,
+     uint64_t file_reference,
+     const uint8_t *utf16_filename SCCA_TEST_ATTRIBUTE_UNUSED,
+     size_t utf16_filename_size )
+{
+	scca_test_file_visitor_context_t *context = (scca_test_file_visitor_context_t *) user_data;
+
+	SCCA_TEST_UNREFERENCED_PARAMETER( entry_index )
+	SCCA_TEST_UNREFERENCED_PARAMETER( utf16_filename )
+
+	context->number_of_metrics_entries += 1;
+	context->strings_size              += utf16_filename_size;
+	context->values_sum                += start_time + duration + flags + file_reference;
+
+	return( context->return_value );
+}
+
+/* Filename callback
+ * Returns the return value of the context
+ */
+int scca_test_file_visitor_on_filename(
+     intptr_t *user_data,
+     int filename_index SCCA_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *utf16_filename SCCA_TEST_ATTRIBUTE_UNUSED,
+     size_t utf16_filename_size )
+{
+	scca_test_file_visitor_context_t *context = (scca_test_file_visitor_context_t *) user_data;
+
+	SCCA_TEST_UNREFERENCED_PARAMETER( filename_index )
+	SCCA_TEST_UNREFERENCED_PARAMETER( utf16_filename )
+
+	context->number_of_filenames += 1;
+	context->strings_size        += utf16_filename_size;
+
+	return( context->return_value );
+}
+
+/* Volume callback
+ * Returns the return value of the context
+ */
+int scca_test_file_visitor_on_volume(
+     intptr_t *user_data,
+     int volume_index SCCA_TEST_ATTRIBUTE_UNUSED,
+     uint64_t creation_time,
+     uint32_t serial_number,
+     const uint8_t *utf16_device_path SCCA_TEST_ATTRIBUTE_UNUSED,
+     size_t utf16_device_path_size )
+{
+	scca_test_file_visitor_context_t *context = (scca_test_file_visitor_context_t *) user_data;
+
+	SCCA_TEST_UNREFERENCED_PARAMETER( volume_index )
+	SCCA_TEST_UNREFERENCED_PARAMETER( utf16_device_path )
+
+	context->number_of_volumes += 1;
+	context->strings_size      += utf16_device_path_size;
+	context->values_sum        += creation_time + serial_number;
+
+	return( context->return_value );
+}
+
+/* Directory string callback
+ * Returns the return value of the context
+ */
+int scca_test_file_visitor_on_directory_string(
+     intptr_t *user_data,
+     int volume_index SCCA_TEST_ATTRIBUTE_UNUSED,
+     int directory_string_index SCCA_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *utf16_directory_string SCCA_TEST_ATTRIBUTE_UNUSED,
+     size_t utf16_directory_string_size )
+{
+	scca_test_file_visitor_context_t *context = (scca_test_file_visitor_context_t *) user_data;
+
+	SCCA_TEST_UNREFERENCED_PARAMETER( volume_index )
+	SCCA_TEST_UNREFERENCED_PARAMETER( directory_string_index )
+	SCCA_TEST_UNREFERENCED_PARAMETER( utf16_directory_string )
+
+	context->number_of_directory_strings += 1;
+	context->strings_size                += utf16_directory_string_size;
+
+	return( context->return_value );
+}
+
+/* File reference callback
+ * Returns the return value of the context
+ */
+int scca_test_file_visitor_on_file_reference(
+     intptr_t *user_data,
+     int volume_index SCCA_TEST_ATTRIBUTE_UNUSED,
+     int file_reference_index SCCA_TEST_ATTRIBUTE_UNUSED,
+     uint64_t file_reference )
+{
+	scca_test_file_visitor_context_t *context = (scca_test_file_visitor_context_t *) user_data;
+
+	SCCA_TEST_UNREFERENCED_PARAMETER( volume_index )
+	SCCA_TEST_UNREFERENCED_PARAMETER( file_reference_index )
+
+	context->number_of_file_references += 1;
+	context->values_sum                += file_reference;
+
+	return( context->return_value );
+}
+
+/* Tests the libscca_file_visitor_visit_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_visitor_visit_data(
+     void )
+{
+	uint8_t data[ 296 ];
+
+	scca_test_file_visitor_context_t context;
+	libscca_file_visitor_t visitor;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	scca_test_file_visitor_create_data(
+	 data,
+	 296 );
+
+	memory_set(
+	 &visitor,
+	 0,
+	 sizeof( libscca_file_visitor_t ) );
+
+	visitor.on_header           = &scca_test_file_visitor_on_header;
+	visitor.on_run_time         = &scca_test_file_visitor_on_run_time;
+	visitor.on_metrics_entry    = &scca_test_file_visitor_on_metrics_entry;
+	visitor.on_filename         = &scca_test_file_visitor_on_filename;
+	visitor.on_volume           = &scca_test_file_visitor_on_volume;
+	visitor.on_directory_string = &scca_test_file_visitor_on_directory_string;
+	visitor.on_file_reference   = &scca_test_file_visitor_on_file_reference;
+
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( scca_test_file_visitor_context_t ) );
+
+	context.return_value = 1;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_visitor_visit_data(
+	          &visitor,
+	          (intptr_t *) &context,
+	          data,
+	          296,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_headers",
+	 context.number_of_headers,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_run_times",
+	 context.number_of_run_times,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_metrics_entries",
+	 context.number_of_metrics_entries,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_filenames",
+	 context.number_of_filenames,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_volumes",
+	 context.number_of_volumes,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_directory_strings",
+	 context.number_of_directory_strings,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_file_references",
+	 context.number_of_file_references,
+	 2 );
+
+	/* The executable filename: 4, the metrics entry filenames: 6 + 6, the filenames: 6 + 6,
+	 * the device path: 4 and the directory strings: 4 + 2
+	 */
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "context.strings_size",
+	 context.strings_size,
+	 (size_t) 38 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "context.values_sum",
+	 context.values_sum,
+	 (uint64_t) ( 17 + 0x12345678UL + 5 + 0x01d0a1b2c3d4e5f6ULL + 1 + 2 + 3 + 4 + 0x01d0000000000000ULL + 0xabcd1234UL + 10 + 20 ) );
+
+	/* Test with a callback that stops visiting
+	 */
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( scca_test_file_visitor_context_t ) );
+
+	context.return_value = 0;
+
+	result = libscca_file_visitor_visit_data(
+	          &visitor,
+	          (intptr_t *) &context,
+	          data,
+	          296,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_headers",
+	 context.number_of_headers,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_run_times",
+	 context.number_of_run_times,
+	 0 );
+
+	/* Test with only a file reference callback, the other sections are not parsed
+	 */
+	memory_set(
+	 &visitor,
+	 0,
+	 sizeof( libscca_file_visitor_t ) );
+
+	visitor.on_file_reference = &scca_test_file_visitor_on_file_reference;
+
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( scca_test_file_visitor_context_t ) );
+
+	context.return_value = 1;
+
+	result = libscca_file_visitor_visit_data(
+	          &visitor,
+	          (intptr_t *) &context,
+	          data,
+	          296,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_metrics_entries",
+	 context.number_of_metrics_entries,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_file_references",
+	 context.number_of_file_references,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libscca_file_visitor_visit_data(
+	          NULL,
+	          (intptr_t *) &context,
+	          data,
+	          296,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_visitor_visit_data(
+	          &visitor,
+	          (intptr_t *) &context,
+	          NULL,
+	          296,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_visitor_visit_data(
+	          &visitor,
+	          (intptr_t *) &context,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a callback that fails
+	 */
+	context.return_value = -1;
+
+	result = libscca_file_visitor_visit_data(
+	          &visitor,
+	          (intptr_t *) &context,
+	          data,
+	          296,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a number of file references that exceeds the file references size
+	 */
+	context.return_value = 1;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 260 ] ),
+	 3 );
+
+	result = libscca_file_visitor_visit_data(
+	          &visitor,
+	          (intptr_t *) &context,
+	          data,
+	          296,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with data that is too small for the file information
+	 */
+	result = libscca_file_visitor_visit_data(
+	          &visitor,
+	          (intptr_t *) &context,
+	          data,
+	          100,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_file_visitor_visit_data",
+	 scca_test_file_visitor_visit_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2147 @@
+/*
+ * Library filename_index type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_filename_index.h"
+
+/* L"\\WINDOWS\\SYSTEM32\\NTDLL.DLL"
+ */
+uint16_t scca_test_filename_index_ntdll_path[ 27 ] = {
+	'\\', 'W', 'I', 'N', 'D', 'O', 'W', 'S', '\\', 'S', 'Y', 'S', 'T', 'E', 'M', '3', '2', '\\',
+	'N', 'T', 'D', 'L', 'L', '.', 'D', 'L', 'L' };
+
+/* L"NTDLL.DLL"
+ */
+uint16_t scca_test_filename_index_ntdll_name[ 9 ] = {
+	'N', 'T', 'D', 'L', 'L', '.', 'D', 'L', 'L' };
+
+/* L"CMD.EXE"
+ */
+uint16_t scca_test_filename_index_cmd_name[ 7 ] = {
+	'C', 'M', 'D', '.', 'E', 'X', 'E' };
+
+/* L"KERNEL32.DLL"
+ */
+uint16_t scca_test_filename_index_kernel32_name[ 12 ] = {
+	'K', 'E', 'R', 'N', 'E', 'L', '3', '2', '.', 'D', 'L', 'L' };
+
+/* Creates the data of a filename index with 2 sources
+ * The first source references \WINDOWS\SYSTEM32\NTDLL.DLL, NTDLL.DLL and CMD.EXE
+ * the second source references NTDLL.DLL
+ * Returns 1 if successful or -1 on error
+ */
+int scca_test_filename_index_create_data(
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libscca_filename_index_builder_t *filename_index_builder = NULL;
+	uint32_t source_index                                    = 0;
+	int result                                               = 0;
+
+	result = libscca_filename_index_builder_initialize(
+	          &filename_index_builder,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	result = libscca_filename_index_builder_append_source_path(
+	          filename_index_builder,
+	          "CMD.EXE-4A81B364.pf",
+	          19,
+	          &source_index,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	result = libscca_filename_index_builder_append_utf16_filename(
+	          filename_index_builder,
+	          0,
+	          0,
+	          scca_test_filename_index_ntdll_path,
+	          27,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	result = libscca_filename_index_builder_append_utf16_filename(
+	          filename_index_builder,
+	          0,
+	          0,
+	          scca_test_filename_index_ntdll_name,
+	          9,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	result = libscca_filename_index_builder_append_utf16_filename(
+	          filename_index_builder,
+	          0,
+	          1,
+	          scca_test_filename_index_cmd_name,
+	          7,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	result = libscca_filename_index_builder_append_source_path(
+	          filename_index_builder,
+	          "NOTEPAD.EXE-D8414F97.pf",
+	          23,
+	          &source_index,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	result = libscca_filename_index_builder_append_utf16_filename(
+	          filename_index_builder,
+	          1,
+	          5,
+	          scca_test_filename_index_ntdll_name,
+	          9,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	result = libscca_filename_index_builder_get_data_size(
+	          filename_index_builder,
+	          data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	*data = (uint8_t *) memory_allocate(
+	                     *data_size );
+
+	if( *data == NULL )
+	{
+		goto on_error;
+	}
+	result = libscca_filename_index_builder_write_data(
+	          filename_index_builder,
+	          *data,
+	          *data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	result = libscca_filename_index_builder_free(
+	          &filename_index_builder,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *data != NULL )
+	{
+		memory_free(
+		 *data );
+
+		*data = NULL;
+	}
+	if( filename_index_builder != NULL )
+	{
+		libscca_filename_index_builder_free(
+		 &filename_index_builder,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_filename_index_compare_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_compare_utf16_string(
+     void )
+{
+	uint8_t utf16_stream[ 14 ] = {
+		'C', 0, 'M', 0, 'D', 0, '.', 0, 'E', 0, 'X', 0, 'E', 0 };
+
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_compare_utf16_string(
+	          utf16_stream,
+	          7,
+	          scca_test_filename_index_cmd_name,
+	          7 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_filename_index_compare_utf16_string(
+	          utf16_stream,
+	          3,
+	          scca_test_filename_index_cmd_name,
+	          7 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libscca_filename_index_compare_utf16_string(
+	          utf16_stream,
+	          7,
+	          scca_test_filename_index_cmd_name,
+	          3 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libscca_filename_index_compare_utf16_string(
+	          utf16_stream,
+	          7,
+	          scca_test_filename_index_ntdll_name,
+	          9 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libscca_filename_index_compare_utf16_string(
+	          utf16_stream,
+	          7,
+	          scca_test_filename_index_kernel32_name,
+	          12 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* Tests the libscca_filename_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libscca_filename_index_t *filename_index = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 1;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_initialize(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_free(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	filename_index = (libscca_filename_index_t *) 0x12345678UL;
+
+	result = libscca_filename_index_initialize(
+	          &filename_index,
+	          &error );
+
+	filename_index = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_filename_index_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = libscca_filename_index_initialize(
+		          &filename_index,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( filename_index != NULL )
+			{
+				libscca_filename_index_free(
+				 &filename_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "filename_index",
+			 filename_index );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_filename_index_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = libscca_filename_index_initialize(
+		          &filename_index,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( filename_index != NULL )
+			{
+				libscca_filename_index_free(
+				 &filename_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "filename_index",
+			 filename_index );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index != NULL )
+	{
+		libscca_filename_index_free(
+		 &filename_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_index_set_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_set_data(
+     void )
+{
+	uint8_t data[ 64 ] = {
+		'S', 'C', 'C', 'A', 'I', 'N', 'D', 'X', 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error                 = NULL;
+	libscca_filename_index_t *filename_index = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_filename_index_initialize(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_set_data(
+	          NULL,
+	          data,
+	          64,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_set_data(
+	          filename_index,
+	          NULL,
+	          64,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_set_data(
+	          filename_index,
+	          data,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a source entry that lies outside the data
+	 */
+	result = libscca_filename_index_set_data(
+	          filename_index,
+	          data,
+	          64,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid signature
+	 */
+	data[ 12 ] = 0x00;
+	data[ 0 ]  = 'X';
+
+	result = libscca_filename_index_set_data(
+	          filename_index,
+	          data,
+	          64,
+	          &error );
+
+	data[ 0 ] = 'S';
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported format version
+	 */
+	data[ 8 ] = 0x02;
+
+	result = libscca_filename_index_set_data(
+	          filename_index,
+	          data,
+	          64,
+	          &error );
+
+	data[ 8 ] = 0x01;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_set_data(
+	          filename_index,
+	          data,
+	          64,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "( (libscca_internal_filename_index_t *) filename_index )->number_of_sources",
+	 ( (libscca_internal_filename_index_t *) filename_index )->number_of_sources,
+	 (uint32_t) 0 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	/* Clean up
+	 */
+	result = libscca_filename_index_free(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index != NULL )
+	{
+		libscca_filename_index_free(
+		 &filename_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_index_find_utf16_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_find_utf16_filename(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libscca_filename_index_t *filename_index = NULL;
+	uint8_t *data                            = NULL;
+	size_t data_size                         = 0;
+	uint32_t first_posting                   = 0;
+	uint32_t number_of_postings              = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = scca_test_filename_index_create_data(
+	          &data,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_initialize(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_set_data(
+	          filename_index,
+	          data,
+	          data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "( (libscca_internal_filename_index_t *) filename_index )->number_of_sources",
+	 ( (libscca_internal_filename_index_t *) filename_index )->number_of_sources,
+	 (uint32_t) 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "( (libscca_internal_filename_index_t *) filename_index )->number_of_keys",
+	 ( (libscca_internal_filename_index_t *) filename_index )->number_of_keys,
+	 (uint32_t) 3 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "( (libscca_internal_filename_index_t *) filename_index )->number_of_postings",
+	 ( (libscca_internal_filename_index_t *) filename_index )->number_of_postings,
+	 (uint32_t) 4 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_find_utf16_filename(
+	          filename_index,
+	          scca_test_filename_index_ntdll_name,
+	          9,
+	          &first_posting,
+	          &number_of_postings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_postings",
+	 number_of_postings,
+	 (uint32_t) 2 );
+
+	result = libscca_filename_index_find_utf16_filename(
+	          filename_index,
+	          scca_test_filename_index_ntdll_path,
+	          27,
+	          &first_posting,
+	          &number_of_postings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_postings",
+	 number_of_postings,
+	 (uint32_t) 1 );
+
+	result = libscca_filename_index_find_utf16_filename(
+	          filename_index,
+	          scca_test_filename_index_cmd_name,
+	          7,
+	          &first_posting,
+	          &number_of_postings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_postings",
+	 number_of_postings,
+	 (uint32_t) 1 );
+
+	/* A prefix of a key is not a match
+	 */
+	result = libscca_filename_index_find_utf16_filename(
+	          filename_index,
+	          scca_test_filename_index_cmd_name,
+	          3,
+	          &first_posting,
+	          &number_of_postings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_find_utf16_filename(
+	          filename_index,
+	          scca_test_filename_index_kernel32_name,
+	          12,
+	          &first_posting,
+	          &number_of_postings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_find_utf16_filename(
+	          NULL,
+	          scca_test_filename_index_cmd_name,
+	          7,
+	          &first_posting,
+	          &number_of_postings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_find_utf16_filename(
+	          filename_index,
+	          NULL,
+	          7,
+	          &first_posting,
+	          &number_of_postings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_find_utf16_filename(
+	          filename_index,
+	          scca_test_filename_index_cmd_name,
+	          7,
+	          NULL,
+	          &number_of_postings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_find_utf16_filename(
+	          filename_index,
+	          scca_test_filename_index_cmd_name,
+	          7,
+	          &first_posting,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_index_free(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index != NULL )
+	{
+		libscca_filename_index_free(
+		 &filename_index,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_index_get_posting function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_get_posting(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libscca_filename_index_t *filename_index = NULL;
+	uint8_t *data                            = NULL;
+	size_t data_size                         = 0;
+	uint32_t first_posting                   = 0;
+	uint32_t metrics_index                   = 0;
+	uint32_t number_of_postings              = 0;
+	uint32_t source_index                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = scca_test_filename_index_create_data(
+	          &data,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_initialize(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_set_data(
+	          filename_index,
+	          data,
+	          data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_find_utf16_filename(
+	          filename_index,
+	          scca_test_filename_index_ntdll_name,
+	          9,
+	          &first_posting,
+	          &number_of_postings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* The postings of a key are stored in the order they were appended
+	 */
+	result = libscca_filename_index_get_posting(
+	          filename_index,
+	          first_posting,
+	          &source_index,
+	          &metrics_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "source_index",
+	 source_index,
+	 (uint32_t) 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "metrics_index",
+	 metrics_index,
+	 (uint32_t) 0 );
+
+	result = libscca_filename_index_get_posting(
+	          filename_index,
+	          first_posting + 1,
+	          &source_index,
+	          &metrics_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "source_index",
+	 source_index,
+	 (uint32_t) 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "metrics_index",
+	 metrics_index,
+	 (uint32_t) 5 );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_get_posting(
+	          NULL,
+	          first_posting,
+	          &source_index,
+	          &metrics_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_get_posting(
+	          filename_index,
+	          4,
+	          &source_index,
+	          &metrics_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_get_posting(
+	          filename_index,
+	          first_posting,
+	          NULL,
+	          &metrics_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_get_posting(
+	          filename_index,
+	          first_posting,
+	          &source_index,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_index_free(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index != NULL )
+	{
+		libscca_filename_index_free(
+		 &filename_index,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_index_get_utf8_source_path_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_get_utf8_source_path_size(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libscca_filename_index_t *filename_index = NULL;
+	uint8_t *data                            = NULL;
+	size_t data_size                         = 0;
+	size_t utf8_string_size                  = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = scca_test_filename_index_create_data(
+	          &data,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_initialize(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_set_data(
+	          filename_index,
+	          data,
+	          data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_get_utf8_source_path_size(
+	          filename_index,
+	          1,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 24 );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_get_utf8_source_path_size(
+	          NULL,
+	          1,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_get_utf8_source_path_size(
+	          filename_index,
+	          2,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_get_utf8_source_path_size(
+	          filename_index,
+	          1,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_index_free(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index != NULL )
+	{
+		libscca_filename_index_free(
+		 &filename_index,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_index_get_utf8_source_path function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_get_utf8_source_path(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error                 = NULL;
+	libscca_filename_index_t *filename_index = NULL;
+	uint8_t *data                            = NULL;
+	size_t data_size                         = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = scca_test_filename_index_create_data(
+	          &data,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_initialize(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_set_data(
+	          filename_index,
+	          data,
+	          data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_get_utf8_source_path(
+	          filename_index,
+	          1,
+	          utf8_string,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "NOTEPAD.EXE-D8414F97.pf",
+	          24 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_get_utf8_source_path(
+	          NULL,
+	          1,
+	          utf8_string,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_get_utf8_source_path(
+	          filename_index,
+	          2,
+	          utf8_string,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_get_utf8_source_path(
+	          filename_index,
+	          1,
+	          NULL,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_get_utf8_source_path(
+	          filename_index,
+	          1,
+	          utf8_string,
+	          23,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_index_free(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index != NULL )
+	{
+		libscca_filename_index_free(
+		 &filename_index,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_index_get_utf16_source_path_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_get_utf16_source_path_size(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libscca_filename_index_t *filename_index = NULL;
+	uint8_t *data                            = NULL;
+	size_t data_size                         = 0;
+	size_t utf16_string_size                 = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = scca_test_filename_index_create_data(
+	          &data,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_initialize(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_set_data(
+	          filename_index,
+	          data,
+	          data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_get_utf16_source_path_size(
+	          filename_index,
+	          0,
+	          &utf16_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 20 );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_get_utf16_source_path_size(
+	          NULL,
+	          0,
+	          &utf16_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_get_utf16_source_path_size(
+	          filename_index,
+	          2,
+	          &utf16_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_index_free(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index != NULL )
+	{
+		libscca_filename_index_free(
+		 &filename_index,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_index_get_utf16_source_path function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_get_utf16_source_path(
+     void )
+{
+	uint16_t expected_utf16_string[ 20 ] = {
+		'C', 'M', 'D', '.', 'E', 'X', 'E', '-', '4', 'A', '8', '1', 'B', '3', '6', '4', '.', 'p', 'f', 0 };
+
+	uint16_t utf16_string[ 32 ];
+
+	libcerror_error_t *error                 = NULL;
+	libscca_filename_index_t *filename_index = NULL;
+	uint8_t *data                            = NULL;
+	size_t data_size                         = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = scca_test_filename_index_create_data(
+	          &data,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_initialize(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_set_data(
+	          filename_index,
+	          data,
+	          data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_get_utf16_source_path(
+	          filename_index,
+	          0,
+	          utf16_string,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          expected_utf16_string,
+	          sizeof( uint16_t ) * 20 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_get_utf16_source_path(
+	          NULL,
+	          0,
+	          utf16_string,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_get_utf16_source_path(
+	          filename_index,
+	          2,
+	          utf16_string,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_get_utf16_source_path(
+	          filename_index,
+	          0,
+	          NULL,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_get_utf16_source_path(
+	          filename_index,
+	          0,
+	          utf16_string,
+	          19,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_index_free(
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index",
+	 filename_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index != NULL )
+	{
+		libscca_filename_index_free(
+		 &filename_index,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_compare_utf16_string",
+	 scca_test_filename_index_compare_utf16_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_initialize",
+	 scca_test_filename_index_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_free",
+	 scca_test_filename_index_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_set_data",
+	 scca_test_filename_index_set_data );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_find_utf16_filename",
+	 scca_test_filename_index_find_utf16_filename );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_get_posting",
+	 scca_test_filename_index_get_posting );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_get_utf8_source_path_size",
+	 scca_test_filename_index_get_utf8_source_path_size );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_get_utf8_source_path",
+	 scca_test_filename_index_get_utf8_source_path );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_get_utf16_source_path_size",
+	 scca_test_filename_index_get_utf16_source_path_size );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_get_utf16_source_path",
+	 scca_test_filename_index_get_utf16_source_path );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1367 @@
+/*
+ * Library filename_index_builder type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_filename_index_builder.h"
+
+/* L"NTDLL.DLL"
+ */
+uint16_t scca_test_filename_index_builder_ntdll_name[ 9 ] = {
+	'N', 'T', 'D', 'L', 'L', '.', 'D', 'L', 'L' };
+
+/* L"CMD.EXE"
+ */
+uint16_t scca_test_filename_index_builder_cmd_name[ 7 ] = {
+	'C', 'M', 'D', '.', 'E', 'X', 'E' };
+
+/* Tests the libscca_filename_index_builder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_builder_initialize(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libscca_filename_index_builder_t *filename_index_builder = NULL;
+	int result                                               = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests                          = 2;
+	int number_of_memset_fail_tests                          = 1;
+	int test_number                                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_builder_initialize(
+	          &filename_index_builder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index_builder",
+	 filename_index_builder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_builder_free(
+	          &filename_index_builder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index_builder",
+	 filename_index_builder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_builder_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	filename_index_builder = (libscca_filename_index_builder_t *) 0x12345678UL;
+
+	result = libscca_filename_index_builder_initialize(
+	          &filename_index_builder,
+	          &error );
+
+	filename_index_builder = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_filename_index_builder_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = libscca_filename_index_builder_initialize(
+		          &filename_index_builder,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( filename_index_builder != NULL )
+			{
+				libscca_filename_index_builder_free(
+				 &filename_index_builder,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "filename_index_builder",
+			 filename_index_builder );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_filename_index_builder_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = libscca_filename_index_builder_initialize(
+		          &filename_index_builder,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( filename_index_builder != NULL )
+			{
+				libscca_filename_index_builder_free(
+				 &filename_index_builder,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "filename_index_builder",
+			 filename_index_builder );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index_builder != NULL )
+	{
+		libscca_filename_index_builder_free(
+		 &filename_index_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_index_builder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_builder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_builder_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_index_builder_append_source_path function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_builder_append_source_path(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libscca_filename_index_builder_t *filename_index_builder = NULL;
+	uint32_t source_index                                    = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_filename_index_builder_initialize(
+	          &filename_index_builder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index_builder",
+	 filename_index_builder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_builder_append_source_path(
+	          filename_index_builder,
+	          "CMD.EXE-4A81B364.pf",
+	          19,
+	          &source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "source_index",
+	 source_index,
+	 (uint32_t) 0 );
+
+	result = libscca_filename_index_builder_append_source_path(
+	          filename_index_builder,
+	          "NOTEPAD.EXE-D8414F97.pf",
+	          23,
+	          &source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "source_index",
+	 source_index,
+	 (uint32_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_builder_append_source_path(
+	          NULL,
+	          "CMD.EXE-4A81B364.pf",
+	          19,
+	          &source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_builder_append_source_path(
+	          filename_index_builder,
+	          NULL,
+	          19,
+	          &source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_builder_append_source_path(
+	          filename_index_builder,
+	          "CMD.EXE-4A81B364.pf",
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE,
+	          &source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_builder_append_source_path(
+	          filename_index_builder,
+	          "CMD.EXE-4A81B364.pf",
+	          19,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_index_builder_free(
+	          &filename_index_builder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index_builder",
+	 filename_index_builder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index_builder != NULL )
+	{
+		libscca_filename_index_builder_free(
+		 &filename_index_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libscca_filename_index_builder_append_source_path_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_builder_append_source_path_wide(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libscca_filename_index_builder_t *filename_index_builder = NULL;
+	uint32_t source_index                                    = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_filename_index_builder_initialize(
+	          &filename_index_builder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index_builder",
+	 filename_index_builder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_builder_append_source_path_wide(
+	          filename_index_builder,
+	          L"CMD.EXE-4A81B364.pf",
+	          19,
+	          &source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "source_index",
+	 source_index,
+	 (uint32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_builder_append_source_path_wide(
+	          NULL,
+	          L"CMD.EXE-4A81B364.pf",
+	          19,
+	          &source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_builder_append_source_path_wide(
+	          filename_index_builder,
+	          NULL,
+	          19,
+	          &source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_builder_append_source_path_wide(
+	          filename_index_builder,
+	          L"CMD.EXE-4A81B364.pf",
+	          19,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_index_builder_free(
+	          &filename_index_builder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index_builder",
+	 filename_index_builder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index_builder != NULL )
+	{
+		libscca_filename_index_builder_free(
+		 &filename_index_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libscca_filename_index_builder_append_utf16_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_builder_append_utf16_filename(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libscca_filename_index_builder_t *filename_index_builder = NULL;
+	uint32_t source_index                                    = 0;
+	int number_of_keys                                       = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_filename_index_builder_initialize(
+	          &filename_index_builder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index_builder",
+	 filename_index_builder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_builder_append_source_path(
+	          filename_index_builder,
+	          "CMD.EXE-4A81B364.pf",
+	          19,
+	          &source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_builder_append_utf16_filename(
+	          filename_index_builder,
+	          0,
+	          0,
+	          scca_test_filename_index_builder_ntdll_name,
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_builder_append_utf16_filename(
+	          filename_index_builder,
+	          0,
+	          1,
+	          scca_test_filename_index_builder_cmd_name,
+	          7,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a filename that was already appended does not add a key
+	 */
+	result = libscca_filename_index_builder_append_utf16_filename(
+	          filename_index_builder,
+	          0,
+	          2,
+	          scca_test_filename_index_builder_ntdll_name,
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_builder_get_number_of_keys(
+	          filename_index_builder,
+	          &number_of_keys,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_keys",
+	 number_of_keys,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_builder_append_utf16_filename(
+	          NULL,
+	          0,
+	          0,
+	          scca_test_filename_index_builder_ntdll_name,
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_builder_append_utf16_filename(
+	          filename_index_builder,
+	          1,
+	          0,
+	          scca_test_filename_index_builder_ntdll_name,
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_builder_append_utf16_filename(
+	          filename_index_builder,
+	          0,
+	          0,
+	          NULL,
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_builder_append_utf16_filename(
+	          filename_index_builder,
+	          0,
+	          0,
+	          scca_test_filename_index_builder_ntdll_name,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_index_builder_free(
+	          &filename_index_builder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index_builder",
+	 filename_index_builder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index_builder != NULL )
+	{
+		libscca_filename_index_builder_free(
+		 &filename_index_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_index_builder_get_number_of_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_builder_get_number_of_keys(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libscca_filename_index_builder_t *filename_index_builder = NULL;
+	int number_of_keys                                       = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_filename_index_builder_initialize(
+	          &filename_index_builder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index_builder",
+	 filename_index_builder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_builder_get_number_of_keys(
+	          filename_index_builder,
+	          &number_of_keys,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_keys",
+	 number_of_keys,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_builder_get_number_of_keys(
+	          NULL,
+	          &number_of_keys,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_builder_get_number_of_keys(
+	          filename_index_builder,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_index_builder_free(
+	          &filename_index_builder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index_builder",
+	 filename_index_builder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index_builder != NULL )
+	{
+		libscca_filename_index_builder_free(
+		 &filename_index_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_index_builder_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_builder_get_data_size(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libscca_filename_index_builder_t *filename_index_builder = NULL;
+	size_t data_size                                         = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_filename_index_builder_initialize(
+	          &filename_index_builder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index_builder",
+	 filename_index_builder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_builder_get_data_size(
+	          filename_index_builder,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 64 );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_builder_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_builder_get_data_size(
+	          filename_index_builder,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_index_builder_free(
+	          &filename_index_builder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index_builder",
+	 filename_index_builder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index_builder != NULL )
+	{
+		libscca_filename_index_builder_free(
+		 &filename_index_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_index_builder_write_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_index_builder_write_data(
+     void )
+{
+	uint8_t data[ 256 ];
+
+	libcerror_error_t *error                                 = NULL;
+	libscca_filename_index_builder_t *filename_index_builder = NULL;
+	uint32_t source_index                                    = 0;
+	size_t data_size                                         = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_filename_index_builder_initialize(
+	          &filename_index_builder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_index_builder",
+	 filename_index_builder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_builder_append_source_path(
+	          filename_index_builder,
+	          "CMD.EXE-4A81B364.pf",
+	          19,
+	          &source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_builder_append_utf16_filename(
+	          filename_index_builder,
+	          0,
+	          1,
+	          scca_test_filename_index_builder_cmd_name,
+	          7,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_index_builder_get_data_size(
+	          filename_index_builder,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 150 );
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_index_builder_write_data(
+	          filename_index_builder,
+	          data,
+	          data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "SCCAINDX",
+	          8 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_index_builder_write_data(
+	          NULL,
+	          data,
+	          data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_builder_write_data(
+	          filename_index_builder,
+	          NULL,
+	          data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_index_builder_write_data(
+	          filename_index_builder,
+	          data,
+	          data_size - 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_index_builder_free(
+	          &filename_index_builder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_index_builder",
+	 filename_index_builder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_index_builder != NULL )
+	{
+		libscca_filename_index_builder_free(
+		 &filename_index_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_builder_initialize",
+	 scca_test_filename_index_builder_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_builder_free",
+	 scca_test_filename_index_builder_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_builder_append_source_path",
+	 scca_test_filename_index_builder_append_source_path );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_builder_append_source_path_wide",
+	 scca_test_filename_index_builder_append_source_path_wide );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_builder_append_utf16_filename",
+	 scca_test_filename_index_builder_append_utf16_filename );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_builder_get_number_of_keys",
+	 scca_test_filename_index_builder_get_number_of_keys );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_builder_get_data_size",
+	 scca_test_filename_index_builder_get_data_size );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_index_builder_write_data",
+	 scca_test_filename_index_builder_write_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,515 @@
+/*
+ * Library FILETIME functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_filetime.h"
+
+/* Tests the libscca_filetime_get_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filetime_get_date_time_values(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	uint32_t fraction_of_second = 0;
+	uint16_t year               = 0;
+	uint8_t day_of_month        = 0;
+	uint8_t hours               = 0;
+	uint8_t minutes             = 0;
+	uint8_t month               = 0;
+	uint8_t seconds             = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_filetime_get_date_time_values(
+	          125963012961234567UL,
+	          &year,
+	          &month,
+	          &day_of_month,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &fraction_of_second,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "year",
+	 year,
+	 2000 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 29 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 12 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "minutes",
+	 minutes,
+	 34 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 56 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "fraction_of_second",
+	 fraction_of_second,
+	 1234567 );
+
+	/* Test error cases
+	 */
+	result = libscca_filetime_get_date_time_values(
+	          2650467744000000000UL,
+	          &year,
+	          &month,
+	          &day_of_month,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &fraction_of_second,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filetime_get_date_time_values(
+	          0xffffffffffffffffUL,
+	          &year,
+	          &month,
+	          &day_of_month,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &fraction_of_second,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filetime_get_date_time_values(
+	          0,
+	          NULL,
+	          &month,
+	          &day_of_month,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &fraction_of_second,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filetime_get_date_time_values(
+	          0,
+	          &year,
+	          &month,
+	          &day_of_month,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_filetime_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filetime_copy_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_filetime_copy_to_utf8_string(
+	          0,
+	          utf8_string,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "1601-01-01T00:00:00.0000000Z",
+	          29 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_filetime_copy_to_utf8_string(
+	          2650467743999999999UL,
+	          utf8_string,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "9999-12-31T23:59:59.9999999Z",
+	          29 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_filetime_copy_to_utf8_string(
+	          0,
+	          NULL,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filetime_copy_to_utf8_string(
+	          0,
+	          utf8_string,
+	          28,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* Tests the libscca_filetime_array_copy_to_utf8_strings function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filetime_array_copy_to_utf8_strings(
+     void )
+{
+	uint8_t utf8_strings[ 3 * LIBSCCA_FILETIME_ISO8601_STRING_SIZE ];
+
+	uint64_t filetimes[ 3 ]  = { 0, 125963012961234567UL, 129938279823437500UL };
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_filetime_array_copy_to_utf8_strings(
+	          filetimes,
+	          3,
+	          utf8_strings,
+	          3 * LIBSCCA_FILETIME_ISO8601_STRING_SIZE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_strings,
+	          "1601-01-01T00:00:00.0000000Z\0"
+	          "2000-02-29T12:34:56.1234567Z\0"
+	          "2012-10-04T12:39:42.3437500Z",
+	          3 * LIBSCCA_FILETIME_ISO8601_STRING_SIZE );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_filetime_array_copy_to_utf8_strings(
+	          filetimes,
+	          0,
+	          utf8_strings,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_filetime_array_copy_to_utf8_strings(
+	          NULL,
+	          3,
+	          utf8_strings,
+	          3 * LIBSCCA_FILETIME_ISO8601_STRING_SIZE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filetime_array_copy_to_utf8_strings(
+	          filetimes,
+	          -1,
+	          utf8_strings,
+	          3 * LIBSCCA_FILETIME_ISO8601_STRING_SIZE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filetime_array_copy_to_utf8_strings(
+	          filetimes,
+	          3,
+	          NULL,
+	          3 * LIBSCCA_FILETIME_ISO8601_STRING_SIZE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filetime_array_copy_to_utf8_strings(
+	          filetimes,
+	          3,
+	          utf8_strings,
+	          ( 3 * LIBSCCA_FILETIME_ISO8601_STRING_SIZE ) - 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_filetime_get_date_time_values",
+	 scca_test_filetime_get_date_time_values );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_filetime_copy_to_utf8_string",
+	 scca_test_filetime_copy_to_utf8_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	SCCA_TEST_RUN(
+	 "libscca_filetime_array_copy_to_utf8_strings",
+	 scca_test_filetime_array_copy_to_utf8_strings );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
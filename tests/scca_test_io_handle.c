@@ -398,6 +398,480 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libscca_io_handle_reserve_memory and libscca_io_handle_release_memory functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_io_handle_reserve_memory(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libscca_io_handle_t *io_handle = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->maximum_memory_size = 4096;
+
+	/* Test regular cases
+	 */
+	result = libscca_io_handle_reserve_memory(
+	          io_handle,
+	          4000,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->memory_size",
+	 io_handle->memory_size,
+	 (size_t) 4000 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_io_handle_release_memory(
+	          io_handle,
+	          1000,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->memory_size",
+	 io_handle->memory_size,
+	 (size_t) 3000 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_io_handle_release_memory(
+	          io_handle,
+	          3000,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->memory_size",
+	 io_handle->memory_size,
+	 (size_t) 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_io_handle_reserve_memory(
+	          NULL,
+	          4000,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reserving more than the maximum memory size
+	 */
+	result = libscca_io_handle_reserve_memory(
+	          io_handle,
+	          4097,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->memory_size",
+	 io_handle->memory_size,
+	 (size_t) 0 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_io_handle_release_memory(
+	          NULL,
+	          1000,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test releasing more than was reserved
+	 */
+	result = libscca_io_handle_release_memory(
+	          io_handle,
+	          8000,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->memory_size",
+	 io_handle->memory_size,
+	 (size_t) 0 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libscca_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_io_handle_get_compressed_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_io_handle_get_compressed_data(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libscca_io_handle_t *io_handle = NULL;
+	uint8_t *compressed_data       = NULL;
+	uint8_t *first_compressed_data = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->maximum_memory_size = 10000;
+
+	/* Test regular cases
+	 */
+	result = libscca_io_handle_get_compressed_data(
+	          io_handle,
+	          4096,
+	          &first_compressed_data,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "first_compressed_data",
+	 first_compressed_data );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->memory_size",
+	 io_handle->memory_size,
+	 (size_t) 4096 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a smaller size reuses the compressed data
+	 */
+	result = libscca_io_handle_get_compressed_data(
+	          io_handle,
+	          1024,
+	          &compressed_data,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "compressed_data == first_compressed_data",
+	 (int) ( compressed_data == first_compressed_data ),
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->memory_size",
+	 io_handle->memory_size,
+	 (size_t) 4096 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a larger size grows the compressed data and its reserved memory
+	 */
+	result = libscca_io_handle_get_compressed_data(
+	          io_handle,
+	          8192,
+	          &compressed_data,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_data",
+	 compressed_data );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->compressed_data_size",
+	 io_handle->compressed_data_size,
+	 (size_t) 8192 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->memory_size",
+	 io_handle->memory_size,
+	 (size_t) 8192 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the compressed data remains reserved when the IO handle is cleared
+	 */
+	result = libscca_io_handle_clear(
+	          io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->compressed_data == compressed_data",
+	 (int) ( io_handle->compressed_data == compressed_data ),
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->memory_size",
+	 io_handle->memory_size,
+	 (size_t) 8192 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_io_handle_get_compressed_data(
+	          NULL,
+	          4096,
+	          &compressed_data,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_io_handle_get_compressed_data(
+	          io_handle,
+	          0,
+	          &compressed_data,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_io_handle_get_compressed_data(
+	          io_handle,
+	          4096,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test growing the compressed data beyond the maximum memory size
+	 */
+	result = libscca_io_handle_get_compressed_data(
+	          io_handle,
+	          10001,
+	          &compressed_data,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->compressed_data_size",
+	 io_handle->compressed_data_size,
+	 (size_t) 8192 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->memory_size",
+	 io_handle->memory_size,
+	 (size_t) 8192 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libscca_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +903,14 @@ int main(
 	 "libscca_io_handle_clear",
 	 scca_test_io_handle_clear );
 
+	SCCA_TEST_RUN(
+	 "libscca_io_handle_reserve_memory",
+	 scca_test_io_handle_reserve_memory );
+
+	SCCA_TEST_RUN(
+	 "libscca_io_handle_get_compressed_data",
+	 scca_test_io_handle_get_compressed_data );
+
 	/* TODO: add tests for libscca_io_handle_read_compressed_file_header */
 
 	/* TODO: add tests for libscca_io_handle_read_compressed_blocks */
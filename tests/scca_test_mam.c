@@ -0,0 +1,873 @@
+/*
+ * Library MAM functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_mam.h"
+#include "../libscca/libscca_mam_decoder.h"
+
+uint8_t scca_test_mam_compressed_data1[ 295 ] = {
+	0x4d, 0x41, 0x4d, 0x04, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x66, 0x56, 0x55, 0x55, 0x55, 0x55, 0x45,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xed, 0xaa, 0x11, 0x60, 0xbe, 0x45, 0xf6,
+	0x83, 0x77, 0x02, 0x96, 0xe8, 0xea, 0x15, 0x4c, 0x21, 0x8d, 0xfb, 0x4d, 0xd6, 0x7c, 0xe4, 0x47,
+	0x87, 0x8e, 0x00, 0x1a, 0x00, 0x00, 0x1a };
+
+uint8_t scca_test_mam_uncompressed_data1[ 89 ] = {
+	0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e, 0x20,
+	0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f, 0x67, 0x2e, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e, 0x20, 0x66, 0x6f, 0x78,
+	0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f, 0x67, 0x2e };
+
+uint8_t scca_test_mam_compressed_data2[ 572 ] = {
+	0x4d, 0x41, 0x4d, 0x04, 0x00, 0x10, 0x01, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0c, 0x18, 0x43, 0x46, 0xa0, 0x31, 0x6c, 0xd4,
+	0x1c, 0x37, 0x4c, 0x0e, 0x23, 0x26, 0x90, 0x19, 0x66, 0xca, 0x80, 0xa7, 0x00, 0x00, 0xff, 0xed,
+	0xff, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0x03, 0x0c, 0xc8, 0x10, 0x0d, 0x33, 0x50, 0x03, 0x37, 0xd8, 0x03, 0x0e, 0x84, 0x91, 0x18,
+	0x62, 0x41, 0xc6, 0x66, 0x94, 0xc0, 0x53, 0x00, 0x00, 0xff, 0xed, 0x0f };
+
+uint8_t scca_test_mam_compressed_data3[ 288 ] = {
+	0x4d, 0x41, 0x4d, 0x04, 0x73, 0x03, 0x00, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x30, 0x71, 0x8c, 0x7f, 0xec, 0xc7, 0x1f,
+	0x00, 0xf8, 0xf1, 0xfe, 0x00, 0x00, 0xff, 0x0e, 0x01, 0xff, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00 };
+
+/* Tests the libscca_mam_get_uncompressed_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_mam_get_uncompressed_size(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	uint32_t uncompressed_data_size = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_mam_get_uncompressed_size(
+	          scca_test_mam_compressed_data1,
+	          295,
+	          &uncompressed_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (uint32_t) 89 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_mam_get_uncompressed_size(
+	          NULL,
+	          295,
+	          &uncompressed_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_mam_get_uncompressed_size(
+	          scca_test_mam_compressed_data1,
+	          7,
+	          &uncompressed_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_mam_get_uncompressed_size(
+	          scca_test_mam_compressed_data1,
+	          295,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported signature
+	 */
+	result = libscca_mam_get_uncompressed_size(
+	          scca_test_mam_uncompressed_data1,
+	          89,
+	          &uncompressed_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_mam_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_mam_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 128 ];
+
+	libcerror_error_t *error           = NULL;
+	libscca_mam_decoder_t *mam_decoder = NULL;
+	size_t uncompressed_data_size      = 0;
+	int result                         = 0;
+	int test_number                    = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_mam_decoder_initialize(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The decoder is reused to test that no state of a previous call is used
+	 */
+	for( test_number = 0;
+	     test_number < 2;
+	     test_number++ )
+	{
+		memory_set(
+		 uncompressed_data,
+		 0,
+		 128 );
+
+		uncompressed_data_size = 128;
+
+		result = libscca_mam_decompress(
+		          mam_decoder,
+		          scca_test_mam_compressed_data1,
+		          295,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 89 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          scca_test_mam_uncompressed_data1,
+		          89 );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = 128;
+
+	result = libscca_mam_decompress(
+	          NULL,
+	          scca_test_mam_compressed_data1,
+	          295,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_mam_decompress(
+	          mam_decoder,
+	          NULL,
+	          295,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_mam_decompress(
+	          mam_decoder,
+	          scca_test_mam_compressed_data1,
+	          295,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_mam_decompress(
+	          mam_decoder,
+	          scca_test_mam_compressed_data1,
+	          295,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an uncompressed data buffer that is too small
+	 */
+	uncompressed_data_size = 88;
+
+	result = libscca_mam_decompress(
+	          mam_decoder,
+	          scca_test_mam_compressed_data1,
+	          295,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with truncated compressed data
+	 */
+	uncompressed_data_size = 128;
+
+	result = libscca_mam_decompress(
+	          mam_decoder,
+	          scca_test_mam_compressed_data1,
+	          200,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_mam_decoder_free(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mam_decoder != NULL )
+	{
+		libscca_mam_decoder_free(
+		 &mam_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_mam_decompress function with compressed data of multiple chunks
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_mam_decompress_multiple_chunks(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libscca_mam_decoder_t *mam_decoder = NULL;
+	uint8_t *compressed_data           = NULL;
+	uint8_t *uncompressed_data         = NULL;
+	size_t compressed_data_size        = 0;
+	size_t uncompressed_data_offset    = 0;
+	size_t uncompressed_data_size      = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_mam_decoder_initialize(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * 69632 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 69632;
+
+	result = libscca_mam_decompress(
+	          mam_decoder,
+	          scca_test_mam_compressed_data2,
+	          572,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 69632 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( uncompressed_data_offset = 0;
+	     uncompressed_data_offset < 69632;
+	     uncompressed_data_offset++ )
+	{
+		if( uncompressed_data[ uncompressed_data_offset ] != (uint8_t) "0123456789abcdef"[ uncompressed_data_offset % 16 ] )
+		{
+			break;
+		}
+	}
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 69632 );
+
+	/* Test error cases
+	 * Every truncated compressed data is copied into a buffer of its exact size
+	 * to detect reads beyond the end of the compressed data
+	 */
+	for( compressed_data_size = 8;
+	     compressed_data_size < 572;
+	     compressed_data_size++ )
+	{
+		compressed_data = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * compressed_data_size );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "compressed_data",
+		 compressed_data );
+
+		if( memory_copy(
+		     compressed_data,
+		     scca_test_mam_compressed_data2,
+		     compressed_data_size ) == NULL )
+		{
+			goto on_error;
+		}
+		uncompressed_data_size = 69632;
+
+		result = libscca_mam_decompress(
+		          mam_decoder,
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		memory_free(
+		 compressed_data );
+
+		compressed_data = NULL;
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	result = libscca_mam_decoder_free(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( mam_decoder != NULL )
+	{
+		libscca_mam_decoder_free(
+		 &mam_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_mam_decompress function with compressed data that contains extended match lengths
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_mam_decompress_extended_match_length(
+     void )
+{
+	uint8_t uncompressed_data[ 1024 ];
+
+	libcerror_error_t *error           = NULL;
+	libscca_mam_decoder_t *mam_decoder = NULL;
+	uint8_t *compressed_data           = NULL;
+	size_t compressed_data_size        = 0;
+	size_t uncompressed_data_offset    = 0;
+	size_t uncompressed_data_size      = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_mam_decoder_initialize(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 1024;
+
+	result = libscca_mam_decompress(
+	          mam_decoder,
+	          scca_test_mam_compressed_data3,
+	          288,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 883 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( uncompressed_data_offset = 0;
+	     uncompressed_data_offset < 883;
+	     uncompressed_data_offset++ )
+	{
+		if( uncompressed_data[ uncompressed_data_offset ] != (uint8_t) "abc"[ uncompressed_data_offset % 3 ] )
+		{
+			break;
+		}
+	}
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 883 );
+
+	/* Test error cases
+	 * Every truncated compressed data is copied into a buffer of its exact size
+	 * to detect reads beyond the end of the compressed data
+	 */
+	for( compressed_data_size = 8;
+	     compressed_data_size < 288;
+	     compressed_data_size++ )
+	{
+		compressed_data = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * compressed_data_size );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "compressed_data",
+		 compressed_data );
+
+		if( memory_copy(
+		     compressed_data,
+		     scca_test_mam_compressed_data3,
+		     compressed_data_size ) == NULL )
+		{
+			goto on_error;
+		}
+		uncompressed_data_size = 1024;
+
+		result = libscca_mam_decompress(
+		          mam_decoder,
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		memory_free(
+		 compressed_data );
+
+		compressed_data = NULL;
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libscca_mam_decoder_free(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( mam_decoder != NULL )
+	{
+		libscca_mam_decoder_free(
+		 &mam_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_mam_get_uncompressed_size",
+	 scca_test_mam_get_uncompressed_size );
+
+	SCCA_TEST_RUN(
+	 "libscca_mam_decompress",
+	 scca_test_mam_decompress );
+
+	SCCA_TEST_RUN(
+	 "libscca_mam_decompress_multiple_chunks",
+	 scca_test_mam_decompress_multiple_chunks );
+
+	SCCA_TEST_RUN(
+	 "libscca_mam_decompress_extended_match_length",
+	 scca_test_mam_decompress_extended_match_length );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
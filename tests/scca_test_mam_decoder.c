@@ -0,0 +1,875 @@
+/*
+ * Library mam_decoder type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_mam_decoder.h"
+
+/* Tests the libscca_mam_decoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_mam_decoder_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libscca_mam_decoder_t *mam_decoder = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libscca_mam_decoder_initialize(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_mam_decoder_free(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_mam_decoder_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	mam_decoder = (libscca_mam_decoder_t *) 0x12345678UL;
+
+	result = libscca_mam_decoder_initialize(
+	          &mam_decoder,
+	          &error );
+
+	mam_decoder = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_mam_decoder_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = libscca_mam_decoder_initialize(
+		          &mam_decoder,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( mam_decoder != NULL )
+			{
+				libscca_mam_decoder_free(
+				 &mam_decoder,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "mam_decoder",
+			 mam_decoder );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_mam_decoder_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = libscca_mam_decoder_initialize(
+		          &mam_decoder,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( mam_decoder != NULL )
+			{
+				libscca_mam_decoder_free(
+				 &mam_decoder,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "mam_decoder",
+			 mam_decoder );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mam_decoder != NULL )
+	{
+		libscca_mam_decoder_free(
+		 &mam_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_mam_decoder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_mam_decoder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_mam_decoder_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_mam_decoder_build_decoding_table function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_mam_decoder_build_decoding_table(
+     void )
+{
+	uint8_t code_lengths[ 256 ];
+
+	libcerror_error_t *error           = NULL;
+	libscca_mam_decoder_t *mam_decoder = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_mam_decoder_initialize(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+
+	/* Every symbol has a 9-bit code
+	 */
+	memory_set(
+	 code_lengths,
+	 0x99,
+	 256 );
+
+	result = libscca_mam_decoder_build_decoding_table(
+	          (libscca_internal_mam_decoder_t *) mam_decoder,
+	          code_lengths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "decoding_table[ 0 ]",
+	 ( (libscca_internal_mam_decoder_t *) mam_decoder )->decoding_table[ 0 ],
+	 (uint16_t) 0x0009 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "decoding_table[ 32767 ]",
+	 ( (libscca_internal_mam_decoder_t *) mam_decoder )->decoding_table[ 32767 ],
+	 (uint16_t) 0x1ff9 );
+
+	/* Symbol 1 has a 1-bit code and symbol 0 a 2-bit code, the other codes are unused
+	 */
+	memory_set(
+	 code_lengths,
+	 0,
+	 256 );
+
+	code_lengths[ 0 ] = 0x12;
+
+	result = libscca_mam_decoder_build_decoding_table(
+	          (libscca_internal_mam_decoder_t *) mam_decoder,
+	          code_lengths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "decoding_table[ 0 ]",
+	 ( (libscca_internal_mam_decoder_t *) mam_decoder )->decoding_table[ 0 ],
+	 (uint16_t) 0x0011 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "decoding_table[ 16384 ]",
+	 ( (libscca_internal_mam_decoder_t *) mam_decoder )->decoding_table[ 16384 ],
+	 (uint16_t) 0x0002 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "decoding_table[ 24576 ]",
+	 ( (libscca_internal_mam_decoder_t *) mam_decoder )->decoding_table[ 24576 ],
+	 (uint16_t) 0x0000 );
+
+	/* Test error cases
+	 */
+	result = libscca_mam_decoder_build_decoding_table(
+	          NULL,
+	          code_lengths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_mam_decoder_build_decoding_table(
+	          (libscca_internal_mam_decoder_t *) mam_decoder,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Every symbol has a 1-bit code
+	 */
+	memory_set(
+	 code_lengths,
+	 0x11,
+	 256 );
+
+	result = libscca_mam_decoder_build_decoding_table(
+	          (libscca_internal_mam_decoder_t *) mam_decoder,
+	          code_lengths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* No symbol has a code
+	 */
+	memory_set(
+	 code_lengths,
+	 0,
+	 256 );
+
+	result = libscca_mam_decoder_build_decoding_table(
+	          (libscca_internal_mam_decoder_t *) mam_decoder,
+	          code_lengths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_mam_decoder_free(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mam_decoder != NULL )
+	{
+		libscca_mam_decoder_free(
+		 &mam_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_mam_decoder_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_mam_decoder_decompress(
+     void )
+{
+	uint8_t compressed_data[ 263 ];
+	uint8_t uncompressed_data[ 32 ];
+
+	/* A literal 'a' followed by a match of 20 bytes at offset 1,
+	 * the match length uses the extended length byte
+	 */
+	uint8_t bit_stream1[ 7 ] = {
+		0xc3, 0x30, 0x00, 0xc0, 0x00, 0x00, 0x02 };
+
+	/* A match of 3 bytes at offset 1 without preceding literals
+	 */
+	uint8_t bit_stream2[ 4 ] = {
+		0x00, 0x80, 0x00, 0x00 };
+
+	/* Data that does not start with a valid 10-bit code
+	 */
+	uint8_t bit_stream3[ 4 ] = {
+		0xff, 0xff, 0xff, 0xff };
+
+	libcerror_error_t *error           = NULL;
+	libscca_mam_decoder_t *mam_decoder = NULL;
+	uint8_t *truncated_data            = NULL;
+	size_t compressed_data_size        = 0;
+	size_t uncompressed_data_offset    = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_mam_decoder_initialize(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* Every symbol has a 9-bit code
+	 */
+	memory_set(
+	 compressed_data,
+	 0x99,
+	 256 );
+
+	if( memory_copy(
+	     &( compressed_data[ 256 ] ),
+	     bit_stream1,
+	     7 ) == NULL )
+	{
+		goto on_error;
+	}
+
+	result = libscca_mam_decoder_decompress(
+	          (libscca_internal_mam_decoder_t *) mam_decoder,
+	          compressed_data,
+	          263,
+	          uncompressed_data,
+	          21,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( uncompressed_data_offset = 0;
+	     uncompressed_data_offset < 21;
+	     uncompressed_data_offset++ )
+	{
+		if( uncompressed_data[ uncompressed_data_offset ] != (uint8_t) 'a' )
+		{
+			break;
+		}
+	}
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 21 );
+
+	/* Test error cases
+	 */
+
+	/* Test with truncated compressed data
+	 * Every truncated compressed data is copied into a buffer of its exact size
+	 * to detect reads beyond the end of the compressed data
+	 */
+	for( compressed_data_size = 1;
+	     compressed_data_size < 263;
+	     compressed_data_size++ )
+	{
+		truncated_data = (uint8_t *) memory_allocate(
+		                              sizeof( uint8_t ) * compressed_data_size );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "truncated_data",
+		 truncated_data );
+
+		if( memory_copy(
+		     truncated_data,
+		     compressed_data,
+		     compressed_data_size ) == NULL )
+		{
+			goto on_error;
+		}
+		result = libscca_mam_decoder_decompress(
+		          (libscca_internal_mam_decoder_t *) mam_decoder,
+		          truncated_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          21,
+		          &error );
+
+		memory_free(
+		 truncated_data );
+
+		truncated_data = NULL;
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test with a match length that exceeds the uncompressed data size
+	 */
+	result = libscca_mam_decoder_decompress(
+	          (libscca_internal_mam_decoder_t *) mam_decoder,
+	          compressed_data,
+	          263,
+	          uncompressed_data,
+	          10,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a match offset that exceeds the uncompressed data offset
+	 */
+	memory_set(
+	 compressed_data,
+	 0x99,
+	 256 );
+
+	if( memory_copy(
+	     &( compressed_data[ 256 ] ),
+	     bit_stream2,
+	     4 ) == NULL )
+	{
+		goto on_error;
+	}
+
+	result = libscca_mam_decoder_decompress(
+	          (libscca_internal_mam_decoder_t *) mam_decoder,
+	          compressed_data,
+	          260,
+	          uncompressed_data,
+	          3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with code lengths that contain too many codes
+	 */
+	memory_set(
+	 compressed_data,
+	 0x11,
+	 256 );
+
+	result = libscca_mam_decoder_decompress(
+	          (libscca_internal_mam_decoder_t *) mam_decoder,
+	          compressed_data,
+	          263,
+	          uncompressed_data,
+	          21,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with code lengths that contain too few codes
+	 */
+	memory_set(
+	 compressed_data,
+	 0x00,
+	 256 );
+
+	result = libscca_mam_decoder_decompress(
+	          (libscca_internal_mam_decoder_t *) mam_decoder,
+	          compressed_data,
+	          263,
+	          uncompressed_data,
+	          21,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid code
+	 */
+	memory_set(
+	 compressed_data,
+	 0xaa,
+	 256 );
+
+	if( memory_copy(
+	     &( compressed_data[ 256 ] ),
+	     bit_stream3,
+	     4 ) == NULL )
+	{
+		goto on_error;
+	}
+
+	result = libscca_mam_decoder_decompress(
+	          (libscca_internal_mam_decoder_t *) mam_decoder,
+	          compressed_data,
+	          260,
+	          uncompressed_data,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_mam_decoder_free(
+	          &mam_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( truncated_data != NULL )
+	{
+		memory_free(
+		 truncated_data );
+	}
+	if( mam_decoder != NULL )
+	{
+		libscca_mam_decoder_free(
+		 &mam_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_mam_decoder_initialize",
+	 scca_test_mam_decoder_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_mam_decoder_free",
+	 scca_test_mam_decoder_free );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_mam_decoder_build_decoding_table",
+	 scca_test_mam_decoder_build_decoding_table );
+
+	SCCA_TEST_RUN(
+	 "libscca_mam_decoder_decompress",
+	 scca_test_mam_decoder_decompress );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,546 @@
+/*
+ * Library prefetch hash functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_prefetch_hash.h"
+
+/* L"\\device\\harddiskvolume1\\windows\\system32\\cmd.exe"
+ */
+uint16_t scca_test_prefetch_hash_cmd_path[ 49 ] = {
+	0x005c, 0x0064, 0x0065, 0x0076, 0x0069, 0x0063, 0x0065, 0x005c, 0x0068, 0x0061, 0x0072, 0x0064,
+	0x0064, 0x0069, 0x0073, 0x006b, 0x0076, 0x006f, 0x006c, 0x0075, 0x006d, 0x0065, 0x0031, 0x005c,
+	0x0077, 0x0069, 0x006e, 0x0064, 0x006f, 0x0077, 0x0073, 0x005c, 0x0073, 0x0079, 0x0073, 0x0074,
+	0x0065, 0x006d, 0x0033, 0x0032, 0x005c, 0x0063, 0x006d, 0x0064, 0x002e, 0x0065, 0x0078, 0x0065,
+	0x0000 };
+
+/* L"\\DEVICE\\HARDDISKVOLUME2\\WINDOWS\\SYSTEM32\\CMD.EXE"
+ */
+uint16_t scca_test_prefetch_hash_windows7_cmd_path[ 49 ] = {
+	0x005c, 0x0044, 0x0045, 0x0056, 0x0049, 0x0043, 0x0045, 0x005c, 0x0048, 0x0041, 0x0052, 0x0044,
+	0x0044, 0x0049, 0x0053, 0x004b, 0x0056, 0x004f, 0x004c, 0x0055, 0x004d, 0x0045, 0x0032, 0x005c,
+	0x0057, 0x0049, 0x004e, 0x0044, 0x004f, 0x0057, 0x0053, 0x005c, 0x0053, 0x0059, 0x0053, 0x0054,
+	0x0045, 0x004d, 0x0033, 0x0032, 0x005c, 0x0043, 0x004d, 0x0044, 0x002e, 0x0045, 0x0058, 0x0045,
+	0x0000 };
+
+/* L"\\DEVICE\\HARDDISKVOLUME2\\PROGRAM FILES\\\u00e4b.EXE"
+ */
+uint16_t scca_test_prefetch_hash_latin1_path[ 45 ] = {
+	0x005c, 0x0044, 0x0045, 0x0056, 0x0049, 0x0043, 0x0045, 0x005c, 0x0048, 0x0041, 0x0052, 0x0044,
+	0x0044, 0x0049, 0x0053, 0x004b, 0x0056, 0x004f, 0x004c, 0x0055, 0x004d, 0x0045, 0x0032, 0x005c,
+	0x0050, 0x0052, 0x004f, 0x0047, 0x0052, 0x0041, 0x004d, 0x0020, 0x0046, 0x0049, 0x004c, 0x0045,
+	0x0053, 0x005c, 0x00e4, 0x0062, 0x002e, 0x0045, 0x0058, 0x0045, 0x0000 };
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_prefetch_hash_upper_case_block function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_prefetch_hash_upper_case_block(
+     void )
+{
+	uint64_t block = 0;
+
+	/* Test regular cases
+	 */
+	block = libscca_prefetch_hash_upper_case_block(
+	         0x007a0061005c0040ULL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "block",
+	 block,
+	 (uint64_t) 0x005a0041005c0040ULL );
+
+	block = libscca_prefetch_hash_upper_case_block(
+	         0x007b0060005b0041ULL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "block",
+	 block,
+	 (uint64_t) 0x007b0060005b0041ULL );
+
+	/* Test with characters outside the Basic Latin range
+	 */
+	block = libscca_prefetch_hash_upper_case_block(
+	         0x043000e400ff0061ULL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "block",
+	 block,
+	 (uint64_t) 0x041000c401780041ULL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* Tests the libscca_calculate_prefetch_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_calculate_prefetch_hash(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t prefetch_hash   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_calculate_prefetch_hash(
+	          scca_test_prefetch_hash_cmd_path,
+	          49,
+	          LIBSCCA_PREFETCH_HASH_TYPE_XP,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0x087b4001UL );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_calculate_prefetch_hash(
+	          scca_test_prefetch_hash_windows7_cmd_path,
+	          49,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0x4a81b364UL );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_calculate_prefetch_hash(
+	          scca_test_prefetch_hash_windows7_cmd_path,
+	          49,
+	          LIBSCCA_PREFETCH_HASH_TYPE_2008,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0x4a81b364UL );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a path that is not a multitude of 4 characters and
+	 * contains characters outside the Basic Latin range
+	 */
+	result = libscca_calculate_prefetch_hash(
+	          scca_test_prefetch_hash_latin1_path,
+	          45,
+	          LIBSCCA_PREFETCH_HASH_TYPE_XP,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0x0a0d292dUL );
+
+	result = libscca_calculate_prefetch_hash(
+	          scca_test_prefetch_hash_latin1_path,
+	          45,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0xbe545578UL );
+
+	/* Test with a size that excludes the end-of-string character
+	 */
+	result = libscca_calculate_prefetch_hash(
+	          scca_test_prefetch_hash_windows7_cmd_path,
+	          48,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0x4a81b364UL );
+
+	/* Test error cases
+	 */
+	result = libscca_calculate_prefetch_hash(
+	          NULL,
+	          49,
+	          LIBSCCA_PREFETCH_HASH_TYPE_XP,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_calculate_prefetch_hash(
+	          scca_test_prefetch_hash_cmd_path,
+	          (size_t) SSIZE_MAX,
+	          LIBSCCA_PREFETCH_HASH_TYPE_XP,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_calculate_prefetch_hash(
+	          scca_test_prefetch_hash_cmd_path,
+	          49,
+	          0,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_calculate_prefetch_hash(
+	          scca_test_prefetch_hash_cmd_path,
+	          49,
+	          LIBSCCA_PREFETCH_HASH_TYPE_XP,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_calculate_prefetch_hashes function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_calculate_prefetch_hashes(
+     void )
+{
+	const uint16_t *utf16_strings[ 3 ] = {
+		scca_test_prefetch_hash_cmd_path,
+		scca_test_prefetch_hash_windows7_cmd_path,
+		scca_test_prefetch_hash_latin1_path };
+
+	size_t utf16_string_sizes[ 3 ] = { 49, 49, 45 };
+
+	libcerror_error_t *error        = NULL;
+	uint32_t prefetch_hashes[ 3 ]   = { 0, 0, 0 };
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_calculate_prefetch_hashes(
+	          utf16_strings,
+	          utf16_string_sizes,
+	          3,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          prefetch_hashes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hashes[ 0 ]",
+	 prefetch_hashes[ 0 ],
+	 (uint32_t) 0x89305d47UL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hashes[ 1 ]",
+	 prefetch_hashes[ 1 ],
+	 (uint32_t) 0x4a81b364UL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hashes[ 2 ]",
+	 prefetch_hashes[ 2 ],
+	 (uint32_t) 0xbe545578UL );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_calculate_prefetch_hashes(
+	          utf16_strings,
+	          utf16_string_sizes,
+	          0,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          prefetch_hashes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libscca_calculate_prefetch_hashes(
+	          NULL,
+	          utf16_string_sizes,
+	          3,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          prefetch_hashes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_calculate_prefetch_hashes(
+	          utf16_strings,
+	          NULL,
+	          3,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          prefetch_hashes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_calculate_prefetch_hashes(
+	          utf16_strings,
+	          utf16_string_sizes,
+	          -1,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          prefetch_hashes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_calculate_prefetch_hashes(
+	          utf16_strings,
+	          utf16_string_sizes,
+	          3,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf16_strings[ 1 ] = NULL;
+
+	result = libscca_calculate_prefetch_hashes(
+	          utf16_strings,
+	          utf16_string_sizes,
+	          3,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          prefetch_hashes,
+	          &error );
+
+	utf16_strings[ 1 ] = scca_test_prefetch_hash_windows7_cmd_path;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_prefetch_hash_upper_case_block",
+	 scca_test_prefetch_hash_upper_case_block );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	SCCA_TEST_RUN(
+	 "libscca_calculate_prefetch_hash",
+	 scca_test_calculate_prefetch_hash );
+
+	SCCA_TEST_RUN(
+	 "libscca_calculate_prefetch_hashes",
+	 scca_test_calculate_prefetch_hashes );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,271 @@
+/*
+ * Library read_failure type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_read_failure.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_read_failure_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_read_failure_clear(
+     void )
+{
+	libscca_read_failure_t read_failure;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	read_failure.is_set       = 1;
+	read_failure.error_domain = (int) LIBCERROR_ERROR_DOMAIN_IO;
+	read_failure.error_code   = (int) LIBCERROR_IO_ERROR_READ_FAILED;
+	read_failure.offset       = 1024;
+
+	/* Test regular cases
+	 */
+	result = libscca_read_failure_clear(
+	          &read_failure,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "read_failure.is_set",
+	 read_failure.is_set,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "read_failure.offset",
+	 (int64_t) read_failure.offset,
+	 (int64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_read_failure_clear(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_read_failure_set function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_read_failure_set(
+     void )
+{
+	libscca_read_failure_t read_failure;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	result = libscca_read_failure_clear(
+	          &read_failure,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_read_failure_set(
+	          &read_failure,
+	          (int) LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+	          (int) LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+	          4096,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "read_failure.is_set",
+	 read_failure.is_set,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "read_failure.error_domain",
+	 read_failure.error_domain,
+	 (int) LIBCERROR_ERROR_DOMAIN_COMPRESSION );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "read_failure.error_code",
+	 read_failure.error_code,
+	 (int) LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "read_failure.offset",
+	 (int64_t) read_failure.offset,
+	 (int64_t) 4096 );
+
+	/* Test that the innermost failure, which is recorded first, is retained
+	 */
+	result = libscca_read_failure_set(
+	          &read_failure,
+	          (int) LIBCERROR_ERROR_DOMAIN_IO,
+	          (int) LIBCERROR_IO_ERROR_READ_FAILED,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "read_failure.error_domain",
+	 read_failure.error_domain,
+	 (int) LIBCERROR_ERROR_DOMAIN_COMPRESSION );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "read_failure.error_code",
+	 read_failure.error_code,
+	 (int) LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "read_failure.offset",
+	 (int64_t) read_failure.offset,
+	 (int64_t) 4096 );
+
+	/* Test error cases
+	 */
+	result = libscca_read_failure_set(
+	          NULL,
+	          (int) LIBCERROR_ERROR_DOMAIN_IO,
+	          (int) LIBCERROR_IO_ERROR_READ_FAILED,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_read_failure_clear",
+	 scca_test_read_failure_clear );
+
+	SCCA_TEST_RUN(
+	 "libscca_read_failure_set",
+	 scca_test_read_failure_set );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,682 @@
+/*
+ * Library snapshot functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_file.h"
+#include "../libscca/libscca_filename_strings.h"
+#include "../libscca/libscca_snapshot.h"
+
+uint8_t scca_test_snapshot_data1[ 296 ] = {
+	0x53, 0x43, 0x43, 0x41, 0x53, 0x4e, 0x41, 0x50, 0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+	0x28, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12,
+	0x03, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xf6, 0xe5, 0xd4, 0xc3, 0xb2, 0xa1, 0xd0, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x2e, 0x00, 0x45, 0x00, 0x58, 0x00,
+	0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x01,
+	0xd4, 0xc3, 0xb2, 0xa1, 0x20, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x41, 0x00, 0x2e, 0x00, 0x45, 0x00, 0x58, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x43, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00
+ };
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_snapshot_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_snapshot_get_data_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	size_t data_size         = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_snapshot_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test file that is not open
+	 */
+	result = libscca_snapshot_get_data_size(
+	          (libscca_internal_file_t *) file,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_snapshot_read_data and libscca_snapshot_write_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_snapshot_read_data(
+     void )
+{
+	uint8_t data[ 296 ];
+
+	libcerror_error_t *error                = NULL;
+	libscca_file_t *file                    = NULL;
+	libscca_internal_file_t *internal_file  = NULL;
+	size_t data_size                        = 0;
+	int number_of_entries                   = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file = (libscca_internal_file_t *) file;
+
+	/* Test regular cases
+	 */
+	result = libscca_snapshot_read_data(
+	          internal_file,
+	          scca_test_snapshot_data1,
+	          296,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file->file_header",
+	 internal_file->file_header );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_file->file_header->format_version",
+	 internal_file->file_header->format_version,
+	 (uint32_t) 23 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_file->file_header->prefetch_hash",
+	 internal_file->file_header->prefetch_hash,
+	 (uint32_t) 0x12345678UL );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_file->file_header->executable_filename_size",
+	 internal_file->file_header->executable_filename_size,
+	 (size_t) 10 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file->file_information",
+	 internal_file->file_information );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_file->file_information->run_count",
+	 internal_file->file_information->run_count,
+	 (uint32_t) 3 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_file->file_information->last_run_time[ 0 ]",
+	 internal_file->file_information->last_run_time[ 0 ],
+	 (uint64_t) 0x01d0a1b2c3d4e5f6ULL );
+
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          file,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_number_of_volumes(
+	          file,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_get_number_of_filenames(
+	          internal_file->filename_strings,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_snapshot_get_data_size(
+	          internal_file,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 296 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_snapshot_write_data(
+	          internal_file,
+	          data,
+	          296,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          scca_test_snapshot_data1,
+	          296 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_snapshot_write_data(
+	          internal_file,
+	          data,
+	          295,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_snapshot_write_data(
+	          internal_file,
+	          NULL,
+	          296,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read data with values already set
+	 */
+	result = libscca_snapshot_read_data(
+	          internal_file,
+	          scca_test_snapshot_data1,
+	          296,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_close(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_snapshot_read_data(
+	          NULL,
+	          scca_test_snapshot_data1,
+	          296,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_snapshot_read_data(
+	          internal_file,
+	          NULL,
+	          296,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_snapshot_read_data(
+	          internal_file,
+	          scca_test_snapshot_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_snapshot_read_data(
+	          internal_file,
+	          scca_test_snapshot_data1,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data size smaller than the snapshot data size
+	 */
+	result = libscca_snapshot_read_data(
+	          internal_file,
+	          scca_test_snapshot_data1,
+	          295,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where signature is invalid
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 scca_test_snapshot_data1,
+	 0xffffffffUL );
+
+	result = libscca_snapshot_read_data(
+	          internal_file,
+	          scca_test_snapshot_data1,
+	          296,
+	          &error );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 scca_test_snapshot_data1,
+	 0x41434353UL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the device path is out of bounds
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( scca_test_snapshot_data1[ 248 ] ),
+	 0x00001000UL );
+
+	result = libscca_snapshot_read_data(
+	          internal_file,
+	          scca_test_snapshot_data1,
+	          296,
+	          &error );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( scca_test_snapshot_data1[ 248 ] ),
+	 0x00000006UL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the filename string is out of bounds
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( scca_test_snapshot_data1[ 268 ] ),
+	 0x00001000UL );
+
+	result = libscca_snapshot_read_data(
+	          internal_file,
+	          scca_test_snapshot_data1,
+	          296,
+	          &error );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( scca_test_snapshot_data1[ 268 ] ),
+	 0x0000000cUL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "internal_file->file_header",
+	 internal_file->file_header );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_snapshot_get_data_size",
+	 scca_test_snapshot_get_data_size );
+
+	SCCA_TEST_RUN(
+	 "libscca_snapshot_read_data",
+	 scca_test_snapshot_read_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+}
+
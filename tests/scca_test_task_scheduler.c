@@ -0,0 +1,958 @@
+/*
+ * Library task_scheduler type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_task_scheduler.h"
+
+/* Tests the libscca_task_scheduler_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_task_scheduler_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libscca_task_scheduler_t *task_scheduler = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 2;
+	int number_of_memset_fail_tests          = 2;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libscca_task_scheduler_initialize(
+	          &task_scheduler,
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "task_scheduler",
+	 task_scheduler );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_task_scheduler_free(
+	          &task_scheduler,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "task_scheduler",
+	 task_scheduler );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_task_scheduler_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	task_scheduler = (libscca_task_scheduler_t *) 0x12345678UL;
+
+	result = libscca_task_scheduler_initialize(
+	          &task_scheduler,
+	          4,
+	          &error );
+
+	task_scheduler = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_task_scheduler_initialize(
+	          &task_scheduler,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_task_scheduler_initialize(
+	          &task_scheduler,
+	          LIBSCCA_TASK_SCHEDULER_MAXIMUM_NUMBER_OF_WORKERS + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_task_scheduler_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = libscca_task_scheduler_initialize(
+		          &task_scheduler,
+		          4,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( task_scheduler != NULL )
+			{
+				libscca_task_scheduler_free(
+				 &task_scheduler,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "task_scheduler",
+			 task_scheduler );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_task_scheduler_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = libscca_task_scheduler_initialize(
+		          &task_scheduler,
+		          4,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( task_scheduler != NULL )
+			{
+				libscca_task_scheduler_free(
+				 &task_scheduler,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "task_scheduler",
+			 task_scheduler );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( task_scheduler != NULL )
+	{
+		libscca_task_scheduler_free(
+		 &task_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_task_scheduler_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_task_scheduler_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_task_scheduler_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_task_scheduler_append_task function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_task_scheduler_append_task(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libscca_task_scheduler_t *task_scheduler = NULL;
+	int result                               = 0;
+	int task_index                           = 0;
+	int test_number                          = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_task_scheduler_initialize(
+	          &task_scheduler,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "task_scheduler",
+	 task_scheduler );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, more tasks than initially allocated
+	 */
+	for( test_number = 0;
+	     test_number < 300;
+	     test_number++ )
+	{
+		result = libscca_task_scheduler_append_task(
+		          task_scheduler,
+		          (size64_t) test_number,
+		          &task_index,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "task_index",
+		 task_index,
+		 test_number );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libscca_task_scheduler_append_task(
+	          NULL,
+	          0,
+	          &task_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_task_scheduler_append_task(
+	          task_scheduler,
+	          0,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_task_scheduler_start(
+	          task_scheduler,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_task_scheduler_append_task(
+	          task_scheduler,
+	          0,
+	          &task_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_task_scheduler_free(
+	          &task_scheduler,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "task_scheduler",
+	 task_scheduler );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( task_scheduler != NULL )
+	{
+		libscca_task_scheduler_free(
+		 &task_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_task_scheduler_start function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_task_scheduler_start(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libscca_task_scheduler_t *task_scheduler = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_task_scheduler_initialize(
+	          &task_scheduler,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "task_scheduler",
+	 task_scheduler );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, without tasks
+	 */
+	result = libscca_task_scheduler_start(
+	          task_scheduler,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_task_scheduler_start(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_task_scheduler_start(
+	          task_scheduler,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_task_scheduler_free(
+	          &task_scheduler,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "task_scheduler",
+	 task_scheduler );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( task_scheduler != NULL )
+	{
+		libscca_task_scheduler_free(
+		 &task_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_task_scheduler_get_next_task function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_task_scheduler_get_next_task(
+     void )
+{
+	/* The expected order in which worker 0 retrieves the tasks, it first empties
+	 * its own queue and then steals the remaining tasks of worker 1
+	 */
+	int expected_task_indexes[ 5 ]           = { 1, 2, 0, 4, 3 };
+	size64_t weights[ 5 ]                    = { 10, 50, 30, 20, 40 };
+
+	libcerror_error_t *error                 = NULL;
+	libscca_task_scheduler_t *task_scheduler = NULL;
+	int result                               = 0;
+	int task_index                           = 0;
+	int test_number                          = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_task_scheduler_initialize(
+	          &task_scheduler,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "task_scheduler",
+	 task_scheduler );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( test_number = 0;
+	     test_number < 5;
+	     test_number++ )
+	{
+		result = libscca_task_scheduler_append_task(
+		          task_scheduler,
+		          weights[ test_number ],
+		          &task_index,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libscca_task_scheduler_get_next_task(
+	          task_scheduler,
+	          0,
+	          &task_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_task_scheduler_start(
+	          task_scheduler,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_task_scheduler_get_next_task(
+	          NULL,
+	          0,
+	          &task_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_task_scheduler_get_next_task(
+	          task_scheduler,
+	          -1,
+	          &task_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_task_scheduler_get_next_task(
+	          task_scheduler,
+	          2,
+	          &task_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_task_scheduler_get_next_task(
+	          task_scheduler,
+	          0,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	for( test_number = 0;
+	     test_number < 5;
+	     test_number++ )
+	{
+		result = libscca_task_scheduler_get_next_task(
+		          task_scheduler,
+		          0,
+		          &task_index,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "task_index",
+		 task_index,
+		 expected_task_indexes[ test_number ] );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libscca_task_scheduler_get_next_task(
+	          task_scheduler,
+	          0,
+	          &task_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_task_scheduler_get_next_task(
+	          task_scheduler,
+	          1,
+	          &task_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libscca_task_scheduler_free(
+	          &task_scheduler,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "task_scheduler",
+	 task_scheduler );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( task_scheduler != NULL )
+	{
+		libscca_task_scheduler_free(
+		 &task_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_task_scheduler_compare_tasks function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_task_scheduler_compare_tasks(
+     void )
+{
+	libscca_task_scheduler_task_t first_task;
+	libscca_task_scheduler_task_t second_task;
+
+	int result = 0;
+
+	first_task.weight  = 200;
+	first_task.index   = 1;
+	second_task.weight = 100;
+	second_task.index  = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_task_scheduler_compare_tasks(
+	          &first_task,
+	          &second_task );
+
+	SCCA_TEST_ASSERT_LESS_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_task_scheduler_compare_tasks(
+	          &second_task,
+	          &first_task );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Tasks of equal weight retain the order in which they were appended
+	 */
+	second_task.weight = 200;
+
+	result = libscca_task_scheduler_compare_tasks(
+	          &first_task,
+	          &second_task );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_task_scheduler_compare_tasks(
+	          &first_task,
+	          &first_task );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_task_scheduler_initialize",
+	 scca_test_task_scheduler_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_task_scheduler_free",
+	 scca_test_task_scheduler_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_task_scheduler_append_task",
+	 scca_test_task_scheduler_append_task );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_task_scheduler_compare_tasks",
+	 scca_test_task_scheduler_compare_tasks );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	SCCA_TEST_RUN(
+	 "libscca_task_scheduler_start",
+	 scca_test_task_scheduler_start );
+
+	SCCA_TEST_RUN(
+	 "libscca_task_scheduler_get_next_task",
+	 scca_test_task_scheduler_get_next_task );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
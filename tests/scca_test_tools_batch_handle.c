@@ -0,0 +1,492 @@
+/*
+ * Tools batch_handle type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/batch_handle.h"
+#include "../sccatools/source_list.h"
+
+/* Tests the batch_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_batch_handle_initialize(
+     void )
+{
+	batch_handle_t *batch_handle      = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = batch_handle_initialize(
+	          &batch_handle,
+	          BATCH_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "batch_handle",
+	 batch_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every worker has its own MAM decoder
+	 */
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "batch_handle->workers[ 0 ].mam_decoder",
+	 batch_handle->workers[ 0 ].mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "batch_handle->workers[ 1 ].mam_decoder",
+	 batch_handle->workers[ 1 ].mam_decoder );
+
+	SCCA_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "batch_handle->workers[ 1 ].mam_decoder",
+	 (intptr_t) batch_handle->workers[ 1 ].mam_decoder,
+	 (intptr_t) batch_handle->workers[ 0 ].mam_decoder );
+
+	result = batch_handle_free(
+	          &batch_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "batch_handle",
+	 batch_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = batch_handle_initialize(
+	          NULL,
+	          BATCH_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	batch_handle = (batch_handle_t *) 0x12345678UL;
+
+	result = batch_handle_initialize(
+	          &batch_handle,
+	          BATCH_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+	          &error );
+
+	batch_handle = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = batch_handle_initialize(
+	          &batch_handle,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test batch_handle_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = batch_handle_initialize(
+		          &batch_handle,
+		          BATCH_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( batch_handle != NULL )
+			{
+				batch_handle_free(
+				 &batch_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "batch_handle",
+			 batch_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test batch_handle_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = batch_handle_initialize(
+		          &batch_handle,
+		          BATCH_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( batch_handle != NULL )
+			{
+				batch_handle_free(
+				 &batch_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "batch_handle",
+			 batch_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch_handle != NULL )
+	{
+		batch_handle_free(
+		 &batch_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the batch_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_batch_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = batch_handle_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the batch_handle_process_sources function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_batch_handle_process_sources(
+     void )
+{
+	batch_handle_t *batch_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	source_list_t *source_list   = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = batch_handle_initialize(
+	          &batch_handle,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "batch_handle",
+	 batch_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = source_list_initialize(
+	          &source_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "source_list",
+	 source_list );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = batch_handle_process_sources(
+	          batch_handle,
+	          source_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = batch_handle_process_sources(
+	          NULL,
+	          source_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = batch_handle_process_sources(
+	          batch_handle,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = source_list_free(
+	          &source_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = batch_handle_free(
+	          &batch_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_list != NULL )
+	{
+		source_list_free(
+		 &source_list,
+		 NULL );
+	}
+	if( batch_handle != NULL )
+	{
+		batch_handle_free(
+		 &batch_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "batch_handle_initialize",
+	 scca_test_tools_batch_handle_initialize );
+
+	SCCA_TEST_RUN(
+	 "batch_handle_free",
+	 scca_test_tools_batch_handle_free );
+
+	SCCA_TEST_RUN(
+	 "batch_handle_process_sources",
+	 scca_test_tools_batch_handle_process_sources );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
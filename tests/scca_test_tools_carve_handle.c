@@ -0,0 +1,773 @@
+/*
+ * Tools carve_handle type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/carve_handle.h"
+
+/* Tests the carve_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_carve_handle_initialize(
+     void )
+{
+	carve_handle_t *carve_handle    = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = carve_handle_initialize(
+	          &carve_handle,
+	          CARVE_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "carve_handle",
+	 carve_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = carve_handle_free(
+	          &carve_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "carve_handle",
+	 carve_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = carve_handle_initialize(
+	          NULL,
+	          CARVE_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	carve_handle = (carve_handle_t *) 0x12345678UL;
+
+	result = carve_handle_initialize(
+	          &carve_handle,
+	          CARVE_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+	          &error );
+
+	carve_handle = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = carve_handle_initialize(
+	          &carve_handle,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = carve_handle_initialize(
+	          &carve_handle,
+	          CARVE_HANDLE_MAXIMUM_NUMBER_OF_JOBS + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test carve_handle_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = carve_handle_initialize(
+		          &carve_handle,
+		          CARVE_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( carve_handle != NULL )
+			{
+				carve_handle_free(
+				 &carve_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "carve_handle",
+			 carve_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test carve_handle_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = carve_handle_initialize(
+		          &carve_handle,
+		          CARVE_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( carve_handle != NULL )
+			{
+				carve_handle_free(
+				 &carve_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "carve_handle",
+			 carve_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carve_handle != NULL )
+	{
+		carve_handle_free(
+		 &carve_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the carve_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_carve_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = carve_handle_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the carve_handle_set_chunk_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_carve_handle_set_chunk_size(
+     void )
+{
+	carve_handle_t *carve_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = carve_handle_initialize(
+	          &carve_handle,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "carve_handle",
+	 carve_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = carve_handle_set_chunk_size(
+	          carve_handle,
+	          4096,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "carve_handle->chunk_size",
+	 carve_handle->chunk_size,
+	 (size_t) 4096 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = carve_handle_set_chunk_size(
+	          NULL,
+	          4096,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = carve_handle_set_chunk_size(
+	          carve_handle,
+	          CARVE_HANDLE_SIGNATURE_SIZE - 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = carve_handle_free(
+	          &carve_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carve_handle != NULL )
+	{
+		carve_handle_free(
+		 &carve_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the carve_handle_chunk_append_file function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_carve_handle_chunk_append_file(
+     void )
+{
+	carve_handle_chunk_t chunk;
+
+	libcerror_error_t *error = NULL;
+	int file_index           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &chunk,
+	          0,
+	          sizeof( carve_handle_chunk_t ) ) != NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	for( file_index = 0;
+	     file_index < 20;
+	     file_index++ )
+	{
+		result = carve_handle_chunk_append_file(
+		          &chunk,
+		          (off64_t) ( file_index * 512 ),
+		          256,
+		          LIBSCCA_FILE_TYPE_UNCOMPRESSED,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "chunk.number_of_files",
+	 chunk.number_of_files,
+	 20 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "chunk.number_of_allocated_files",
+	 chunk.number_of_allocated_files,
+	 32 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "chunk.files[ 19 ].offset",
+	 (int64_t) chunk.files[ 19 ].offset,
+	 (int64_t) ( 19 * 512 ) );
+
+	/* Test error cases
+	 */
+	result = carve_handle_chunk_append_file(
+	          NULL,
+	          0,
+	          256,
+	          LIBSCCA_FILE_TYPE_UNCOMPRESSED,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 chunk.files );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk.files != NULL )
+	{
+		memory_free(
+		 chunk.files );
+	}
+	return( 0 );
+}
+
+/* Tests the carve_handle_scan_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_carve_handle_scan_data(
+     void )
+{
+	uint8_t data[ 256 ];
+
+	carve_handle_chunk_t chunk;
+
+	carve_handle_t *carve_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &chunk,
+	          0,
+	          sizeof( carve_handle_chunk_t ) ) != NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          data,
+	          0,
+	          256 ) != NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* A signature with a file size that is too small to contain the file header
+	 */
+	result = memory_copy(
+	          &( data[ 64 ] ),
+	          "\x1e\x00\x00\x00SCCA\x11\x00\x00\x00\x10\x00\x00\x00",
+	          16 ) != NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = carve_handle_initialize(
+	          &carve_handle,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "carve_handle",
+	 carve_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	chunk.size = 128;
+
+	/* Test regular cases
+	 */
+	result = carve_handle_scan_data(
+	          carve_handle,
+	          &chunk,
+	          data,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "chunk.number_of_files",
+	 chunk.number_of_files,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = carve_handle_scan_data(
+	          NULL,
+	          &chunk,
+	          data,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = carve_handle_scan_data(
+	          carve_handle,
+	          NULL,
+	          data,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = carve_handle_scan_data(
+	          carve_handle,
+	          &chunk,
+	          NULL,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = carve_handle_scan_data(
+	          carve_handle,
+	          &chunk,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = carve_handle_free(
+	          &carve_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carve_handle != NULL )
+	{
+		carve_handle_free(
+		 &carve_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "carve_handle_initialize",
+	 scca_test_tools_carve_handle_initialize );
+
+	SCCA_TEST_RUN(
+	 "carve_handle_free",
+	 scca_test_tools_carve_handle_free );
+
+	SCCA_TEST_RUN(
+	 "carve_handle_set_chunk_size",
+	 scca_test_tools_carve_handle_set_chunk_size );
+
+	SCCA_TEST_RUN(
+	 "carve_handle_chunk_append_file",
+	 scca_test_tools_carve_handle_chunk_append_file );
+
+	SCCA_TEST_RUN(
+	 "carve_handle_scan_data",
+	 scca_test_tools_carve_handle_scan_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,933 @@
+/*
+ * Tools export_handle type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/export_handle.h"
+
+/* Tests the export_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_export_handle_initialize(
+     void )
+{
+	export_handle_t *export_handle  = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = export_handle_initialize(
+	          &export_handle,
+	          EXPORT_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "export_handle",
+	 export_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every worker has its own MAM decoder
+	 */
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "export_handle->workers[ 0 ].mam_decoder",
+	 export_handle->workers[ 0 ].mam_decoder );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "export_handle->workers[ 1 ].mam_decoder",
+	 export_handle->workers[ 1 ].mam_decoder );
+
+	SCCA_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "export_handle->workers[ 1 ].mam_decoder",
+	 (intptr_t) export_handle->workers[ 1 ].mam_decoder,
+	 (intptr_t) export_handle->workers[ 0 ].mam_decoder );
+
+	result = export_handle_free(
+	          &export_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "export_handle",
+	 export_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = export_handle_initialize(
+	          NULL,
+	          EXPORT_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	export_handle = (export_handle_t *) 0x12345678UL;
+
+	result = export_handle_initialize(
+	          &export_handle,
+	          EXPORT_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+	          &error );
+
+	export_handle = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_handle_initialize(
+	          &export_handle,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_handle_initialize(
+	          &export_handle,
+	          EXPORT_HANDLE_MAXIMUM_NUMBER_OF_JOBS + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test export_handle_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = export_handle_initialize(
+		          &export_handle,
+		          EXPORT_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( export_handle != NULL )
+			{
+				export_handle_free(
+				 &export_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "export_handle",
+			 export_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test export_handle_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = export_handle_initialize(
+		          &export_handle,
+		          EXPORT_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( export_handle != NULL )
+			{
+				export_handle_free(
+				 &export_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "export_handle",
+			 export_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_handle != NULL )
+	{
+		export_handle_free(
+		 &export_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the export_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_export_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = export_handle_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the export_handle_set_target_path function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_export_handle_set_target_path(
+     void )
+{
+	export_handle_t *export_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = export_handle_initialize(
+	          &export_handle,
+	          EXPORT_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "export_handle",
+	 export_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = export_handle_set_target_path(
+	          export_handle,
+	          _SYSTEM_STRING( "target" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "export_handle->target_path",
+	 export_handle->target_path );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = export_handle_set_target_path(
+	          NULL,
+	          _SYSTEM_STRING( "target" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_handle_set_target_path(
+	          export_handle,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = export_handle_free(
+	          &export_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "export_handle",
+	 export_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_handle != NULL )
+	{
+		export_handle_free(
+		 &export_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the export_handle_path_is_prefetch_file function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_export_handle_path_is_prefetch_file(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = export_handle_path_is_prefetch_file(
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = export_handle_path_is_prefetch_file(
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.PF" ),
+	          19 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = export_handle_path_is_prefetch_file(
+	          _SYSTEM_STRING( "Layout.ini" ),
+	          10 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = export_handle_path_is_prefetch_file(
+	          _SYSTEM_STRING( ".pf" ),
+	          3 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = export_handle_path_is_prefetch_file(
+	          NULL,
+	          19 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the export_handle_append_task function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_export_handle_append_task(
+     void )
+{
+	export_handle_t *export_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+	int task_index                 = 0;
+
+	/* Initialize test
+	 */
+	result = export_handle_initialize(
+	          &export_handle,
+	          EXPORT_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "export_handle",
+	 export_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( task_index = 0;
+	     task_index < 100;
+	     task_index++ )
+	{
+		result = export_handle_append_task(
+		          export_handle,
+		          _SYSTEM_STRING( "Prefetch/CMD.EXE-4A81B364.pf" ),
+		          9,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "export_handle->number_of_tasks",
+	 export_handle->number_of_tasks,
+	 100 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "export_handle->number_of_allocated_tasks",
+	 export_handle->number_of_allocated_tasks,
+	 128 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "export_handle->tasks[ 99 ].relative_path_offset",
+	 export_handle->tasks[ 99 ].relative_path_offset,
+	 (size_t) 9 );
+
+	/* Test error cases
+	 */
+	result = export_handle_append_task(
+	          NULL,
+	          _SYSTEM_STRING( "Prefetch/CMD.EXE-4A81B364.pf" ),
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_handle_append_task(
+	          export_handle,
+	          NULL,
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The relative path cannot be empty
+	 */
+	result = export_handle_append_task(
+	          export_handle,
+	          _SYSTEM_STRING( "Prefetch/" ),
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = export_handle_free(
+	          &export_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "export_handle",
+	 export_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_handle != NULL )
+	{
+		export_handle_free(
+		 &export_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the export_handle_get_target_path function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_export_handle_get_target_path(
+     void )
+{
+#if defined( WINAPI )
+	system_character_t expected_target_path[] = _SYSTEM_STRING( "target\\CMD.EXE-4A81B364.pf" );
+#else
+	system_character_t expected_target_path[] = _SYSTEM_STRING( "target/CMD.EXE-4A81B364.pf" );
+#endif
+
+	export_handle_t *export_handle  = NULL;
+	libcerror_error_t *error        = NULL;
+	system_character_t *target_path = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = export_handle_initialize(
+	          &export_handle,
+	          EXPORT_HANDLE_DEFAULT_NUMBER_OF_JOBS,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "export_handle",
+	 export_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_handle_append_task(
+	          export_handle,
+	          _SYSTEM_STRING( "Prefetch/CMD.EXE-4A81B364.pf" ),
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = export_handle_get_target_path(
+	          export_handle,
+	          &( export_handle->tasks[ 0 ] ),
+	          &target_path,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = export_handle_set_target_path(
+	          export_handle,
+	          _SYSTEM_STRING( "target" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_handle_get_target_path(
+	          export_handle,
+	          &( export_handle->tasks[ 0 ] ),
+	          &target_path,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "target_path",
+	 target_path );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          target_path,
+	          expected_target_path,
+	          system_string_length( expected_target_path ) + 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 target_path );
+
+	target_path = NULL;
+
+	result = export_handle_get_target_path(
+	          NULL,
+	          &( export_handle->tasks[ 0 ] ),
+	          &target_path,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_handle_get_target_path(
+	          export_handle,
+	          NULL,
+	          &target_path,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_handle_get_target_path(
+	          export_handle,
+	          &( export_handle->tasks[ 0 ] ),
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = export_handle_free(
+	          &export_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "export_handle",
+	 export_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( target_path != NULL )
+	{
+		memory_free(
+		 target_path );
+	}
+	if( export_handle != NULL )
+	{
+		export_handle_free(
+		 &export_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "export_handle_initialize",
+	 scca_test_tools_export_handle_initialize );
+
+	SCCA_TEST_RUN(
+	 "export_handle_free",
+	 scca_test_tools_export_handle_free );
+
+	SCCA_TEST_RUN(
+	 "export_handle_set_target_path",
+	 scca_test_tools_export_handle_set_target_path );
+
+	SCCA_TEST_RUN(
+	 "export_handle_path_is_prefetch_file",
+	 scca_test_tools_export_handle_path_is_prefetch_file );
+
+	SCCA_TEST_RUN(
+	 "export_handle_append_task",
+	 scca_test_tools_export_handle_append_task );
+
+	SCCA_TEST_RUN(
+	 "export_handle_get_target_path",
+	 scca_test_tools_export_handle_get_target_path );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
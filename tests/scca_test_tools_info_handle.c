@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -268,6 +269,580 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the info_handle_get_scratch_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_info_handle_get_scratch_buffer(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	info_handle_t *info_handle = NULL;
+	uint8_t *buffer            = NULL;
+	uint8_t *first_buffer      = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = info_handle_initialize(
+	          &info_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "info_handle",
+	 info_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = info_handle_get_scratch_buffer(
+	          info_handle,
+	          INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING,
+	          16,
+	          &first_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "first_buffer",
+	 first_buffer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "info_handle->scratch_buffer_sizes[ INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING ]",
+	 info_handle->scratch_buffer_sizes[ INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING ],
+	 (size_t) INFO_HANDLE_MINIMUM_SCRATCH_BUFFER_SIZE );
+
+	/* A smaller size reuses the buffer
+	 */
+	result = info_handle_get_scratch_buffer(
+	          info_handle,
+	          INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING,
+	          8,
+	          &buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "buffer == first_buffer",
+	 (int) ( buffer == first_buffer ),
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A larger size grows the buffer
+	 */
+	result = info_handle_get_scratch_buffer(
+	          info_handle,
+	          INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING,
+	          INFO_HANDLE_MINIMUM_SCRATCH_BUFFER_SIZE + 1,
+	          &buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "info_handle->scratch_buffer_sizes[ INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING ]",
+	 info_handle->scratch_buffer_sizes[ INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING ],
+	 (size_t) ( 2 * INFO_HANDLE_MINIMUM_SCRATCH_BUFFER_SIZE ) );
+
+	/* Test error cases
+	 */
+	result = info_handle_get_scratch_buffer(
+	          NULL,
+	          INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING,
+	          16,
+	          &buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_handle_get_scratch_buffer(
+	          info_handle,
+	          INFO_HANDLE_NUMBER_OF_SCRATCH_BUFFERS,
+	          16,
+	          &buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_handle_get_scratch_buffer(
+	          info_handle,
+	          INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING,
+	          0,
+	          &buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_handle_get_scratch_buffer(
+	          info_handle,
+	          INFO_HANDLE_SCRATCH_BUFFER_VALUE_STRING,
+	          16,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = info_handle_free(
+	          &info_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "info_handle",
+	 info_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_handle != NULL )
+	{
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the info_handle_set_fields function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_info_handle_set_fields(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	info_handle_t *info_handle = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = info_handle_initialize(
+	          &info_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "info_handle",
+	 info_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "info_handle->fields",
+	 info_handle->fields,
+	 (uint32_t) INFO_HANDLE_FIELDS_ALL );
+
+	/* Test regular cases
+	 */
+	result = info_handle_set_fields(
+	          info_handle,
+	          _SYSTEM_STRING( "executable,hash,run_count,last_run_times" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "info_handle->fields",
+	 info_handle->fields,
+	 (uint32_t) ( INFO_HANDLE_FIELD_EXECUTABLE_FILENAME | INFO_HANDLE_FIELD_PREFETCH_HASH | INFO_HANDLE_FIELD_RUN_COUNT | INFO_HANDLE_FIELD_LAST_RUN_TIMES ) );
+
+	result = info_handle_set_fields(
+	          info_handle,
+	          _SYSTEM_STRING( "all" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "info_handle->fields",
+	 info_handle->fields,
+	 (uint32_t) INFO_HANDLE_FIELDS_ALL );
+
+	/* Unsupported fields do not change the fields
+	 */
+	result = info_handle_set_fields(
+	          info_handle,
+	          _SYSTEM_STRING( "hash,bogus" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_handle_set_fields(
+	          info_handle,
+	          _SYSTEM_STRING( "" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A trailing separator is ignored
+	 */
+	result = info_handle_set_fields(
+	          info_handle,
+	          _SYSTEM_STRING( "hash," ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "info_handle->fields",
+	 info_handle->fields,
+	 (uint32_t) INFO_HANDLE_FIELD_PREFETCH_HASH );
+
+	/* Test error cases
+	 */
+	result = info_handle_set_fields(
+	          NULL,
+	          _SYSTEM_STRING( "hash" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_handle_set_fields(
+	          info_handle,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = info_handle_free(
+	          &info_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "info_handle",
+	 info_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_handle != NULL )
+	{
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the info_handle_filetime_value_fprint function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_info_handle_filetime_value_fprint(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	info_handle_t *info_handle = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = info_handle_initialize(
+	          &info_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "info_handle",
+	 info_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	info_handle->output_writer->buffer_offset = 0;
+
+	result = info_handle_filetime_value_fprint(
+	          info_handle,
+	          "Last run time",
+	          0x019db1ded53e8000UL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "info_handle->output_writer->buffer_offset",
+	 info_handle->output_writer->buffer_offset,
+	 (size_t) 51 );
+
+	result = memory_compare(
+	          info_handle->output_writer->buffer,
+	          "Last run time: Jan 01, 1970 00:00:00.000000000 UTC\n",
+	          51 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a FILETIME past the year 9999 that cannot be represented as a date and time string
+	 */
+	info_handle->output_writer->buffer_offset = 0;
+
+	result = info_handle_filetime_value_fprint(
+	          info_handle,
+	          "Last run time",
+	          0xffffffffffffffffUL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "info_handle->output_writer->buffer_offset",
+	 info_handle->output_writer->buffer_offset,
+	 (size_t) 39 );
+
+	result = memory_compare(
+	          info_handle->output_writer->buffer,
+	          "Last run time: (0xffffffff 0xffffffff)\n",
+	          39 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	info_handle->output_writer->buffer_offset = 0;
+
+	/* Test error cases
+	 */
+	result = info_handle_filetime_value_fprint(
+	          NULL,
+	          "Last run time",
+	          0xffffffffffffffffUL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = info_handle_free(
+	          &info_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "info_handle",
+	 info_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_handle != NULL )
+	{
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -291,6 +866,18 @@ int main(
 	 "info_handle_free",
 	 scca_test_tools_info_handle_free );
 
+	SCCA_TEST_RUN(
+	 "info_handle_get_scratch_buffer",
+	 scca_test_tools_info_handle_get_scratch_buffer );
+
+	SCCA_TEST_RUN(
+	 "info_handle_set_fields",
+	 scca_test_tools_info_handle_set_fields );
+
+	SCCA_TEST_RUN(
+	 "info_handle_filetime_value_fprint",
+	 scca_test_tools_info_handle_filetime_value_fprint );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,650 @@
+/*
+ * Tools mapped_file type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/mapped_file.h"
+
+/* The name of the file used to test opening a mapped file, created in the current working directory
+ */
+#define SCCA_TEST_TOOLS_MAPPED_FILE_FILENAME	"scca_test_tools_mapped_file.dat"
+
+/* The data of the file used to test opening a mapped file
+ */
+static const char *scca_test_tools_mapped_file_data = "SCCAINDX mapped file test data";
+
+/* Writes data to a file
+ * Returns 1 if successful or -1 on error
+ */
+int scca_test_tools_mapped_file_write_file(
+     const char *filename,
+     const char *data,
+     size_t data_size )
+{
+	FILE *stream = NULL;
+
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( stream == NULL )
+	{
+		return( -1 );
+	}
+	if( file_stream_write(
+	     stream,
+	     data,
+	     data_size ) != data_size )
+	{
+		file_stream_close(
+		 stream );
+
+		return( -1 );
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the mapped_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_mapped_file_initialize(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	mapped_file_t *mapped_file = NULL;
+	int result                 = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = mapped_file_initialize(
+	          &mapped_file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mapped_file_free(
+	          &mapped_file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mapped_file_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	mapped_file = (mapped_file_t *) 0x12345678UL;
+
+	result = mapped_file_initialize(
+	          &mapped_file,
+	          &error );
+
+	mapped_file = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test mapped_file_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = mapped_file_initialize(
+		          &mapped_file,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( mapped_file != NULL )
+			{
+				mapped_file_free(
+				 &mapped_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "mapped_file",
+			 mapped_file );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test mapped_file_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = mapped_file_initialize(
+		          &mapped_file,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( mapped_file != NULL )
+			{
+				mapped_file_free(
+				 &mapped_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "mapped_file",
+			 mapped_file );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_file != NULL )
+	{
+		mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the mapped_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_mapped_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = mapped_file_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the mapped_file_open function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_mapped_file_open(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	mapped_file_t *mapped_file = NULL;
+	size_t data_size           = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	data_size = narrow_string_length(
+	             scca_test_tools_mapped_file_data );
+
+	result = scca_test_tools_mapped_file_write_file(
+	          SCCA_TEST_TOOLS_MAPPED_FILE_FILENAME,
+	          scca_test_tools_mapped_file_data,
+	          data_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = mapped_file_initialize(
+	          &mapped_file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = mapped_file_open(
+	          mapped_file,
+	          _SYSTEM_STRING( SCCA_TEST_TOOLS_MAPPED_FILE_FILENAME ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file->data",
+	 mapped_file->data );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "mapped_file->data_size",
+	 mapped_file->data_size,
+	 data_size );
+
+	result = memory_compare(
+	          mapped_file->data,
+	          scca_test_tools_mapped_file_data,
+	          data_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	/* Test opening a mapped file that is already open
+	 */
+	result = mapped_file_open(
+	          mapped_file,
+	          _SYSTEM_STRING( SCCA_TEST_TOOLS_MAPPED_FILE_FILENAME ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mapped_file_close(
+	          mapped_file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mapped_file->data",
+	 mapped_file->data );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mapped_file_open(
+	          NULL,
+	          _SYSTEM_STRING( SCCA_TEST_TOOLS_MAPPED_FILE_FILENAME ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mapped_file_open(
+	          mapped_file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mapped_file_open(
+	          mapped_file,
+	          _SYSTEM_STRING( "scca_test_tools_mapped_file.missing" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mapped_file->data",
+	 mapped_file->data );
+
+	/* Clean up
+	 */
+	result = mapped_file_free(
+	          &mapped_file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 SCCA_TEST_TOOLS_MAPPED_FILE_FILENAME );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_file != NULL )
+	{
+		mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	remove(
+	 SCCA_TEST_TOOLS_MAPPED_FILE_FILENAME );
+
+	return( 0 );
+}
+
+/* Tests the mapped_file_close function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_mapped_file_close(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	mapped_file_t *mapped_file = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = mapped_file_initialize(
+	          &mapped_file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	/* Test closing a mapped file that is not open
+	 */
+	result = mapped_file_close(
+	          mapped_file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mapped_file_close(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = mapped_file_free(
+	          &mapped_file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_file != NULL )
+	{
+		mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "mapped_file_initialize",
+	 scca_test_tools_mapped_file_initialize );
+
+	SCCA_TEST_RUN(
+	 "mapped_file_free",
+	 scca_test_tools_mapped_file_free );
+
+	SCCA_TEST_RUN(
+	 "mapped_file_open",
+	 scca_test_tools_mapped_file_open );
+
+	SCCA_TEST_RUN(
+	 "mapped_file_close",
+	 scca_test_tools_mapped_file_close );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1271 @@
+/*
+ * Tools output_writer functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/output_writer.h"
+
+/* Tests the output_writer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_output_writer_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	output_writer_t *output_writer  = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = output_writer_initialize(
+	          &output_writer,
+	          stdout,
+	          OUTPUT_WRITER_DEFAULT_BUFFER_SIZE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "output_writer",
+	 output_writer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_writer_free(
+	          &output_writer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "output_writer",
+	 output_writer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test in memory mode
+	 */
+	result = output_writer_initialize(
+	          &output_writer,
+	          NULL,
+	          OUTPUT_WRITER_DEFAULT_BUFFER_SIZE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "output_writer",
+	 output_writer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_writer_free(
+	          &output_writer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = output_writer_initialize(
+	          NULL,
+	          stdout,
+	          OUTPUT_WRITER_DEFAULT_BUFFER_SIZE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	output_writer = (output_writer_t *) 0x12345678UL;
+
+	result = output_writer_initialize(
+	          &output_writer,
+	          stdout,
+	          OUTPUT_WRITER_DEFAULT_BUFFER_SIZE,
+	          &error );
+
+	output_writer = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_writer_initialize(
+	          &output_writer,
+	          stdout,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test output_writer_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = output_writer_initialize(
+		          &output_writer,
+		          stdout,
+		          OUTPUT_WRITER_DEFAULT_BUFFER_SIZE,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( output_writer != NULL )
+			{
+				output_writer_free(
+				 &output_writer,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "output_writer",
+			 output_writer );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test output_writer_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = output_writer_initialize(
+		          &output_writer,
+		          stdout,
+		          OUTPUT_WRITER_DEFAULT_BUFFER_SIZE,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( output_writer != NULL )
+			{
+				output_writer_free(
+				 &output_writer,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "output_writer",
+			 output_writer );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_writer != NULL )
+	{
+		output_writer_free(
+		 &output_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the output_writer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_output_writer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = output_writer_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the output_writer_set_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_output_writer_set_stream(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	output_writer_t *output_writer = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = output_writer_initialize(
+	          &output_writer,
+	          stdout,
+	          OUTPUT_WRITER_DEFAULT_BUFFER_SIZE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "output_writer",
+	 output_writer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = output_writer_set_stream(
+	          output_writer,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = output_writer_set_stream(
+	          NULL,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test output_writer_set_stream with data remaining in the buffer
+	 */
+	output_writer->buffer_offset = 1;
+
+	result = output_writer_set_stream(
+	          output_writer,
+	          stdout,
+	          &error );
+
+	output_writer->buffer_offset = 0;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_writer_free(
+	          &output_writer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_writer != NULL )
+	{
+		output_writer_free(
+		 &output_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the output_writer_write_data function in memory mode
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_output_writer_write_data_in_memory(
+     void )
+{
+	uint8_t data[ 24 ]             = { 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x' };
+	libcerror_error_t *error       = NULL;
+	output_writer_t *output_writer = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = output_writer_initialize(
+	          &output_writer,
+	          NULL,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "output_writer",
+	 output_writer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = output_writer_write_data(
+	          output_writer,
+	          data,
+	          24,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_writer->buffer_offset",
+	 output_writer->buffer_offset,
+	 (size_t) 24 );
+
+	result = memory_compare(
+	          output_writer->buffer,
+	          data,
+	          24 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Flushing in memory mode retains the data
+	 */
+	result = output_writer_flush(
+	          output_writer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_writer->buffer_offset",
+	 output_writer->buffer_offset,
+	 (size_t) 24 );
+
+	/* Test output_writer_printf
+	 */
+	output_writer->buffer_offset = 0;
+
+	result = output_writer_printf(
+	          output_writer,
+	          "%s: %d of %d\n",
+	          "value",
+	          12,
+	          345678 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_writer->buffer_offset",
+	 output_writer->buffer_offset,
+	 (size_t) 20 );
+
+	result = memory_compare(
+	          output_writer->buffer,
+	          "value: 12 of 345678\n",
+	          20 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = output_writer_printf(
+	          NULL,
+	          "%s",
+	          "value" );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Clean up
+	 */
+	result = output_writer_free(
+	          &output_writer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_writer != NULL )
+	{
+		output_writer_free(
+		 &output_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the output_writer_write_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_output_writer_write_data(
+     output_writer_t *output_writer )
+{
+	uint8_t data[ 4 ]        = { 'd', 'a', 't', 'a' };
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	output_writer->buffer_offset = 0;
+
+	result = output_writer_write_data(
+	          output_writer,
+	          data,
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_writer->buffer_offset",
+	 output_writer->buffer_offset,
+	 (size_t) 4 );
+
+	result = memory_compare(
+	          output_writer->buffer,
+	          data,
+	          4 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = output_writer_write_data(
+	          NULL,
+	          data,
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_writer_write_data(
+	          output_writer,
+	          NULL,
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_writer_write_data(
+	          output_writer,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the output_writer_write_decimal_uint64 function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_output_writer_write_decimal_uint64(
+     output_writer_t *output_writer )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	output_writer->buffer_offset = 0;
+
+	result = output_writer_write_decimal_uint64(
+	          output_writer,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_writer_write_decimal_uint64(
+	          output_writer,
+	          0xffffffffffffffffUL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_writer->buffer_offset",
+	 output_writer->buffer_offset,
+	 (size_t) 21 );
+
+	result = memory_compare(
+	          output_writer->buffer,
+	          "018446744073709551615",
+	          21 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = output_writer_write_decimal_uint64(
+	          NULL,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the output_writer_write_hexadecimal_uint64 function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_output_writer_write_hexadecimal_uint64(
+     output_writer_t *output_writer )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	output_writer->buffer_offset = 0;
+
+	result = output_writer_write_hexadecimal_uint64(
+	          output_writer,
+	          0x1234abcdUL,
+	          8,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_writer_write_hexadecimal_uint64(
+	          output_writer,
+	          0x0fUL,
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_writer_write_hexadecimal_uint64(
+	          output_writer,
+	          0xffffffffffffffffUL,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_writer->buffer_offset",
+	 output_writer->buffer_offset,
+	 (size_t) 28 );
+
+	result = memory_compare(
+	          output_writer->buffer,
+	          "1234abcd000fffffffffffffffff",
+	          28 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = output_writer_write_hexadecimal_uint64(
+	          NULL,
+	          0,
+	          8,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_writer_write_hexadecimal_uint64(
+	          output_writer,
+	          0,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_writer_write_hexadecimal_uint64(
+	          output_writer,
+	          0,
+	          17,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the output_writer_write_system_string function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_output_writer_write_system_string(
+     output_writer_t *output_writer )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	output_writer->buffer_offset = 0;
+
+	result = output_writer_write_system_string(
+	          output_writer,
+	          _SYSTEM_STRING( "\\VOLUME{01}" ),
+	          11,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_writer->buffer_offset",
+	 output_writer->buffer_offset,
+	 (size_t) 11 );
+
+	result = memory_compare(
+	          output_writer->buffer,
+	          "\\VOLUME{01}",
+	          11 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = output_writer_write_system_string(
+	          output_writer,
+	          _SYSTEM_STRING( "" ),
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_writer->buffer_offset",
+	 output_writer->buffer_offset,
+	 (size_t) 11 );
+
+	/* Test error cases
+	 */
+	result = output_writer_write_system_string(
+	          NULL,
+	          _SYSTEM_STRING( "\\VOLUME{01}" ),
+	          11,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_writer_write_system_string(
+	          output_writer,
+	          NULL,
+	          11,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the output_writer_write_json_string function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_output_writer_write_json_string(
+     output_writer_t *output_writer )
+{
+	uint8_t utf8_string[ 12 ] = { 'C', ':', '\\', '"', 'a', '"', '\t', 0x01, 0xc3, 0xa9, 0x00, 'X' };
+	libcerror_error_t *error  = NULL;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	output_writer->buffer_offset = 0;
+
+	result = output_writer_write_json_string(
+	          output_writer,
+	          utf8_string,
+	          12,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_writer->buffer_offset",
+	 output_writer->buffer_offset,
+	 (size_t) 21 );
+
+	result = memory_compare(
+	          output_writer->buffer,
+	          "\"C:\\\\\\\"a\\\"\\t\\u0001\xc3\xa9\"",
+	          21 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = output_writer_write_json_string(
+	          NULL,
+	          utf8_string,
+	          12,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_writer_write_json_string(
+	          output_writer,
+	          NULL,
+	          12,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error       = NULL;
+	output_writer_t *output_writer = NULL;
+	int result                     = 0;
+
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "output_writer_initialize",
+	 scca_test_tools_output_writer_initialize );
+
+	SCCA_TEST_RUN(
+	 "output_writer_free",
+	 scca_test_tools_output_writer_free );
+
+	SCCA_TEST_RUN(
+	 "output_writer_set_stream",
+	 scca_test_tools_output_writer_set_stream );
+
+	SCCA_TEST_RUN(
+	 "output_writer_write_data_in_memory",
+	 scca_test_tools_output_writer_write_data_in_memory );
+
+	/* Initialize output writer for tests
+	 * Note that the tests do not flush the buffered data
+	 */
+	result = output_writer_initialize(
+	          &output_writer,
+	          stdout,
+	          OUTPUT_WRITER_DEFAULT_BUFFER_SIZE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "output_writer",
+	 output_writer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_RUN_WITH_ARGS(
+	 "output_writer_write_data",
+	 scca_test_tools_output_writer_write_data,
+	 output_writer );
+
+	SCCA_TEST_RUN_WITH_ARGS(
+	 "output_writer_write_decimal_uint64",
+	 scca_test_tools_output_writer_write_decimal_uint64,
+	 output_writer );
+
+	SCCA_TEST_RUN_WITH_ARGS(
+	 "output_writer_write_hexadecimal_uint64",
+	 scca_test_tools_output_writer_write_hexadecimal_uint64,
+	 output_writer );
+
+	SCCA_TEST_RUN_WITH_ARGS(
+	 "output_writer_write_system_string",
+	 scca_test_tools_output_writer_write_system_string,
+	 output_writer );
+
+	SCCA_TEST_RUN_WITH_ARGS(
+	 "output_writer_write_json_string",
+	 scca_test_tools_output_writer_write_json_string,
+	 output_writer );
+
+	/* Clean up
+	 */
+	result = output_writer_free(
+	          &output_writer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "output_writer",
+	 output_writer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_writer != NULL )
+	{
+		output_writer_free(
+		 &output_writer,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
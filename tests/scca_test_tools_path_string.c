@@ -346,6 +346,116 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the path_string_copy_from_file_entry_path_to_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_path_string_copy_from_file_entry_path_to_buffer(
+     void )
+{
+	system_character_t file_entry_path[ 5 ] = { 't', 'e', 0x03, 't', 0 };
+	system_character_t expected_path[ 8 ]   = { 't', 'e', '\\', 'x', '0', '3', 't', 0 };
+	system_character_t path[ 41 ];
+	libcerror_error_t *error                = NULL;
+	int result                              = 0;
+
+	/* Test regular cases
+	 */
+	result = path_string_copy_from_file_entry_path_to_buffer(
+	          path,
+	          41,
+	          file_entry_path,
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          path,
+	          expected_path,
+	          sizeof( system_character_t ) * 8 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = path_string_copy_from_file_entry_path_to_buffer(
+	          NULL,
+	          41,
+	          file_entry_path,
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = path_string_copy_from_file_entry_path_to_buffer(
+	          path,
+	          40,
+	          file_entry_path,
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = path_string_copy_from_file_entry_path_to_buffer(
+	          path,
+	          41,
+	          NULL,
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -365,6 +475,10 @@ int main(
 	 "path_string_copy_from_file_entry_path",
 	 scca_test_tools_path_string_copy_from_file_entry_path )
 
+	SCCA_TEST_RUN(
+	 "path_string_copy_from_file_entry_path_to_buffer",
+	 scca_test_tools_path_string_copy_from_file_entry_path_to_buffer )
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,1118 @@
+/*
+ * Tools query_handle type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/query_handle.h"
+#include "../sccatools/result_cache.h"
+
+/* Tests the query_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_query_handle_initialize(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	query_handle_t *query_handle = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = query_handle_initialize(
+	          &query_handle,
+	          RESULT_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "query_handle",
+	 query_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = query_handle_free(
+	          &query_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "query_handle",
+	 query_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = query_handle_initialize(
+	          NULL,
+	          RESULT_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	query_handle = (query_handle_t *) 0x12345678UL;
+
+	result = query_handle_initialize(
+	          &query_handle,
+	          RESULT_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+	          &error );
+
+	query_handle = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = query_handle_initialize(
+	          &query_handle,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "query_handle",
+	 query_handle );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( query_handle != NULL )
+	{
+		query_handle_free(
+		 &query_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the query_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_query_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = query_handle_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the query_handle_parse_json_string function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_query_handle_parse_json_string(
+     void )
+{
+	uint8_t expected_utf8_string[ 9 ] = {
+		'a', '"', '\\', '/', '\n', 0xc3, 0xa9, 0xf0, 0x9f };
+
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t data_offset        = 0;
+	size_t utf8_string_length = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = query_handle_parse_json_string(
+	          (uint8_t *) "\"CMD.EXE\",",
+	          10,
+	          &data_offset,
+	          utf8_string,
+	          32,
+	          &utf8_string_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 9 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_length",
+	 utf8_string_length,
+	 (size_t) 7 );
+
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "CMD.EXE",
+	          8 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test escaped characters including a surrogate pair
+	 */
+	data_offset = 0;
+
+	result = query_handle_parse_json_string(
+	          (uint8_t *) "\"a\\\"\\\\\\/\\n\\u00e9\\ud83d\\ude00\"",
+	          29,
+	          &data_offset,
+	          utf8_string,
+	          32,
+	          &utf8_string_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 29 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_length",
+	 utf8_string_length,
+	 (size_t) 11 );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          9 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "utf8_string[ 9 ]",
+	 utf8_string[ 9 ],
+	 (uint8_t) 0x98 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "utf8_string[ 10 ]",
+	 utf8_string[ 10 ],
+	 (uint8_t) 0x80 );
+
+	/* Test error cases
+	 */
+	data_offset = 0;
+
+	result = query_handle_parse_json_string(
+	          NULL,
+	          10,
+	          &data_offset,
+	          utf8_string,
+	          32,
+	          &utf8_string_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = query_handle_parse_json_string(
+	          (uint8_t *) "\"CMD.EXE\",",
+	          10,
+	          NULL,
+	          utf8_string,
+	          32,
+	          &utf8_string_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a missing opening quote
+	 */
+	data_offset = 0;
+
+	result = query_handle_parse_json_string(
+	          (uint8_t *) "CMD.EXE\"",
+	          8,
+	          &data_offset,
+	          utf8_string,
+	          32,
+	          &utf8_string_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a missing closing quote
+	 */
+	data_offset = 0;
+
+	result = query_handle_parse_json_string(
+	          (uint8_t *) "\"CMD.EXE",
+	          8,
+	          &data_offset,
+	          utf8_string,
+	          32,
+	          &utf8_string_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a string that exceeds the UTF-8 string size
+	 */
+	data_offset = 0;
+
+	result = query_handle_parse_json_string(
+	          (uint8_t *) "\"CMD.EXE\"",
+	          9,
+	          &data_offset,
+	          utf8_string,
+	          4,
+	          &utf8_string_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a high surrogate without low surrogate
+	 */
+	data_offset = 0;
+
+	result = query_handle_parse_json_string(
+	          (uint8_t *) "\"\\ud83d\"",
+	          9,
+	          &data_offset,
+	          utf8_string,
+	          32,
+	          &utf8_string_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an unsupported escaped character
+	 */
+	data_offset = 0;
+
+	result = query_handle_parse_json_string(
+	          (uint8_t *) "\"\\x\"",
+	          4,
+	          &data_offset,
+	          utf8_string,
+	          32,
+	          &utf8_string_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the query_handle_parse_request function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_query_handle_parse_request(
+     void )
+{
+	const char *invalid_requests[ 9 ] = {
+		"",
+		"{}",
+		"{\"executable\":\"\"}",
+		"{\"executable\":1}",
+		"{\"file_reference\":\"1\"}",
+		"{\"file_reference\":18446744073709551616}",
+		"{\"stats\":false}",
+		"{\"bogus\":\"CMD.EXE\"}",
+		"{\"executable\":\"CMD.EXE\",\"filename\":\"A\"}" };
+
+	libcerror_error_t *error     = NULL;
+	query_handle_t *query_handle = NULL;
+	int request_index            = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = query_handle_initialize(
+	          &query_handle,
+	          RESULT_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "query_handle",
+	 query_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = query_handle_parse_request(
+	          query_handle,
+	          (uint8_t *) " { \"executable\" : \"CMD.EXE\" } ",
+	          30,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "query_handle->query_type",
+	 query_handle->query_type,
+	 QUERY_HANDLE_QUERY_TYPE_EXECUTABLE );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "query_handle->query_value_length",
+	 query_handle->query_value_length,
+	 (size_t) 7 );
+
+	result = query_handle_parse_request(
+	          query_handle,
+	          (uint8_t *) "{\"filename\":\"NTDLL\"}",
+	          20,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "query_handle->query_type",
+	 query_handle->query_type,
+	 QUERY_HANDLE_QUERY_TYPE_FILENAME );
+
+	result = query_handle_parse_request(
+	          query_handle,
+	          (uint8_t *) "{\"file_reference\":281474976710663}",
+	          34,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "query_handle->query_type",
+	 query_handle->query_type,
+	 QUERY_HANDLE_QUERY_TYPE_FILE_REFERENCE );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "query_handle->query_file_reference",
+	 query_handle->query_file_reference,
+	 (uint64_t) 0x0001000000000007ULL );
+
+	result = query_handle_parse_request(
+	          query_handle,
+	          (uint8_t *) "{\"stats\":true}",
+	          14,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "query_handle->query_type",
+	 query_handle->query_type,
+	 QUERY_HANDLE_QUERY_TYPE_STATISTICS );
+
+	/* Test error cases
+	 */
+	for( request_index = 0;
+	     request_index < 9;
+	     request_index++ )
+	{
+		result = query_handle_parse_request(
+		          query_handle,
+		          (uint8_t *) invalid_requests[ request_index ],
+		          narrow_string_length(
+		           invalid_requests[ request_index ] ),
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "query_handle->query_type",
+		 query_handle->query_type,
+		 QUERY_HANDLE_QUERY_TYPE_UNDEFINED );
+	}
+	result = query_handle_parse_request(
+	          NULL,
+	          (uint8_t *) "{\"stats\":true}",
+	          14,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = query_handle_parse_request(
+	          query_handle,
+	          NULL,
+	          14,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = query_handle_free(
+	          &query_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "query_handle",
+	 query_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( query_handle != NULL )
+	{
+		query_handle_free(
+		 &query_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the query_handle_entry_matches function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_query_handle_entry_matches(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	query_handle_t *query_handle = NULL;
+	result_cache_entry_t *entry  = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = query_handle_initialize(
+	          &query_handle,
+	          RESULT_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "query_handle",
+	 query_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = result_cache_entry_initialize(
+	          &entry,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          1024,
+	          1234567890,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "entry",
+	 entry );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	entry->executable_filename = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * 8 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "entry->executable_filename",
+	 entry->executable_filename );
+
+	result = narrow_string_copy(
+	          (char *) entry->executable_filename,
+	          "CMD.EXE",
+	          8 ) != NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	entry->executable_filename_size = 8;
+
+	entry->filenames = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * 22 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "entry->filenames",
+	 entry->filenames );
+
+	result = memory_copy(
+	          entry->filenames,
+	          "\\KERNEL32.DLL\0\\NTDLL\0",
+	          22 ) != NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	entry->filenames_size = 22;
+
+	entry->file_references = (uint64_t *) memory_allocate(
+	                                       sizeof( uint64_t ) * 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "entry->file_references",
+	 entry->file_references );
+
+	entry->file_references[ 0 ]      = 0x0003000000000007ULL;
+	entry->number_of_file_references = 1;
+
+	/* Test regular cases
+	 */
+	result = query_handle_parse_request(
+	          query_handle,
+	          (uint8_t *) "{\"executable\":\"cmd.exe\"}",
+	          24,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = query_handle_entry_matches(
+	          query_handle,
+	          entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = query_handle_parse_request(
+	          query_handle,
+	          (uint8_t *) "{\"executable\":\"cmd\"}",
+	          20,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = query_handle_entry_matches(
+	          query_handle,
+	          entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = query_handle_parse_request(
+	          query_handle,
+	          (uint8_t *) "{\"filename\":\"ntdll\"}",
+	          20,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = query_handle_entry_matches(
+	          query_handle,
+	          entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = query_handle_parse_request(
+	          query_handle,
+	          (uint8_t *) "{\"filename\":\"USER32\"}",
+	          21,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = query_handle_entry_matches(
+	          query_handle,
+	          entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a file reference without sequence number matches any sequence number
+	 */
+	result = query_handle_parse_request(
+	          query_handle,
+	          (uint8_t *) "{\"file_reference\":7}",
+	          20,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = query_handle_entry_matches(
+	          query_handle,
+	          entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = query_handle_parse_request(
+	          query_handle,
+	          (uint8_t *) "{\"file_reference\":281474976710663}",
+	          34,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = query_handle_entry_matches(
+	          query_handle,
+	          entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = query_handle_entry_matches(
+	          NULL,
+	          entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = query_handle_entry_matches(
+	          query_handle,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = result_cache_entry_free(
+	          &entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "entry",
+	 entry );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = query_handle_free(
+	          &query_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "query_handle",
+	 query_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entry != NULL )
+	{
+		result_cache_entry_free(
+		 &entry,
+		 NULL );
+	}
+	if( query_handle != NULL )
+	{
+		query_handle_free(
+		 &query_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "query_handle_initialize",
+	 scca_test_tools_query_handle_initialize );
+
+	SCCA_TEST_RUN(
+	 "query_handle_free",
+	 scca_test_tools_query_handle_free );
+
+	SCCA_TEST_RUN(
+	 "query_handle_parse_json_string",
+	 scca_test_tools_query_handle_parse_json_string );
+
+	SCCA_TEST_RUN(
+	 "query_handle_parse_request",
+	 scca_test_tools_query_handle_parse_request );
+
+	SCCA_TEST_RUN(
+	 "query_handle_entry_matches",
+	 scca_test_tools_query_handle_entry_matches );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1030 @@
+/*
+ * Tools result_cache type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/result_cache.h"
+
+/* Tests the result_cache_entry_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_result_cache_entry_initialize(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	result_cache_entry_t *entry = NULL;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = result_cache_entry_initialize(
+	          &entry,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          1024,
+	          1234567890,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "entry",
+	 entry );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "entry->path_length",
+	 entry->path_length,
+	 (size_t) 19 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "entry->file_size",
+	 entry->file_size,
+	 (uint64_t) 1024 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "entry->modification_time",
+	 entry->modification_time,
+	 (int64_t) 1234567890 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "entry->path_hash",
+	 entry->path_hash,
+	 result_cache_calculate_path_hash(
+	  _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	  19 ) );
+
+	result = result_cache_entry_free(
+	          &entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "entry",
+	 entry );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = result_cache_entry_initialize(
+	          NULL,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          1024,
+	          1234567890,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	entry = (result_cache_entry_t *) 0x12345678UL;
+
+	result = result_cache_entry_initialize(
+	          &entry,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          1024,
+	          1234567890,
+	          &error );
+
+	entry = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = result_cache_entry_initialize(
+	          &entry,
+	          NULL,
+	          19,
+	          1024,
+	          1234567890,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = result_cache_entry_initialize(
+	          &entry,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          0,
+	          1024,
+	          1234567890,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entry != NULL )
+	{
+		result_cache_entry_free(
+		 &entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the result_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_result_cache_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	result_cache_t *result_cache    = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = result_cache_initialize(
+	          &result_cache,
+	          RESULT_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "result_cache",
+	 result_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result_cache->maximum_number_of_entries",
+	 result_cache->maximum_number_of_entries,
+	 RESULT_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "result_cache->number_of_buckets",
+	 result_cache->number_of_buckets,
+	 (uint32_t) 1024 );
+
+	result = result_cache_free(
+	          &result_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "result_cache",
+	 result_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = result_cache_initialize(
+	          NULL,
+	          RESULT_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result_cache = (result_cache_t *) 0x12345678UL;
+
+	result = result_cache_initialize(
+	          &result_cache,
+	          RESULT_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+	          &error );
+
+	result_cache = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = result_cache_initialize(
+	          &result_cache,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = result_cache_initialize(
+	          &result_cache,
+	          RESULT_CACHE_MAXIMUM_NUMBER_OF_ENTRIES + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test result_cache_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = result_cache_initialize(
+		          &result_cache,
+		          RESULT_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( result_cache != NULL )
+			{
+				result_cache_free(
+				 &result_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "result_cache",
+			 result_cache );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test result_cache_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = result_cache_initialize(
+		          &result_cache,
+		          RESULT_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( result_cache != NULL )
+			{
+				result_cache_free(
+				 &result_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "result_cache",
+			 result_cache );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( result_cache != NULL )
+	{
+		result_cache_free(
+		 &result_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the result_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_result_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = result_cache_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = result_cache_entry_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the result_cache_get_entry and result_cache_insert_entry functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_result_cache_get_entry(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	result_cache_entry_t *cached_entry = NULL;
+	result_cache_entry_t *entry        = NULL;
+	result_cache_t *result_cache       = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = result_cache_initialize(
+	          &result_cache,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "result_cache",
+	 result_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = result_cache_get_entry(
+	          result_cache,
+	          _SYSTEM_STRING( "A.pf" ),
+	          4,
+	          100,
+	          1,
+	          &cached_entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "cached_entry",
+	 cached_entry );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = result_cache_entry_initialize(
+	          &entry,
+	          _SYSTEM_STRING( "A.pf" ),
+	          4,
+	          100,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = result_cache_insert_entry(
+	          result_cache,
+	          entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cached_entry = entry;
+	entry        = NULL;
+
+	/* Test inserting an entry that is already part of the cache
+	 */
+	result = result_cache_insert_entry(
+	          result_cache,
+	          cached_entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test inserting a second entry for the same path
+	 */
+	result = result_cache_entry_initialize(
+	          &entry,
+	          _SYSTEM_STRING( "A.pf" ),
+	          4,
+	          100,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = result_cache_insert_entry(
+	          result_cache,
+	          entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = result_cache_entry_free(
+	          &entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a cache hit
+	 */
+	cached_entry = NULL;
+
+	result = result_cache_get_entry(
+	          result_cache,
+	          _SYSTEM_STRING( "A.pf" ),
+	          4,
+	          100,
+	          1,
+	          &cached_entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "cached_entry",
+	 cached_entry );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "result_cache->number_of_hits",
+	 result_cache->number_of_hits,
+	 (uint64_t) 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "result_cache->number_of_misses",
+	 result_cache->number_of_misses,
+	 (uint64_t) 1 );
+
+	/* Test that a changed file size invalidates the entry
+	 */
+	result = result_cache_get_entry(
+	          result_cache,
+	          _SYSTEM_STRING( "A.pf" ),
+	          4,
+	          200,
+	          1,
+	          &cached_entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "cached_entry",
+	 cached_entry );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result_cache->number_of_entries",
+	 result_cache->number_of_entries,
+	 0 );
+
+	/* Test that the least recently used entry is evicted
+	 */
+	result = result_cache_entry_initialize(
+	          &entry,
+	          _SYSTEM_STRING( "A.pf" ),
+	          4,
+	          200,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = result_cache_insert_entry(
+	          result_cache,
+	          entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	entry = NULL;
+
+	result = result_cache_entry_initialize(
+	          &entry,
+	          _SYSTEM_STRING( "B.pf" ),
+	          4,
+	          100,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = result_cache_insert_entry(
+	          result_cache,
+	          entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	entry = NULL;
+
+	/* Make A.pf the most recently used entry
+	 */
+	result = result_cache_get_entry(
+	          result_cache,
+	          _SYSTEM_STRING( "A.pf" ),
+	          4,
+	          200,
+	          1,
+	          &cached_entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = result_cache_entry_initialize(
+	          &entry,
+	          _SYSTEM_STRING( "C.pf" ),
+	          4,
+	          100,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = result_cache_insert_entry(
+	          result_cache,
+	          entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	entry = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result_cache->number_of_entries",
+	 result_cache->number_of_entries,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "result_cache->number_of_evictions",
+	 result_cache->number_of_evictions,
+	 (uint64_t) 1 );
+
+	result = result_cache_get_entry(
+	          result_cache,
+	          _SYSTEM_STRING( "B.pf" ),
+	          4,
+	          100,
+	          1,
+	          &cached_entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = result_cache_get_entry(
+	          result_cache,
+	          _SYSTEM_STRING( "A.pf" ),
+	          4,
+	          200,
+	          1,
+	          &cached_entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = result_cache_get_entry(
+	          NULL,
+	          _SYSTEM_STRING( "A.pf" ),
+	          4,
+	          200,
+	          1,
+	          &cached_entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = result_cache_get_entry(
+	          result_cache,
+	          NULL,
+	          4,
+	          200,
+	          1,
+	          &cached_entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = result_cache_get_entry(
+	          result_cache,
+	          _SYSTEM_STRING( "A.pf" ),
+	          4,
+	          200,
+	          1,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = result_cache_insert_entry(
+	          NULL,
+	          cached_entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = result_cache_insert_entry(
+	          result_cache,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = result_cache_free(
+	          &result_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "result_cache",
+	 result_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entry != NULL )
+	{
+		result_cache_entry_free(
+		 &entry,
+		 NULL );
+	}
+	if( result_cache != NULL )
+	{
+		result_cache_free(
+		 &result_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "result_cache_entry_initialize",
+	 scca_test_tools_result_cache_entry_initialize );
+
+	SCCA_TEST_RUN(
+	 "result_cache_initialize",
+	 scca_test_tools_result_cache_initialize );
+
+	SCCA_TEST_RUN(
+	 "result_cache_free",
+	 scca_test_tools_result_cache_free );
+
+	SCCA_TEST_RUN(
+	 "result_cache_get_entry",
+	 scca_test_tools_result_cache_get_entry );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
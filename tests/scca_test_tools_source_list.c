@@ -0,0 +1,1678 @@
+/*
+ * Tools source_list type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/source_list.h"
+
+#if !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_UNISTD_H )
+#define SCCA_TEST_TOOLS_SOURCE_LIST_HAVE_DIRECTORY_TREE
+#endif
+
+#if defined( SCCA_TEST_TOOLS_SOURCE_LIST_HAVE_DIRECTORY_TREE )
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined( SCCA_TEST_TOOLS_SOURCE_LIST_HAVE_DIRECTORY_TREE )
+
+/* The directories of the test directory tree in creation order
+ */
+static const char *scca_test_tools_source_list_tree_directories[ 3 ] = {
+	"empty",
+	"sub",
+	"sub/nested" };
+
+/* The files of the test directory tree in creation order
+ */
+static const char *scca_test_tools_source_list_tree_files[ 4 ] = {
+	"b.pf",
+	"sub/nested/d.pf",
+	"a.pf",
+	"sub/c.pf" };
+
+/* The files of the test directory tree in the order they are expected to be appended
+ */
+static const char *scca_test_tools_source_list_tree_sorted_files[ 4 ] = {
+	"a.pf",
+	"b.pf",
+	"sub/c.pf",
+	"sub/nested/d.pf" };
+
+/* Writes data to a file
+ * Returns 1 if successful or -1 on error
+ */
+int scca_test_tools_source_list_write_file(
+     const char *filename,
+     const char *data,
+     size_t data_size )
+{
+	FILE *stream = NULL;
+
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( stream == NULL )
+	{
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		if( file_stream_write(
+		     stream,
+		     data,
+		     data_size ) != data_size )
+		{
+			file_stream_close(
+			 stream );
+
+			return( -1 );
+		}
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a temporary directory tree in the current working directory
+ * The path of the root of the tree is stored in path
+ * Returns 1 if successful or -1 on error
+ */
+int scca_test_tools_source_list_create_tree(
+     char *path,
+     size_t path_size )
+{
+	char entry_path[ 256 ];
+
+	int entry_index = 0;
+	int print_count = 0;
+
+	if( path == NULL )
+	{
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               path,
+	               path_size,
+	               "scca_test_source_list_XXXXXX" );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= path_size ) )
+	{
+		return( -1 );
+	}
+	if( mkdtemp(
+	     path ) == NULL )
+	{
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < 3;
+	     entry_index++ )
+	{
+		print_count = narrow_string_snprintf(
+		               entry_path,
+		               256,
+		               "%s/%s",
+		               path,
+		               scca_test_tools_source_list_tree_directories[ entry_index ] );
+
+		if( ( print_count < 0 )
+		 || ( print_count >= 256 ) )
+		{
+			return( -1 );
+		}
+		if( mkdir(
+		     entry_path,
+		     0700 ) != 0 )
+		{
+			return( -1 );
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		print_count = narrow_string_snprintf(
+		               entry_path,
+		               256,
+		               "%s/%s",
+		               path,
+		               scca_test_tools_source_list_tree_files[ entry_index ] );
+
+		if( ( print_count < 0 )
+		 || ( print_count >= 256 ) )
+		{
+			return( -1 );
+		}
+		if( scca_test_tools_source_list_write_file(
+		     entry_path,
+		     "SCCA",
+		     4 ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Removes a temporary directory tree created by scca_test_tools_source_list_create_tree
+ * Entries that do not exist are ignored
+ */
+void scca_test_tools_source_list_remove_tree(
+      const char *path )
+{
+	char entry_path[ 256 ];
+
+	int entry_index = 0;
+	int print_count = 0;
+
+	if( ( path == NULL )
+	 || ( path[ 0 ] == 0 ) )
+	{
+		return;
+	}
+	for( entry_index = 3;
+	     entry_index >= 0;
+	     entry_index-- )
+	{
+		print_count = narrow_string_snprintf(
+		               entry_path,
+		               256,
+		               "%s/%s",
+		               path,
+		               scca_test_tools_source_list_tree_files[ entry_index ] );
+
+		if( ( print_count > 0 )
+		 && ( print_count < 256 ) )
+		{
+			unlink(
+			 entry_path );
+		}
+	}
+	for( entry_index = 2;
+	     entry_index >= 0;
+	     entry_index-- )
+	{
+		print_count = narrow_string_snprintf(
+		               entry_path,
+		               256,
+		               "%s/%s",
+		               path,
+		               scca_test_tools_source_list_tree_directories[ entry_index ] );
+
+		if( ( print_count > 0 )
+		 && ( print_count < 256 ) )
+		{
+			rmdir(
+			 entry_path );
+		}
+	}
+	rmdir(
+	 path );
+}
+
+/* Compares a source with a path in the test directory tree
+ * Returns 1 if equal, 0 if not or -1 on error
+ */
+int scca_test_tools_source_list_compare_source(
+     source_list_t *source_list,
+     int source_index,
+     const char *path,
+     const char *entry_name )
+{
+	char entry_path[ 256 ];
+
+	size_t entry_path_length = 0;
+	int print_count          = 0;
+
+	if( ( source_list == NULL )
+	 || ( source_index < 0 )
+	 || ( source_index >= source_list->number_of_sources ) )
+	{
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               entry_path,
+	               256,
+	               "%s/%s",
+	               path,
+	               entry_name );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 256 ) )
+	{
+		return( -1 );
+	}
+	entry_path_length = narrow_string_length(
+	                     entry_path );
+
+	if( narrow_string_compare(
+	     source_list->sources[ source_index ],
+	     entry_path,
+	     entry_path_length + 1 ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( SCCA_TEST_TOOLS_SOURCE_LIST_HAVE_DIRECTORY_TREE ) */
+
+/* Tests the source_list_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_source_list_initialize(
+     void )
+{
+	source_list_t *source_list      = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = source_list_initialize(
+	          &source_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "source_list",
+	 source_list );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = source_list_free(
+	          &source_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "source_list",
+	 source_list );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = source_list_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	source_list = (source_list_t *) 0x12345678UL;
+
+	result = source_list_initialize(
+	          &source_list,
+	          &error );
+
+	source_list = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test source_list_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = source_list_initialize(
+		          &source_list,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( source_list != NULL )
+			{
+				source_list_free(
+				 &source_list,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "source_list",
+			 source_list );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test source_list_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = source_list_initialize(
+		          &source_list,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( source_list != NULL )
+			{
+				source_list_free(
+				 &source_list,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "source_list",
+			 source_list );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_list != NULL )
+	{
+		source_list_free(
+		 &source_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the source_list_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_source_list_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = source_list_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the source_list_append_source function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_source_list_append_source(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	source_list_t *source_list = NULL;
+	int result                 = 0;
+	int source_index           = 0;
+
+	/* Initialize test
+	 */
+	result = source_list_initialize(
+	          &source_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "source_list",
+	 source_list );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( source_index = 0;
+	     source_index < 100;
+	     source_index++ )
+	{
+		result = source_list_append_source(
+		          source_list,
+		          _SYSTEM_STRING( "source.pf" ),
+		          6,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "source_list->number_of_sources",
+	 source_list->number_of_sources,
+	 100 );
+
+	result = system_string_compare(
+	          source_list->sources[ 99 ],
+	          _SYSTEM_STRING( "source" ),
+	          7 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = source_list_append_source(
+	          NULL,
+	          _SYSTEM_STRING( "source" ),
+	          6,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = source_list_append_source(
+	          source_list,
+	          NULL,
+	          6,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = source_list_append_source(
+	          source_list,
+	          _SYSTEM_STRING( "source" ),
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = source_list_free(
+	          &source_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "source_list",
+	 source_list );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_list != NULL )
+	{
+		source_list_free(
+		 &source_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( SCCA_TEST_TOOLS_SOURCE_LIST_HAVE_DIRECTORY_TREE )
+
+/* Tests the source_list_append_path function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_source_list_append_path(
+     void )
+{
+	char entry_path[ 256 ];
+	char path[ 64 ];
+
+	libcerror_error_t *error   = NULL;
+	source_list_t *source_list = NULL;
+	int entry_index            = 0;
+	int result                 = 0;
+
+	path[ 0 ] = 0;
+
+	/* Initialize test
+	 */
+	result = source_list_initialize(
+	          &source_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "source_list",
+	 source_list );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scca_test_tools_source_list_create_tree(
+	          path,
+	          64 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = narrow_string_snprintf(
+	          entry_path,
+	          256,
+	          "%s/a.pf",
+	          path );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = source_list_append_path(
+	          source_list,
+	          entry_path,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "source_list->number_of_sources",
+	 source_list->number_of_sources,
+	 1 );
+
+	result = scca_test_tools_source_list_compare_source(
+	          source_list,
+	          0,
+	          path,
+	          "a.pf" );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test that a directory is read recursively in sorted order
+	 */
+	result = source_list_append_path(
+	          source_list,
+	          path,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "source_list->number_of_sources",
+	 source_list->number_of_sources,
+	 5 );
+
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		result = scca_test_tools_source_list_compare_source(
+		          source_list,
+		          entry_index + 1,
+		          path,
+		          scca_test_tools_source_list_tree_sorted_files[ entry_index ] );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Test error cases
+	 */
+	result = source_list_append_path(
+	          source_list,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = source_list_append_path(
+	          NULL,
+	          entry_path,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = source_list_append_path(
+	          NULL,
+	          path,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the path does not exist
+	 */
+	result = narrow_string_snprintf(
+	          entry_path,
+	          256,
+	          "%s/missing.pf",
+	          path );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = source_list_append_path(
+	          source_list,
+	          entry_path,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "source_list->number_of_sources",
+	 source_list->number_of_sources,
+	 5 );
+
+	/* Clean up
+	 */
+	result = source_list_free(
+	          &source_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "source_list",
+	 source_list );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	scca_test_tools_source_list_remove_tree(
+	 path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_list != NULL )
+	{
+		source_list_free(
+		 &source_list,
+		 NULL );
+	}
+	scca_test_tools_source_list_remove_tree(
+	 path );
+
+	return( 0 );
+}
+
+/* Tests the source_list_append_directory function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_source_list_append_directory(
+     void )
+{
+	char entry_path[ 256 ];
+	char path[ 64 ];
+
+	libcerror_error_t *error   = NULL;
+	source_list_t *source_list = NULL;
+	int entry_index            = 0;
+	int result                 = 0;
+
+	path[ 0 ] = 0;
+
+	/* Initialize test
+	 */
+	result = source_list_initialize(
+	          &source_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "source_list",
+	 source_list );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scca_test_tools_source_list_create_tree(
+	          path,
+	          64 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = source_list_append_directory(
+	          source_list,
+	          path,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "source_list->number_of_sources",
+	 source_list->number_of_sources,
+	 4 );
+
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		result = scca_test_tools_source_list_compare_source(
+		          source_list,
+		          entry_index,
+		          path,
+		          scca_test_tools_source_list_tree_sorted_files[ entry_index ] );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Test that trailing path separators are not duplicated in the sources
+	 */
+	result = narrow_string_snprintf(
+	          entry_path,
+	          256,
+	          "%s//",
+	          path );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = source_list_append_directory(
+	          source_list,
+	          entry_path,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "source_list->number_of_sources",
+	 source_list->number_of_sources,
+	 8 );
+
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		result = scca_test_tools_source_list_compare_source(
+		          source_list,
+		          entry_index + 4,
+		          path,
+		          scca_test_tools_source_list_tree_sorted_files[ entry_index ] );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Test that an empty directory does not append sources
+	 */
+	result = narrow_string_snprintf(
+	          entry_path,
+	          256,
+	          "%s/empty",
+	          path );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = source_list_append_directory(
+	          source_list,
+	          entry_path,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "source_list->number_of_sources",
+	 source_list->number_of_sources,
+	 8 );
+
+	/* Test error cases
+	 */
+	result = source_list_append_directory(
+	          NULL,
+	          path,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = source_list_append_directory(
+	          source_list,
+	          NULL,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = source_list_append_directory(
+	          source_list,
+	          path,
+	          -1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = source_list_append_directory(
+	          source_list,
+	          path,
+	          SOURCE_LIST_MAXIMUM_RECURSION_DEPTH + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = source_list_append_directory(
+	          source_list,
+	          "",
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the path is not a directory
+	 */
+	result = narrow_string_snprintf(
+	          entry_path,
+	          256,
+	          "%s/a.pf",
+	          path );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = source_list_append_directory(
+	          source_list,
+	          entry_path,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_IO,
+	          LIBCERROR_IO_ERROR_OPEN_FAILED );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the directory does not exist
+	 */
+	result = narrow_string_snprintf(
+	          entry_path,
+	          256,
+	          "%s/missing",
+	          path );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = source_list_append_directory(
+	          source_list,
+	          entry_path,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_IO,
+	          LIBCERROR_IO_ERROR_OPEN_FAILED );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "source_list->number_of_sources",
+	 source_list->number_of_sources,
+	 8 );
+
+	/* Clean up
+	 */
+	result = source_list_free(
+	          &source_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "source_list",
+	 source_list );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	scca_test_tools_source_list_remove_tree(
+	 path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_list != NULL )
+	{
+		source_list_free(
+		 &source_list,
+		 NULL );
+	}
+	scca_test_tools_source_list_remove_tree(
+	 path );
+
+	return( 0 );
+}
+
+#endif /* defined( SCCA_TEST_TOOLS_SOURCE_LIST_HAVE_DIRECTORY_TREE ) */
+
+/* Tests the source_list_read_file function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_source_list_read_file(
+     void )
+{
+#if defined( SCCA_TEST_TOOLS_SOURCE_LIST_HAVE_DIRECTORY_TREE )
+	char list_data[ 512 ];
+	char list_filename[ 80 ];
+	char path[ 64 ];
+#endif
+
+	libcerror_error_t *error   = NULL;
+	source_list_t *source_list = NULL;
+	int result                 = 0;
+
+#if defined( SCCA_TEST_TOOLS_SOURCE_LIST_HAVE_DIRECTORY_TREE )
+	path[ 0 ]          = 0;
+	list_filename[ 0 ] = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = source_list_initialize(
+	          &source_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "source_list",
+	 source_list );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( SCCA_TEST_TOOLS_SOURCE_LIST_HAVE_DIRECTORY_TREE )
+	result = scca_test_tools_source_list_create_tree(
+	          path,
+	          64 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = narrow_string_snprintf(
+	          list_filename,
+	          80,
+	          "%s.lst",
+	          path );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test regular cases
+	 * The file list contains empty lines, lines terminated by CRLF
+	 * and a last line without end-of-line
+	 */
+	result = narrow_string_snprintf(
+	          list_data,
+	          512,
+	          "\n%s/a.pf\r\n\r\n%s/sub\r\n\n%s/b.pf",
+	          path,
+	          path,
+	          path );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = scca_test_tools_source_list_write_file(
+	          list_filename,
+	          list_data,
+	          narrow_string_length(
+	           list_data ) );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = source_list_read_file(
+	          source_list,
+	          list_filename,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "source_list->number_of_sources",
+	 source_list->number_of_sources,
+	 4 );
+
+	result = scca_test_tools_source_list_compare_source(
+	          source_list,
+	          0,
+	          path,
+	          "a.pf" );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = scca_test_tools_source_list_compare_source(
+	          source_list,
+	          1,
+	          path,
+	          "sub/c.pf" );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = scca_test_tools_source_list_compare_source(
+	          source_list,
+	          2,
+	          path,
+	          "sub/nested/d.pf" );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = scca_test_tools_source_list_compare_source(
+	          source_list,
+	          3,
+	          path,
+	          "b.pf" );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error case where the file list contains a path that does not exist
+	 */
+	result = narrow_string_snprintf(
+	          list_data,
+	          512,
+	          "%s/a.pf\r\n%s/missing.pf\r\n",
+	          path,
+	          path );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = scca_test_tools_source_list_write_file(
+	          list_filename,
+	          list_data,
+	          narrow_string_length(
+	           list_data ) );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = source_list_read_file(
+	          source_list,
+	          list_filename,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	unlink(
+	 list_filename );
+
+	scca_test_tools_source_list_remove_tree(
+	 path );
+
+	list_filename[ 0 ] = 0;
+	path[ 0 ]          = 0;
+
+#endif /* defined( SCCA_TEST_TOOLS_SOURCE_LIST_HAVE_DIRECTORY_TREE ) */
+
+	/* Test error cases
+	 */
+	result = source_list_read_file(
+	          NULL,
+	          _SYSTEM_STRING( "filelist" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = source_list_read_file(
+	          source_list,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = source_list_read_file(
+	          source_list,
+	          _SYSTEM_STRING( "scca_test_missing.lst" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = source_list_free(
+	          &source_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_list != NULL )
+	{
+		source_list_free(
+		 &source_list,
+		 NULL );
+	}
+#if defined( SCCA_TEST_TOOLS_SOURCE_LIST_HAVE_DIRECTORY_TREE )
+	if( list_filename[ 0 ] != 0 )
+	{
+		unlink(
+		 list_filename );
+	}
+	scca_test_tools_source_list_remove_tree(
+	 path );
+
+#endif
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "source_list_initialize",
+	 scca_test_tools_source_list_initialize );
+
+	SCCA_TEST_RUN(
+	 "source_list_free",
+	 scca_test_tools_source_list_free );
+
+	SCCA_TEST_RUN(
+	 "source_list_append_source",
+	 scca_test_tools_source_list_append_source );
+
+#if defined( SCCA_TEST_TOOLS_SOURCE_LIST_HAVE_DIRECTORY_TREE )
+
+	SCCA_TEST_RUN(
+	 "source_list_append_path",
+	 scca_test_tools_source_list_append_path );
+
+	SCCA_TEST_RUN(
+	 "source_list_append_directory",
+	 scca_test_tools_source_list_append_directory );
+
+#endif /* defined( SCCA_TEST_TOOLS_SOURCE_LIST_HAVE_DIRECTORY_TREE ) */
+
+
+	SCCA_TEST_RUN(
+	 "source_list_read_file",
+	 scca_test_tools_source_list_read_file );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
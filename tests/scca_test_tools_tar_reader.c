@@ -0,0 +1,1333 @@
+/*
+ * Tools tar_reader type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/tar_reader.h"
+
+uint8_t scca_test_tools_tar_reader_pax_records[ 37 ] = {
+	'3', '7', ' ', 'p', 'a', 't', 'h', '=', 'l', 'o', 'n', 'g', '/', 'd', 'i', 'r',
+	'/', 'C', 'M', 'D', '.', 'E', 'X', 'E', '-', '1', '2', '3', '4', '5', '6', '7',
+	'8', '.', 'p', 'f', '\n' };
+
+/* Creates a tar header block
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_tar_reader_set_header(
+     uint8_t *header,
+     const char *name,
+     const char *prefix,
+     size_t data_size,
+     uint8_t type_flag )
+{
+	size_t header_index = 0;
+	size_t string_index = 0;
+	uint32_t checksum   = 0;
+
+	if( memory_set(
+	     header,
+	     0,
+	     TAR_READER_BLOCK_SIZE ) == NULL )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     ( string_index < 100 ) && ( name[ string_index ] != 0 );
+	     string_index++ )
+	{
+		header[ string_index ] = (uint8_t) name[ string_index ];
+	}
+	if( prefix != NULL )
+	{
+		for( string_index = 0;
+		     ( string_index < 155 ) && ( prefix[ string_index ] != 0 );
+		     string_index++ )
+		{
+			header[ 345 + string_index ] = (uint8_t) prefix[ string_index ];
+		}
+	}
+	/* The size is stored as an 11 digit octal number
+	 */
+	for( string_index = 0;
+	     string_index < 11;
+	     string_index++ )
+	{
+		header[ 124 + 10 - string_index ] = (uint8_t) '0' + (uint8_t) ( data_size & 0x07 );
+
+		data_size >>= 3;
+	}
+	header[ 156 ] = type_flag;
+
+	if( memory_copy(
+	     &( header[ 257 ] ),
+	     "ustar\0" "00",
+	     8 ) == NULL )
+	{
+		return( 0 );
+	}
+	for( header_index = 0;
+	     header_index < TAR_READER_BLOCK_SIZE;
+	     header_index++ )
+	{
+		if( ( header_index >= 148 )
+		 && ( header_index < 156 ) )
+		{
+			checksum += (uint32_t) ' ';
+		}
+		else
+		{
+			checksum += (uint32_t) header[ header_index ];
+		}
+	}
+	/* The checksum is stored as a 6 digit octal number followed by an end-of-string character and a space
+	 */
+	for( string_index = 0;
+	     string_index < 6;
+	     string_index++ )
+	{
+		header[ 148 + 5 - string_index ] = (uint8_t) '0' + (uint8_t) ( checksum & 0x07 );
+
+		checksum >>= 3;
+	}
+	header[ 154 ] = 0;
+	header[ 155 ] = (uint8_t) ' ';
+
+	return( 1 );
+}
+
+/* Writes a tar member to a stream
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_tar_reader_write_member(
+     FILE *stream,
+     const char *name,
+     const char *prefix,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t type_flag )
+{
+	uint8_t block[ TAR_READER_BLOCK_SIZE ];
+
+	size_t padding_size = 0;
+
+	if( scca_test_tools_tar_reader_set_header(
+	     block,
+	     name,
+	     prefix,
+	     data_size,
+	     type_flag ) != 1 )
+	{
+		return( 0 );
+	}
+	if( fwrite(
+	     block,
+	     1,
+	     TAR_READER_BLOCK_SIZE,
+	     stream ) != TAR_READER_BLOCK_SIZE )
+	{
+		return( 0 );
+	}
+	if( data_size > 0 )
+	{
+		if( fwrite(
+		     data,
+		     1,
+		     data_size,
+		     stream ) != data_size )
+		{
+			return( 0 );
+		}
+		padding_size = data_size % TAR_READER_BLOCK_SIZE;
+
+		if( padding_size != 0 )
+		{
+			padding_size = TAR_READER_BLOCK_SIZE - padding_size;
+
+			if( memory_set(
+			     block,
+			     0,
+			     TAR_READER_BLOCK_SIZE ) == NULL )
+			{
+				return( 0 );
+			}
+			if( fwrite(
+			     block,
+			     1,
+			     padding_size,
+			     stream ) != padding_size )
+			{
+				return( 0 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the tar_reader_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_tar_reader_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	tar_reader_t *tar_reader        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 4;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = tar_reader_initialize(
+	          &tar_reader,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "tar_reader",
+	 tar_reader );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = tar_reader_free(
+	          &tar_reader,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "tar_reader",
+	 tar_reader );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = tar_reader_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	tar_reader = (tar_reader_t *) 0x12345678UL;
+
+	result = tar_reader_initialize(
+	          &tar_reader,
+	          &error );
+
+	tar_reader = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test tar_reader_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = tar_reader_initialize(
+		          &tar_reader,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( tar_reader != NULL )
+			{
+				tar_reader_free(
+				 &tar_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "tar_reader",
+			 tar_reader );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test tar_reader_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = tar_reader_initialize(
+		          &tar_reader,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( tar_reader != NULL )
+			{
+				tar_reader_free(
+				 &tar_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "tar_reader",
+			 tar_reader );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tar_reader != NULL )
+	{
+		tar_reader_free(
+		 &tar_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the tar_reader_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_tar_reader_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = tar_reader_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the tar_reader_parse_number function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_tar_reader_parse_number(
+     void )
+{
+	uint8_t base256_field[ 12 ] = {
+		0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00 };
+
+	libcerror_error_t *error = NULL;
+	uint64_t value_64bit     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = tar_reader_parse_number(
+	          (uint8_t *) "0000644\0",
+	          8,
+	          &value_64bit,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 420 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = tar_reader_parse_number(
+	          (uint8_t *) "   17 \0\0",
+	          8,
+	          &value_64bit,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 15 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = tar_reader_parse_number(
+	          base256_field,
+	          12,
+	          &value_64bit,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x10000UL );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = tar_reader_parse_number(
+	          NULL,
+	          8,
+	          &value_64bit,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = tar_reader_parse_number(
+	          (uint8_t *) "0000644\0",
+	          8,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = tar_reader_parse_number(
+	          (uint8_t *) "0000649\0",
+	          8,
+	          &value_64bit,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Negative base-256 numbers are not supported
+	 */
+	base256_field[ 0 ] = 0xff;
+
+	result = tar_reader_parse_number(
+	          base256_field,
+	          12,
+	          &value_64bit,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the tar_reader_header_is_valid function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_tar_reader_header_is_valid(
+     void )
+{
+	uint8_t header[ TAR_READER_BLOCK_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = scca_test_tools_tar_reader_set_header(
+	          header,
+	          "CMD.EXE-4A81B364.pf",
+	          NULL,
+	          1234,
+	          (uint8_t) '0' );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = tar_reader_header_is_valid(
+	          header,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	header[ 0 ] = (uint8_t) 'X';
+
+	result = tar_reader_header_is_valid(
+	          header,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = tar_reader_header_is_valid(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the tar_reader_parse_pax_records function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_tar_reader_parse_pax_records(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	tar_reader_t *tar_reader = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = tar_reader_initialize(
+	          &tar_reader,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "tar_reader",
+	 tar_reader );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = tar_reader_parse_pax_records(
+	          tar_reader,
+	          scca_test_tools_tar_reader_pax_records,
+	          37,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "tar_reader->utf8_long_name_size",
+	 tar_reader->utf8_long_name_size,
+	 (size_t) 29 );
+
+	result = narrow_string_compare(
+	          (char *) tar_reader->utf8_long_name,
+	          "long/dir/CMD.EXE-12345678.pf",
+	          29 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = tar_reader_parse_pax_records(
+	          tar_reader,
+	          (uint8_t *) "12 size=600\n",
+	          12,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "tar_reader->has_pax_size",
+	 tar_reader->has_pax_size,
+	 (uint8_t) 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "tar_reader->pax_size",
+	 tar_reader->pax_size,
+	 (uint64_t) 600 );
+
+	/* Test error cases
+	 */
+	result = tar_reader_parse_pax_records(
+	          NULL,
+	          scca_test_tools_tar_reader_pax_records,
+	          37,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A record size that exceeds the data
+	 */
+	result = tar_reader_parse_pax_records(
+	          tar_reader,
+	          (uint8_t *) "99 path=x\n",
+	          10,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A record without a value
+	 */
+	result = tar_reader_parse_pax_records(
+	          tar_reader,
+	          (uint8_t *) "8 path\n",
+	          7,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = tar_reader_free(
+	          &tar_reader,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "tar_reader",
+	 tar_reader );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tar_reader != NULL )
+	{
+		tar_reader_free(
+		 &tar_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the tar_reader_read_member function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_tar_reader_read_member(
+     void )
+{
+	uint8_t data[ 600 ];
+	uint8_t end_of_archive[ 2 * TAR_READER_BLOCK_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	tar_reader_t *tar_reader = NULL;
+	FILE *stream             = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          data,
+	          0x5a,
+	          600 ) != NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          end_of_archive,
+	          0,
+	          2 * TAR_READER_BLOCK_SIZE ) != NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	stream = tmpfile();
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	/* A member with a pax extended header path
+	 */
+	result = scca_test_tools_tar_reader_write_member(
+	          stream,
+	          "PaxHeaders/short",
+	          NULL,
+	          scca_test_tools_tar_reader_pax_records,
+	          37,
+	          (uint8_t) 'x' );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = scca_test_tools_tar_reader_write_member(
+	          stream,
+	          "short",
+	          NULL,
+	          (uint8_t *) "hello",
+	          5,
+	          (uint8_t) '0' );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* A directory member that is skipped
+	 */
+	result = scca_test_tools_tar_reader_write_member(
+	          stream,
+	          "dir/",
+	          NULL,
+	          NULL,
+	          0,
+	          (uint8_t) '5' );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* A member with an ustar name prefix and data that spans multiple blocks
+	 */
+	result = scca_test_tools_tar_reader_write_member(
+	          stream,
+	          "b.pf",
+	          "prefix",
+	          data,
+	          600,
+	          (uint8_t) '0' );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fwrite(
+	          end_of_archive,
+	          1,
+	          2 * TAR_READER_BLOCK_SIZE,
+	          stream ) == ( 2 * TAR_READER_BLOCK_SIZE );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	rewind(
+	 stream );
+
+	result = tar_reader_initialize(
+	          &tar_reader,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "tar_reader",
+	 tar_reader );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = tar_reader_open_stream(
+	          tar_reader,
+	          stream,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = tar_reader_read_member(
+	          tar_reader,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          tar_reader->member_name,
+	          _SYSTEM_STRING( "long/dir/CMD.EXE-12345678.pf" ),
+	          29 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "tar_reader->member_data_size",
+	 tar_reader->member_data_size,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          tar_reader->member_data,
+	          "hello",
+	          5 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = tar_reader_read_member(
+	          tar_reader,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          tar_reader->member_name,
+	          _SYSTEM_STRING( "prefix/b.pf" ),
+	          12 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "tar_reader->member_data_size",
+	 tar_reader->member_data_size,
+	 (size_t) 600 );
+
+	result = memory_compare(
+	          tar_reader->member_data,
+	          data,
+	          600 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = tar_reader_read_member(
+	          tar_reader,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = tar_reader_read_member(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = tar_reader_free(
+	          &tar_reader,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "tar_reader",
+	 tar_reader );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fclose(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tar_reader != NULL )
+	{
+		tar_reader_free(
+		 &tar_reader,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		fclose(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* Tests the tar_reader_read_member function with a corrupted header
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_tar_reader_read_member_corrupted(
+     void )
+{
+	uint8_t header[ TAR_READER_BLOCK_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	tar_reader_t *tar_reader = NULL;
+	FILE *stream             = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = scca_test_tools_tar_reader_set_header(
+	          header,
+	          "a.pf",
+	          NULL,
+	          0,
+	          (uint8_t) '0' );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	header[ 0 ] = (uint8_t) 'b';
+
+	stream = tmpfile();
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = fwrite(
+	          header,
+	          1,
+	          TAR_READER_BLOCK_SIZE,
+	          stream ) == TAR_READER_BLOCK_SIZE;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	rewind(
+	 stream );
+
+	result = tar_reader_initialize(
+	          &tar_reader,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = tar_reader_open_stream(
+	          tar_reader,
+	          stream,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = tar_reader_read_member(
+	          tar_reader,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = tar_reader_free(
+	          &tar_reader,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fclose(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tar_reader != NULL )
+	{
+		tar_reader_free(
+		 &tar_reader,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		fclose(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "tar_reader_initialize",
+	 scca_test_tools_tar_reader_initialize );
+
+	SCCA_TEST_RUN(
+	 "tar_reader_free",
+	 scca_test_tools_tar_reader_free );
+
+	SCCA_TEST_RUN(
+	 "tar_reader_parse_number",
+	 scca_test_tools_tar_reader_parse_number );
+
+	SCCA_TEST_RUN(
+	 "tar_reader_header_is_valid",
+	 scca_test_tools_tar_reader_header_is_valid );
+
+	SCCA_TEST_RUN(
+	 "tar_reader_parse_pax_records",
+	 scca_test_tools_tar_reader_parse_pax_records );
+
+	SCCA_TEST_RUN(
+	 "tar_reader_read_member",
+	 scca_test_tools_tar_reader_read_member );
+
+	SCCA_TEST_RUN(
+	 "tar_reader_read_member_corrupted",
+	 scca_test_tools_tar_reader_read_member_corrupted );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1323 @@
+/*
+ * Tools watch_handle type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/output_writer.h"
+#include "../sccatools/watch_handle.h"
+
+/* Tests the watch_state_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_watch_state_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	watch_state_t *state            = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = watch_state_initialize(
+	          &state,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "state",
+	 state );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "state->path_length",
+	 state->path_length,
+	 (size_t) 19 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "state->path[ 19 ]",
+	 (int) state->path[ 19 ],
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "state->executable_filename",
+	 state->executable_filename );
+
+	result = watch_state_free(
+	          &state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "state",
+	 state );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = watch_state_initialize(
+	          NULL,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	state = (watch_state_t *) 0x12345678UL;
+
+	result = watch_state_initialize(
+	          &state,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          &error );
+
+	state = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = watch_state_initialize(
+	          &state,
+	          NULL,
+	          19,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = watch_state_initialize(
+	          &state,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test watch_state_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = watch_state_initialize(
+		          &state,
+		          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+		          19,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( state != NULL )
+			{
+				watch_state_free(
+				 &state,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "state",
+			 state );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test watch_state_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = watch_state_initialize(
+		          &state,
+		          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+		          19,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( state != NULL )
+			{
+				watch_state_free(
+				 &state,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "state",
+			 state );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( state != NULL )
+	{
+		watch_state_free(
+		 &state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the watch_state_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_watch_state_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = watch_state_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the watch_state_has_changed function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_watch_state_has_changed(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	watch_state_t *current_state  = NULL;
+	watch_state_t *previous_state = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = watch_state_initialize(
+	          &previous_state,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = watch_state_initialize(
+	          &current_state,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	previous_state->run_count                = 2;
+	previous_state->last_run_times[ 0 ]      = 20;
+	previous_state->last_run_times[ 1 ]      = 10;
+	previous_state->number_of_last_run_times = 2;
+
+	current_state->run_count                = 2;
+	current_state->last_run_times[ 0 ]      = 20;
+	current_state->last_run_times[ 1 ]      = 10;
+	current_state->number_of_last_run_times = 2;
+
+	/* Test regular cases
+	 */
+	result = watch_state_has_changed(
+	          previous_state,
+	          current_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	current_state->last_run_times[ 1 ] = 15;
+
+	result = watch_state_has_changed(
+	          previous_state,
+	          current_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	current_state->last_run_times[ 1 ] = 10;
+	current_state->run_count           = 3;
+
+	result = watch_state_has_changed(
+	          previous_state,
+	          current_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = watch_state_has_changed(
+	          NULL,
+	          current_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = watch_state_has_changed(
+	          previous_state,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = watch_state_free(
+	          &current_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = watch_state_free(
+	          &previous_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( current_state != NULL )
+	{
+		watch_state_free(
+		 &current_state,
+		 NULL );
+	}
+	if( previous_state != NULL )
+	{
+		watch_state_free(
+		 &previous_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the watch_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_watch_handle_initialize(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	watch_handle_t *watch_handle = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = watch_handle_initialize(
+	          &watch_handle,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "watch_handle",
+	 watch_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = watch_handle_free(
+	          &watch_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "watch_handle",
+	 watch_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = watch_handle_initialize(
+	          NULL,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	watch_handle = (watch_handle_t *) 0x12345678UL;
+
+	result = watch_handle_initialize(
+	          &watch_handle,
+	          NULL,
+	          &error );
+
+	watch_handle = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( watch_handle != NULL )
+	{
+		watch_handle_free(
+		 &watch_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the watch_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_watch_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = watch_handle_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the watch_handle_path_is_prefetch_file function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_watch_handle_path_is_prefetch_file(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = watch_handle_path_is_prefetch_file(
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = watch_handle_path_is_prefetch_file(
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.PF" ),
+	          19 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = watch_handle_path_is_prefetch_file(
+	          _SYSTEM_STRING( "Layout.ini" ),
+	          10 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = watch_handle_path_is_prefetch_file(
+	          _SYSTEM_STRING( ".pf" ),
+	          3 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = watch_handle_path_is_prefetch_file(
+	          NULL,
+	          19 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the watch_handle_get_state, watch_handle_insert_state and watch_handle_remove_state functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_watch_handle_get_state(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	watch_handle_t *watch_handle = NULL;
+	watch_state_t *found_state   = NULL;
+	watch_state_t *state         = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = watch_handle_initialize(
+	          &watch_handle,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = watch_state_initialize(
+	          &state,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = watch_handle_get_state(
+	          watch_handle,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          &found_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = watch_handle_insert_state(
+	          watch_handle,
+	          state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "watch_handle->number_of_states",
+	 watch_handle->number_of_states,
+	 1 );
+
+	result = watch_handle_get_state(
+	          watch_handle,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          &found_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "found_state",
+	 (int) ( found_state == state ),
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = watch_handle_insert_state(
+	          watch_handle,
+	          state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = watch_handle_get_state(
+	          NULL,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          &found_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = watch_handle_get_state(
+	          watch_handle,
+	          NULL,
+	          19,
+	          &found_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = watch_handle_get_state(
+	          watch_handle,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = watch_handle_remove_state(
+	          watch_handle,
+	          state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "watch_handle->number_of_states",
+	 watch_handle->number_of_states,
+	 0 );
+
+	result = watch_handle_get_state(
+	          watch_handle,
+	          _SYSTEM_STRING( "CMD.EXE-4A81B364.pf" ),
+	          19,
+	          &found_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = watch_handle_remove_state(
+	          watch_handle,
+	          state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = watch_state_free(
+	          &state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = watch_handle_free(
+	          &watch_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ( watch_handle != NULL )
+	 && ( state != NULL ) )
+	{
+		watch_handle_remove_state(
+		 watch_handle,
+		 state,
+		 NULL );
+	}
+	if( state != NULL )
+	{
+		watch_state_free(
+		 &state,
+		 NULL );
+	}
+	if( watch_handle != NULL )
+	{
+		watch_handle_free(
+		 &watch_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the watch_handle_event_fprint function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_watch_handle_event_fprint(
+     void )
+{
+	const char *expected_string   = "{\"event\":\"modified\",\"source\":\"C.pf\",\"prefetch_hash\":4660,\"run_count\":3,\"run_count_delta\":1,\"new_last_run_times\":[30]}\n";
+	libcerror_error_t *error      = NULL;
+	watch_handle_t *watch_handle  = NULL;
+	watch_state_t *current_state  = NULL;
+	watch_state_t *previous_state = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = watch_handle_initialize(
+	          &watch_handle,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = watch_state_initialize(
+	          &previous_state,
+	          _SYSTEM_STRING( "C.pf" ),
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = watch_state_initialize(
+	          &current_state,
+	          _SYSTEM_STRING( "C.pf" ),
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	previous_state->prefetch_hash            = 0x1234;
+	previous_state->run_count                = 2;
+	previous_state->last_run_times[ 0 ]      = 20;
+	previous_state->last_run_times[ 1 ]      = 10;
+	previous_state->number_of_last_run_times = 2;
+
+	current_state->prefetch_hash            = 0x1234;
+	current_state->run_count                = 3;
+	current_state->last_run_times[ 0 ]      = 30;
+	current_state->last_run_times[ 1 ]      = 20;
+	current_state->last_run_times[ 2 ]      = 10;
+	current_state->number_of_last_run_times = 3;
+
+	/* Test regular cases
+	 */
+	result = watch_handle_event_fprint(
+	          watch_handle,
+	          WATCH_HANDLE_EVENT_TYPE_MODIFIED,
+	          previous_state,
+	          current_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "watch_handle->output_writer->buffer_offset",
+	 watch_handle->output_writer->buffer_offset,
+	 (size_t) 118 );
+
+	result = memory_compare(
+	          watch_handle->output_writer->buffer,
+	          expected_string,
+	          118 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = watch_handle_event_fprint(
+	          NULL,
+	          WATCH_HANDLE_EVENT_TYPE_MODIFIED,
+	          previous_state,
+	          current_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = watch_handle_event_fprint(
+	          watch_handle,
+	          WATCH_HANDLE_EVENT_TYPE_MODIFIED,
+	          NULL,
+	          current_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = watch_handle_event_fprint(
+	          watch_handle,
+	          WATCH_HANDLE_EVENT_TYPE_MODIFIED,
+	          previous_state,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = watch_handle_event_fprint(
+	          watch_handle,
+	          (int) 'x',
+	          previous_state,
+	          current_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = watch_state_free(
+	          &current_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = watch_state_free(
+	          &previous_state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = watch_handle_free(
+	          &watch_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( current_state != NULL )
+	{
+		watch_state_free(
+		 &current_state,
+		 NULL );
+	}
+	if( previous_state != NULL )
+	{
+		watch_state_free(
+		 &previous_state,
+		 NULL );
+	}
+	if( watch_handle != NULL )
+	{
+		watch_handle_free(
+		 &watch_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "watch_state_initialize",
+	 scca_test_tools_watch_state_initialize );
+
+	SCCA_TEST_RUN(
+	 "watch_state_free",
+	 scca_test_tools_watch_state_free );
+
+	SCCA_TEST_RUN(
+	 "watch_state_has_changed",
+	 scca_test_tools_watch_state_has_changed );
+
+	SCCA_TEST_RUN(
+	 "watch_handle_initialize",
+	 scca_test_tools_watch_handle_initialize );
+
+	SCCA_TEST_RUN(
+	 "watch_handle_free",
+	 scca_test_tools_watch_handle_free );
+
+	SCCA_TEST_RUN(
+	 "watch_handle_path_is_prefetch_file",
+	 scca_test_tools_watch_handle_path_is_prefetch_file );
+
+	SCCA_TEST_RUN(
+	 "watch_handle_get_state",
+	 scca_test_tools_watch_handle_get_state );
+
+	SCCA_TEST_RUN(
+	 "watch_handle_event_fprint",
+	 scca_test_tools_watch_handle_event_fprint );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
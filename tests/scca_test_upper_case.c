@@ -0,0 +1,254 @@
+/*
+ * Library upper case functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_upper_case.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_upper_case_get_utf16_character function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_upper_case_get_utf16_character(
+     void )
+{
+	uint16_t character = 0;
+
+	/* Test regular cases
+	 */
+	character = libscca_upper_case_get_utf16_character(
+	             0x0061 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x0041 );
+
+	character = libscca_upper_case_get_utf16_character(
+	             0x005c );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x005c );
+
+	character = libscca_upper_case_get_utf16_character(
+	             0x00e9 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x00c9 );
+
+	character = libscca_upper_case_get_utf16_character(
+	             0x00f7 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x00f7 );
+
+	character = libscca_upper_case_get_utf16_character(
+	             0x00ff );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x0178 );
+
+	character = libscca_upper_case_get_utf16_character(
+	             0x0101 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x0100 );
+
+	character = libscca_upper_case_get_utf16_character(
+	             0x013a );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x0139 );
+
+	character = libscca_upper_case_get_utf16_character(
+	             0x03b1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x0391 );
+
+	character = libscca_upper_case_get_utf16_character(
+	             0x0451 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x0401 );
+
+	character = libscca_upper_case_get_utf16_character(
+	             0xff41 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0xff21 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* Tests the libscca_upper_case_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_upper_case_utf16_string(
+     void )
+{
+	uint16_t expected_utf16_string[ 8 ] = { 0x0043, 0x003a, 0x005c, 0x004e, 0x0054, 0x00c4, 0, 0x0061 };
+	uint16_t utf16_string[ 8 ]          = { 0x0063, 0x003a, 0x005c, 0x006e, 0x0074, 0x00e4, 0, 0x0061 };
+	libcerror_error_t *error            = NULL;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_upper_case_utf16_string(
+	          utf16_string,
+	          8,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          expected_utf16_string,
+	          sizeof( uint16_t ) * 8 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_upper_case_utf16_string(
+	          NULL,
+	          8,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_upper_case_utf16_string(
+	          utf16_string,
+	          (size_t) SSIZE_MAX,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_upper_case_get_utf16_character",
+	 scca_test_upper_case_get_utf16_character );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	SCCA_TEST_RUN(
+	 "libscca_upper_case_utf16_string",
+	 scca_test_upper_case_utf16_string );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
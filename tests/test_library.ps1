@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "compressed_block error file_header file_information file_metrics filename_string filename_strings io_handle notify volume_information"
+$LibraryTests = "carve compressed_block error file_header file_information file_metrics file_visitor filename_index filename_index_builder filename_string filename_strings filetime io_handle mam mam_decoder notify prefetch_hash read_failure snapshot task_scheduler upper_case volume_information"
 $LibraryTestsWithInput = "file support"
 $OptionSets = "" -split " "
 
@@ -1,6 +1,6 @@
 # Tests tools functions and types.
 
-$ToolsTests = "info_handle output path_string signal"
+$ToolsTests = "batch_handle carve_handle export_handle filetime_string info_handle mapped_file output output_writer path_string query_handle result_cache signal source_list tar_reader watch_handle"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1